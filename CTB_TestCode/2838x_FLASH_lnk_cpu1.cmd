@@ -106,6 +106,11 @@ SECTIONS
    Filter4_RegsFile : > RAMGS4, fill=0x4444
    Difference_RegsFile : >RAMGS5, fill=0x3333
 
+   /* Code histograms of the ADCIN characterisation (TB_Functions.c), one GS RAM block each */
+   ADC_CharHistogram0 : > RAMGS6, type=NOINIT
+   ADC_CharHistogram1 : > RAMGS7, type=NOINIT
+   ADC_CharHistogram2 : > RAMGS8, type=NOINIT
+
    #if defined(__TI_EABI__)
        .TI.ramfunc : {} LOAD = FLASH3,
                         RUN = RAMLS0 | RAMLS1 | RAMLS2 |RAMLS3,
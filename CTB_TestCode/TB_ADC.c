@@ -7,9 +7,9 @@
 ///             50 MHz clock (SYSCLK = 200 MHz). The measurement is triggered by the ePWM1 module
 ///             triggered. The measurement inputs are each ADCINx3 (x= A, B, C or D).
 ///
-/// @version    V1.1.0
+/// @version    V1.2.0
 ///
-/// @date       23-04-2024
+/// @date       19-10-2026
 ///
 /// @author     Vijay
 //=================================================================================================
@@ -41,6 +41,15 @@ void AdcInitAll(void)
     AdcaRegs.ADCCTL2.bit.SIGNALMODE = 0;
     AdcInitTrimRegister(ADC_MODULE_A, 0, 0);
 
+    // Read-back of DACOUTA (ADCINA0) and DACOUTB (ADCINA1) for the fast self-test
+    AdcaRegs.ADCSOC0CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
+    AdcaRegs.ADCSOC0CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN0;
+    AdcaRegs.ADCSOC0CTL.bit.ACQPS = 29;
+
+    AdcaRegs.ADCSOC1CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
+    AdcaRegs.ADCSOC1CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN1;
+    AdcaRegs.ADCSOC1CTL.bit.ACQPS = 29;
+
     AdcaRegs.ADCSOC2CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
     AdcaRegs.ADCSOC2CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN2;
     AdcaRegs.ADCSOC2CTL.bit.ACQPS = 29;
@@ -79,6 +88,11 @@ void AdcInitAll(void)
     AdcbRegs.ADCSOC0CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN0;
     AdcbRegs.ADCSOC0CTL.bit.ACQPS = 29;
 
+    // Read-back of DACOUTC (ADCINB1) for the fast self-test
+    AdcbRegs.ADCSOC1CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
+    AdcbRegs.ADCSOC1CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN1;
+    AdcbRegs.ADCSOC1CTL.bit.ACQPS = 29;
+
     AdcbRegs.ADCSOC2CTL.bit.TRIGSEL = ADC_TRIGGER_EPWM1_SOCA;
     AdcbRegs.ADCSOC2CTL.bit.CHSEL = ADC_SINGLE_ENDED_ADCIN2;
     AdcbRegs.ADCSOC2CTL.bit.ACQPS = 29;
@@ -7,9 +7,9 @@
 ///             50 MHz clock (SYSCLK = 200 MHz). The measurement is triggered by the ePWM1 module
 ///             triggered. The measurement inputs are each ADCINx3 (x= A, B, C or D).
 ///
-/// @version    V1.1.0
+/// @version    V1.2.0
 ///
-/// @date       23-04-2024
+/// @date       19-10-2026
 ///
 /// @author     Vijay
 //=================================================================================================
@@ -6,10 +6,14 @@
 ///           Functions lights-ups the LEDs for visual checking of GPIOs and PWMs.
 ///           Functions also generate linearly increaseing DAC values and passes it through analog MUX...
 ///           finally checks for error ADC results and lights-ups the resp. Error LED if any error
+///           V1.2.0: fast self-test of the ADCINs (few DAC levels per channel, three channels at once),
+///           the full sweep only runs if the fast self-test fails
+///           V1.2.0: characterisation of the ADCINs (gain error, offset, INL, DNL, noise per channel),
+///           the results are sent over the UART interface (SCI-A, 115200 baud)
 ///
-/// @version  V1.1.0
+/// @version  V1.2.0
 ///
-/// @date     23-04-2024
+/// @date     19-10-2026
 ///
 /// @author   Vijay
 //=================================================================================================
@@ -29,6 +33,33 @@ uint16_t  A2_Error_count=0,A3_Error_count=0,A4_Error_count=0,A5_Error_count=0;
 uint16_t  B0_Error_count=0,B2_Error_count=0,B3_Error_count=0,B4_Error_count=0,B5_Error_count=0;
 uint16_t  C2_Error_count=0,C3_Error_count=0,C4_Error_count=0,C5_Error_count=0;
 uint16_t  D0_Error_count=0,D1_Error_count=0,D2_Error_count=0,D3_Error_count=0,D4_Error_count=0,D5_Error_count=0,IN14_Error_count=0,IN15_Error_count=0;
+// Fast self-test: 1 = run the fast self-test first and the full sweep only on failure, 0 = full sweep only
+uint16_t  ADC_fast_mode = 1;
+// Fast self-test: DAC levels, max. deviation of an ADCIN from the DAC read-back (in LSB)
+uint16_t  ADC_fast_levels[ADC_FAST_NUMBER_OF_LEVELS] = {400, 2000, 3600};
+uint16_t  ADC_fast_tolerance = 80;
+// Fast self-test: MUX positions (channels) that are selected at the same time, one per analogue MUX
+// (MUX 1: GPIO136/132/131, MUX 2: GPIO126/128/130, MUX 3: GPIO44/57/55), -1 = none
+const int16_t ADC_fast_slots[ADC_FAST_NUMBER_OF_SLOTS][3] =
+{
+    { 0,  2,  5}, { 1,  3,  6}, { 4,  7,  9}, {19,  8, 10},
+    {20, 11, 13}, {-1, 12, 14}, {-1, 15, 17}, {-1, 16, 18}
+};
+// Fast self-test: result, bit i set = channel i (MUX position 0 to 20) failed
+uint32_t  ADC_fast_failed = 0;
+// Characterisation: 1 = characterise all ADCINs after the check and send the results over UART
+uint16_t  ADC_char_mode = 1;
+// Characterisation: results per MUX position and running statistics of the three selected channels
+ADC_CharResult ADC_char_results[ADC_CHAR_NUMBER_OF_CHANNELS];
+ADC_CharState  ADC_char_state[3];
+// Characterisation: code histograms of the three selected channels (fine pass), one GS RAM block each
+#pragma DATA_SECTION(ADC_char_histogram0, "ADC_CharHistogram0");
+#pragma DATA_SECTION(ADC_char_histogram1, "ADC_CharHistogram1");
+#pragma DATA_SECTION(ADC_char_histogram2, "ADC_CharHistogram2");
+uint16_t ADC_char_histogram0[ADC_CHAR_NUMBER_OF_CODES];
+uint16_t ADC_char_histogram1[ADC_CHAR_NUMBER_OF_CODES];
+uint16_t ADC_char_histogram2[ADC_CHAR_NUMBER_OF_CODES];
+uint16_t *const ADC_char_histogram[3] = {ADC_char_histogram0, ADC_char_histogram1, ADC_char_histogram2};
 
 //-------------------------------------------------------------------------------------------------
 // Global functions
@@ -119,7 +150,8 @@ void GPIOLEDs_Check(void)
 ///         if the code detects any error/mismatch in data read by ADCIN to that of DAC generated value,
 ///         it will light up the respective Error LED. The ADCIN values are simultaneously sent to ePWMs,
 ///         which control the brightness of PWM LEDs, making them gradually brighter.
-///         repeats the process for 3 times
+///         repeats the process for 3 times. If ADC_fast_mode is set, the fast self-test runs first
+///         and the sweep is skipped if all channels pass
 ///
 /// @param  void
 ///
@@ -128,6 +160,10 @@ void GPIOLEDs_Check(void)
 //=================================================================================================
 void ADCINs_Check(void)
 {
+    // Fast self-test first, the full sweep is only needed if a channel failed
+    if(ADC_fast_mode && ADCINs_FastCheck())
+        return;
+
     EALLOW;
     for(uint16_t k = 0; k < Repeat_count; k++)
     {
@@ -151,6 +187,382 @@ void ADCINs_Check(void)
     EDIS;
 }
 
+//=== Function:ADCINs_FastCheck==========================================================================
+///
+/// @brief  Fast self-test of the ADCINs. The three analogue MUXes are switched independently, so one
+///         channel of each MUX is tested at the same time. For each DAC level in ADC_fast_levels the
+///         DACs are set, and after settling all ADC modules (triggered together by ePWM1 SOCA) are
+///         sampled ADC_FAST_NUMBER_OF_SAMPLES times. The mean of every selected channel is compared
+///         with the mean of the DAC read-back (DACOUTA/B/C measured directly at ADCINA0, ADCINA1 and
+///         ADCINB1), so offset and gain errors of the DACs do not count as channel errors.
+///         Failed channels are stored in ADC_fast_failed.
+///
+/// @param  void
+///
+/// @return bool passed (true = all channels within ADC_fast_tolerance)
+///
+//=================================================================================================
+bool ADCINs_FastCheck(void)
+{
+    ADC_fast_failed = 0;
+    EALLOW;
+    for(uint16_t k = 0; k < ADC_FAST_NUMBER_OF_SLOTS; k++)
+    {
+        for(uint16_t m = 0; m < 3; m++)
+        {
+            if(ADC_fast_slots[k][m] >= 0)
+                Mux_Select(ADC_fast_slots[k][m]);
+        }
+        for(uint16_t l = 0; l < ADC_FAST_NUMBER_OF_LEVELS; l++)
+        {
+            DacaRegs.DACVALS.bit.DACVALS = ADC_fast_levels[l];
+            DacbRegs.DACVALS.bit.DACVALS = ADC_fast_levels[l];
+            DaccRegs.DACVALS.bit.DACVALS = ADC_fast_levels[l];
+            DELAY_US(ADC_FAST_SETTLE_US);
+
+            // Sum up the read-back and the selected channels, all read from the same conversions
+            uint32_t reference = 0;
+            uint32_t sum[3] = {0, 0, 0};
+            for(uint16_t n = 0; n < ADC_FAST_NUMBER_OF_SAMPLES; n++)
+            {
+                reference += (uint32_t)AdcaResultRegs.ADCRESULT0 + AdcaResultRegs.ADCRESULT1
+                           + AdcbResultRegs.ADCRESULT1;
+                for(uint16_t m = 0; m < 3; m++)
+                {
+                    if(ADC_fast_slots[k][m] >= 0)
+                        sum[m] += ADC_Result(ADC_fast_slots[k][m]);
+                }
+                // Wait for the next conversion (ePWM1 SOCA)
+                DELAY_US(ADC_FAST_SAMPLE_US);
+            }
+            int32_t expected = reference / (3 * ADC_FAST_NUMBER_OF_SAMPLES);
+            for(uint16_t m = 0; m < 3; m++)
+            {
+                if(ADC_fast_slots[k][m] < 0)
+                    continue;
+                int32_t deviation = (int32_t)(sum[m] / ADC_FAST_NUMBER_OF_SAMPLES) - expected;
+                if(deviation < 0)
+                    deviation = -deviation;
+                if(deviation > ADC_fast_tolerance)
+                    ADC_fast_failed |= 1UL << ADC_fast_slots[k][m];
+            }
+        }
+        // Deselect all channels
+        Mux_Select(23);
+    }
+    EDIS;
+    return (ADC_fast_failed == 0);
+}
+
+//=== Function:ADCINs_Characterize==========================================================================
+///
+/// @brief  Characterisation of the ADCINs. As in the fast self-test, one channel of each MUX is measured
+///         at the same time. For every group two sweeps of DAC-A/B/C are made:
+///         coarse pass - every ADC_CHAR_COARSE_STEP codes, the best-fit line (gain and offset) is
+///                       calculated with running means and co-moments (Welford), so no samples are stored
+///         fine pass   - every code, the mean of ADC_CHAR_NUMBER_OF_SAMPLES samples is compared with the
+///                       best-fit line (INL), the variance of the samples of each code is summed up (noise)
+///                       and every sample is counted in a 4096-bin code histogram of its channel
+///         The DNL is calculated from the code density of the histogram: DNL(code) = hits(code) / mean
+///         hits - 1, codes without a hit are missing codes. The three histograms (one per MUX) take
+///         3 x 4096 words and are placed in RAMGS6 to RAMGS8, all other values are min./max. values and
+///         running sums. A channel with |gain| < ADC_CHAR_MIN_GAIN (e.g. open input) fails, INL and DNL
+///         are not calculated for it. The DAC is the stimulus, so its errors are included in the results.
+///         After all channels are measured the results are sent over UART, one line per channel.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ADCINs_Characterize(void)
+{
+    uint32_t sum[3], sumsq[3];
+
+    EALLOW;
+    for(uint16_t k = 0; k < ADC_FAST_NUMBER_OF_SLOTS; k++)
+    {
+        for(uint16_t m = 0; m < 3; m++)
+        {
+            if(ADC_fast_slots[k][m] >= 0)
+                Mux_Select(ADC_fast_slots[k][m]);
+            ADC_char_state[m].n = 0;
+            ADC_char_state[m].mean_x = 0.0f;
+            ADC_char_state[m].mean_y = 0.0f;
+            ADC_char_state[m].m2_x = 0.0f;
+            ADC_char_state[m].c_xy = 0.0f;
+            ADC_char_state[m].variance = 0.0f;
+            for(uint16_t code = 0; code < ADC_CHAR_NUMBER_OF_CODES; code++)
+                ADC_char_histogram[m][code] = 0;
+        }
+
+        // Coarse pass: best-fit line
+        for(uint16_t code = ADC_CHAR_FIRST_CODE; code <= ADC_CHAR_LAST_CODE; code += ADC_CHAR_COARSE_STEP)
+        {
+            DacaRegs.DACVALS.bit.DACVALS = code;
+            DacbRegs.DACVALS.bit.DACVALS = code;
+            DaccRegs.DACVALS.bit.DACVALS = code;
+            DELAY_US(ADC_CHAR_COARSE_SETTLE_US);
+            ADC_CharSample(k, sum, sumsq, false);
+            for(uint16_t m = 0; m < 3; m++)
+            {
+                ADC_CharState *state = &ADC_char_state[m];
+                float y = (float)sum[m] / ADC_CHAR_NUMBER_OF_SAMPLES;
+                float dx = (float)code - state->mean_x;
+                state->n++;
+                state->mean_x += dx / state->n;
+                state->mean_y += (y - state->mean_y) / state->n;
+                state->m2_x += dx * ((float)code - state->mean_x);
+                state->c_xy += dx * (y - state->mean_y);
+            }
+        }
+        for(uint16_t m = 0; m < 3; m++)
+        {
+            ADC_CharState *state = &ADC_char_state[m];
+            state->gain = state->c_xy / state->m2_x;
+            state->offset = state->mean_y - state->gain * state->mean_x;
+            if(ADC_fast_slots[k][m] < 0)
+                continue;
+            ADC_CharResult *result = &ADC_char_results[ADC_fast_slots[k][m]];
+            result->gain_error = (state->gain - 1.0f) * 100.0f;
+            result->offset = state->offset;
+            // INL and DNL are divided by the gain, a channel without a usable transfer curve fails
+            // (the comparison is also false for NaN)
+            result->failed = !(fabsf(state->gain) >= ADC_CHAR_MIN_GAIN);
+            result->inl_max = result->failed ? 0.0f : -4096.0f;
+            result->inl_min = result->failed ? 0.0f : 4096.0f;
+            result->dnl_max = 0.0f;
+            result->dnl_min = 0.0f;
+            result->missing_codes = 0;
+        }
+
+        // Fine pass: INL, noise and code histogram
+        for(uint16_t code = ADC_CHAR_FIRST_CODE; code <= ADC_CHAR_LAST_CODE; code++)
+        {
+            DacaRegs.DACVALS.bit.DACVALS = code;
+            DacbRegs.DACVALS.bit.DACVALS = code;
+            DaccRegs.DACVALS.bit.DACVALS = code;
+            DELAY_US(code == ADC_CHAR_FIRST_CODE ? ADC_CHAR_COARSE_SETTLE_US : ADC_CHAR_SETTLE_US);
+            ADC_CharSample(k, sum, sumsq, true);
+            for(uint16_t m = 0; m < 3; m++)
+            {
+                if(ADC_fast_slots[k][m] < 0)
+                    continue;
+                ADC_CharState *state = &ADC_char_state[m];
+                ADC_CharResult *result = &ADC_char_results[ADC_fast_slots[k][m]];
+                // Variance of the samples of this code, exact in integers: (N * sum(y^2) - sum(y)^2) / (N * (N - 1))
+                uint64_t spread = (uint64_t)ADC_CHAR_NUMBER_OF_SAMPLES * sumsq[m] - (uint64_t)sum[m] * sum[m];
+                state->variance += (float)spread / (ADC_CHAR_NUMBER_OF_SAMPLES * (ADC_CHAR_NUMBER_OF_SAMPLES - 1));
+                if(result->failed)
+                    continue;
+                float y = (float)sum[m] / ADC_CHAR_NUMBER_OF_SAMPLES;
+                float inl = (y - (state->offset + state->gain * code)) / state->gain;
+                if(inl > result->inl_max)
+                    result->inl_max = inl;
+                if(inl < result->inl_min)
+                    result->inl_min = inl;
+            }
+        }
+        for(uint16_t m = 0; m < 3; m++)
+        {
+            if(ADC_fast_slots[k][m] < 0)
+                continue;
+            ADC_CharResult *result = &ADC_char_results[ADC_fast_slots[k][m]];
+            result->noise = sqrtf(ADC_char_state[m].variance / (ADC_CHAR_LAST_CODE - ADC_CHAR_FIRST_CODE + 1));
+            if(!result->failed)
+                ADC_CharDnl(m, result);
+        }
+        // Deselect all channels
+        Mux_Select(23);
+    }
+    EDIS;
+
+    // Send the results
+    UartWriteString("\r\nADCIN characterisation, DAC codes ");
+    UartWriteInt(ADC_CHAR_FIRST_CODE);
+    UartWriteString(" to ");
+    UartWriteInt(ADC_CHAR_LAST_CODE);
+    UartWriteString(", ");
+    UartWriteInt(ADC_CHAR_NUMBER_OF_SAMPLES);
+    UartWriteString(" samples per code\r\n");
+    for(uint16_t i = 0; i < ADC_CHAR_NUMBER_OF_CHANNELS; i++)
+        ADC_CharReport(i);
+}
+
+//=== Function: ADC_CharSample ==========================================================================
+///
+/// @brief  Function sums up ADC_CHAR_NUMBER_OF_SAMPLES results (and their squares) of the three channels
+///         of group k, one sample per conversion of ePWM1 SOCA. If histogram is set, every result is also
+///         counted in the code histogram of its channel (saturating at 0xFFFF)
+///
+/// @param  uint16_t k (group in ADC_fast_slots), uint32_t *sum, uint32_t *sumsq (3 values each),
+///         bool histogram
+///
+/// @return void
+///
+//===========================================================================================================
+void ADC_CharSample(uint16_t k, uint32_t *sum, uint32_t *sumsq, bool histogram)
+{
+    for(uint16_t m = 0; m < 3; m++)
+    {
+        sum[m] = 0;
+        sumsq[m] = 0;
+    }
+    for(uint16_t n = 0; n < ADC_CHAR_NUMBER_OF_SAMPLES; n++)
+    {
+        for(uint16_t m = 0; m < 3; m++)
+        {
+            if(ADC_fast_slots[k][m] < 0)
+                continue;
+            uint32_t y = ADC_Result(ADC_fast_slots[k][m]);
+            sum[m] += y;
+            sumsq[m] += y * y;
+            if(histogram)
+            {
+                uint16_t *hits = &ADC_char_histogram[m][y & (ADC_CHAR_NUMBER_OF_CODES - 1)];
+                if(*hits < 0xFFFF)
+                    (*hits)++;
+            }
+        }
+        // Wait for the next conversion (ePWM1 SOCA)
+        DELAY_US(ADC_FAST_SAMPLE_US);
+    }
+}
+
+//=== Function: ADC_CharDnl ==========================================================================
+///
+/// @brief  Function calculates the DNL from the code histogram of MUX m (code density). Only the ADC codes
+///         inside the swept range are evaluated: the end codes of the range (from the best-fit line) are
+///         excluded, because they only get part of the hits. DNL(code) = hits(code) / mean hits - 1,
+///         codes without a hit are counted as missing codes (DNL = -1)
+///
+/// @param  uint16_t m (MUX 0 to 2), ADC_CharResult *result
+///
+/// @return void
+///
+//===========================================================================================================
+void ADC_CharDnl(uint16_t m, ADC_CharResult *result)
+{
+    const ADC_CharState *state = &ADC_char_state[m];
+    const uint16_t *hits = ADC_char_histogram[m];
+    float first = state->offset + state->gain * ADC_CHAR_FIRST_CODE;
+    float last = state->offset + state->gain * ADC_CHAR_LAST_CODE;
+    if(first > last)
+    {
+        float swap = first;
+        first = last;
+        last = swap;
+    }
+    // Range of complete codes, limited to 1 ... 4094
+    int32_t low = (first < 0.0f) ? 1 : (int32_t)first + 2;
+    int32_t high = (last > (float)(ADC_CHAR_NUMBER_OF_CODES - 1)) ? ADC_CHAR_NUMBER_OF_CODES - 2 : (int32_t)last - 1;
+    if(low < 1)
+        low = 1;
+    if(high > ADC_CHAR_NUMBER_OF_CODES - 2)
+        high = ADC_CHAR_NUMBER_OF_CODES - 2;
+    if(high <= low)
+    {
+        result->failed = true;
+        return;
+    }
+
+    uint32_t total = 0;
+    for(int32_t code = low; code <= high; code++)
+        total += hits[code];
+    float mean = (float)total / (float)(high - low + 1);
+    result->dnl_max = -1.0f;
+    result->dnl_min = 4096.0f;
+    for(int32_t code = low; code <= high; code++)
+    {
+        float dnl = (float)hits[code] / mean - 1.0f;
+        if(dnl > result->dnl_max)
+            result->dnl_max = dnl;
+        if(dnl < result->dnl_min)
+            result->dnl_min = dnl;
+        if(hits[code] == 0)
+            result->missing_codes++;
+    }
+}
+
+//=== Function: ADC_CharReport ==========================================================================
+///
+/// @brief  Function sends the characterisation result of MUX position i over UART, e.g.
+///         "MUX 5: gain error 0.12 %, offset -1.25, INL max 0.80 min -0.95, DNL max 0.40 min -0.35,
+///         missing codes 0, noise 0.62 LSB" or for a failed channel
+///         "MUX 5: FAILED, gain error -99.80 %, offset 1.25, noise 0.62 LSB"
+///
+/// @param  uint16_t i (MUX position 0 to 20)
+///
+/// @return void
+///
+//===========================================================================================================
+void ADC_CharReport(uint16_t i)
+{
+    const ADC_CharResult *result = &ADC_char_results[i];
+
+    UartWriteString("MUX ");
+    UartWriteInt(i);
+    UartWriteString(result->failed ? ": FAILED, gain error " : ": gain error ");
+    UartWriteFloat(result->gain_error, 2);
+    UartWriteString(" %, offset ");
+    UartWriteFloat(result->offset, 2);
+    if(!result->failed)
+    {
+        UartWriteString(", INL max ");
+        UartWriteFloat(result->inl_max, 2);
+        UartWriteString(" min ");
+        UartWriteFloat(result->inl_min, 2);
+        UartWriteString(", DNL max ");
+        UartWriteFloat(result->dnl_max, 2);
+        UartWriteString(" min ");
+        UartWriteFloat(result->dnl_min, 2);
+        UartWriteString(", missing codes ");
+        UartWriteInt(result->missing_codes);
+    }
+    UartWriteString(", noise ");
+    UartWriteFloat(result->noise, 2);
+    UartWriteString(" LSB\r\n");
+}
+
+//=== Function: ADC_Result ==========================================================================
+///
+/// @brief  Function returns the latest ADC result of the ADCIN that is connected to MUX position i
+///         (same assignment as in ADCtoPWM)
+///
+/// @param  int i (MUX position 0 to 20)
+///
+/// @return uint16_t ADC result (0 for other positions)
+///
+//===========================================================================================================
+uint16_t ADC_Result(int i)
+{
+    switch(i)
+    {
+        case 0:  return AdcaResultRegs.ADCRESULT2;
+        case 1:  return AdcaResultRegs.ADCRESULT3;
+        case 2:  return AdcaResultRegs.ADCRESULT4;
+        case 3:  return AdcaResultRegs.ADCRESULT5;
+        case 4:  return AdcbResultRegs.ADCRESULT0;
+        case 5:  return AdcbResultRegs.ADCRESULT2;
+        case 6:  return AdcbResultRegs.ADCRESULT3;
+        case 7:  return AdcbResultRegs.ADCRESULT4;
+        case 8:  return AdcbResultRegs.ADCRESULT5;
+        case 9:  return AdccResultRegs.ADCRESULT2;
+        case 10: return AdccResultRegs.ADCRESULT3;
+        case 11: return AdccResultRegs.ADCRESULT4;
+        case 12: return AdccResultRegs.ADCRESULT5;
+        case 13: return AdcdResultRegs.ADCRESULT0;
+        case 14: return AdcdResultRegs.ADCRESULT1;
+        case 15: return AdcdResultRegs.ADCRESULT2;
+        case 16: return AdcdResultRegs.ADCRESULT3;
+        case 17: return AdcdResultRegs.ADCRESULT4;
+        case 18: return AdcdResultRegs.ADCRESULT5;
+        case 19: return AdcaResultRegs.ADCRESULT14;
+        case 20: return AdcaResultRegs.ADCRESULT15;
+        default: return 0;
+    }
+}
+
 //=== Function: Hardware_Error_Detection_Check ==========================================================================
 ///
 /// @brief  Function to check the all Hardware Error Detections
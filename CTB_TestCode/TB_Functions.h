@@ -3,9 +3,9 @@
 ///
 /// @brief    File contains functions for testing all GPIOs, PWMs, DACs and ADCs
 ///
-/// @version  V1.1.0
+/// @version  V1.2.0
 ///
-/// @date     23-04-2024
+/// @date     19-10-2026
 ///
 /// @author   Vijay
 //=================================================================================================
@@ -15,10 +15,36 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "TB_Device.h"
+#include "TB_UART.h"
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Fast self-test of the ADCINs: number of DAC levels, of channel groups (slots) and of samples
+// per level, settling time after setting the DACs and time between two samples (ePWM1 SOCA: 5 us)
+#define ADC_FAST_NUMBER_OF_LEVELS       3
+#define ADC_FAST_NUMBER_OF_SLOTS        8
+#define ADC_FAST_NUMBER_OF_SAMPLES      16
+#define ADC_FAST_SETTLE_US              2000
+#define ADC_FAST_SAMPLE_US              10
+// Characterisation of the ADCINs: swept DAC codes, step of the coarse pass (gain and offset), samples
+// per code and settling times of the coarse and fine pass, number of MUX positions (channels)
+#define ADC_CHAR_FIRST_CODE             100
+#define ADC_CHAR_LAST_CODE              3900
+#define ADC_CHAR_COARSE_STEP            16
+#define ADC_CHAR_NUMBER_OF_SAMPLES      32
+#define ADC_CHAR_COARSE_SETTLE_US       500
+#define ADC_CHAR_SETTLE_US              50
+#define ADC_CHAR_NUMBER_OF_CHANNELS     21
+// Characterisation: min. gain of a usable channel (below: channel failed, no INL/DNL), number of ADC codes
+// (bins of the code histogram, 12-bit ADC)
+#define ADC_CHAR_MIN_GAIN               0.5f
+#define ADC_CHAR_NUMBER_OF_CODES        4096
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+extern uint16_t ADC_char_mode;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -26,6 +52,37 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Characterisation result of one ADCIN (all values in LSB except the gain error)
+typedef struct
+{
+    float gain_error;   // Gain error of the best-fit line in %
+    float offset;       // Offset of the best-fit line at DAC code 0
+    float inl_max;      // Max. and min. deviation from the best-fit line
+    float inl_min;
+    float dnl_max;      // Max. and min. DNL from the code histogram (hits / mean hits - 1)
+    float dnl_min;
+    uint16_t missing_codes; // Codes of the histogram without a hit
+    float noise;        // Standard deviation of the samples of one code (pooled over all codes)
+    bool failed;        // Gain below ADC_CHAR_MIN_GAIN, INL and DNL not calculated
+} ADC_CharResult;
+
+// Running statistics of one channel during the characterisation
+typedef struct
+{
+    uint16_t n;         // Coarse pass: number of codes, means, sum of squares and co-moment (Welford)
+    float mean_x;
+    float mean_y;
+    float m2_x;
+    float c_xy;
+    float gain;         // Best-fit line: ADC result = offset + gain * DAC code
+    float offset;
+    float variance;     // Fine pass: sum of the variances of all codes
+} ADC_CharState;
+
+
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
@@ -34,6 +91,12 @@ extern void Error_LEDs_Check(void);
 extern void PWM_LEDs_Check(void);
 extern void GPIOLEDs_Check(void);
 extern void ADCINs_Check(void);
+extern bool ADCINs_FastCheck(void);
+extern uint16_t ADC_Result(int);
+extern void ADCINs_Characterize(void);
+extern void ADC_CharSample(uint16_t, uint32_t *, uint32_t *, bool);
+extern void ADC_CharDnl(uint16_t, ADC_CharResult *);
+extern void ADC_CharReport(uint16_t);
 extern void Hardware_Error_Detection_Check(void);
 extern void ADC_ErrorCheck(int);
 extern void Error_LEDs_Off(int);
@@ -0,0 +1,175 @@
+//=================================================================================================
+/// @file       TB_UART.c
+///
+/// @brief      file contains variables and functions to send test results over the UART interface
+///             SCI-A of the TMS320F2838x (GPIO 28 RxD, GPIO 135 TxD, 115200 baud, 8N1). The
+///             transmission is polled (no interrupts), the functions return when the last character
+///             has been written to the transmit FIFO
+///
+/// @version    V1.0.0
+///
+/// @date       19-10-2026
+///
+/// @author     Vijay
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_UART.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: UartInit ==========================================================================
+///
+/// @brief Function initialises the GPIOs and the SCI-A module (115200 baud, 8 data bits, no parity,
+///        1 stop bit, FIFO enabled)
+///
+/// @param void
+///
+/// @return void
+///
+//=================================================================================================
+void UartInit(void)
+{
+    EALLOW; // Cancel register write protection
+
+    GpioCtrlRegs.GPALOCK.bit.GPIO28 = 0;    // Unlock configuration of GPIO 28 (RxD)
+    GpioCtrlRegs.GPAGMUX2.bit.GPIO28 = (UART_GPIO_RX_MUX >> 2);   // Set to SCI-A RxD
+    GpioCtrlRegs.GPAMUX2.bit.GPIO28 = (UART_GPIO_RX_MUX & 0x03);
+    GpioCtrlRegs.GPAPUD.bit.GPIO28 = 1;     // Disable pull-up resistor
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO28 = 0x03;    // Asynchronous input (must be set for SCI)
+    GpioCtrlRegs.GPELOCK.bit.GPIO135 = 0;   // Unlock configuration of GPIO 135 (TxD)
+    GpioCtrlRegs.GPEGMUX1.bit.GPIO135 = (UART_GPIO_TX_MUX >> 2);  // Set to SCI-A TxD
+    GpioCtrlRegs.GPEMUX1.bit.GPIO135 = (UART_GPIO_TX_MUX & 0x03);
+    GpioCtrlRegs.GPEPUD.bit.GPIO135 = 1;    // Disable pull-up resistor
+    GpioCtrlRegs.GPEQSEL1.bit.GPIO135 = 0x03;   // Asynchronous input (must be set for SCI)
+
+    CpuSysRegs.PCLKCR7.bit.SCI_A = 1;   // Switch on the clock for the SCI module and wait 5 clocks
+    __asm(" RPT #4 || NOP");
+    SciaRegs.SCICTL1.bit.SWRESET = 0;   // Hold the module in reset during configuration
+    SciaRegs.SCICCR.all = 0x0007;   // 1 stop bit, no parity, no loopback, 8 data bits
+    SciaRegs.SCICTL1.all = 0x0003;  // Enable transmitter and receiver, no interrupts
+    SciaRegs.SCICTL2.all = 0x0000;
+    // Baud rate = LSPCLK / ((BRR + 1) * 8), rounded (115200 baud: BRR = 53, +0.5 %)
+    uint16_t divider = (uint16_t)((UART_LSPCLK + 4UL * UART_BAUD) / (8UL * UART_BAUD) - 1UL);
+    SciaRegs.SCIHBAUD.all = divider >> 8;
+    SciaRegs.SCILBAUD.all = divider & 0xFF;
+    SciaRegs.SCIFFTX.all = 0xE040;  // Enable the FIFOs, reset the transmit FIFO
+    SciaRegs.SCIFFRX.all = 0x2044;  // Reset the receive FIFO
+    SciaRegs.SCIFFCT.all = 0x0000;
+    SciaRegs.SCICTL1.bit.SWRESET = 1;   // Release the module from reset
+
+    EDIS;   // Set register write protection
+}
+
+//=== Function: UartWriteChar =====================================================================
+///
+/// @brief Function waits for a free place in the transmit FIFO and writes one character
+///
+/// @param char c
+///
+/// @return void
+///
+//=================================================================================================
+void UartWriteChar(char c)
+{
+    while(SciaRegs.SCIFFTX.bit.TXFFST >= UART_SIZE_FIFO);
+    SciaRegs.SCITXBUF.all = (uint16_t)c & 0xFF;
+}
+
+//=== Function: UartWriteString ===================================================================
+///
+/// @brief Function sends a zero-terminated string
+///
+/// @param const char *text
+///
+/// @return void
+///
+//=================================================================================================
+void UartWriteString(const char *text)
+{
+    while(*text != '\0')
+        UartWriteChar(*text++);
+}
+
+//=== Function: UartWriteInt ======================================================================
+///
+/// @brief Function sends a signed integer as decimal number (without sprintf, the stack of the
+///        project is too small for the formatted output of the runtime library)
+///
+/// @param int32_t value
+///
+/// @return void
+///
+//=================================================================================================
+void UartWriteInt(int32_t value)
+{
+    char digits[11];
+    uint16_t count = 0;
+    uint32_t magnitude = (value < 0) ? (uint32_t)(-value) : (uint32_t)value;
+
+    if(value < 0)
+        UartWriteChar('-');
+    do
+    {
+        digits[count++] = '0' + (char)(magnitude % 10UL);
+        magnitude /= 10UL;
+    } while(magnitude != 0);
+    while(count > 0)
+        UartWriteChar(digits[--count]);
+}
+
+//=== Function: UartWriteFloat ====================================================================
+///
+/// @brief Function sends a floating point number with "decimals" decimals (max. 4, rounded).
+///        NaN is sent as "nan" and +/-infinity as "inf"/"-inf", values whose integer part does not fit
+///        in an int32_t are clamped to the largest value that can be sent
+///
+/// @param float value, uint16_t decimals
+///
+/// @return void
+///
+//=================================================================================================
+void UartWriteFloat(float value, uint16_t decimals)
+{
+    uint32_t scale = 1;
+    if(decimals > 4)
+        decimals = 4;
+    for(uint16_t i = 0; i < decimals; i++)
+        scale *= 10UL;
+
+    if(isnan(value))
+    {
+        UartWriteString("nan");
+        return;
+    }
+    if(value < 0.0f)
+    {
+        UartWriteChar('-');
+        value = -value;
+    }
+    if(isinf(value))
+    {
+        UartWriteString("inf");
+        return;
+    }
+    // Clamp to the range of UartWriteInt(), the conversion of a larger float is undefined
+    float scaled = value * (float)scale + 0.5f;
+    uint32_t fixed = (scaled < 2147483647.0f) ? (uint32_t)scaled : 2147483647UL;
+    UartWriteInt((int32_t)(fixed / scale));
+    if(decimals == 0)
+        return;
+    UartWriteChar('.');
+    uint32_t fraction = fixed % scale;
+    for(uint32_t digit = scale / 10UL; digit > 0; digit /= 10UL)
+    {
+        UartWriteChar('0' + (char)((fraction / digit) % 10UL));
+    }
+}
@@ -0,0 +1,54 @@
+//=================================================================================================
+/// @file       TB_UART.h
+///
+/// @brief      file contains variables and functions to send test results over the UART interface
+///             SCI-A of the TMS320F2838x (GPIO 28 RxD, GPIO 135 TxD, 115200 baud, 8N1). The
+///             transmission is polled (no interrupts), the functions return when the last character
+///             has been written to the transmit FIFO
+///
+/// @version    V1.0.0
+///
+/// @date       19-10-2026
+///
+/// @author     Vijay
+//=================================================================================================
+#ifndef MYUART_H_
+#define MYUART_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "TB_Device.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Low-speed peripheral clock (SYSCLK / (2 * LSPCLKDIV) = 200 MHz / 4, see TB_Device.c)
+#define UART_LSPCLK                 50000000UL
+// Baud rate
+#define UART_BAUD                   115200UL
+// GPIOs and mux numbers of SCI-A on the control board
+#define UART_GPIO_RX                28
+#define UART_GPIO_RX_MUX            1
+#define UART_GPIO_TX                135
+#define UART_GPIO_TX_MUX            6
+// Size of the transmit FIFO
+#define UART_SIZE_FIFO              16
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Function initialises the GPIOs and the SCI-A module
+extern void UartInit(void);
+// Function sends one character
+extern void UartWriteChar(char c);
+// Function sends a zero-terminated string
+extern void UartWriteString(const char *text);
+// Function sends a signed integer as decimal number
+extern void UartWriteInt(int32_t value);
+// Function sends a floating point number with the given number of decimals
+extern void UartWriteFloat(float value, uint16_t decimals);
+
+
+#endif
@@ -5,10 +5,11 @@
 ///           Functions to configure for all GPIOs, PWMs, DACs, and ADCs.
 ///           Functions to check the Error LEDs, PWM LEDs, and GPIO LEDs (Group-A to Group-H).
 ///           Functions to performs hardware error detection checks and ADC input's checks.
+///           V1.2.0: characterisation of the ADCINs, results are sent over UART (SCI-A)
 ///
-/// @version  V1.1.0
+/// @version  V1.2.0
 ///
-/// @date     23-04-2024
+/// @date     19-10-2026
 ///
 /// @author   Vijay
 //=================================================================================================
@@ -21,6 +22,7 @@
 #include "TB_GPIO.h"
 #include "TB_DAC.h"
 #include "TB_Functions.h"
+#include "TB_UART.h"
 #include "TB_Device.h"
 
 //-------------------------------------------------------------------------------------------------
@@ -78,6 +80,9 @@ void main(void)
     //  initialise all ADCs (module A,B,C,D)
     AdcInitAll();
 
+    //  initialise the UART interface (SCI-A, 115200 baud) for the characterisation results
+    UartInit();
+
     //------------------------------------------------------------------------------
 
     //  Checks Hardware_Error_Detection section
@@ -86,6 +91,10 @@ void main(void)
     //  Checks all ADCINs
     ADCINs_Check();
 
+    //  Characterises all ADCINs (gain error, offset, INL, DNL, noise) and sends the results over UART
+    if(ADC_char_mode)
+        ADCINs_Characterize();
+
     //------------------------------------------------------------------------------
 
     // Continuous loop main programme
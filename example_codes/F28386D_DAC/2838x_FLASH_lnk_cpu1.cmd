@@ -92,6 +92,8 @@ SECTIONS
 
    ramgs0 : > RAMGS0, type=NOINIT
    ramgs1 : > RAMGS1, type=NOINIT
+   /* Tabellen des Signalgenerators (myDAC.c), der DMA hat nur Zugriff auf die GSx-RAMs */
+   DACDMA           : > RAMGS14
    
    MSGRAM_CPU1_TO_CPU2 : > CPU1TOCPU2RAM, type=NOINIT
    MSGRAM_CPU2_TO_CPU1 : > CPU2TOCPU1RAM, type=NOINIT
@@ -7,9 +7,13 @@
 ///						genauen Funktion sind im Modul "myDevice.c" zu finden. Die Ausgangsspannung wird
 ///						an Pin ADCINA0/DACOUTA ausgegeben.
 ///
-/// @version	V1.2
+///						nderung V1.3: Signalgenerator ("myDAC.c" V2.0). DAC-A gibt einen Sinus, DAC-B ein
+///						Dreieck und DAC-C eine Rampe aus (Takt: ePWM1, 100 kHz). Die Werte werden per DMA
+///						bertragen, die Hauptschleife ist frei fr andere Aufgaben
 ///
-/// @date			08.09.2022
+/// @version	V1.3
+///
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -22,6 +26,8 @@
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Abtastrate des Signalgenerators in Hz
+#define MAIN_SAMPLE_RATE									100000
 
 
 //-------------------------------------------------------------------------------------------------
@@ -47,8 +53,22 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
-	  // DAC initialisieren
-	  DacAInit();
+	  // DAC-Module A, B und C initialisieren
+	  DacInit(DAC_MODULE_A);
+	  DacInit(DAC_MODULE_B);
+	  DacInit(DAC_MODULE_C);
+	  // Signalgenerator mit ePWM1-Takt initialisieren und die Signale einstellen:
+	  // Modul, Signalform, Frequenz in Hz, Amplitude und Offset in DAC-Werten
+	  if (   !DacWaveInit(DAC_PACING_EPWM, MAIN_SAMPLE_RATE)
+	  		|| !DacWaveSet(DAC_MODULE_A, DAC_WAVE_SINE,     1000.0f, 2000, 2048)
+	  		|| !DacWaveSet(DAC_MODULE_B, DAC_WAVE_TRIANGLE,  500.0f, 1000, 2048)
+	  		|| !DacWaveSet(DAC_MODULE_C, DAC_WAVE_RAMP,      200.0f, 2048, 2048))
+	  {
+	  		// Fehlerbehandlung:
+	  		// ...
+	  }
+	  // Ausgabe starten (luft ohne Zutun der CPU)
+	  DacWaveStart();
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -56,8 +76,8 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-    		// DAC-Wert setzen
-    		DacaRegs.DACVALS.bit.DACVALS = 0;
+    		// Weitere Aufgaben des Hauptprogramms
+    		// ...
     }
 }
 
@@ -6,9 +6,19 @@
 ///							der Module B und C ist analog zu der des Moduls A. Die Referenzspannung ist
 ///							VREFHI und die DAC-Spannung wird an Pin ADCINA0/DACOUTA ausgegeben.
 ///
-/// @version    V1.1
+///							nderung in Version 2.0: Initialisierung der Module A, B und C ("DacInit()") und
+///							Signalgenerator. Die Module geben periodisch eine Tabelle (Sinus, Dreieck, Rampe
+///							oder beliebige Werte) aus. Die Werte werden von je einem DMA-Kanal pro Modul in das
+///							Register DACVALS kopiert, ohne dass die CPU beteiligt ist. Den Takt gibt entweder
+///							das ePWM1-Modul (SOCA bei TBCTR = 0, alle Module bernehmen den Wert gleichzeitig
+///							beim ePWM1-Sync) oder der CPU-Timer 1 vor. Frequenz, Amplitude und Offset sind je
+///							Modul einstellbar. Die Frequenz ergibt sich aus Abtastrate / Anzahl der Punkte,
+///							sie wird daher auf die nchste darstellbare Frequenz gerundet.
+///							DAC-A: Pin ADCINA0/DACOUTA, DAC-B: Pin ADCINA1/DACOUTB, DAC-C: Pin ADCINB1/DACOUTC
 ///
-/// @date       13.01.2023
+/// @version    V2.0
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -21,6 +31,24 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Register der DAC-Module und der zugehrigen DMA-Kanle (DAC-A: CH1, DAC-B: CH2, DAC-C: CH3)
+volatile struct DAC_REGS *const dacRegs[DAC_NUMBER_OF_MODULES] = {&DacaRegs, &DacbRegs,
+																																	&DaccRegs};
+volatile struct CH_REGS *const dacDmaChannels[DAC_NUMBER_OF_MODULES] = {&DmaRegs.CH1,
+																																				&DmaRegs.CH2,
+																																				&DmaRegs.CH3};
+// Tabellen des Signalgenerators. Der DMA hat nur Zugriff auf die GSx-RAMs, daher liegen die
+// Tabellen in der Sektion "DACDMA"
+uint16_t dacWaveTables[DAC_NUMBER_OF_MODULES][DAC_SIZE_TABLE];
+#pragma DATA_SECTION(dacWaveTables, "DACDMA");
+// Einstellungen des Signalgenerators je Modul
+DacWave dacWaves[DAC_NUMBER_OF_MODULES];
+// Taktquelle (DAC_PACING_...) und Abtastrate des Signalgenerators in Hz
+uint16_t dacPacing = DAC_PACING_EPWM;
+uint32_t dacSampleRate = 0;
+// Flag, ob der Signalgenerator luft
+uint16_t dacWaveRunning = 0;
+
 
 
 //-------------------------------------------------------------------------------------------------
@@ -37,53 +65,69 @@
 //=================================================================================================
 void DacAInit(void)
 {
+		DacInit(DAC_MODULE_A);
+}
+
+
+//=== Function: DacInit ===========================================================================
+///
+/// @brief	Funktion initialisiert das DAC-Modul "module" (DAC_MODULE_A, _B oder _C) und schaltet
+///					den Ausgang ein. Der DAC-Wert wird mit dem nchsten SYSCLK bernommen, der
+///					Signalgenerator stellt bei Bedarf die Synchronisierung ber das ePWM1-Modul ein.
+///					Die Funktion gibt "false" zurck, falls das Modul ungltig ist.
+///
+/// @param  uint16_t module
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool DacInit(uint16_t module)
+{
+		if (module >= DAC_NUMBER_OF_MODULES)
+		{
+				return false;
+		}
+		volatile struct DAC_REGS *regs = dacRegs[module];
+
 		// Register-Schreibschutz aufheben
 		EALLOW;
 
     // Takt fr das DAC-Modul einschalten und 5 Takte
     // warten, bis der Takt zum Modul durchgestellt ist
     // (siehe S. 283 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-		CpuSysRegs.PCLKCR16.bit.DAC_A = 1;
+		if (module == DAC_MODULE_A)
+		{
+				CpuSysRegs.PCLKCR16.bit.DAC_A = 1;
+		}
+		else if (module == DAC_MODULE_B)
+		{
+				CpuSysRegs.PCLKCR16.bit.DAC_B = 1;
+		}
+		else
+		{
+				CpuSysRegs.PCLKCR16.bit.DAC_C = 1;
+		}
     __asm(" RPT #4 || NOP");
     // VREFHI als Referenzspannung verwenden
     // 0: VDAC (ADCINB0) zu VSS als Referenz
     // 1: VREFHI zu VSS als Referenz
-    DacaRegs.DACCTL.bit.DACREFSEL = DAC_REF_VREFHI;
+    regs->DACCTL.bit.DACREFSEL = DAC_REF_VREFHI;
     // DAC-Wert beim nchsten SYSCLK aus dem Schattenregister bernehmen
     // 0: DAC-Wert ber SYSCLK synchronisieren
     // 1: DAC-Wert ber ePWM-Modul synchronisieren
-    DacaRegs.DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;
+    regs->DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;
     // ePWM1 ld den Wert vom DACVALS- in das DACVALA-Register
     // (nur aktiv falls LOADMODE = 1)
     // 0: EPWM1SYNCPER
     // 1: EPWM2SYNCPER
     // ...
     // 15: EPWM16SYNCPER
-    DacaRegs.DACCTL.bit.SYNCSEL = DAC_EPWM1SYNCPER;
-    /*
-    // Initialisierung fr das ePWM1-Modul zur DAC-Synchronisierung:
-    // Takt fr das PWM1-Modul einschalten und 5 Takte
-    // warten, bis der Takt zum Modul durchgestellt ist
-    // (siehe S. 169 (siehe S. 283 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
-    __asm(" RPT #4 || NOP");
-    // Erweiterte Enstellung fr den DAC- und CMPSS-Synchronisationsimpuls ausschalten
-    // 0: Erweiterte Einstellung deaktiviert, Einstellung ber PWMSYNCSEL
-    // 4: TBCTR = CMPC (beim hoch zhlen)
-    // 5: TBCTR = CMPC (beim herunter zhlen)
-    // 6: TBCTR = CMPD (beim hoch zhlen)
-    // 7: TBCTR = CMPD (beim herunter zhlen)
-    EPwm1Regs.HRPCTL.bit.PWMSYNCSELX = 0;
-    // Synchronisationsimpuls fr DAC und CMPSS bei TBCTR = 0 senden
-    // 0: Synchronisationsimpuls bei TBCTR = PRD
-    // 1: Synchronisationsimpuls bei TBCTR = 0
-    EPwm1Regs.HRPCTL.bit.PWMSYNCSEL = 1
-		*/
+    regs->DACCTL.bit.SYNCSEL = DAC_EPWM1SYNCPER;
     // Ausgang des DAC einschalten.
-    // Das Ausgangssignal des DAC wird an Pin DACOUTA (ADCINA0) ausgegeben
+    // Das Ausgangssignal des DAC wird an Pin DACOUTx ausgegeben
     // 0: Ausgang ausgeschaltet
     // 1: Ausgang eingeschaltet
-    DacaRegs.DACOUTEN.bit.DACOUTEN = DAC_ENABLE_OUTPUT;
+    regs->DACOUTEN.bit.DACOUTEN = DAC_ENABLE_OUTPUT;
     // Erst 500 s nach Einschalten des ADC kann
     // eine korrekte Messung durchgefhrt werden
 		// (siehe "Power Up Time" S. 159 Data Sheet TMS320F2838x, SPRSP14D, Rev. D, Feb. 2021)
@@ -91,4 +135,415 @@ void DacAInit(void)
 
 		// Register-Schreibschutz setzen
 		EDIS;
+		return true;
+}
+
+
+//=== Function: DacWaveInit =======================================================================
+///
+/// @brief	Funktion initialisiert die Taktquelle "pacing" (DAC_PACING_EPWM oder DAC_PACING_TIMER)
+///					mit der Abtastrate "sampleRate" in Hz sowie die DMA-Kanle CH1 bis CH3. Jeder Takt
+///					triggert in allen laufenden Kanlen die bertragung eines Werts aus der Tabelle in
+///					das Register DACVALS, am Ende der Tabelle beginnt der Kanal automatisch von vorn
+///					(CONTINUOUS). Beim ePWM1-Modul bernehmen die DACs den Wert beim folgenden
+///					ePWM1-Sync (TBCTR = 0) gleichzeitig und ohne Jitter durch die DMA-Laufzeit, der
+///					CPU-Timer 1 kann verwendet werden, wenn das ePWM1-Modul anderweitig belegt ist. Die
+///					Abtastrate wird auf die nchste einstellbare gerundet ("dacSampleRate"). Die
+///					Ausgabe startet erst mit "DacWaveStart()". Die Funktion gibt "false" zurck, falls
+///					die Parameter ungltig sind.
+///
+/// @param  uint16_t pacing, uint32_t sampleRate
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool DacWaveInit(uint16_t pacing,
+								 uint32_t sampleRate)
+{
+		if (   (pacing > DAC_PACING_TIMER)
+				|| (sampleRate < DAC_SAMPLE_RATE_MIN)
+				|| (sampleRate > DAC_SAMPLE_RATE_MAX))
+		{
+				return false;
+		}
+		DacWaveStop();
+		dacPacing = pacing;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		if (pacing == DAC_PACING_EPWM)
+		{
+				// Periode in TBCLK-Takten (100 MHz, < 65536 wegen DAC_SAMPLE_RATE_MIN)
+				uint32_t period = DAC_EPWM_CLOCK / sampleRate;
+				dacSampleRate = DAC_EPWM_CLOCK / period;
+
+				// Synchronisierungstakt whrend der Konfiguration ausschalten
+				CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+				// Takt fr das PWM1-Modul einschalten und 5 Takte
+				// warten, bis der Takt zum Modul durchgestellt ist
+				// (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+				CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
+				__asm(" RPT #4 || NOP");
+				// Timer anhalten (wird in "DacWaveStart()" gestartet)
+				EPwm1Regs.TBCTL.bit.CTRMODE = 3;
+				// Taktteiler: 1 (TBCLK = EPWMCLK = 100 MHz)
+				EPwm1Regs.TBCTL.bit.CLKDIV    = 0;
+				EPwm1Regs.TBCTL.bit.HSPCLKDIV = 0;
+				EPwm1Regs.TBCTL.bit.PHSEN = 0;
+				// Periodendauer direkt laden (ohne Umweg ber das Shadow-Register)
+				EPwm1Regs.TBCTL.bit.PRDLD = 1;
+				EPwm1Regs.TBPRD = (uint16_t)(period - 1);
+				EPwm1Regs.TBCTR = 0;
+				// SOCA (DMA-Trigger) bei TBCTR = 0 auslsen (bei jedem Ereignis)
+				EPwm1Regs.ETSEL.bit.SOCASEL = 1;
+				EPwm1Regs.ETPS.bit.SOCAPRD  = 1;
+				EPwm1Regs.ETSEL.bit.SOCAEN  = 1;
+				// Erweiterte Enstellung fr den DAC- und CMPSS-Synchronisationsimpuls ausschalten
+				// und Synchronisationsimpuls fr DAC und CMPSS bei TBCTR = 0 senden
+				EPwm1Regs.HRPCTL.bit.PWMSYNCSELX = 0;
+				EPwm1Regs.HRPCTL.bit.PWMSYNCSEL  = 1;
+				// Synchronisierungstakt wieder einschalten
+				CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+		}
+		else
+		{
+				// Periode in SYSCLK-Takten (200 MHz)
+				uint32_t period = DAC_TIMER_CLOCK / sampleRate;
+				dacSampleRate = DAC_TIMER_CLOCK / period;
+
+				// CPU-Timer 1 anhalten, Vorteiler 1, Periode laden
+				CpuTimer1Regs.TCR.bit.TSS = 1;
+				CpuTimer1Regs.TPR.all  = 0;
+				CpuTimer1Regs.TPRH.all = 0;
+				CpuTimer1Regs.PRD.all  = period - 1;
+				CpuTimer1Regs.TCR.bit.TRB = 1;
+				// Interrupt-Signal einschalten (Trigger fr den DMA). Der CPU-Interrupt 13
+				// bleibt ausgeschaltet, die CPU wird nicht unterbrochen
+				CpuTimer1Regs.TCR.bit.TIE = 1;
+		}
+
+		// Zugriff auf das Peripheral Frame 1 (DAC) dem DMA statt dem CLA zuweisen
+		CpuSysRegs.SECMSEL.bit.PF1SEL = 1;
+		// Takt fr den DMA einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		// DMA auch bei angehaltener CPU (Debugger) weiterlaufen lassen
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// Trigger der Kanle CH1 bis CH3 (DAC-A bis DAC-C)
+		uint16_t trigger = (pacing == DAC_PACING_EPWM) ? DAC_DMA_TRIGGER_EPWM1SOCA
+																									 : DAC_DMA_TRIGGER_TINT1;
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = trigger;
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH2 = trigger;
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH3 = trigger;
+		for (uint16_t i = 0; i < DAC_NUMBER_OF_MODULES; i++)
+		{
+				volatile struct CH_REGS *channel = dacDmaChannels[i];
+				channel->MODE.bit.PERINTSEL  = i + 1;
+				channel->MODE.bit.PERINTE    = 1;
+				channel->MODE.bit.ONESHOT    = 0;
+				// Am Ende der Tabelle automatisch von vorn beginnen
+				channel->MODE.bit.CONTINUOUS = 1;
+				channel->MODE.bit.DATASIZE   = 0;
+				channel->MODE.bit.OVRINTE    = 0;
+				channel->MODE.bit.CHINTE     = 0;
+				// Ein Burst = ein Wert
+				channel->BURST_SIZE.bit.BURSTSIZE = 0;
+				// Quelle: Tabelle (fortlaufend), Ziel: DACVALS (fest)
+				channel->SRC_BURST_STEP    = 0;
+				channel->SRC_TRANSFER_STEP = 1;
+				channel->DST_BURST_STEP    = 0;
+				channel->DST_TRANSFER_STEP = 0;
+				channel->SRC_WRAP_SIZE = 0xFFFF;
+				channel->SRC_WRAP_STEP = 0;
+				channel->DST_WRAP_SIZE = 0xFFFF;
+				channel->DST_WRAP_STEP = 0;
+				channel->DST_BEG_ADDR_SHADOW = (uint32_t)&dacRegs[i]->DACVALS.all;
+				channel->DST_ADDR_SHADOW     = (uint32_t)&dacRegs[i]->DACVALS.all;
+		}
+
+		// Register-Schreibschutz setzen
+		EDIS;
+		return true;
+}
+
+
+//=== Function: DacWaveSet ========================================================================
+///
+/// @brief	Funktion berechnet fr das Modul "module" eine Periode der Signalform "shape"
+///					(DAC_WAVE_SINE, _TRIANGLE, _RAMP oder DAC_WAVE_OFF) mit der Frequenz "frequency" in
+///					Hz, der Amplitude (Scheitelwert) "amplitude" und dem Offset "offset" in DAC-Werten
+///					(0 ... DAC_VALUE_MAX, Werte auerhalb werden begrenzt). Die Anzahl der Punkte ist
+///					Abtastrate / Frequenz, die ausgegebene Frequenz steht in "dacWaves[module]". Luft
+///					der Signalgenerator, wird er fr die Berechnung angehalten und anschlieend mit
+///					"DacWaveStart()" neu gestartet, alle Module beginnen dann gemeinsam am Anfang ihrer
+///					Tabelle (die Phasenlage der Module zueinander bleibt erhalten). Die Funktion gibt
+///					"false" zurck, falls die Parameter ungltig sind oder "DacWaveInit()" nicht
+///					aufgerufen wurde.
+///
+/// @param  uint16_t module, uint16_t shape, float frequency, uint16_t amplitude, uint16_t offset
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool DacWaveSet(uint16_t module,
+								uint16_t shape,
+								float frequency,
+								uint16_t amplitude,
+								uint16_t offset)
+{
+		if (   (module >= DAC_NUMBER_OF_MODULES)
+				|| (shape > DAC_WAVE_RAMP)
+				|| !dacSampleRate)
+		{
+				return false;
+		}
+		if (shape == DAC_WAVE_OFF)
+		{
+				dacWaves[module].shape = DAC_WAVE_OFF;
+				DacWaveApply(module);
+				return true;
+		}
+		if (frequency <= 0.0f)
+		{
+				return false;
+		}
+		// Anzahl der Punkte pro Periode (gerundet)
+		float points = (float)dacSampleRate / frequency + 0.5f;
+		if (   (points < (float)DAC_MIN_POINTS)
+				|| (points >= (float)(DAC_SIZE_TABLE + 1)))
+		{
+				return false;
+		}
+		uint16_t numberOfPoints = (uint16_t)points;
+
+		// Signalgenerator anhalten, damit keine halb berechnete Tabelle ausgegeben wird. Die
+		// Kanle der brigen Module werden mit angehalten, damit beim Neustart alle Kanle
+		// gemeinsam am Anfang ihrer Tabelle beginnen
+		uint16_t running = dacWaveRunning;
+		DacWaveStop();
+
+		// Tabelle berechnen (Wert zwischen -1 und 1, skaliert mit Amplitude und Offset)
+		for (uint16_t i = 0; i < numberOfPoints; i++)
+		{
+				float phase = (float)i / (float)numberOfPoints;
+				float unit;
+				switch (shape)
+				{
+						case DAC_WAVE_SINE:
+								unit = sinf(2.0f * 3.14159265f * phase);
+								break;
+						case DAC_WAVE_TRIANGLE:
+								unit = (phase < 0.5f) ? (4.0f * phase - 1.0f) : (3.0f - 4.0f * phase);
+								break;
+						default:
+								unit = 2.0f * phase - 1.0f;
+								break;
+				}
+				float value = (float)offset + (float)amplitude * unit;
+				// Auf den Bereich des DAC begrenzen und runden
+				if (value < 0.0f)
+				{
+						value = 0.0f;
+				}
+				else if (value > (float)DAC_VALUE_MAX)
+				{
+						value = (float)DAC_VALUE_MAX;
+				}
+				dacWaveTables[module][i] = (uint16_t)(value + 0.5f);
+		}
+
+		dacWaves[module].numberOfPoints = numberOfPoints;
+		dacWaves[module].amplitude      = amplitude;
+		dacWaves[module].offset         = offset;
+		dacWaves[module].frequency      = (float)dacSampleRate / (float)numberOfPoints;
+		dacWaves[module].shape          = shape;
+		if (running)
+		{
+				DacWaveStart();
+		}
+		else
+		{
+				DacWaveApply(module);
+		}
+		return true;
+}
+
+
+//=== Function: DacWaveLoadTable ==================================================================
+///
+/// @brief	Funktion bernimmt "numberOfPoints" beliebige DAC-Werte aus "table" als eine Periode
+///					des Moduls "module" (DAC_WAVE_ARBITRARY). Die Frequenz ist Abtastrate / Anzahl der
+///					Punkte. Luft der Signalgenerator, wird er wie bei "DacWaveSet()" angehalten und
+///					neu gestartet, alle Module bleiben zueinander phasensynchron. Die Funktion gibt
+///					"false" zurck, falls die Parameter ungltig sind oder "DacWaveInit()" nicht
+///					aufgerufen wurde.
+///
+/// @param  uint16_t module, const uint16_t *table, uint16_t numberOfPoints
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool DacWaveLoadTable(uint16_t module,
+											const uint16_t *table,
+											uint16_t numberOfPoints)
+{
+		if (   (module >= DAC_NUMBER_OF_MODULES)
+				|| (table == 0)
+				|| (numberOfPoints < DAC_MIN_POINTS)
+				|| (numberOfPoints > DAC_SIZE_TABLE)
+				|| !dacSampleRate)
+		{
+				return false;
+		}
+
+		// Signalgenerator anhalten, damit keine halb kopierte Tabelle ausgegeben wird
+		uint16_t running = dacWaveRunning;
+		DacWaveStop();
+
+		for (uint16_t i = 0; i < numberOfPoints; i++)
+		{
+				dacWaveTables[module][i] = (table[i] > DAC_VALUE_MAX) ? DAC_VALUE_MAX : table[i];
+		}
+
+		dacWaves[module].numberOfPoints = numberOfPoints;
+		dacWaves[module].amplitude      = 0;
+		dacWaves[module].offset         = 0;
+		dacWaves[module].frequency      = (float)dacSampleRate / (float)numberOfPoints;
+		dacWaves[module].shape          = DAC_WAVE_ARBITRARY;
+		if (running)
+		{
+				DacWaveStart();
+		}
+		else
+		{
+				DacWaveApply(module);
+		}
+		return true;
+}
+
+
+//=== Function: DacWaveStart ======================================================================
+///
+/// @brief	Funktion startet die DMA-Kanle aller eingestellten Module und anschlieend die
+///					Taktquelle. Da alle Kanle vom selben Takt getriggert werden und gemeinsam am Anfang
+///					ihrer Tabelle beginnen, sind die Signale zueinander phasensynchron.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DacWaveStart(void)
+{
+		if (!dacSampleRate)
+		{
+				return;
+		}
+		dacWaveRunning = 1;
+		for (uint16_t i = 0; i < DAC_NUMBER_OF_MODULES; i++)
+		{
+				DacWaveApply(i);
+		}
+
+		EALLOW;
+		if (dacPacing == DAC_PACING_EPWM)
+		{
+				// Zhler zurcksetzen und hochzhlen
+				EPwm1Regs.TBCTR = 0;
+				EPwm1Regs.TBCTL.bit.CTRMODE = 0;
+		}
+		else
+		{
+				// Zhler neu laden und starten
+				CpuTimer1Regs.TCR.bit.TRB = 1;
+				CpuTimer1Regs.TCR.bit.TSS = 0;
+		}
+		EDIS;
+}
+
+
+//=== Function: DacWaveStop =======================================================================
+///
+/// @brief	Funktion hlt die Taktquelle und alle DMA-Kanle des Signalgenerators an. Die DACs
+///					behalten den zuletzt ausgegebenen Wert.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void DacWaveStop(void)
+{
+		EALLOW;
+		if (dacSampleRate)
+		{
+				if (dacPacing == DAC_PACING_EPWM)
+				{
+						EPwm1Regs.TBCTL.bit.CTRMODE = 3;
+				}
+				else
+				{
+						CpuTimer1Regs.TCR.bit.TSS = 1;
+				}
+		}
+		for (uint16_t i = 0; i < DAC_NUMBER_OF_MODULES; i++)
+		{
+				dacDmaChannels[i]->CONTROL.bit.HALT = 1;
+		}
+		EDIS;
+		dacWaveRunning = 0;
+}
+
+
+//=== Function: DacWaveApply ======================================================================
+///
+/// @brief	Funktion hlt den DMA-Kanal des Moduls "module" an und startet ihn mit der aktuellen
+///					Tabelle neu, falls der Signalgenerator luft und eine Signalform eingestellt ist. Bei
+///					Taktung durch das ePWM1-Modul wird der DAC-Wert synchron zum ePWM1-Sync bernommen.
+///					Wird der Kanal bei laufender Taktquelle neu gestartet, beginnt er unabhngig von den
+///					brigen Kanlen am Anfang seiner Tabelle (keine Phasensynchronitt, siehe
+///					"DacWaveStart()").
+///
+/// @param  uint16_t module
+///
+/// @return void
+///
+//=================================================================================================
+void DacWaveApply(uint16_t module)
+{
+		volatile struct CH_REGS *channel = dacDmaChannels[module];
+
+		EALLOW;
+		// Kanal anhalten und zurcksetzen
+		channel->CONTROL.bit.HALT      = 1;
+		channel->CONTROL.bit.SOFTRESET = 1;
+		__asm(" NOP");
+		// bernahme des DAC-Werts: synchron zum ePWM1-Sync (Signalgenerator mit ePWM-Takt)
+		// oder mit dem nchsten SYSCLK (Signalgenerator mit CPU-Timer, Modul ohne Signal)
+		if (   (dacPacing == DAC_PACING_EPWM)
+				&& (dacWaves[module].shape != DAC_WAVE_OFF))
+		{
+				dacRegs[module]->DACCTL.bit.LOADMODE = DAC_SYNC_EPWM;
+		}
+		else
+		{
+				dacRegs[module]->DACCTL.bit.LOADMODE = DAC_SYNC_SYSCLK;
+		}
+
+		if (   dacWaveRunning
+				&& (dacWaves[module].shape != DAC_WAVE_OFF))
+		{
+				// Ein Wert pro Trigger, eine bertragung = eine Periode (Anzahl - 1)
+				channel->TRANSFER_SIZE = dacWaves[module].numberOfPoints - 1;
+				channel->SRC_BEG_ADDR_SHADOW = (uint32_t)&dacWaveTables[module][0];
+				channel->SRC_ADDR_SHADOW     = (uint32_t)&dacWaveTables[module][0];
+				// Gespeicherte Trigger verwerfen und Kanal starten
+				// (Adressen werden aus den Shadow-Registern bernommen)
+				channel->CONTROL.bit.PERINTCLR = 1;
+				channel->CONTROL.bit.ERRCLR    = 1;
+				channel->CONTROL.bit.RUN       = 1;
+		}
+		EDIS;
 }
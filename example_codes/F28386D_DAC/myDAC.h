@@ -6,9 +6,19 @@
 ///							der Module B und C ist analog zu der des Moduls A. Die Referenzspannung ist
 ///							VREFHI und die DAC-Spannung wird an Pin ADCINA0/DACOUTA ausgegeben.
 ///
-/// @version    V1.1
+///							nderung in Version 2.0: Initialisierung der Module A, B und C ("DacInit()") und
+///							Signalgenerator. Die Module geben periodisch eine Tabelle (Sinus, Dreieck, Rampe
+///							oder beliebige Werte) aus. Die Werte werden von je einem DMA-Kanal pro Modul in das
+///							Register DACVALS kopiert, ohne dass die CPU beteiligt ist. Den Takt gibt entweder
+///							das ePWM1-Modul (SOCA bei TBCTR = 0, alle Module bernehmen den Wert gleichzeitig
+///							beim ePWM1-Sync) oder der CPU-Timer 1 vor. Frequenz, Amplitude und Offset sind je
+///							Modul einstellbar. Die Frequenz ergibt sich aus Abtastrate / Anzahl der Punkte,
+///							sie wird daher auf die nchste darstellbare Frequenz gerundet.
+///							DAC-A: Pin ADCINA0/DACOUTA, DAC-B: Pin ADCINA1/DACOUTB, DAC-C: Pin ADCINB1/DACOUTC
 ///
-/// @date       13.01.2023
+/// @version    V2.0
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -18,6 +28,7 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include <math.h>
 
 
 //-------------------------------------------------------------------------------------------------
@@ -49,6 +60,35 @@
 // Ausgang
 #define DAC_DISABLE_OUTPUT				0
 #define DAC_ENABLE_OUTPUT					1
+// DAC-Module
+#define DAC_MODULE_A							0
+#define DAC_MODULE_B							1
+#define DAC_MODULE_C							2
+#define DAC_NUMBER_OF_MODULES			3
+// Grter DAC-Wert (12 Bit)
+#define DAC_VALUE_MAX							4095
+// Signalformen des Signalgenerators
+#define DAC_WAVE_OFF							0
+#define DAC_WAVE_SINE							1
+#define DAC_WAVE_TRIANGLE					2
+#define DAC_WAVE_RAMP							3
+#define DAC_WAVE_ARBITRARY				4
+// Taktquelle des Signalgenerators
+#define DAC_PACING_EPWM						0
+#define DAC_PACING_TIMER					1
+// Max. Anzahl der Punkte pro Periode (Gre der Tabelle je Modul) und min. Anzahl
+#define DAC_SIZE_TABLE						512
+#define DAC_MIN_POINTS						4
+// Grenzen der Abtastrate in Hz (die Einschwingzeit des DAC betrgt ca. 2 us, siehe
+// "Settling Time" Data Sheet TMS320F2838x, SPRSP14D, Rev. D, Feb. 2021)
+#define DAC_SAMPLE_RATE_MIN				1600
+#define DAC_SAMPLE_RATE_MAX				500000
+// Takt des ePWM-Moduls (EPWMCLK = SYSCLK / 2) und des CPU-Timers (SYSCLK) in Hz
+#define DAC_EPWM_CLOCK						100000000UL
+#define DAC_TIMER_CLOCK						200000000UL
+// DMA-Trigger (siehe Tabelle "DMA Trigger Source Options", Reference Manual TMS320F2838x)
+#define DAC_DMA_TRIGGER_EPWM1SOCA	36
+#define DAC_DMA_TRIGGER_TINT1			69
 
 
 //-------------------------------------------------------------------------------------------------
@@ -56,9 +96,31 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Einstellungen des Signalgenerators je Modul
+typedef struct
+{
+		// Signalform (DAC_WAVE_...)
+		uint16_t shape;
+		// Anzahl der Punkte pro Periode (Lnge der Tabelle)
+		uint16_t numberOfPoints;
+		// Amplitude (Scheitelwert) und Offset in DAC-Werten
+		uint16_t amplitude;
+		uint16_t offset;
+		// Tatschlich ausgegebene Frequenz in Hz (Abtastrate / Anzahl der Punkte)
+		float frequency;
+} DacWave;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Einstellungen des Signalgenerators je Modul
+extern DacWave dacWaves[DAC_NUMBER_OF_MODULES];
+// Abtastrate des Signalgenerators in Hz
+extern uint32_t dacSampleRate;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -66,6 +128,27 @@
 //-------------------------------------------------------------------------------------------------
 // Funktion initialisiert den DAC-A Modul
 extern void DacAInit(void);
+// Funktion initialisiert ein DAC-Modul (A, B oder C)
+extern bool DacInit(uint16_t module);
+// Funktion initialisiert die Taktquelle und die DMA-Kanle des Signalgenerators
+extern bool DacWaveInit(uint16_t pacing,
+												uint32_t sampleRate);
+// Funktion berechnet die Tabelle einer Signalform fr ein Modul
+extern bool DacWaveSet(uint16_t module,
+											 uint16_t shape,
+											 float frequency,
+											 uint16_t amplitude,
+											 uint16_t offset);
+// Funktion bernimmt eine beliebige Tabelle fr ein Modul
+extern bool DacWaveLoadTable(uint16_t module,
+														 const uint16_t *table,
+														 uint16_t numberOfPoints);
+// Funktion startet die Ausgabe aller eingestellten Module
+extern void DacWaveStart(void);
+// Funktion hlt die Ausgabe aller Module an
+extern void DacWaveStop(void);
+// Funktion bertrgt die Einstellungen eines Moduls auf DAC und DMA-Kanal
+extern void DacWaveApply(uint16_t module);
 
 
 #endif
@@ -4,9 +4,22 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 2.0: DMA-Modus (AD5664_USE_DMA). Die Datenworte werden von
+///							zwei DMA-Kanlen, die durch die FIFO-Ereignisse des SPI-D-Moduls getriggert
+///							werden, in den Sende-FIFO bzw. aus dem Empfangs-FIFO kopiert. Pro bertragung
+///							wird nur ein Interrupt (Ende des Empfangs-Kanals) ausgelst
+///							nderung in Version 3.0: 12-Bit Datenlnge (ein DAC-Befehl = 2 statt 3 Worte)
+///							und bertragung aller vier Kanle mit einem Aufruf ("AD5664SetChannels()")
+///							nderung in Version 4.0: "AD5664SetChannels()" blockiert nicht mehr. Ist noch eine
+///							bertragung aktiv, wird der Werte-Satz gespeichert und am Ende der bertragung aus
+///							der ISR gesendet (ein noch nicht gesendeter Satz wird durch den neuesten ersetzt).
+///							Optional werden alle Ausgnge gleichzeitig aktualisiert (AD5664_SIMULTANEOUS_UPDATE)
+///							nderung in Version 4.1: "AD5664SetChannels()" kann auch aus einer ISR aufgerufen
+///							werden (z.B. von der Signal-Sonde "myProbe.c")
 ///
-/// @date       13.02.2023
+/// @version    V4.1
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -21,6 +34,22 @@
 //-------------------------------------------------------------------------------------------------
 // Flag speichert den aktuellen Zustand der SPI-Kommunikation  (bereit/Kommunikation aktiv)
 uint32_t ad5664StatusFlag = AD5664_STATUS_IN_PROGRESS;
+// Sende- und Empfangspuffer (ein DAC-Befehl = AD5664_WORDS_PER_FRAME Worte). Der DMA
+// hat nur Zugriff auf die GSx-RAMs, daher liegen die Puffer in der Sektion "SPIDMA"
+// (siehe .cmd-Datei)
+#pragma DATA_SECTION(ad5664BufferTx, "SPIDMA");
+uint16_t ad5664BufferTx[AD5664_SIZE_BUFFER];
+#pragma DATA_SECTION(ad5664BufferRx, "SPIDMA");
+uint16_t ad5664BufferRx[AD5664_SIZE_BUFFER];
+// Anzahl der DAC-Befehle der aktuellen bertragung und Index des nchsten Befehls
+// (Index nur ohne DMA, die ISR schreibt die Befehle nacheinander in den FIFO)
+uint16_t ad5664NumberOfFrames = 0;
+uint16_t ad5664FrameIndex = 0;
+// Werte-Satz, der am Ende der aktiven bertragung gesendet wird, und Flag, ob ein Satz wartet
+uint16_t ad5664PendingValues[AD5664_NUMBER_OF_CHANNELS];
+uint16_t ad5664PendingFlag = 0;
+// Anzahl der vollstndig gesendeten Werte-Stze (z.B. zur Messung der Update-Rate)
+volatile uint32_t ad5664NumberOfSets = 0;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -94,8 +123,8 @@ void AD5664Init(uint32_t clock)
     SpidRegs.SPICCR.bit.CLKPOLARITY = 0;
     // Phase = 0 (Daten bei der ersten (mit POL = 0 also einer steigenden) Flanke bernehmen)
     SpidRegs.SPICTL.bit.CLK_PHASE = 0;
-    // 8-Bit Datenlnge
-    SpidRegs.SPICCR.bit.SPICHAR = 7;
+    // 12-Bit Datenlnge (ein 24-Bit DAC-Befehl = 2 Worte)
+    SpidRegs.SPICCR.bit.SPICHAR = AD5664_WORD_LENGTH - 1;
     // Master-Mode setzen
     SpidRegs.SPICTL.bit.MASTER_SLAVE = 1;
     // bertragung aktivieren
@@ -108,10 +137,15 @@ void AD5664Init(uint32_t clock)
     SpidRegs.SPIFFTX.bit.TXFIFO = 0;
     // FIFO-Modus einschalten
     SpidRegs.SPIFFTX.bit.SPIFFENA = 1;
+#if AD5664_USE_DMA
+    // RX-FIFO Interrupt ausschalten (das Ende der bertragung meldet der DMA)
+    SpidRegs.SPIFFRX.bit.RXFFIENA = 0;
+#else
     // RX-FIFO Interrupt einschalten
     SpidRegs.SPIFFRX.bit.RXFFIENA = 1;
-    // Interrupt auslsen, wenn 3 Bytes empfangen wurden
-    SpidRegs.SPIFFRX.bit.RXFFIL = 3;
+#endif
+    // Interrupt bzw. DMA-Trigger auslsen, wenn ein DAC-Befehl (2 Worte) empfangen wurde
+    SpidRegs.SPIFFRX.bit.RXFFIL = AD5664_WORDS_PER_FRAME;
     // RX-FIFO Interupt-Flag lschen
     SpidRegs.SPIFFRX.bit.RXFFINTCLR = 1;
     // FIFO-Reset aufheben
@@ -132,6 +166,11 @@ void AD5664Init(uint32_t clock)
     // CPU-Interrupts nach Konfiguration global wieder freigeben
     EINT;
 
+#if AD5664_USE_DMA
+    // DMA-Kanle initialisieren
+    AD5664InitDma();
+#endif
+
     // Status auf "bereit" setzen
     ad5664StatusFlag = AD5664_STATUS_IDLE;
 
@@ -143,7 +182,8 @@ void AD5664Init(uint32_t clock)
 //=== Function: AD566SetChannel ===================================================================
 ///
 /// @brief  Funktion setzt den Wert fr einen Kanal (A, B, C oder D) des DAC.
-///					Der Wert wird vom DAC anschlieend direkt bernommen
+///					Der Wert wird vom DAC anschlieend direkt bernommen. Die Funktion darf nur
+///					aufgerufen werden, wenn keine bertragung aktiv ist (Status "bereit")
 ///
 /// @param  uint16_t channel, uint16_t value
 ///
@@ -152,31 +192,155 @@ void AD5664Init(uint32_t clock)
 //=================================================================================================
 void AD566SetChannel(uint16_t channel,
 										 uint16_t value)
+{
+		// Befehl in den Sendepuffer schreiben (neuen DAC-Wert sofort setzen)
+		ad5664BufferTx[0] = AD5664_FRAME_HIGH(AD5664_WRITE_REG_SET_DAC | channel, value);
+		ad5664BufferTx[1] = AD5664_FRAME_LOW(value);
+		AD5664StartTransfer(1);
+}
+
+
+//=== Function: AD5664SetChannels =================================================================
+///
+/// @brief  Funktion bergibt die Werte aller vier Kanle (A, B, C und D, "values[0]" ...
+///					"values[3]") und kehrt sofort zurck. Ist keine bertragung aktiv, wird der Satz
+///					direkt gesendet. Andernfalls wird er gespeichert und am Ende der aktiven bertragung
+///					aus der ISR gesendet. Ein gespeicherter, noch nicht gesendeter Satz wird dabei durch
+///					den neuen Satz ersetzt, es wird also immer der aktuellste Satz ausgegeben. Die vier
+///					Befehle (je 2 Worte) werden nacheinander gesendet, zwischen den Befehlen geht die
+///					SS-Leitung kurz auf high (notwendig, damit der DAC den nchsten Befehl annimmt). Das
+///					Ende eines Satzes wird ber "ad5664NumberOfSets" gemeldet. Die Funktion kann aus dem
+///					Hauptprogramm und aus einer ISR aufgerufen werden.
+///
+/// @param  const uint16_t *values
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664SetChannels(const uint16_t *values)
+{
+		// CPU-Interrupts sperren, damit die ISR nicht gleichzeitig auf den Satz zugreift. Der
+		// vorherige Zustand wird gespeichert, damit die Funktion auch aus einer ISR aufgerufen
+		// werden kann, ohne dort die Interrupts wieder freizugeben
+		uint16_t interruptState = __disable_interrupts();
+		for (uint16_t i = 0; i < AD5664_NUMBER_OF_CHANNELS; i++)
+		{
+				ad5664PendingValues[i] = values[i];
+		}
+		ad5664PendingFlag = 1;
+		// Keine bertragung aktiv, Satz direkt senden
+		if (ad5664StatusFlag == AD5664_STATUS_IDLE)
+		{
+				AD5664StartSet();
+		}
+		__restore_interrupts(interruptState);
+}
+
+
+//=== Function: AD5664StartSet ====================================================================
+///
+/// @brief  Funktion schreibt den gespeicherten Werte-Satz in den Sendepuffer und startet die
+///					bertragung. Mit AD5664_SIMULTANEOUS_UPDATE = 1 werden die Kanle A bis C nur in
+///					die Eingangsregister geschrieben und der Befehl fr Kanal D aktualisiert alle vier
+///					Ausgnge gleichzeitig. Ansonsten wird jeder Ausgang direkt aktualisiert. Die
+///					Funktion wird aus "AD5664SetChannels()" (bei gesperrten Interrupts) und aus den
+///					ISRs aufgerufen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664StartSet(void)
+{
+		uint16_t command;
+
+		for (uint16_t i = 0; i < AD5664_NUMBER_OF_CHANNELS; i++)
+		{
+#if AD5664_SIMULTANEOUS_UPDATE
+				command = (i == AD5664_CHANNEL_D) ? AD5664_WRITE_REG_SET_ALL : AD5664_WRITE_REG;
+#else
+				command = AD5664_WRITE_REG_SET_DAC;
+#endif
+				ad5664BufferTx[2*i]     = AD5664_FRAME_HIGH(command | i, ad5664PendingValues[i]);
+				ad5664BufferTx[2*i + 1] = AD5664_FRAME_LOW(ad5664PendingValues[i]);
+		}
+		ad5664PendingFlag = 0;
+		AD5664StartTransfer(AD5664_NUMBER_OF_CHANNELS);
+}
+
+
+//=== Function: AD5664FinishTransfer ==============================================================
+///
+/// @brief  Funktion wird aus den ISRs am Ende einer bertragung aufgerufen. Wartet ein
+///					Werte-Satz, wird dieser direkt gesendet, ansonsten wird der Status auf "bereit"
+///					gesetzt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664FinishTransfer(void)
+{
+		// Nur vollstndige Stze zhlen (nicht die Einzelbefehle von "AD566SetChannel()")
+		if (ad5664NumberOfFrames == AD5664_NUMBER_OF_CHANNELS)
+		{
+				ad5664NumberOfSets++;
+		}
+		if (ad5664PendingFlag)
+		{
+				AD5664StartSet();
+		}
+		else
+		{
+				ad5664StatusFlag = AD5664_STATUS_IDLE;
+		}
+}
+
+
+//=== Function: AD5664StartTransfer ===============================================================
+///
+/// @brief  Funktion sendet die ersten "numberOfFrames" DAC-Befehle aus "ad5664BufferTx[]". Im
+///					DMA-Modus bernehmen die DMA-Kanle die bertragung, ansonsten wird der erste Befehl
+///					in den FIFO geschrieben und die weiteren Befehle jeweils aus der ISR gesendet. Die
+///					Befehle werden nicht gemeinsam in den FIFO geschrieben, da die SS-Leitung sonst
+///					zwischen den Befehlen nicht auf high geht.
+///
+/// @param  uint16_t numberOfFrames
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664StartTransfer(uint16_t numberOfFrames)
 {
 		// Flag setzen um der aufrufenden Stelle zu signalisieren,
 		// dass eine SPI-Kommunikation gestartet wurde
-		ad5664StatusFlag = AD5664_STATUS_IN_PROGRESS;
-		// Daten in den SPI-Hardware-Puffer kopieren (16 Byte, Daten mssen links-bnig sein,
-		// siehe S. 3904 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
-		// Steuer-Byte (neuen DAC-Wert sofort setzen)
-		SpidRegs.SPITXBUF = ( (AD5664_WRITE_REG_SET_DAC | channel) << 8 );
-		// Daten MSB
-		SpidRegs.SPITXBUF = ( ((value >> 8) & 0xFF) << 8 );
-		// Daten LSB
-		SpidRegs.SPITXBUF = ( (value & 0xFF) << 8 );
+		ad5664StatusFlag     = AD5664_STATUS_IN_PROGRESS;
+		ad5664NumberOfFrames = numberOfFrames;
+#if AD5664_USE_DMA
+		AD5664StartDma(numberOfFrames);
+#else
+		ad5664FrameIndex     = 1;
+		// Daten in den SPI-Hardware-Puffer kopieren (Daten mssen links-bnig sein,
+		// siehe S. 3904 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		SpidRegs.SPITXBUF = ad5664BufferTx[0];
+		SpidRegs.SPITXBUF = ad5664BufferTx[1];
+#endif
 }
 
 
 //=== Function: AD5664SpiISR ======================================================================
 ///
-/// @brief	Funktion wird aufgerufen, sobald drei Bytes ber SPI empfangen wurde. Fr den Betrieb
-///					des Hardware-Monitors werden die Daten ber SPI zwar nur gesendet, aber die Konfigu-
-///					ration des Sende-Interrupts ist komplizierter als die des Emfangs-Interrupts. Zudem
-///					wird der Sende-Interrupt ausgelst, sobal der TX-Puffer leer ist. Zu diesem Zeitpunkt
-///					befindet sich das letzte zu sendene Byte jedoch noch im Ausgangsregister. Der Interrupt
-///					kommt also zu frh. Aus diesem Grund und weil beim Senden auch automatisch Daten
-///					empfangen werden, wurde hier die Kommunikation mithilfe des Empfangs-Interrupts umge-
-///					setzt.
+/// @brief	Funktion wird aufgerufen, sobald ein DAC-Befehl (2 Worte) ber SPI empfangen wurde
+///					(nur ohne DMA). Fr den Betrieb des Hardware-Monitors werden die Daten ber SPI zwar
+///					nur gesendet, aber die Konfiguration des Sende-Interrupts ist komplizierter als die
+///					des Emfangs-Interrupts. Zudem wird der Sende-Interrupt ausgelst, sobal der TX-Puffer
+///					leer ist. Zu diesem Zeitpunkt befindet sich das letzte zu sendene Wort jedoch noch im
+///					Ausgangsregister. Der Interrupt kommt also zu frh. Aus diesem Grund und weil beim
+///					Senden auch automatisch Daten empfangen werden, wurde hier die Kommunikation mithilfe
+///					des Empfangs-Interrupts umgesetzt. Sind noch Befehle brig, wird der nchste Befehl
+///					gesendet.
 ///
 /// @param  void
 ///
@@ -194,15 +358,188 @@ __interrupt void AD5664SpiISR(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Status auf "bereit" setzen
-		ad5664StatusFlag = AD5664_STATUS_IDLE;
-		// Empfangene Bytes auslesen
+		// Empfangene Worte auslesen
 		uint16_t dummy = SpidRegs.SPIRXBUF;
 		dummy = SpidRegs.SPIRXBUF;
-		dummy = SpidRegs.SPIRXBUF;
+
+		// Nchsten Befehl senden oder bertragung abschlieen
+		if (ad5664FrameIndex < ad5664NumberOfFrames)
+		{
+				SpidRegs.SPITXBUF = ad5664BufferTx[2*ad5664FrameIndex];
+				SpidRegs.SPITXBUF = ad5664BufferTx[2*ad5664FrameIndex + 1];
+				ad5664FrameIndex++;
+		}
+		else
+		{
+				AD5664FinishTransfer();
+		}
 
     // RX-FIFO Interupt-Flag lschen
     SpidRegs.SPIFFRX.bit.RXFFINTCLR = 1;
 		// Interrupt-Flag der Gruppe 6 lschen (da gehrt der SPI-Interrupt zu)
     PieCtrlRegs.PIEACK.bit.ACK6 = 1;
 }
+
+
+//=== Function: AD5664InitDma =====================================================================
+///
+/// @brief  Funktion initialisiert die DMA-Kanle AD5664_DMA_CHANNEL_TX (Sendepuffer ->
+///					SPITXBUF) und AD5664_DMA_CHANNEL_RX (SPIRXBUF -> Empfangspuffer). Beide Kanle
+///					werden durch das Empfangs-Ereignis SPIRXDMA des SPI-D-Moduls getriggert, das
+///					ausgelst wird, sobald ein DAC-Befehl (2 Worte) vollstndig gesendet/empfangen
+///					wurde. Pro Trigger kopiert der Empfangs-Kanal die beiden empfangenen Worte und der
+///					Sende-Kanal schreibt den nchsten Befehl in den FIFO. Da der FIFO zwischen zwei
+///					Befehlen leer ist, geht die SS-Leitung wie vom DAC gefordert kurz auf high. Nur der
+///					Empfangs-Kanal lst am Ende der bertragung einen Interrupt aus.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664InitDma(void)
+{
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Zugriff auf das Peripheral Frame 2 (SPI) dem DMA statt dem CLA zuweisen
+		CpuSysRegs.SECMSEL.bit.PF2SEL = 1;
+		// Takt fr den DMA einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		// DMA zurcksetzen und auch bei angehaltener CPU (Debugger) weiterlaufen lassen
+		DmaRegs.DMACTRL.bit.HARDRESET = 1;
+		__asm(" NOP");
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// Sende-Kanal: Trigger durch SPIRXDMA (vorheriger Befehl abgeschlossen),
+		// der erste Befehl wird per Software-Trigger gestartet
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH1 = AD5664_DMA_TRIGGER_SPIDRX;
+		DmaRegs.CH1.MODE.bit.PERINTSEL  = AD5664_DMA_CHANNEL_TX;
+		DmaRegs.CH1.MODE.bit.PERINTE    = 1;
+		DmaRegs.CH1.MODE.bit.ONESHOT    = 0;
+		DmaRegs.CH1.MODE.bit.CONTINUOUS = 0;
+		DmaRegs.CH1.MODE.bit.DATASIZE   = 0;
+		DmaRegs.CH1.MODE.bit.OVRINTE    = 0;
+		DmaRegs.CH1.MODE.bit.CHINTE     = 0;
+		// Ein Burst = ein DAC-Befehl
+		DmaRegs.CH1.BURST_SIZE.bit.BURSTSIZE = AD5664_WORDS_PER_FRAME - 1;
+		// Quelle: Sendepuffer (fortlaufend), Ziel: SPITXBUF (fest)
+		DmaRegs.CH1.SRC_BURST_STEP    = 1;
+		DmaRegs.CH1.SRC_TRANSFER_STEP = 1;
+		DmaRegs.CH1.DST_BURST_STEP    = 0;
+		DmaRegs.CH1.DST_TRANSFER_STEP = 0;
+		DmaRegs.CH1.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.SRC_WRAP_STEP = 0;
+		DmaRegs.CH1.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH1.DST_WRAP_STEP = 0;
+		DmaRegs.CH1.SRC_BEG_ADDR_SHADOW = (uint32_t)&ad5664BufferTx[0];
+		DmaRegs.CH1.SRC_ADDR_SHADOW     = (uint32_t)&ad5664BufferTx[0];
+		DmaRegs.CH1.DST_BEG_ADDR_SHADOW = (uint32_t)&SpidRegs.SPITXBUF;
+		DmaRegs.CH1.DST_ADDR_SHADOW     = (uint32_t)&SpidRegs.SPITXBUF;
+
+		// Empfangs-Kanal: Trigger durch SPIRXDMA (RXFFST >= RXFFIL)
+		DmaClaSrcSelRegs.DMACHSRCSEL1.bit.CH2 = AD5664_DMA_TRIGGER_SPIDRX;
+		DmaRegs.CH2.MODE.bit.PERINTSEL  = AD5664_DMA_CHANNEL_RX;
+		DmaRegs.CH2.MODE.bit.PERINTE    = 1;
+		DmaRegs.CH2.MODE.bit.ONESHOT    = 0;
+		DmaRegs.CH2.MODE.bit.CONTINUOUS = 0;
+		DmaRegs.CH2.MODE.bit.DATASIZE   = 0;
+		DmaRegs.CH2.MODE.bit.OVRINTE    = 0;
+		// Interrupt am Ende der bertragung
+		DmaRegs.CH2.MODE.bit.CHINTMODE  = 1;
+		DmaRegs.CH2.MODE.bit.CHINTE     = 1;
+		DmaRegs.CH2.BURST_SIZE.bit.BURSTSIZE = AD5664_WORDS_PER_FRAME - 1;
+		// Quelle: SPIRXBUF (fest), Ziel: Empfangspuffer (fortlaufend)
+		DmaRegs.CH2.SRC_BURST_STEP    = 0;
+		DmaRegs.CH2.SRC_TRANSFER_STEP = 0;
+		DmaRegs.CH2.DST_BURST_STEP    = 1;
+		DmaRegs.CH2.DST_TRANSFER_STEP = 1;
+		DmaRegs.CH2.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH2.SRC_WRAP_STEP = 0;
+		DmaRegs.CH2.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH2.DST_WRAP_STEP = 0;
+		DmaRegs.CH2.SRC_BEG_ADDR_SHADOW = (uint32_t)&SpidRegs.SPIRXBUF;
+		DmaRegs.CH2.SRC_ADDR_SHADOW     = (uint32_t)&SpidRegs.SPIRXBUF;
+		DmaRegs.CH2.DST_BEG_ADDR_SHADOW = (uint32_t)&ad5664BufferRx[0];
+		DmaRegs.CH2.DST_ADDR_SHADOW     = (uint32_t)&ad5664BufferRx[0];
+
+		// CPU-Interrupts whrend der Konfiguration global sperren
+		DINT;
+		// ISR fr das Ende des Empfangs-Kanals in der PIE-Vector Table speichern
+		PieVectTable.DMA_CH2_INT = &AD5664DmaISR;
+		// DMA_CH2-Interrupt freischalten (Zeile 7, Spalte 2 der Tabelle 3-2)
+		PieCtrlRegs.PIEIER7.bit.INTx2 = 1;
+		// CPU-Interrupt 7 einschalten
+		IER |= M_INT7;
+		// CPU-Interrupts nach Konfiguration global wieder freigeben
+		EINT;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: AD5664StartDma ====================================================================
+///
+/// @brief  Funktion bertrgt die ersten "numberOfFrames" DAC-Befehle aus "ad5664BufferTx[]"
+///					per DMA. Der erste Befehl wird per Software-Trigger in den FIFO geschrieben, jeder
+///					weitere Befehl wird durch das Ende des vorherigen Befehls getriggert. Die Funktion
+///					gibt "false" zurck, falls die Anzahl ungltig ist.
+///
+/// @param  uint16_t numberOfFrames
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool AD5664StartDma(uint16_t numberOfFrames)
+{
+		if (   !numberOfFrames
+				|| (numberOfFrames > AD5664_NUMBER_OF_CHANNELS))
+		{
+				return false;
+		}
+
+		EALLOW;
+		// Empfangs-FIFO leeren, damit keine alten Daten einen Trigger auslsen
+		SpidRegs.SPIFFRX.bit.RXFIFORESET = 0;
+		SpidRegs.SPIFFRX.bit.RXFFOVFCLR  = 1;
+		SpidRegs.SPIFFRX.bit.RXFFINTCLR  = 1;
+		SpidRegs.SPIFFRX.bit.RXFIFORESET = 1;
+		// Ein Burst pro Befehl (Anzahl - 1)
+		DmaRegs.CH1.TRANSFER_SIZE = numberOfFrames - 1;
+		DmaRegs.CH2.TRANSFER_SIZE = numberOfFrames - 1;
+		// Gespeicherte Trigger der vorherigen bertragung verwerfen
+		// (der letzte Befehl triggert den Sende-Kanal ein weiteres Mal)
+		DmaRegs.CH1.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH1.CONTROL.bit.ERRCLR    = 1;
+		DmaRegs.CH2.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH2.CONTROL.bit.ERRCLR    = 1;
+		// Kanle starten (Adressen werden aus den Shadow-Registern bernommen)
+		DmaRegs.CH2.CONTROL.bit.RUN = 1;
+		DmaRegs.CH1.CONTROL.bit.RUN = 1;
+		// Ersten Befehl per Software-Trigger senden
+		DmaRegs.CH1.CONTROL.bit.PERINTFRC = 1;
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: AD5664DmaISR ======================================================================
+///
+/// @brief	Funktion wird aufgerufen, sobald der Empfangs-Kanal alle Befehle kopiert hat. Die
+///					bertragung ist damit abgeschlossen, ein wartender Werte-Satz wird direkt gesendet.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void AD5664DmaISR(void)
+{
+		// bertragung abschlieen (nchsten Satz senden oder Status auf "bereit" setzen)
+		AD5664FinishTransfer();
+		// Interrupt-Flag der Gruppe 7 lschen (da gehren die DMA-Interrupts zu)
+		PieCtrlRegs.PIEACK.bit.ACK7 = 1;
+}
@@ -4,9 +4,22 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 2.0: DMA-Modus (AD5664_USE_DMA). Die Datenworte werden von
+///							zwei DMA-Kanlen, die durch die FIFO-Ereignisse des SPI-D-Moduls getriggert
+///							werden, in den Sende-FIFO bzw. aus dem Empfangs-FIFO kopiert. Pro bertragung
+///							wird nur ein Interrupt (Ende des Empfangs-Kanals) ausgelst
+///							nderung in Version 3.0: 12-Bit Datenlnge (ein DAC-Befehl = 2 statt 3 Worte)
+///							und bertragung aller vier Kanle mit einem Aufruf ("AD5664SetChannels()")
+///							nderung in Version 4.0: "AD5664SetChannels()" blockiert nicht mehr. Ist noch eine
+///							bertragung aktiv, wird der Werte-Satz gespeichert und am Ende der bertragung aus
+///							der ISR gesendet (ein noch nicht gesendeter Satz wird durch den neuesten ersetzt).
+///							Optional werden alle Ausgnge gleichzeitig aktualisiert (AD5664_SIMULTANEOUS_UPDATE)
+///							nderung in Version 4.1: "AD5664SetChannels()" kann auch aus einer ISR aufgerufen
+///							werden (z.B. von der Signal-Sonde "myProbe.c")
 ///
-/// @date       13.02.2023
+/// @version    V4.1
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -33,6 +46,26 @@
 // Betriebszustnde der SPI-Kommunikation
 #define AD5664_STATUS_IDLE							0
 #define AD5664_STATUS_IN_PROGRESS				1
+// DMA-Modus: 1 = Datenworte per DMA bertragen, 0 = Datenworte von der CPU in den FIFO schreiben
+#define AD5664_USE_DMA									1
+// Datenlnge der SPI-Worte in Bit. Ein 24-Bit DAC-Befehl (Steuer-Byte + 16-Bit Wert) wird
+// als 2 Worte zu je 12 Bit bertragen (statt 3 Worte zu je 8 Bit)
+#define AD5664_WORD_LENGTH							12
+// Anzahl der Datenworte pro DAC-Befehl
+#define AD5664_WORDS_PER_FRAME					2
+// Anzahl der Kanle
+#define AD5664_NUMBER_OF_CHANNELS				4
+// Gleichzeitige Aktualisierung: 1 = Kanle A bis C nur in die Eingangsregister schreiben, der
+// Befehl fr Kanal D aktualisiert alle Ausgnge gleichzeitig, 0 = jeden Ausgang direkt setzen
+#define AD5664_SIMULTANEOUS_UPDATE			1
+// Gre der Sende- und Empfangspuffer (ein Befehl pro Kanal, liegen in der Sektion
+// "SPIDMA" im GSx-RAM, siehe .cmd-Datei)
+#define AD5664_SIZE_BUFFER							(AD5664_NUMBER_OF_CHANNELS * AD5664_WORDS_PER_FRAME)
+// Verwendete DMA-Kanle und deren Trigger-Quelle (Register DMACHSRCSELx). Beide Kanle
+// werden durch das Empfangs-Ereignis getriggert (Ende eines DAC-Befehls)
+#define AD5664_DMA_CHANNEL_TX						1
+#define AD5664_DMA_CHANNEL_RX						2
+#define AD5664_DMA_TRIGGER_SPIDRX				116
 
 // DAC-Protokoll:
 // Befehl/Steuerung
@@ -53,6 +86,10 @@
 //-------------------------------------------------------------------------------------------------
 // Macros
 //-------------------------------------------------------------------------------------------------
+// Teilt einen DAC-Befehl (Steuer-Byte "command" + 16-Bit Wert "value") in zwei linksbndige
+// 12-Bit Worte auf: 1. Wort = Steuer-Byte + oberes Nibble des Werts, 2. Wort = untere 12 Bit
+#define AD5664_FRAME_HIGH(command, value)	((uint16_t)((((command) << 4) | ((value) >> 12)) << 4))
+#define AD5664_FRAME_LOW(value)						((uint16_t)(((value) & 0x0FFF) << 4))
 
 
 //-------------------------------------------------------------------------------------------------
@@ -60,6 +97,11 @@
 //-------------------------------------------------------------------------------------------------
 // Flag speichert den aktuellen Zustand der SPI-Kommunikation (bereit/Kommunikation aktiv)
 extern uint32_t ad5664StatusFlag;
+// Sende- und Empfangspuffer (Sendedaten linksbndig)
+extern uint16_t ad5664BufferTx[AD5664_SIZE_BUFFER];
+extern uint16_t ad5664BufferRx[AD5664_SIZE_BUFFER];
+// Anzahl der vollstndig gesendeten Werte-Stze
+extern volatile uint32_t ad5664NumberOfSets;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -70,8 +112,22 @@ extern void AD5664Init(uint32_t clock);
 // Funktion sendet einen Wert fr einen Kanal des DAC
 extern void AD566SetChannel(uint16_t channel,
 														uint16_t value);
+// Funktion bergibt die Werte aller vier Kanle des DAC (blockiert nicht)
+extern void AD5664SetChannels(const uint16_t *values);
+// Funktion schreibt den gespeicherten Werte-Satz in den Sendepuffer und startet die bertragung
+extern void AD5664StartSet(void);
+// Funktion schliet eine bertragung ab und sendet ggf. den nchsten Werte-Satz
+extern void AD5664FinishTransfer(void);
+// Funktion startet die bertragung der Befehle im Sendepuffer
+extern void AD5664StartTransfer(uint16_t numberOfFrames);
 // SPI-Interrupt-Routine zur Kommunikation mit dem DAC
 __interrupt void AD5664SpiISR(void);
+// Funktion initialisiert die DMA-Kanle fr den DMA-Modus
+extern void AD5664InitDma(void);
+// Funktion startet die DMA-bertragung der Befehle im Sendepuffer
+extern bool AD5664StartDma(uint16_t numberOfFrames);
+// DMA-Interrupt-Routine am Ende einer bertragung
+__interrupt void AD5664DmaISR(void);
 
 
 #endif
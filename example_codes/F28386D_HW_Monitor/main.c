@@ -5,9 +5,16 @@
 ///						TMS320F2838x. Das Projekt kann als Grundlage fr neue Programme verwendet werden.
 ///						Es kann direkt auf die Register des Mikrocontrollers zugegriffen werden.
 ///
-/// @version	V1.2
+///						nderung AD5664.c V3.0: Alle vier Kanle werden mit einem Aufruf gesendet
+///						nderung AD5664.c V4.0: Die Hauptschleife wartet nicht mehr auf das Ende der
+///						bertragung
+///						nderung main.c V1.5  : Signal-Sonde ("myProbe.c"). Die Kanle werden in einer
+///						Beispiel-Regel-ISR (ePWM1, 10 kHz) abgetastet, die Zuordnung der Signale erfolgt
+///						zur Laufzeit ber "mainSelection[]" (z.B. im Debugger)
 ///
-/// @date			08.09.2022
+/// @version	V1.5
+///
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -16,25 +23,52 @@
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
 #include "AD5664.h"
+#include "myProbe.h"
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Periodendauer der Regel-ISR: (TBPRD + 1) / EPWMCLK = 10000 / 100 MHz = 100 us (10 kHz)
+#define MAIN_CONTROL_PERIOD								9999
+// Schrittweite des Beispiel-Winkels pro Aufruf der Regel-ISR (50 Hz bei 10 kHz)
+#define MAIN_ANGLE_STEP										(2.0f * 3.14159265f * 50.0f / 10000.0f)
+#define MAIN_ANGLE_MAX										(2.0f * 3.14159265f)
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Funktion initialisiert das ePWM1-Modul als Zeitgeber fr die Regel-ISR
+void MainInitControlTimer(void);
+// Beispiel-Regel-ISR (ePWM1)
+__interrupt void MainControlISR(void);
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-uint16_t dataDacA = 0;
-uint16_t dataDacB = 0;
-uint16_t dataDacC = 0;
-uint16_t dataDacD = 0;
+// Beispiel-Signale, die in der Regel-ISR berechnet werden
+uint32_t controlCounter = 0;
+float controlAngle = 0.0f;
+int16_t controlTriangle = 0;
+int16_t controlTriangleStep = 1;
+// Registrierte Signale (Index = Kennung in "mainSelection[]"):
+// Adresse, Datentyp, Skalierung, Offset (DAC-Wert = Wert * Skalierung + Offset)
+const ProbeSignal mainSignals[] =
+{
+		// 0: Zhler der Regel-ISR (untere 16 Bit laufen ber den ganzen DAC-Bereich)
+		{&controlCounter,  PROBE_TYPE_UINT32_WRAP, 1.0f,                   0.0f},
+		// 1: Winkel 0 ... 2*pi -> 0 ... 65535
+		{&controlAngle,    PROBE_TYPE_FLOAT,  65535.0f / MAIN_ANGLE_MAX,   0.0f},
+		// 2: Dreieck -1000 ... 1000 -> 2767 ... 62767 (0 in der Mitte)
+		{&controlTriangle, PROBE_TYPE_INT16,  30.0f,                       32767.0f},
+		// 3: Anzahl der gesendeten DAC-Werte-Stze (zur Kontrolle der Update-Rate, untere 16 Bit)
+		{(const void *)&ad5664NumberOfSets, PROBE_TYPE_UINT32_WRAP, 1.0f,  0.0f}
+};
+// Zuordnung der Signale zu den Kanlen A bis D (Index in "mainSignals[]", PROBE_NONE: aus).
+// Kann zur Laufzeit z.B. im Debugger oder ber einen seriellen Monitor gendert werden
+uint16_t mainSelection[AD5664_NUMBER_OF_CHANNELS] = {1, 2, PROBE_NONE, PROBE_NONE};
 
 
 //=== Function: main ==============================================================================
@@ -52,6 +86,14 @@ void main(void)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
 		// DAC mit 16 MHz SPI-Clock initialisieren
 		AD5664Init(AD5664_SPI_CLOCK_16MHZ);
+		// Signal-Sonde mit der Tabelle der Signale initialisieren
+		if (!ProbeInit(mainSignals, sizeof(mainSignals) / sizeof(ProbeSignal)))
+		{
+				// Fehlerbehandlung:
+				// ...
+		}
+		// Zeitgeber fr die Regel-ISR initialisieren
+		MainInitControlTimer();
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -60,24 +102,113 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_A,
-												dataDacA);
-
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_B,
-												dataDacB);
+        // Genderte Zuordnung der Signale bernehmen. Die Regel-ISR gibt die Signale
+        // anschlieend ohne Zutun des Hauptprogramms auf dem DAC aus
+        for (uint16_t i = 0; i < AD5664_NUMBER_OF_CHANNELS; i++)
+        {
+        		if (mainSelection[i] != probeSelection[i])
+        		{
+        				if (!ProbeSelect(i, mainSelection[i]))
+        				{
+        						// Ungltige Zuordnung verwerfen
+        						mainSelection[i] = probeSelection[i];
+        				}
+        		}
+        }
+
+        // Weitere Aufgaben des Hauptprogramms
+        // ...
+    }
+}
 
 
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_C,
-												dataDacC);
+//=== Function: MainInitControlTimer ==============================================================
+///
+/// @brief  Funktion initialisiert das ePWM1-Modul, um alle 100 us (10 kHz) einen Interrupt
+///					auszulsen. Die ISR steht stellvertretend fr die Regel-ISR einer Anwendung.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void MainInitControlTimer(void)
+{
+    // Register-Schreibschutz aufheben
+		EALLOW;
+    // Synchronisierungstakt whrend der Konfiguration ausschalten
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 0;
+
+    // Takt fr das PWM1-Modul einschalten und 5 Takte warten, bis der Takt zum
+    // Modul durchgestellt ist (siehe S. 169 Reference Manual TMS320F2838x,
+    // SPRUII0D, Rev. D, July 2022)
+    CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
+    __asm(" RPT #4 || NOP");
+		// Zhlrichtung des Timers: hoch
+    EPwm1Regs.TBCTL.bit.CTRMODE = 0;
+		// Taktteiler: 1 (TBCLK = EPWMCLK = SYSCLK / 2 = 100 MHz)
+    EPwm1Regs.TBCTL.bit.CLKDIV    = 0;
+		EPwm1Regs.TBCTL.bit.HSPCLKDIV = 0;
+		// TBCTR nicht mit Wert aus dem Phasenregister laden
+    EPwm1Regs.TBCTL.bit.PHSEN = 0;
+    // Periodendauer direkt laden (ohne Umweg ber das Shadow-Register)
+    EPwm1Regs.TBCTL.bit.PRDLD = 1;
+    EPwm1Regs.TBPRD = MAIN_CONTROL_PERIOD;
+		// Zhler auf 0 setzen
+		EPwm1Regs.TBCTR = 0;
+		// Interrupt einschalten, auslsen wenn der Timer 0 erreicht (bei jedem Ereignis)
+		EPwm1Regs.ETSEL.bit.INTEN  = 1;
+		EPwm1Regs.ETSEL.bit.INTSEL = 1;
+		EPwm1Regs.ETPS.bit.INTPRD  = 1;
+
+    // Interrupt-Service-Routine an die entsprechende Stelle
+    // (EPWM1_INT) der PIE-Vector Table speichern
+    PieVectTable.EPWM1_INT = &MainControlISR;
+    // INT3.1-Interrupt freischalten (Zeile 3, Spalte 1 der Tabelle 3-2)
+    // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+    PieCtrlRegs.PIEIER3.bit.INTx1 = 1;
+    // CPU-Interrupt 3 einschalten (Zeile 3 der Tabelle)
+    IER |= M_INT3;
+
+    // Synchronisierungstakt wieder einschalten
+    CpuSysRegs.PCLKCR0.bit.TBCLKSYNC = 1;
+		// Register-Schreibschutz setzen
+		EDIS;
+}
 
 
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_D,
-												dataDacD);
-    }
+//=== Function: MainControlISR ====================================================================
+///
+/// @brief  ISR wird alle 100 us aufgerufen und steht stellvertretend fr die Regel-ISR einer
+///					Anwendung. Nach der Berechnung der (Beispiel-)Signale werden diese mit der Signal-
+///					Sonde abgetastet und auf dem DAC ausgegeben.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void MainControlISR(void)
+{
+		// Beispiel-Signale berechnen (hier steht in einer Anwendung der Regelalgorithmus)
+		controlCounter++;
+		controlAngle += MAIN_ANGLE_STEP;
+		if (controlAngle >= MAIN_ANGLE_MAX)
+		{
+				controlAngle -= MAIN_ANGLE_MAX;
+		}
+		controlTriangle += controlTriangleStep;
+		if (   (controlTriangle >= 1000)
+				|| (controlTriangle <= -1000))
+		{
+				controlTriangleStep = -controlTriangleStep;
+		}
+
+		// Signale synchron zur Regelung abtasten und auf dem DAC ausgeben
+		ProbeSample();
+
+    // Interrupt-Flag im ePWM1-Modul lschen
+		EPwm1Regs.ETCLR.bit.INT = 1;
+    // Interrupt-Flag der Gruppe 3 lschen (da gehrt der ePMW1-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK3 = 1;
 }
-
@@ -0,0 +1,192 @@
+//=================================================================================================
+/// @file       myProbe.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Signal-Sonde, mit der beliebige
+///							Variablen auf den Kanlen A bis D des Hardware-Monitors (DAC AD5664) ausgegeben
+///							werden knnen (z.B. zur Darstellung interner Gren auf einem Oszilloskop). Die
+///							Signale werden in einer Tabelle ("ProbeSignal") mit Adresse, Datentyp, Skalierung
+///							und Offset registriert und zur Laufzeit ber ihren Index einem Kanal zugeordnet
+///							("ProbeSelect()", z.B. ber den Debugger oder einen seriellen Monitor). Die Funktion
+///							"ProbeSample()" wird in der Regel-ISR aufgerufen, tastet die vier Signale ab und
+///							bergibt die DAC-Werte an "AD5664SetChannels()". Die Laufzeit ist unabhngig von
+///							den gewhlten Signalen konstant (vier Lesezugriffe, je eine Multiplikation und
+///							Addition).
+///
+///							DAC-Wert = Wert * scale + offset (begrenzt auf 0 ... 65535, NaN und unendliche
+///							Werte ergeben 0)
+///
+///							Zhler und andere 32-Bit-Werte, deren Bereich den DAC bersteigt, werden mit dem
+///							Typ PROBE_TYPE_UINT32_WRAP ausgegeben: Es werden nur die unteren 16 Bit verwendet,
+///							der Wert luft dadurch wie ein Sgezahn ber den DAC-Bereich (bei scale = 1.0)
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myProbe.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Tabelle der registrierten Signale (muss whrend der Laufzeit gltig bleiben)
+const ProbeSignal *probeTable = 0;
+uint16_t probeNumberOfSignals = 0;
+// Index des Signals je Kanal (PROBE_NONE: Kanal ausgeschaltet)
+uint16_t probeSelection[AD5664_NUMBER_OF_CHANNELS] = {PROBE_NONE, PROBE_NONE,
+																											PROBE_NONE, PROBE_NONE};
+// Zeiger auf das Signal je Kanal (wird von "ProbeSelect()" gesetzt, damit die ISR nicht
+// in der Tabelle suchen muss, 0: Kanal ausgeschaltet)
+const ProbeSignal *volatile probeChannels[AD5664_NUMBER_OF_CHANNELS] = {0, 0, 0, 0};
+// Zuletzt ausgegebene DAC-Werte
+uint16_t probeValues[AD5664_NUMBER_OF_CHANNELS] = {PROBE_VALUE_OFF, PROBE_VALUE_OFF,
+																									 PROBE_VALUE_OFF, PROBE_VALUE_OFF};
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ProbeInit =========================================================================
+///
+/// @brief  Funktion bernimmt die Tabelle der registrierten Signale und schaltet alle Kanle aus.
+///					Der Index eines Signals in der Tabelle ist seine Kennung in "ProbeSelect()". Die
+///					Funktion gibt "false" zurck, falls die Tabelle ungltig ist.
+///
+/// @param  const ProbeSignal *table, uint16_t numberOfSignals
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool ProbeInit(const ProbeSignal *table,
+							 uint16_t numberOfSignals)
+{
+		if (   (table == 0)
+				|| (numberOfSignals >= PROBE_NONE))
+		{
+				return false;
+		}
+		for (uint16_t i = 0; i < numberOfSignals; i++)
+		{
+				if (   (table[i].address == 0)
+						|| (table[i].type > PROBE_TYPE_UINT32_WRAP))
+				{
+						return false;
+				}
+		}
+		for (uint16_t i = 0; i < AD5664_NUMBER_OF_CHANNELS; i++)
+		{
+				probeChannels[i]  = 0;
+				probeSelection[i] = PROBE_NONE;
+		}
+		probeTable           = table;
+		probeNumberOfSignals = numberOfSignals;
+		return true;
+}
+
+
+//=== Function: ProbeSelect =======================================================================
+///
+/// @brief  Funktion ordnet dem Kanal "channel" (AD5664_CHANNEL_A ... AD5664_CHANNEL_D) das Signal
+///					mit dem Index "index" zu (PROBE_NONE: Kanal ausschalten). Die Zuordnung wird mit
+///					einem einzigen 32-Bit-Schreibzugriff bernommen und kann daher jederzeit (auch
+///					whrend die Regel-ISR luft) gendert werden. Die Funktion gibt "false" zurck,
+///					falls Kanal oder Index ungltig sind.
+///
+/// @param  uint16_t channel, uint16_t index
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool ProbeSelect(uint16_t channel,
+								 uint16_t index)
+{
+		if (   (channel >= AD5664_NUMBER_OF_CHANNELS)
+				|| (   (index != PROBE_NONE)
+						&& (index >= probeNumberOfSignals)))
+		{
+				return false;
+		}
+		probeChannels[channel]  = (index == PROBE_NONE) ? 0 : &probeTable[index];
+		probeSelection[channel] = index;
+		return true;
+}
+
+
+//=== Function: ProbeSample =======================================================================
+///
+/// @brief  Funktion tastet die den Kanlen zugeordneten Signale ab, rechnet sie in DAC-Werte um
+///					und bergibt die Werte an "AD5664SetChannels()". Die Funktion wird in der Regel-ISR
+///					aufgerufen, damit die Ausgabe synchron zur Regelung ist. Die Laufzeit ist konstant,
+///					die SPI-bertragung luft anschlieend ohne Zutun der CPU.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ProbeSample(void)
+{
+		for (uint16_t i = 0; i < AD5664_NUMBER_OF_CHANNELS; i++)
+		{
+				const ProbeSignal *signal = probeChannels[i];
+				if (signal == 0)
+				{
+						probeValues[i] = PROBE_VALUE_OFF;
+						continue;
+				}
+				float value = ProbeReadValue(signal) * signal->scale + signal->offset;
+				// Auf den Bereich des DAC begrenzen. NaN und unendliche Werte (z.B. nicht
+				// initialisierte float-Variablen oder ein berlauf der Skalierung) ergeben 0,
+				// da die Umwandlung in uint16_t fr diese Werte nicht definiert ist
+				if (   !isfinite(value)
+						|| (value < 0.0f))
+				{
+						value = 0.0f;
+				}
+				else if (value > PROBE_VALUE_MAX)
+				{
+						value = PROBE_VALUE_MAX;
+				}
+				// Runden
+				probeValues[i] = (uint16_t)(value + 0.5f);
+		}
+		// Werte an den DAC bergeben (blockiert nicht)
+		AD5664SetChannels(probeValues);
+}
+
+
+//=== Function: ProbeReadValue ====================================================================
+///
+/// @brief  Funktion liest den Wert eines Signals entsprechend seines Datentyps und gibt ihn als
+///					float zurck. 32-Bit-Werte werden mit einem Zugriff gelesen, damit die ISR keinen
+///					halb geschriebenen Wert liest. Beim Typ PROBE_TYPE_UINT32_WRAP werden nur die unteren
+///					16 Bit zurckgegeben.
+///
+/// @param  const ProbeSignal *signal
+///
+/// @return float value
+///
+//=================================================================================================
+float ProbeReadValue(const ProbeSignal *signal)
+{
+		switch (signal->type)
+		{
+				case PROBE_TYPE_UINT16:
+						return (float)*(const volatile uint16_t *)signal->address;
+				case PROBE_TYPE_INT16:
+						return (float)*(const volatile int16_t *)signal->address;
+				case PROBE_TYPE_UINT32:
+						return (float)*(const volatile uint32_t *)signal->address;
+				case PROBE_TYPE_INT32:
+						return (float)*(const volatile int32_t *)signal->address;
+				case PROBE_TYPE_UINT32_WRAP:
+						return (float)(uint16_t)*(const volatile uint32_t *)signal->address;
+				default:
+						return *(const volatile float *)signal->address;
+		}
+}
@@ -0,0 +1,102 @@
+//=================================================================================================
+/// @file       myProbe.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Signal-Sonde, mit der beliebige
+///							Variablen auf den Kanlen A bis D des Hardware-Monitors (DAC AD5664) ausgegeben
+///							werden knnen (z.B. zur Darstellung interner Gren auf einem Oszilloskop). Die
+///							Signale werden in einer Tabelle ("ProbeSignal") mit Adresse, Datentyp, Skalierung
+///							und Offset registriert und zur Laufzeit ber ihren Index einem Kanal zugeordnet
+///							("ProbeSelect()", z.B. ber den Debugger oder einen seriellen Monitor). Die Funktion
+///							"ProbeSample()" wird in der Regel-ISR aufgerufen, tastet die vier Signale ab und
+///							bergibt die DAC-Werte an "AD5664SetChannels()". Die Laufzeit ist unabhngig von
+///							den gewhlten Signalen konstant (vier Lesezugriffe, je eine Multiplikation und
+///							Addition).
+///
+///							DAC-Wert = Wert * scale + offset (begrenzt auf 0 ... 65535, NaN und unendliche
+///							Werte ergeben 0)
+///
+///							Zhler und andere 32-Bit-Werte, deren Bereich den DAC bersteigt, werden mit dem
+///							Typ PROBE_TYPE_UINT32_WRAP ausgegeben: Es werden nur die unteren 16 Bit verwendet,
+///							der Wert luft dadurch wie ein Sgezahn ber den DAC-Bereich (bei scale = 1.0)
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYPROBE_H_
+#define MYPROBE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "AD5664.h"
+#include <math.h>
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Datentypen der Signale
+#define PROBE_TYPE_UINT16												0
+#define PROBE_TYPE_INT16												1
+#define PROBE_TYPE_UINT32												2
+#define PROBE_TYPE_INT32												3
+#define PROBE_TYPE_FLOAT												4
+// Untere 16 Bit eines uint32_t (luft ber den DAC-Bereich ber, z.B. fr Zhler)
+#define PROBE_TYPE_UINT32_WRAP									5
+// Index fr einen ausgeschalteten Kanal
+#define PROBE_NONE															0xFFFF
+// DAC-Wert eines ausgeschalteten Kanals
+#define PROBE_VALUE_OFF													0
+// Grter DAC-Wert
+#define PROBE_VALUE_MAX													65535.0f
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Registriertes Signal
+typedef struct
+{
+		// Adresse der Variable
+		const void *address;
+		// Datentyp (PROBE_TYPE_...)
+		uint16_t type;
+		// Umrechnung in den DAC-Wert: Wert * scale + offset
+		float scale;
+		float offset;
+} ProbeSignal;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Index des Signals je Kanal (PROBE_NONE: Kanal ausgeschaltet)
+extern uint16_t probeSelection[AD5664_NUMBER_OF_CHANNELS];
+// Zuletzt ausgegebene DAC-Werte
+extern uint16_t probeValues[AD5664_NUMBER_OF_CHANNELS];
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion bernimmt die Tabelle der registrierten Signale
+extern bool ProbeInit(const ProbeSignal *table,
+											uint16_t numberOfSignals);
+// Funktion ordnet einem Kanal ein Signal zu
+extern bool ProbeSelect(uint16_t channel,
+												uint16_t index);
+// Funktion tastet die Signale ab und gibt sie auf dem DAC aus (Aufruf in der Regel-ISR)
+extern void ProbeSample(void);
+// Funktion liest den Wert eines Signals als float
+extern float ProbeReadValue(const ProbeSignal *signal);
+
+
+#endif
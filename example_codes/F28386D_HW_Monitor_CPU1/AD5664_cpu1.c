@@ -4,9 +4,13 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Die bergabe des SPI-D-Moduls an CPU 2 erfolgt nicht
+///							mehr in "AD5664Init()", sondern zusammen mit den brigen Modulen ber
+///							"OffloadAssign()" ("myOffload.c")
 ///
-/// @date       13.02.2023
+/// @version    V1.2
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -26,9 +30,9 @@
 //-------------------------------------------------------------------------------------------------
 //=== Function: AD5664Init ========================================================================
 ///
-/// @brief  Funktion initialisiert die GPIOs zur Kommunikation mit dem DAC. Anschlieend wird
-///					die Steuerung ber das SPI-D-Modul an COU 2 bergeben. Die GPIOs werden wie folgt
-///					konfiguiert:
+/// @brief  Funktion initialisiert die GPIOs zur Kommunikation mit dem DAC. Die Steuerung ber
+///					das SPI-D-Modul wird anschlieend mit "OffloadAssign(OFFLOAD_SPI_D)" an CPU 2
+///					bergeben. Die GPIOs werden wie folgt konfiguiert:
 ///					MOSI: GPIO 91
 ///					MISO: GPIO 92
 ///					CLK : GPIO 93
@@ -82,12 +86,6 @@ void AD5664Init(void)
     // Asynchroner Eingang (muss fr SPI gesetzt sein)
     GpioCtrlRegs.GPCQSEL2.bit.GPIO94 = 0x03;
 
-    // Steuerung ber SPI-D an CPU 2 bergeben
-    DevCfgRegs.CPUSEL6.bit.SPI_D = 1;
-    // CPU 2 signalisieren, dass Sie nun die
-    // Kontrolle ber das SPI-D Modul hat
-    Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.bit.IPC0 = 1;
-
 
 		// Register-Schreibschutz setzen
 		EDIS;
@@ -4,9 +4,13 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 1.2: Die bergabe des SPI-D-Moduls an CPU 2 erfolgt nicht
+///							mehr in "AD5664Init()", sondern zusammen mit den brigen Modulen ber
+///							"OffloadAssign()" ("myOffload.c")
 ///
-/// @date       13.02.2023
+/// @version    V1.2
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -37,7 +41,6 @@
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
 // Funktion initialisiert die GPIOs zur Kommunikation mit dem DAC
-// und bergibt die Steuerung des SPI-D-Moduls an CPU 2
 extern void AD5664Init(void);
 
 
@@ -0,0 +1,26 @@
+//=================================================================================================
+/// @file       f2838x_cla_typedefs.h
+///
+/// @brief      Ersatz fr die gleichnamige Datei aus C2000Ware fr die Host-Tests. Die Datei wird
+///							ber den Include-Pfad (-I) statt der Originaldatei eingebunden und enthlt nur
+///							die Standard-Header, die von den Treibern verwendet werden.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef F2838X_CLA_TYPEDEFS_H_
+#define F2838X_CLA_TYPEDEFS_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+#endif
@@ -0,0 +1,26 @@
+//=================================================================================================
+/// @file       f2838x_device.h
+///
+/// @brief      Ersatz fr die Registerdefinitionen aus C2000Ware fr die Host-Tests. Die Datei
+///							wird ber den Include-Pfad (-I) statt der Originaldatei eingebunden, so dass
+///							"myExchange.c" unverndert mit dem Host-Compiler (gcc) bersetzt werden kann. Der
+///							Datensatz wird nur ber gewhnliche Speicherzugriffe ausgetauscht, es werden
+///							keine Register bentigt.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef F2838X_DEVICE_H_
+#define F2838X_DEVICE_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "f2838x_cla_typedefs.h"
+
+
+#endif
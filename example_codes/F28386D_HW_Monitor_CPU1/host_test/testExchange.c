@@ -0,0 +1,256 @@
+//=================================================================================================
+/// @file       testExchange.c
+///
+/// @brief      Host-Stresstest des Sequenzzhler-Protokolls ("myExchange.c") mit zwei Threads. Ein
+///							Thread bernimmt die Rolle von CPU 1 und schreibt fortlaufend Datenstze mit
+///							"ExchangeWrite()", ein zweiter Thread bernimmt die Rolle von CPU 2 und liest sie
+///							gleichzeitig mit "ExchangeRead()". Jeder Datensatz enthlt die laufende Nummer
+///							des Schreibvorgangs und daraus abgeleitete Prfwerte. Geprft werden:
+///
+///							- Jeder gelesene Datensatz ist vollstndig (alle Worte aus demselben
+///							  Schreibvorgang, kein halb geschriebener Satz)
+///							- Die Nummer der gelesenen Datenstze nimmt nie ab
+///							- Bei einem fehlgeschlagenen Lesen bleibt der Puffer des Aufrufers unverndert
+///
+///							Zum Vergleich liest ein dritter Durchlauf den Datensatz ohne Sequenzzhler und
+///							zhlt die dabei gelesenen unvollstndigen Datenstze (nur Ausgabe, keine
+///							Prfung, da das Ergebnis von der Verteilung der Threads abhngt).
+///
+///							Das Protokoll setzt voraus, dass Speicherzugriffe in Programmreihenfolge
+///							ausgefhrt werden (C28x ohne Cache, "volatile" verhindert das Umsortieren durch
+///							den Compiler). Auf dem Host gilt dies fr x86 (Total Store Order), auf Hosts mit
+///							schwacher Speicherordnung (z.B. ARM) wren zustzliche Speicherbarrieren ntig.
+///
+///							Der Sequenzzhler ist 16 Bit breit. Damit der Test nicht flschlich fehlschlgt,
+///							falls der lesende Thread vom Betriebssystem verdrngt wird, whrend der
+///							schreibende Thread genau ein Vielfaches von 32768 Datenstzen schreibt, wird
+///							der schreibende Thread leicht gebremst (auf dem Mikrocontroller schreibt CPU 1
+///							nur bei einer nderung der Werte).
+///
+///							Aufruf: make test
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <pthread.h>
+#include "../myExchange.h"
+
+#if !defined(__x86_64__) && !defined(__i386__)
+#error "Der Test setzt die Speicherordnung von x86 voraus (siehe oben)"
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Schreibvorgnge pro Durchlauf
+#define TEST_NUMBER_OF_WRITES										4000000UL
+// Leerlaufschleifen nach jedem Schreibvorgang. Bremst den schreibenden Thread (siehe oben) und
+// verlngert den Test, damit der lesende Thread auch auf einem Host mit nur einem Kern hufig
+// whrend des Kopierens verdrngt wird
+#define TEST_WRITE_DELAY												100
+// Min. Anzahl an gelesenen Datenstzen mit Sequenzzhler
+#define TEST_MIN_READS													1000UL
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+#define CHECK(condition)																																	\
+		do																																										\
+		{																																											\
+				if (!(condition))																																	\
+				{																																									\
+						printf("  FEHLER %s:%d: %s\n", __FILE__, __LINE__, #condition);								\
+						testErrors++;																																	\
+				}																																									\
+		} while (0)
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+static uint32_t testErrors = 0;
+// Datensatz im "gemeinsamen RAM"
+static SharedExchange testExchange;
+// Wird vom schreibenden Thread nach dem letzten Schreibvorgang gesetzt
+static volatile bool testWriterFinished = false;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+// Datensatz mit der Nummer "number" und den Prfwerten
+static void TestFillData(uint32_t number,
+												 uint16_t *data)
+{
+		data[0] = (uint16_t)number;
+		data[1] = (uint16_t)(number >> 16);
+		data[2] = (uint16_t)~number;
+		data[3] = (uint16_t)(data[0] ^ data[1] ^ 0x5A5A);
+}
+
+
+// Prft, ob ein Datensatz vollstndig ist, und gibt seine Nummer zurck
+static bool TestCheckData(const uint16_t *data,
+													uint32_t *number)
+{
+		*number = ((uint32_t)data[1] << 16) | data[0];
+		return (   ((uint16_t)(data[0] ^ data[2]) == 0xFFFF)
+						&& (data[3] == (uint16_t)(data[0] ^ data[1] ^ 0x5A5A)));
+}
+
+
+// Schreibender Thread (CPU 1)
+static void *TestWriter(void *argument)
+{
+		(void)argument;
+		uint16_t data[EXCHANGE_SIZE_DATA];
+		for (uint32_t number = 1; number <= TEST_NUMBER_OF_WRITES; number++)
+		{
+				TestFillData(number, data);
+				ExchangeWrite(&testExchange, data);
+				for (volatile uint16_t i = 0; i < TEST_WRITE_DELAY; i++)
+				{
+				}
+		}
+		testWriterFinished = true;
+		return 0;
+}
+
+
+// Startet den schreibenden Thread
+static bool TestStartWriter(pthread_t *writer)
+{
+		ExchangeInit(&testExchange);
+		testWriterFinished = false;
+		return (pthread_create(writer, 0, TestWriter, 0) == 0);
+}
+
+
+// Lesen mit Sequenzzhler whrend fortlaufend geschrieben wird
+static void TestSeqlock(void)
+{
+		printf("Lesen mit Sequenzzaehler\n");
+		exchangeRetries  = 0;
+		exchangeFailures = 0;
+		pthread_t writer;
+		if (!TestStartWriter(&writer))
+		{
+				CHECK(false);
+				return;
+		}
+
+		uint16_t data[EXCHANGE_SIZE_DATA] = {0, 0, 0, 0};
+		uint32_t last = 0;
+		uint32_t reads = 0;
+		uint32_t torn = 0;
+		uint32_t backwards = 0;
+		uint32_t changed = 0;
+		while (!testWriterFinished)
+		{
+				uint16_t previous[EXCHANGE_SIZE_DATA];
+				for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+				{
+						previous[i] = data[i];
+				}
+				if (!ExchangeRead(&testExchange, data))
+				{
+						// Puffer muss unverndert bleiben
+						for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+						{
+								if (data[i] != previous[i])
+								{
+										changed++;
+								}
+						}
+						continue;
+				}
+				reads++;
+				uint32_t number;
+				// Der Datensatz nach "ExchangeInit()" besteht nur aus Nullen
+				if (!TestCheckData(data, &number) && (number != 0))
+				{
+						torn++;
+				}
+				else if (number < last)
+				{
+						backwards++;
+				}
+				else
+				{
+						last = number;
+				}
+		}
+		pthread_join(writer, 0);
+
+		printf("  %lu Datensaetze gelesen, Wiederholungen %lu, Fehlversuche %lu\n",
+					 (unsigned long)reads, (unsigned long)exchangeRetries, (unsigned long)exchangeFailures);
+		CHECK(torn == 0);
+		CHECK(backwards == 0);
+		CHECK(changed == 0);
+		CHECK(reads >= TEST_MIN_READS);
+		// Nach dem letzten Schreibvorgang wird der letzte Datensatz gelesen
+		CHECK(ExchangeRead(&testExchange, data));
+		uint32_t number;
+		CHECK(TestCheckData(data, &number) && (number == TEST_NUMBER_OF_WRITES));
+}
+
+
+// Vergleich: Lesen ohne Sequenzzhler (wie vor "myExchange.c")
+static void TestUnprotected(void)
+{
+		printf("Lesen ohne Sequenzzaehler (Vergleich)\n");
+		pthread_t writer;
+		if (!TestStartWriter(&writer))
+		{
+				CHECK(false);
+				return;
+		}
+
+		uint32_t reads = 0;
+		uint32_t torn = 0;
+		while (!testWriterFinished)
+		{
+				uint16_t data[EXCHANGE_SIZE_DATA];
+				for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+				{
+						data[i] = testExchange.data[i];
+				}
+				reads++;
+				uint32_t number;
+				if (!TestCheckData(data, &number) && (number != 0))
+				{
+						torn++;
+				}
+		}
+		pthread_join(writer, 0);
+
+		printf("  %lu Datensaetze gelesen, davon %lu unvollstaendig\n", (unsigned long)reads,
+					 (unsigned long)torn);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Main
+//-------------------------------------------------------------------------------------------------
+int main(void)
+{
+		TestSeqlock();
+		TestUnprotected();
+
+		if (testErrors != 0)
+		{
+				printf("testExchange: %lu Fehler\n", (unsigned long)testErrors);
+				return 1;
+		}
+		printf("testExchange: OK\n");
+		return 0;
+}
@@ -11,9 +11,19 @@
 ///
 ///					  https://software-dl.ti.com/C2000/docs/C2000_Multicore_Development_User_Guide/debug.html
 ///
-/// @version	V1.0
+///						nderung V1.1: Die Daten werden ber einen durch einen Sequenzzhler geschtzten
+///						Datensatz ("myExchange.c") bergeben, CPU 2 liest so immer einen vollstndigen Satz
+///						nderung V1.2: Nachrichten-Austausch mit CPU 2 ("myIpc.c"). CPU 1 fragt als Beispiel
+///						periodisch (alle 50 ms) den Status des Hardware-Monitors von CPU 2 ab
+///						nderung V1.3: Die Peripherie-Module fr Kommunikation und berwachung werden ber
+///						"OffloadAssign()" ("myOffload.c") an CPU 2 bergeben. CPU 2 meldet mit dem Status
+///						ihre Auslastung durch die Ausgabe auf dem Hardware-Monitor ("cpu2Load"), die
+///						Auslastung von CPU 1 durch ihre ISRs (IPC-ISR, weitere ISRs mit "OffloadLoadBegin()"
+///						und "OffloadLoadEnd()") steht in "offloadLoad"
 ///
-/// @date			15.09.2022
+/// @version	V1.3
+///
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -22,6 +32,9 @@
 //-------------------------------------------------------------------------------------------------
 #include "AD5664_cpu1.h"
 #include "myDevice.h"
+#include "myExchange.h"
+#include "myIpc.h"
+#include "myOffload.h"
 
 
 // Dual-Core Debugging:
@@ -46,6 +59,15 @@
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Befehle an CPU 2 (mssen mit dem Projekt von CPU 2 bereinstimmen)
+#define MAIN_COMMAND_GET_STATUS							0x01
+// Max. Wartezeit auf die Antwort von CPU 2
+#define MAIN_TIMEOUT_STATUS									IPC_TIMEOUT_US(1000)
+// Zeitabstand der Statusabfragen (50 ms). Ohne Begrenzung wrde CPU 1 direkt nach jeder
+// Antwort die nchste Anfrage senden und CPU 2 dauerhaft mit Anfragen auslasten
+#define MAIN_INTERVAL_STATUS								IPC_TIMEOUT_US(50000)
+// An CPU 2 bergebene Peripherie-Module (die GPIOs werden vorher von CPU 1 konfiguriert)
+#define MAIN_OFFLOAD_PERIPHERALS						(OFFLOAD_SPI_D)
 
 
 //-------------------------------------------------------------------------------------------------
@@ -59,8 +81,20 @@
 // Daten im gemeinsamen RAM von CPU 1 und CPU 2.
 // CPU 1 kann diese Daten lesen und schreiben,
 // CPU 2 kann sie nur lesen
-uint16_t toCpu2[4];
+SharedExchange toCpu2;
 #pragma DATA_SECTION(toCpu2,"SHARERAMGS1");
+// Werte fr die Kanle A bis D des Hardware-Monitors (z.B. im Debugger ndern)
+uint16_t dataDac[EXCHANGE_SIZE_DATA] = {0, 0, 0, 0};
+// Anfrage an CPU 2 (Antwort, Wartezeit, Callback, Kontext)
+IpcRequest requestStatus = {{0}, MAIN_TIMEOUT_STATUS, 0, 0};
+// Status des Hardware-Monitors von CPU 2 (Anzahl der gesendeten DAC-Werte-Stze)
+uint32_t cpu2NumberOfSets = 0;
+// Auslastung von CPU 2 durch die Ausgabe auf dem Hardware-Monitor in Prozent
+float cpu2Load = 0.0f;
+// Anzahl der unbeantworteten Anfragen
+uint32_t cpu2Timeouts = 0;
+// Zeitpunkt der letzten Statusabfrage (Zhler IPCCOUNTERL)
+uint32_t mainTimeStatus = 0;
 
 
 //=== Function: main ==============================================================================
@@ -74,27 +108,74 @@ uint16_t toCpu2[4];
 //=================================================================================================
 void main(void)
 {
+		// Gemeinsamen RAM GS1 CPU 1 zuweisen und Sequenzzhler und Daten zurcksetzen (der Bereich
+		// wird beim Start nicht initialisiert). Dies muss geschehen, bevor CPU 2 gebootet wird
+		// ("DeviceInit()") und die Module erhlt ("OffloadAssign()"), da CPU 2 sonst einen
+		// zuflligen Datensatz lesen kann
+		EALLOW;
+		// Zugriffsberechtigung RAM-GSx:
+		// 0: CPU1 hat Zugriff auf Speicher GSx
+		// 1: CPU2 hat Zugriff auf Speicher GSx
+		MemCfgRegs.GSxMSEL.bit.MSEL_GS1 = 0;
+		EDIS;
+		ExchangeInit(&toCpu2);
+
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts, CPU2 booten)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
-		// SPI fr Kommunikation mit DAC initialisieren
+		// Nachrichten-Austausch mit CPU 2 initialisieren (vor CPU 2, CPU 1 empfngt keine Anfragen)
+		IpcInit(0);
+		// GPIOs fr die Kommunikation mit dem DAC initialisieren
 		AD5664Init();
+		// Module an CPU 2 bergeben, CPU 2 initialisiert anschlieend deren Treiber
+		OffloadAssign(MAIN_OFFLOAD_PERIPHERALS);
 
     // Register-Schreibschutz ausschalten
     EALLOW;
 
-    // Zugriffsberechtigung RAM-GSx:
-    // 0: CPU1 hat Zugriff auf Speicher GSx
-    // 1: CPU2 hat Zugriff auf Speicher GSx
-    MemCfgRegs.GSxMSEL.bit.MSEL_GS1 = 0;
-
-
-    // Einmal referenzieren damit die Variable im Debugger sichtbar ist
-    toCpu2[0] = 0;
-
 
     while(1)
     {
-
+    		// Genderte Werte als vollstndigen Datensatz an CPU 2 bergeben (nur bei einer
+    		// nderung schreiben, damit CPU 2 nicht unntig erneut lesen muss)
+    		for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+    		{
+    				if (toCpu2.data[i] != dataDac[i])
+    				{
+    						ExchangeWrite(&toCpu2, dataDac);
+    						break;
+    				}
+    		}
+
+    		// Status von CPU 2 alle MAIN_INTERVAL_STATUS Takte abfragen, sobald die vorherige
+    		// Anfrage beendet ist. Die Antwort wird per Interrupt empfangen, CPU 1 muss nicht
+    		// auf CPU 2 warten
+    		if (requestStatus.status == IPC_STATUS_FINISHED)
+    		{
+    				cpu2NumberOfSets = ((uint32_t)requestStatus.response.data[0] << 16)
+    													 | requestStatus.response.data[1];
+    				cpu2Load = (float)requestStatus.response.data[2] * 0.01f;
+    				requestStatus.status = IPC_STATUS_IDLE;
+    		}
+    		else if (requestStatus.status == IPC_STATUS_TIMEOUT)
+    		{
+    				cpu2Timeouts++;
+    				requestStatus.status = IPC_STATUS_IDLE;
+    		}
+    		if (   (requestStatus.status == IPC_STATUS_IDLE)
+    				&& ((IPC_REGS.IPCCOUNTERL - mainTimeStatus) >= MAIN_INTERVAL_STATUS))
+    		{
+    				if (IpcSendRequest(&requestStatus, MAIN_COMMAND_GET_STATUS, 0, 0))
+    				{
+    						mainTimeStatus = IPC_REGS.IPCCOUNTERL;
+    				}
+    		}
+    		// Unbeantwortete Anfragen beenden
+    		IpcCheckTimeouts();
+    		// Auslastung von CPU 1 am Ende des Messfensters berechnen
+    		OffloadLoadUpdate();
+
+    		// Weitere Aufgaben von CPU 1
+    		// ...
     }
 }
 
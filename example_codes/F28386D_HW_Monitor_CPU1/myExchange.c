@@ -0,0 +1,126 @@
+//=================================================================================================
+/// @file       myExchange.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr den konsistenten Datenaustausch zwischen
+///							CPU 1 und CPU 2 ber einen gemeinsamen RAM-Bereich (GSx). CPU 1 schreibt die Daten,
+///							CPU 2 liest sie (CPU 2 hat nur Lesezugriff). Der Austausch ist durch einen
+///							Sequenzzhler geschtzt ("Seqlock"): Der Schreiber erhht den Zhler vor und nach
+///							dem Schreiben der Daten, der Zhler ist also whrend des Schreibens ungerade. Der
+///							Leser liest den Zhler vor und nach dem Kopieren der Daten. Ist der Zhler ungerade
+///							oder hat er sich gendert, wurden die Daten whrend des Lesens geschrieben und das
+///							Lesen wird wiederholt. So liest CPU 2 immer einen vollstndigen Datensatz, ohne dass
+///							CPU 1 warten muss oder eine Sperre bentigt wird. Die Datei ist in den Projekten
+///							beider CPUs identisch.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myExchange.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der wiederholten und der fehlgeschlagenen Leseversuche
+uint32_t exchangeRetries = 0;
+uint32_t exchangeFailures = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ExchangeInit ======================================================================
+///
+/// @brief  Funktion setzt den Sequenzzhler und die Daten zurck. Da der gemeinsame RAM nicht
+///					initialisiert wird (type=NOINIT in der .cmd-Datei), muss die schreibende CPU die
+///					Funktion aufrufen, bevor die lesende CPU gestartet wird. Ansonsten kann die lesende
+///					CPU einen zuflligen Datensatz bernehmen.
+///
+/// @param  SharedExchange *exchange
+///
+/// @return void
+///
+//=================================================================================================
+void ExchangeInit(SharedExchange *exchange)
+{
+		exchange->sequence = 0;
+		for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+		{
+				exchange->data[i] = 0;
+		}
+}
+
+
+//=== Function: ExchangeWrite =====================================================================
+///
+/// @brief  Funktion schreibt einen Datensatz ("EXCHANGE_SIZE_DATA" Worte). Der Sequenzzhler ist
+///					whrend des Schreibens ungerade. Die Funktion darf nur von einer CPU (und dort nur
+///					aus einem Kontext, z.B. dem Hauptprogramm) aufgerufen werden.
+///
+/// @param  SharedExchange *exchange, const uint16_t *data
+///
+/// @return void
+///
+//=================================================================================================
+void ExchangeWrite(SharedExchange *exchange,
+									 const uint16_t *data)
+{
+		// Zhler ungerade: Datensatz wird geschrieben
+		exchange->sequence++;
+		for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+		{
+				exchange->data[i] = data[i];
+		}
+		// Zhler gerade: Datensatz ist vollstndig
+		exchange->sequence++;
+}
+
+
+//=== Function: ExchangeRead ======================================================================
+///
+/// @brief  Funktion kopiert einen vollstndigen Datensatz nach "data". Wurde der Datensatz whrend
+///					des Kopierens geschrieben, wird das Kopieren wiederholt (max. EXCHANGE_READ_RETRIES
+///					Versuche). Die Funktion gibt "false" zurck, falls kein vollstndiger Datensatz
+///					gelesen werden konnte. Der Inhalt von "data" bleibt dann unverndert.
+///
+/// @param  const SharedExchange *exchange, uint16_t *data
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool ExchangeRead(const SharedExchange *exchange,
+									uint16_t *data)
+{
+		uint16_t copy[EXCHANGE_SIZE_DATA];
+
+		for (uint16_t attempt = 0; attempt < EXCHANGE_READ_RETRIES; attempt++)
+		{
+				uint16_t sequence = exchange->sequence;
+				// Ungerader Zhler: Datensatz wird gerade geschrieben
+				if ((sequence & 0x0001) == 0)
+				{
+						for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+						{
+								copy[i] = exchange->data[i];
+						}
+						// Zhler unverndert: Datensatz wurde whrend des Kopierens nicht geschrieben
+						if (exchange->sequence == sequence)
+						{
+								for (uint16_t i = 0; i < EXCHANGE_SIZE_DATA; i++)
+								{
+										data[i] = copy[i];
+								}
+								return true;
+						}
+				}
+				exchangeRetries++;
+		}
+		exchangeFailures++;
+		return false;
+}
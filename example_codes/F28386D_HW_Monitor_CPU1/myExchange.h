@@ -0,0 +1,77 @@
+//=================================================================================================
+/// @file       myExchange.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr den konsistenten Datenaustausch zwischen
+///							CPU 1 und CPU 2 ber einen gemeinsamen RAM-Bereich (GSx). CPU 1 schreibt die Daten,
+///							CPU 2 liest sie (CPU 2 hat nur Lesezugriff). Der Austausch ist durch einen
+///							Sequenzzhler geschtzt ("Seqlock"): Der Schreiber erhht den Zhler vor und nach
+///							dem Schreiben der Daten, der Zhler ist also whrend des Schreibens ungerade. Der
+///							Leser liest den Zhler vor und nach dem Kopieren der Daten. Ist der Zhler ungerade
+///							oder hat er sich gendert, wurden die Daten whrend des Lesens geschrieben und das
+///							Lesen wird wiederholt. So liest CPU 2 immer einen vollstndigen Datensatz, ohne dass
+///							CPU 1 warten muss oder eine Sperre bentigt wird. Die Datei ist in den Projekten
+///							beider CPUs identisch.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYEXCHANGE_H_
+#define MYEXCHANGE_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Datenworte pro Datensatz
+#define EXCHANGE_SIZE_DATA											4
+// Max. Anzahl der Leseversuche in "ExchangeRead()"
+#define EXCHANGE_READ_RETRIES										8
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Datensatz im gemeinsamen RAM (muss in beiden Projekten gleich aufgebaut sein)
+typedef struct
+{
+		// Sequenzzhler (ungerade: Daten werden gerade geschrieben)
+		volatile uint16_t sequence;
+		// Daten
+		volatile uint16_t data[EXCHANGE_SIZE_DATA];
+} SharedExchange;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der wiederholten und der fehlgeschlagenen Leseversuche
+extern uint32_t exchangeRetries;
+extern uint32_t exchangeFailures;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion setzt den Sequenzzhler und die Daten zurck (nur schreibende CPU)
+extern void ExchangeInit(SharedExchange *exchange);
+// Funktion schreibt einen Datensatz (nur schreibende CPU)
+extern void ExchangeWrite(SharedExchange *exchange,
+													const uint16_t *data);
+// Funktion liest einen vollstndigen Datensatz
+extern bool ExchangeRead(const SharedExchange *exchange,
+												 uint16_t *data);
+
+
+#endif
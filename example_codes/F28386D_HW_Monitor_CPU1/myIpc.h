@@ -0,0 +1,166 @@
+//=================================================================================================
+/// @file       myIpc.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr den Austausch von Nachrichten zwischen
+///							CPU 1 und CPU 2. Jede CPU besitzt eine Warteschlange ("IpcSide") in einem eigenen
+///							GSx-RAM (CPU 1: GS2, CPU 2: GS3), in die nur sie schreibt und aus der die andere
+///							CPU nur liest. Nach dem Einreihen einer Nachricht wird die andere CPU ber das
+///							IPC-Flag IPC_FLAG_DOORBELL per Interrupt benachrichtigt ("Trklingel"), keine der
+///							beiden CPUs muss die Warteschlange abfragen. Eine Anfrage ("IpcSendRequest()")
+///							wird auf der anderen CPU in der ISR an die Bearbeitungsfunktion bergeben, deren
+///							Antwort wird ber die ID der Anfrage zugeordnet. Das Ende einer Anfrage (Antwort
+///							oder Zeitberschreitung) wird ber das Status-Element der Anfrage und optional eine
+///							Callback-Funktion gemeldet. Die Zeitberschreitung wird mit dem fr beide CPUs
+///							gemeinsamen Zhler IPCCOUNTERL (SYSCLK) gemessen. Die Datei ist in den Projekten
+///							beider CPUs identisch, die CPU wird ber die Prprozessor-Symbole CPU1 bzw. CPU2
+///							ausgewhlt.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYIPC_H_
+#define MYIPC_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Nachrichten pro Warteschlange (muss eine Zweierpotenz sein)
+#define IPC_SIZE_QUEUE													8
+// Max. Anzahl der Datenworte pro Nachricht
+#define IPC_SIZE_MESSAGE_DATA										8
+// Max. Anzahl gleichzeitig offener Anfragen
+#define IPC_NUMBER_OF_PENDING										4
+// Verwendete IPC-Flags:
+// IPC0 ist fr den Boot-Prozess bzw. die bergabe des SPI-D-Moduls reserviert
+// IPC1: Neue Nachricht in der Warteschlange (lst auf der anderen CPU einen Interrupt aus)
+// IPC2: Warteschlange ist initialisiert (bleibt gesetzt)
+#define IPC_FLAG_DOORBELL												1
+#define IPC_FLAG_READY													2
+// Art der Nachricht
+#define IPC_TYPE_REQUEST												0
+#define IPC_TYPE_RESPONSE												1
+// ID einer Anfrage, auf die keine Antwort erwartet wird
+#define IPC_ID_NONE															0
+// Zustnde einer Anfrage
+#define IPC_STATUS_IDLE													0
+#define IPC_STATUS_PENDING											1
+#define IPC_STATUS_FINISHED											2
+#define IPC_STATUS_TIMEOUT											3
+// Umrechnung von Mikrosekunden in Takte des Zhlers IPCCOUNTERL (SYSCLK = 200 MHz)
+#define IPC_TIMEOUT_US(us)											((uint32_t)(us) * 200UL)
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Zugriff auf die IPC-Register aus Sicht der jeweiligen CPU
+#ifdef CPU1
+#define IPC_REGS																Cpu1toCpu2IpcRegs
+#define IPC_SET_REMOTE(flag)										(IPC_REGS.CPU1TOCPU2IPCSET.all = (1UL << (flag)))
+#define IPC_ACK_LOCAL(flag)											(IPC_REGS.CPU2TOCPU1IPCACK.all = (1UL << (flag)))
+#define IPC_STS_LOCAL(flag)											((IPC_REGS.CPU2TOCPU1IPCSTS.all >> (flag)) & 0x01)
+#else
+#define IPC_REGS																Cpu2toCpu1IpcRegs
+#define IPC_SET_REMOTE(flag)										(IPC_REGS.CPU2TOCPU1IPCSET.all = (1UL << (flag)))
+#define IPC_ACK_LOCAL(flag)											(IPC_REGS.CPU1TOCPU2IPCACK.all = (1UL << (flag)))
+#define IPC_STS_LOCAL(flag)											((IPC_REGS.CPU1TOCPU2IPCSTS.all >> (flag)) & 0x01)
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Nachricht. Die Elemente liegen im gemeinsamen RAM und werden von der anderen CPU geschrieben,
+// daher sind sie "volatile" (der Compiler darf sie nicht vor dem Lesen von "writeIndex" laden)
+typedef struct
+{
+		// Art der Nachricht (IPC_TYPE_...)
+		volatile uint16_t type;
+		// Befehl (wird von der Anwendung festgelegt)
+		volatile uint16_t command;
+		// ID der Anfrage (IPC_ID_NONE: keine Antwort erwartet)
+		volatile uint16_t id;
+		// Anzahl der Datenworte
+		volatile uint16_t length;
+		volatile uint16_t data[IPC_SIZE_MESSAGE_DATA];
+} IpcMessage;
+
+// Warteschlange einer CPU im gemeinsamen RAM (muss in beiden Projekten gleich aufgebaut sein)
+typedef struct
+{
+		// Gesendete Nachrichten dieser CPU
+		IpcMessage messages[IPC_SIZE_QUEUE];
+		// Index der nchsten zu schreibenden Nachricht in "messages"
+		volatile uint16_t writeIndex;
+		// Index der nchsten zu lesenden Nachricht in der Warteschlange der anderen CPU
+		volatile uint16_t readIndex;
+} IpcSide;
+
+// Funktion, die am Ende einer Anfrage aufgerufen wird (aus der ISR bzw. "IpcCheckTimeouts()")
+typedef void (*IpcCallback)(void *context);
+
+// Funktion, die eine empfangene Anfrage bearbeitet (wird aus der ISR aufgerufen). Rckgabe
+// "true": "response" (Befehl, Anzahl, Daten) wird als Antwort gesendet
+typedef bool (*IpcHandler)(const IpcMessage *request,
+													 IpcMessage *response);
+
+// Anfrage. Die Struktur muss bis zum Ende der Anfrage gltig bleiben
+typedef struct
+{
+		// Antwort (wird vom Treiber geschrieben)
+		IpcMessage response;
+		// Max. Wartezeit auf die Antwort in Takten (siehe IPC_TIMEOUT_US())
+		uint32_t timeout;
+		// Wird am Ende der Anfrage aufgerufen (0: kein Aufruf)
+		IpcCallback callback;
+		void *context;
+		// Zeitpunkt des Sendens (IPCCOUNTERL) und ID, wird vom Treiber gesetzt
+		uint32_t start;
+		uint16_t id;
+		// Zustand der Anfrage (IPC_STATUS_...), wird vom Treiber gesetzt
+		volatile uint16_t status;
+} IpcRequest;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der verworfenen Nachrichten (Warteschlange voll, unbekannte Antwort)
+extern uint32_t ipcErrors;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die Warteschlange und den IPC-Interrupt
+extern void IpcInit(IpcHandler handler);
+// Funktion prft, ob die andere CPU bereit ist
+extern bool IpcIsReady(void);
+// Funktion sendet eine Anfrage an die andere CPU
+extern bool IpcSendRequest(IpcRequest *request,
+													 uint16_t command,
+													 const uint16_t *data,
+													 uint16_t length);
+// Funktion sendet eine Nachricht an die andere CPU
+extern bool IpcSend(uint16_t type,
+										uint16_t command,
+										uint16_t id,
+										const volatile uint16_t *data,
+										uint16_t length);
+// Funktion beendet Anfragen, deren Wartezeit abgelaufen ist
+extern void IpcCheckTimeouts(void);
+// Funktion bearbeitet alle empfangenen Nachrichten
+extern void IpcReceive(void);
+// Interrupt-Service-Routine fr neue Nachrichten der anderen CPU
+__interrupt void IpcISR(void);
+
+
+#endif
@@ -0,0 +1,177 @@
+//=================================================================================================
+/// @file       myOffload.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen, um Peripherie-Module (SCI, SPI, I2C) von
+///							CPU 1 an CPU 2 zu bergeben, damit CPU 1 nur die zeitkritische Regelung ausfhrt
+///							und CPU 2 die Kommunikation und berwachung bernimmt. CPU 1 konfiguriert die GPIOs
+///							der Module (nur CPU 1 hat Zugriff auf die GPIO-Multiplexer), weist die Module ber
+///							die Register CPUSELx CPU 2 zu ("OffloadAssign()") und bermittelt die Auswahl ber
+///							das Register IPCSENDDATA und das Flag IPC0. CPU 2 wartet darauf
+///							("OffloadWaitForPeripherals()") und initialisiert anschlieend die Treiber der
+///							bergebenen Module. Daten werden ber den gemeinsamen RAM ("myExchange.c") bzw.
+///							Nachrichten ("myIpc.c") ausgetauscht. Zustzlich kann die Auslastung einer CPU
+///							durch ihre ISRs gemessen werden ("OffloadLoadBegin()", "OffloadLoadEnd()"), um die
+///							Entlastung von CPU 1 zu vergleichen. Die Datei ist in den Projekten beider CPUs
+///							identisch, die CPU wird ber die Prprozessor-Symbole CPU1 bzw. CPU2 ausgewhlt.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myOffload.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// An CPU 2 bergebene Module (OFFLOAD_...)
+uint32_t offloadPeripherals = 0;
+// Messung der Auslastung: Beginn der aktuellen ISR, Summe der ISR-Laufzeiten und Beginn
+// des Messfensters (Takte des Zhlers IPCCOUNTERL)
+uint32_t offloadLoadStart = 0;
+uint32_t offloadLoadBusy = 0;
+uint32_t offloadLoadWindowStart = 0;
+// Auslastung der CPU durch die gemessenen ISRs im letzten Messfenster in Prozent
+float offloadLoad = 0.0f;
+// Max. Laufzeit einer gemessenen ISR in Takten
+uint32_t offloadLoadMax = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+#ifdef CPU1
+//=== Function: OffloadAssign =====================================================================
+///
+/// @brief  Funktion weist die Peripherie-Module "peripherals" (OFFLOAD_..., Bitmaske) CPU 2 zu. Die
+///					GPIOs der Module mssen vorher von CPU 1 konfiguriert werden (z.B. "AD5664Init()").
+///					Anschlieend wird die Auswahl in das Register IPCSENDDATA geschrieben und CPU 2 ber
+///					das Flag IPC0 benachrichtigt. Die Funktion darf nur einmal aufgerufen werden.
+///
+/// @param  uint32_t peripherals
+///
+/// @return void
+///
+//=================================================================================================
+void OffloadAssign(uint32_t peripherals)
+{
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Module CPU 2 zuweisen (0: CPU 1, 1: CPU 2)
+		// (siehe Register CPUSEL5 bis CPUSEL7, Reference Manual TMS320F2838x)
+		DevCfgRegs.CPUSEL5.bit.SCI_A = ((peripherals & OFFLOAD_SCI_A) != 0);
+		DevCfgRegs.CPUSEL5.bit.SCI_B = ((peripherals & OFFLOAD_SCI_B) != 0);
+		DevCfgRegs.CPUSEL5.bit.SCI_C = ((peripherals & OFFLOAD_SCI_C) != 0);
+		DevCfgRegs.CPUSEL5.bit.SCI_D = ((peripherals & OFFLOAD_SCI_D) != 0);
+		DevCfgRegs.CPUSEL6.bit.SPI_A = ((peripherals & OFFLOAD_SPI_A) != 0);
+		DevCfgRegs.CPUSEL6.bit.SPI_B = ((peripherals & OFFLOAD_SPI_B) != 0);
+		DevCfgRegs.CPUSEL6.bit.SPI_C = ((peripherals & OFFLOAD_SPI_C) != 0);
+		DevCfgRegs.CPUSEL6.bit.SPI_D = ((peripherals & OFFLOAD_SPI_D) != 0);
+		DevCfgRegs.CPUSEL7.bit.I2C_A = ((peripherals & OFFLOAD_I2C_A) != 0);
+		DevCfgRegs.CPUSEL7.bit.I2C_B = ((peripherals & OFFLOAD_I2C_B) != 0);
+		offloadPeripherals = peripherals;
+
+		// Auswahl an CPU 2 bermitteln und CPU 2 signalisieren,
+		// dass sie nun die Kontrolle ber die Module hat
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSENDDATA = peripherals;
+		Cpu1toCpu2IpcRegs.CPU1TOCPU2IPCSET.bit.IPC0 = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+#else
+//=== Function: OffloadWaitForPeripherals =========================================================
+///
+/// @brief  Funktion wartet, bis CPU 1 die Peripherie-Module bergeben hat, und gibt die bergebenen
+///					Module (OFFLOAD_..., Bitmaske) zurck. Anschlieend knnen die Treiber der Module
+///					initialisiert werden.
+///
+/// @param  void
+///
+/// @return uint32_t peripherals
+///
+//=================================================================================================
+uint32_t OffloadWaitForPeripherals(void)
+{
+		// Warten, bis CPU 1 die Kontrolle ber die Module bergeben hat
+		while (Cpu2toCpu1IpcRegs.CPU1TOCPU2IPCSTS.bit.IPC0 == 0);
+		offloadPeripherals = Cpu2toCpu1IpcRegs.CPU1TOCPU2IPCRECVDATA;
+		// Flag lschen
+		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.bit.IPC0 = 1;
+		return offloadPeripherals;
+}
+#endif
+
+
+//=== Function: OffloadLoadBegin ==================================================================
+///
+/// @brief  Funktion speichert den Beginn einer ISR. Sie wird als erster Befehl der zu messenden
+///					ISRs aufgerufen, "OffloadLoadEnd()" als letzter. Verschachtelte Interrupts werden
+///					nicht untersttzt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void OffloadLoadBegin(void)
+{
+		offloadLoadStart = OFFLOAD_COUNTER;
+}
+
+
+//=== Function: OffloadLoadEnd ====================================================================
+///
+/// @brief  Funktion addiert die Laufzeit der ISR seit "OffloadLoadBegin()" zur Summe des
+///					aktuellen Messfensters und speichert die max. Laufzeit.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void OffloadLoadEnd(void)
+{
+		uint32_t duration = OFFLOAD_COUNTER - offloadLoadStart;
+		offloadLoadBusy += duration;
+		if (duration > offloadLoadMax)
+		{
+				offloadLoadMax = duration;
+		}
+}
+
+
+//=== Function: OffloadLoadUpdate =================================================================
+///
+/// @brief  Funktion berechnet am Ende eines Messfensters (OFFLOAD_LOAD_WINDOW) die Auslastung der
+///					CPU durch die gemessenen ISRs in Prozent ("offloadLoad") und startet das nchste
+///					Messfenster. Die Funktion wird periodisch im Hauptprogramm aufgerufen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void OffloadLoadUpdate(void)
+{
+		uint32_t now = OFFLOAD_COUNTER;
+		uint32_t window = now - offloadLoadWindowStart;
+
+		if (window >= OFFLOAD_LOAD_WINDOW)
+		{
+				// Summe lesen und zurcksetzen, ohne dass eine ISR dazwischen addiert
+				uint16_t interruptState = __disable_interrupts();
+				uint32_t busy = offloadLoadBusy;
+				offloadLoadBusy = 0;
+				__restore_interrupts(interruptState);
+
+				offloadLoad = 100.0f * (float)busy / (float)window;
+				offloadLoadWindowStart = now;
+		}
+}
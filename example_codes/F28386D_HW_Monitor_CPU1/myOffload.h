@@ -0,0 +1,89 @@
+//=================================================================================================
+/// @file       myOffload.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen, um Peripherie-Module (SCI, SPI, I2C) von
+///							CPU 1 an CPU 2 zu bergeben, damit CPU 1 nur die zeitkritische Regelung ausfhrt
+///							und CPU 2 die Kommunikation und berwachung bernimmt. CPU 1 konfiguriert die GPIOs
+///							der Module (nur CPU 1 hat Zugriff auf die GPIO-Multiplexer), weist die Module ber
+///							die Register CPUSELx CPU 2 zu ("OffloadAssign()") und bermittelt die Auswahl ber
+///							das Register IPCSENDDATA und das Flag IPC0. CPU 2 wartet darauf
+///							("OffloadWaitForPeripherals()") und initialisiert anschlieend die Treiber der
+///							bergebenen Module. Daten werden ber den gemeinsamen RAM ("myExchange.c") bzw.
+///							Nachrichten ("myIpc.c") ausgetauscht. Zustzlich kann die Auslastung einer CPU
+///							durch ihre ISRs gemessen werden ("OffloadLoadBegin()", "OffloadLoadEnd()"), um die
+///							Entlastung von CPU 1 zu vergleichen. Die Datei ist in den Projekten beider CPUs
+///							identisch, die CPU wird ber die Prprozessor-Symbole CPU1 bzw. CPU2 ausgewhlt.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYOFFLOAD_H_
+#define MYOFFLOAD_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Peripherie-Module, die an CPU 2 bergeben werden knnen (Bitmaske)
+#define OFFLOAD_SCI_A														0x0001UL
+#define OFFLOAD_SCI_B														0x0002UL
+#define OFFLOAD_SCI_C														0x0004UL
+#define OFFLOAD_SCI_D														0x0008UL
+#define OFFLOAD_SPI_A														0x0010UL
+#define OFFLOAD_SPI_B														0x0020UL
+#define OFFLOAD_SPI_C														0x0040UL
+#define OFFLOAD_SPI_D														0x0080UL
+#define OFFLOAD_I2C_A														0x0100UL
+#define OFFLOAD_I2C_B														0x0200UL
+// Lnge des Messfensters der Auslastung in Takten (SYSCLK = 200 MHz, 1 s)
+#define OFFLOAD_LOAD_WINDOW											200000000UL
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Gemeinsamer Zhler (SYSCLK) aus Sicht der jeweiligen CPU
+#ifdef CPU1
+#define OFFLOAD_COUNTER													(Cpu1toCpu2IpcRegs.IPCCOUNTERL)
+#else
+#define OFFLOAD_COUNTER													(Cpu2toCpu1IpcRegs.IPCCOUNTERL)
+#endif
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// An CPU 2 bergebene Module (OFFLOAD_...)
+extern uint32_t offloadPeripherals;
+// Auslastung der CPU durch die gemessenen ISRs im letzten Messfenster in Prozent
+extern float offloadLoad;
+// Max. Laufzeit einer gemessenen ISR in Takten
+extern uint32_t offloadLoadMax;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+#ifdef CPU1
+// Funktion weist Peripherie-Module CPU 2 zu und benachrichtigt CPU 2
+extern void OffloadAssign(uint32_t peripherals);
+#else
+// Funktion wartet, bis CPU 1 die Peripherie-Module bergeben hat
+extern uint32_t OffloadWaitForPeripherals(void);
+#endif
+// Funktion speichert den Beginn einer ISR (Messung der Auslastung)
+extern void OffloadLoadBegin(void);
+// Funktion addiert die Laufzeit einer ISR (Messung der Auslastung)
+extern void OffloadLoadEnd(void);
+// Funktion berechnet die Auslastung am Ende eines Messfensters
+extern void OffloadLoadUpdate(void);
+
+
+#endif
@@ -4,9 +4,18 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 2.0: Nicht blockierende bertragung aller vier Kanle
+///							("AD5664SetChannels()"). Die Befehle (je 2 Worte mit 12-Bit Datenlnge) werden
+///							nacheinander aus der ISR gesendet. Ist noch eine bertragung aktiv, wird der
+///							Werte-Satz gespeichert und am Ende der bertragung gesendet. Optional werden alle
+///							Ausgnge gleichzeitig aktualisiert (AD5664_SIMULTANEOUS_UPDATE)
+///							nderung in Version 2.1: "AD5664Init()" wartet nicht mehr selbst auf die bergabe
+///							des SPI-D-Moduls, diese erfolgt vorher ber "OffloadWaitForPeripherals()"
+///							("myOffload.c"). Die Laufzeit der ISR wird fr die Messung der Auslastung erfasst
 ///
-/// @date       13.02.2023
+/// @version    V2.1
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -21,6 +30,16 @@
 //-------------------------------------------------------------------------------------------------
 // Flag speichert den aktuellen Zustand der SPI-Kommunikation  (bereit/Kommunikation aktiv)
 uint32_t ad5664StatusFlag = AD5664_STATUS_IN_PROGRESS;
+// Sendepuffer (ein DAC-Befehl = AD5664_WORDS_PER_FRAME Worte, linksbndig)
+uint16_t ad5664BufferTx[AD5664_SIZE_BUFFER];
+// Anzahl der DAC-Befehle der aktuellen bertragung und Index des nchsten Befehls
+uint16_t ad5664NumberOfFrames = 0;
+uint16_t ad5664FrameIndex = 0;
+// Werte-Satz, der am Ende der aktiven bertragung gesendet wird, und Flag, ob ein Satz wartet
+uint16_t ad5664PendingValues[AD5664_NUMBER_OF_CHANNELS];
+uint16_t ad5664PendingFlag = 0;
+// Anzahl der vollstndig gesendeten Werte-Stze (z.B. zur Messung der Update-Rate)
+volatile uint32_t ad5664NumberOfSets = 0;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -29,7 +48,8 @@ uint32_t ad5664StatusFlag = AD5664_STATUS_IN_PROGRESS;
 //=== Function: AD5664Init ========================================================================
 ///
 /// @brief  Funktion initialisiert das SPI-D-Modul. Der Parameter "clock" gibt die gewnschte
-///					SPI-Taktfrequenz in Hz an
+///					SPI-Taktfrequenz in Hz an. Das Modul muss vorher von CPU 1 bergeben worden sein
+///					("OffloadWaitForPeripherals()" gibt OFFLOAD_SPI_D zurck)
 ///
 /// @param  void
 ///
@@ -41,11 +61,6 @@ void AD5664Init(uint32_t clock)
     // Register-Schreibschutz aufheben
     EALLOW;
 
-		// Warten, bis CPU 1 die Kontrolle ber das SPI-D-Modul bergeben hat
-		while(Cpu2toCpu1IpcRegs.CPU1TOCPU2IPCSTS.bit.IPC0 == 0);
-		// Flag lschen
-		Cpu2toCpu1IpcRegs.CPU2TOCPU1IPCACK.bit.IPC0 = 1;
-
     // Takt fr das SPI-Modul einschalten und 5 Takte
     // warten, bis der Takt zum Modul durchgestellt ist
     // (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
@@ -57,8 +72,8 @@ void AD5664Init(uint32_t clock)
     SpidRegs.SPICCR.bit.CLKPOLARITY = 0;
     // Phase = 0 (Daten bei der ersten (mit POL = 0 also einer steigenden) Flanke bernehmen)
     SpidRegs.SPICTL.bit.CLK_PHASE = 0;
-    // 8-Bit Datenlnge
-    SpidRegs.SPICCR.bit.SPICHAR = 7;
+    // 12-Bit Datenlnge (ein 24-Bit DAC-Befehl = 2 Worte)
+    SpidRegs.SPICCR.bit.SPICHAR = AD5664_WORD_LENGTH - 1;
     // Master-Mode setzen
     SpidRegs.SPICTL.bit.MASTER_SLAVE = 1;
     // bertragung aktivieren
@@ -66,6 +81,8 @@ void AD5664Init(uint32_t clock)
     // Taktrate setzen
     // (Low-Speed CLK / clock) - 1
     // Low-Speed CLK = 50 MHz (siehe "DeviceInit()")
+    // Fr SPI_BIT_RATE = 0..2 teilt das Modul fest durch 4, der hchste SPI-Clock ist daher
+    // 12,5 MHz (AD5664_SPI_CLOCK_16MHZ ergibt SPI_BIT_RATE = 2, also ebenfalls 12,5 MHz)
     SpidRegs.SPIBRR.bit.SPI_BIT_RATE = (50000000 / clock) - 1;
     // FIFO-Reset whrend der Konfiguration setzen
     SpidRegs.SPIFFTX.bit.TXFIFO = 0;
@@ -73,8 +90,8 @@ void AD5664Init(uint32_t clock)
     SpidRegs.SPIFFTX.bit.SPIFFENA = 1;
     // RX-FIFO Interrupt einschalten
     SpidRegs.SPIFFRX.bit.RXFFIENA = 1;
-    // Interrupt auslsen, wenn 3 Bytes empfangen wurden
-    SpidRegs.SPIFFRX.bit.RXFFIL = 3;
+    // Interrupt auslsen, wenn ein DAC-Befehl (2 Worte) empfangen wurde
+    SpidRegs.SPIFFRX.bit.RXFFIL = AD5664_WORDS_PER_FRAME;
     // RX-FIFO Interupt-Flag lschen
     SpidRegs.SPIFFRX.bit.RXFFINTCLR = 1;
     // FIFO-Reset aufheben
@@ -106,7 +123,8 @@ void AD5664Init(uint32_t clock)
 //=== Function: AD566SetChannel ===================================================================
 ///
 /// @brief  Funktion setzt den Wert fr einen Kanal (A, B, C oder D) des DAC.
-///					Der Wert wird vom DAC anschlieend direkt bernommen
+///					Der Wert wird vom DAC anschlieend direkt bernommen. Die Funktion darf nur
+///					aufgerufen werden, wenn keine bertragung aktiv ist (Status "bereit")
 ///
 /// @param  uint16_t channel, uint16_t value
 ///
@@ -115,31 +133,114 @@ void AD5664Init(uint32_t clock)
 //=================================================================================================
 void AD566SetChannel(uint16_t channel,
 										 uint16_t value)
+{
+		// Befehl in den Sendepuffer schreiben (neuen DAC-Wert sofort setzen)
+		ad5664BufferTx[0] = AD5664_FRAME_HIGH(AD5664_WRITE_REG_SET_DAC | channel, value);
+		ad5664BufferTx[1] = AD5664_FRAME_LOW(value);
+		AD5664StartTransfer(1);
+}
+
+
+//=== Function: AD5664SetChannels =================================================================
+///
+/// @brief  Funktion bergibt die Werte aller vier Kanle (A, B, C und D, "values[0]" ...
+///					"values[3]") und kehrt sofort zurck. Ist keine bertragung aktiv, wird der Satz
+///					direkt gesendet. Andernfalls wird er gespeichert und am Ende der aktiven bertragung
+///					aus der ISR gesendet. Ein gespeicherter, noch nicht gesendeter Satz wird dabei durch
+///					den neuen Satz ersetzt, es wird also immer der aktuellste Satz ausgegeben. Das Ende
+///					eines Satzes wird ber "ad5664NumberOfSets" gemeldet.
+///
+/// @param  const uint16_t *values
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664SetChannels(const uint16_t *values)
+{
+		// CPU-Interrupts sperren, damit die ISR nicht gleichzeitig auf den Satz zugreift
+		DINT;
+		for (uint16_t i = 0; i < AD5664_NUMBER_OF_CHANNELS; i++)
+		{
+				ad5664PendingValues[i] = values[i];
+		}
+		ad5664PendingFlag = 1;
+		// Keine bertragung aktiv, Satz direkt senden
+		if (ad5664StatusFlag == AD5664_STATUS_IDLE)
+		{
+				AD5664StartSet();
+		}
+		EINT;
+}
+
+
+//=== Function: AD5664StartSet ====================================================================
+///
+/// @brief  Funktion schreibt den gespeicherten Werte-Satz in den Sendepuffer und startet die
+///					bertragung. Mit AD5664_SIMULTANEOUS_UPDATE = 1 werden die Kanle A bis C nur in
+///					die Eingangsregister geschrieben und der Befehl fr Kanal D aktualisiert alle vier
+///					Ausgnge gleichzeitig. Ansonsten wird jeder Ausgang direkt aktualisiert.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664StartSet(void)
+{
+		uint16_t command;
+
+		for (uint16_t i = 0; i < AD5664_NUMBER_OF_CHANNELS; i++)
+		{
+#if AD5664_SIMULTANEOUS_UPDATE
+				command = (i == AD5664_CHANNEL_D) ? AD5664_WRITE_REG_SET_ALL : AD5664_WRITE_REG;
+#else
+				command = AD5664_WRITE_REG_SET_DAC;
+#endif
+				ad5664BufferTx[2*i]     = AD5664_FRAME_HIGH(command | i, ad5664PendingValues[i]);
+				ad5664BufferTx[2*i + 1] = AD5664_FRAME_LOW(ad5664PendingValues[i]);
+		}
+		ad5664PendingFlag = 0;
+		AD5664StartTransfer(AD5664_NUMBER_OF_CHANNELS);
+}
+
+
+//=== Function: AD5664StartTransfer ===============================================================
+///
+/// @brief  Funktion schreibt den ersten der "numberOfFrames" DAC-Befehle aus "ad5664BufferTx[]"
+///					in den FIFO, die weiteren Befehle werden jeweils aus der ISR gesendet. Die Befehle
+///					werden nicht gemeinsam in den FIFO geschrieben, da die SS-Leitung sonst zwischen den
+///					Befehlen nicht auf high geht (notwendig, damit der DAC den nchsten Befehl annimmt).
+///
+/// @param  uint16_t numberOfFrames
+///
+/// @return void
+///
+//=================================================================================================
+void AD5664StartTransfer(uint16_t numberOfFrames)
 {
 		// Flag setzen um der aufrufenden Stelle zu signalisieren,
 		// dass eine SPI-Kommunikation gestartet wurde
-		ad5664StatusFlag = AD5664_STATUS_IN_PROGRESS;
-		// Daten in den SPI-Hardware-Puffer kopieren (16 Byte, Daten mssen links-bnig sein,
-		// siehe S. 3904 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
-		// Steuer-Byte (neuen DAC-Wert sofort setzen)
-		SpidRegs.SPITXBUF = ( (AD5664_WRITE_REG_SET_DAC | channel) << 8 );
-		// Daten MSB
-		SpidRegs.SPITXBUF = ( ((value >> 8) & 0xFF) << 8 );
-		// Daten LSB
-		SpidRegs.SPITXBUF = ( (value & 0xFF) << 8 );
+		ad5664StatusFlag     = AD5664_STATUS_IN_PROGRESS;
+		ad5664NumberOfFrames = numberOfFrames;
+		ad5664FrameIndex     = 1;
+		// Daten in den SPI-Hardware-Puffer kopieren (Daten mssen links-bnig sein,
+		// siehe S. 3904 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		SpidRegs.SPITXBUF = ad5664BufferTx[0];
+		SpidRegs.SPITXBUF = ad5664BufferTx[1];
 }
 
 
 //=== Function: AD5664SpiISR ======================================================================
 ///
-/// @brief	Funktion wird aufgerufen, sobald drei Bytes ber SPI empfangen wurde. Fr den Betrieb
-///					des Hardware-Monitors werden die Daten ber SPI zwar nur gesendet, aber die Konfigu-
-///					ration des Sende-Interrupts ist komplizierter als die des Emfangs-Interrupts. Zudem
-///					wird der Sende-Interrupt ausgelst, sobal der TX-Puffer leer ist. Zu diesem Zeitpunkt
-///					befindet sich das letzte zu sendene Byte jedoch noch im Ausgangsregister. Der Interrupt
-///					kommt also zu frh. Aus diesem Grund und weil beim Senden auch automatisch Daten
-///					empfangen werden, wurde hier die Kommunikation mithilfe des Empfangs-Interrupts umge-
-///					setzt.
+/// @brief	Funktion wird aufgerufen, sobald ein DAC-Befehl (2 Worte) ber SPI empfangen wurde.
+///					Fr den Betrieb des Hardware-Monitors werden die Daten ber SPI zwar nur gesendet,
+///					aber die Konfiguration des Sende-Interrupts ist komplizierter als die des Emfangs-
+///					Interrupts. Zudem wird der Sende-Interrupt ausgelst, sobal der TX-Puffer leer ist.
+///					Zu diesem Zeitpunkt befindet sich das letzte zu sendene Wort jedoch noch im Ausgangs-
+///					register. Der Interrupt kommt also zu frh. Aus diesem Grund und weil beim Senden
+///					auch automatisch Daten empfangen werden, wurde hier die Kommunikation mithilfe des
+///					Empfangs-Interrupts umgesetzt. Sind noch Befehle brig, wird der nchste Befehl
+///					gesendet. Am Ende der bertragung wird ein wartender Werte-Satz direkt gesendet.
 ///
 /// @param  void
 ///
@@ -157,15 +258,43 @@ __interrupt void AD5664SpiISR(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Status auf "bereit" setzen
-		ad5664StatusFlag = AD5664_STATUS_IDLE;
-		// Empfangene Bytes auslesen
+		// Beginn der ISR fr die Messung der Auslastung speichern
+		OffloadLoadBegin();
+
+		// Empfangene Worte auslesen
 		uint16_t dummy = SpidRegs.SPIRXBUF;
 		dummy = SpidRegs.SPIRXBUF;
-		dummy = SpidRegs.SPIRXBUF;
+
+		if (ad5664FrameIndex < ad5664NumberOfFrames)
+		{
+				// Nchsten Befehl senden
+				SpidRegs.SPITXBUF = ad5664BufferTx[2*ad5664FrameIndex];
+				SpidRegs.SPITXBUF = ad5664BufferTx[2*ad5664FrameIndex + 1];
+				ad5664FrameIndex++;
+		}
+		else
+		{
+				// Nur vollstndige Stze zhlen (nicht die Einzelbefehle von "AD566SetChannel()")
+				if (ad5664NumberOfFrames == AD5664_NUMBER_OF_CHANNELS)
+				{
+						ad5664NumberOfSets++;
+				}
+				// Wartenden Satz senden oder Status auf "bereit" setzen
+				if (ad5664PendingFlag)
+				{
+						AD5664StartSet();
+				}
+				else
+				{
+						ad5664StatusFlag = AD5664_STATUS_IDLE;
+				}
+		}
 
     // RX-FIFO Interupt-Flag lschen
     SpidRegs.SPIFFRX.bit.RXFFINTCLR = 1;
 		// Interrupt-Flag der Gruppe 6 lschen (da gehrt der SPI-Interrupt zu)
     PieCtrlRegs.PIEACK.bit.ACK6 = 1;
+
+		// Laufzeit der ISR erfassen
+		OffloadLoadEnd();
 }
@@ -4,9 +4,18 @@
 /// @brief      Datei enthlt Variablen und Funktionen um den Digital-Analog-Converter AD5664
 ///							zu steuern
 ///
-/// @version    V1.1
+///							nderung in Version 2.0: Nicht blockierende bertragung aller vier Kanle
+///							("AD5664SetChannels()"). Die Befehle (je 2 Worte mit 12-Bit Datenlnge) werden
+///							nacheinander aus der ISR gesendet. Ist noch eine bertragung aktiv, wird der
+///							Werte-Satz gespeichert und am Ende der bertragung gesendet. Optional werden alle
+///							Ausgnge gleichzeitig aktualisiert (AD5664_SIMULTANEOUS_UPDATE)
+///							nderung in Version 2.1: "AD5664Init()" wartet nicht mehr selbst auf die bergabe
+///							des SPI-D-Moduls, diese erfolgt vorher ber "OffloadWaitForPeripherals()"
+///							("myOffload.c"). Die Laufzeit der ISR wird fr die Messung der Auslastung erfasst
 ///
-/// @date       13.02.2023
+/// @version    V2.1
+///
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -16,6 +25,7 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
+#include "myOffload.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -33,6 +43,18 @@
 // Betriebszustnde der SPI-Kommunikation
 #define AD5664_STATUS_IDLE							0
 #define AD5664_STATUS_IN_PROGRESS				1
+// Datenlnge der SPI-Worte in Bit. Ein 24-Bit DAC-Befehl (Steuer-Byte + 16-Bit Wert) wird
+// als 2 Worte zu je 12 Bit bertragen
+#define AD5664_WORD_LENGTH							12
+// Anzahl der Datenworte pro DAC-Befehl
+#define AD5664_WORDS_PER_FRAME					2
+// Anzahl der Kanle
+#define AD5664_NUMBER_OF_CHANNELS				4
+// Gleichzeitige Aktualisierung: 1 = Kanle A bis C nur in die Eingangsregister schreiben, der
+// Befehl fr Kanal D aktualisiert alle Ausgnge gleichzeitig, 0 = jeden Ausgang direkt setzen
+#define AD5664_SIMULTANEOUS_UPDATE			1
+// Gre des Sendepuffers (ein Befehl pro Kanal)
+#define AD5664_SIZE_BUFFER							(AD5664_NUMBER_OF_CHANNELS * AD5664_WORDS_PER_FRAME)
 
 // DAC-Protokoll:
 // Befehl/Steuerung
@@ -53,6 +75,10 @@
 //-------------------------------------------------------------------------------------------------
 // Macros
 //-------------------------------------------------------------------------------------------------
+// Teilt einen DAC-Befehl (Steuer-Byte "command" + 16-Bit Wert "value") in zwei linksbndige
+// 12-Bit Worte auf: 1. Wort = Steuer-Byte + oberes Nibble des Werts, 2. Wort = untere 12 Bit
+#define AD5664_FRAME_HIGH(command, value)	((uint16_t)((((command) << 4) | ((value) >> 12)) << 4))
+#define AD5664_FRAME_LOW(value)						((uint16_t)(((value) & 0x0FFF) << 4))
 
 
 //-------------------------------------------------------------------------------------------------
@@ -60,6 +86,8 @@
 //-------------------------------------------------------------------------------------------------
 // Flag speichert den aktuellen Zustand der SPI-Kommunikation (bereit/Kommunikation aktiv)
 extern uint32_t ad5664StatusFlag;
+// Anzahl der vollstndig gesendeten Werte-Stze
+extern volatile uint32_t ad5664NumberOfSets;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -70,6 +98,12 @@ extern void AD5664Init(uint32_t clock);
 // Funktion sendet einen Wert fr einen Kanal des DAC
 extern void AD566SetChannel(uint16_t channel,
 														uint16_t value);
+// Funktion bergibt die Werte aller vier Kanle des DAC (blockiert nicht)
+extern void AD5664SetChannels(const uint16_t *values);
+// Funktion schreibt den gespeicherten Werte-Satz in den Sendepuffer und startet die bertragung
+extern void AD5664StartSet(void);
+// Funktion startet die bertragung der Befehle im Sendepuffer
+extern void AD5664StartTransfer(uint16_t numberOfFrames);
 // SPI-Interrupt-Routine zur Kommunikation mit dem DAC
 __interrupt void AD5664SpiISR(void);
 
@@ -11,9 +11,21 @@
 ///
 ///					  https://software-dl.ti.com/C2000/docs/C2000_Multicore_Development_User_Guide/debug.html
 ///
-/// @version	V1.0
+///						nderung AD5664_cpu2.c V2.0: Die Hauptschleife wartet nicht mehr auf das Ende der
+///						bertragung, alle vier Kanle werden mit einem Aufruf bergeben
+///						nderung V1.2: Die Daten von CPU 1 werden ber einen durch einen Sequenzzhler
+///						geschtzten Datensatz ("myExchange.c") gelesen, es wird so nie ein halb
+///						geschriebener Satz ausgegeben
+///						nderung V1.3: Nachrichten-Austausch mit CPU 1 ("myIpc.c"). Anfragen von CPU 1
+///						werden per Interrupt in "MainHandleRequest()" beantwortet
+///						nderung V1.4: CPU 2 wartet auf die bergabe der Peripherie-Module durch CPU 1
+///						("myOffload.c") und initialisiert nur die bergebenen Module. Die Auslastung von
+///						CPU 2 durch die Ausgabe auf dem Hardware-Monitor wird gemessen und mit dem Status
+///						an CPU 1 gemeldet (entspricht der Last, die CPU 1 ohne Auslagerung htte)
 ///
-/// @date			15.09.2022
+/// @version	V1.4
+///
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -21,6 +33,9 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "AD5664_cpu2.h"
+#include "myExchange.h"
+#include "myIpc.h"
+#include "myOffload.h"
 
 
 // Dual-Core Debugging:
@@ -45,11 +60,16 @@
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Befehle von CPU 1 (mssen mit dem Projekt von CPU 1 bereinstimmen)
+#define MAIN_COMMAND_GET_STATUS							0x01
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Bearbeitet Anfragen von CPU 1 (wird aus der IPC-ISR aufgerufen)
+bool MainHandleRequest(const IpcMessage *request,
+											 IpcMessage *response);
 
 
 //-------------------------------------------------------------------------------------------------
@@ -58,8 +78,10 @@
 // Daten im gemeinsamen RAM von CPU 1 und CPU 2.
 // CPU 1 kann diese Daten lesen und schreiben,
 // CPU 2 kann sie nur lesen
-uint16_t fromCpu1[4];
+SharedExchange fromCpu1;
 #pragma DATA_SECTION(fromCpu1,"SHARERAMGS1");
+// Zuletzt gelesener vollstndiger Datensatz
+uint16_t dataDac[EXCHANGE_SIZE_DATA] = {0, 0, 0, 0};
 
 
 //=== Function: main ==============================================================================
@@ -75,39 +97,71 @@ void main(void)
 {
 		// Mikrocontroller initialisieren
 		DeviceInit(DEVICE_DEFAULT);
-		// SPI fr die Kommunikation mit dem DAC mit 16 MHz SPI-Clock initialisieren
-		AD5664Init(AD5664_SPI_CLOCK_16MHZ);
+		// Warten, bis CPU 1 die GPIOs konfiguriert und die Peripherie-Module bergeben hat
+		uint32_t peripherals = OffloadWaitForPeripherals();
+		// SPI fr die Kommunikation mit dem DAC initialisieren (AD5664_SPI_CLOCK_16MHZ
+		// ergibt SPI_BIT_RATE = 2, der SPI-Clock ist damit LSPCLK / 4 = 12,5 MHz)
+		if (peripherals & OFFLOAD_SPI_D)
+		{
+				AD5664Init(AD5664_SPI_CLOCK_16MHZ);
+		}
+		// Weitere bergebene Module (SCI, I2C) initialisieren
+		// ...
+		// Nachrichten-Austausch mit CPU 1 initialisieren
+		IpcInit(&MainHandleRequest);
 
     // Register-Schreibschutz ausschalten
     EALLOW;
 
 
-		// Einmal referenzieren damit die Variable im Debugger sichtbar ist
-    // (der Schreibbefehl hat keine Auswirkung auf den Wert, da CPU 2
-    // nur lesen kann)
-		fromCpu1[0] = 0;
-
-
     while(1)
     {
-    		// Kontinuierlich die Daten an den hardware-Monitor senden
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_A,
-												fromCpu1[0]);
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_B,
-												fromCpu1[1]);
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_C,
-												fromCpu1[2]);
-
-        while (ad5664StatusFlag == AD5664_STATUS_IN_PROGRESS);
-        AD566SetChannel(AD5664_CHANNEL_D,
-												fromCpu1[3]);
+    		// Vollstndigen Datensatz von CPU 1 lesen. Schlgt das Lesen fehl (CPU 1 schreibt
+    		// gerade ununterbrochen), bleibt der zuletzt gelesene Satz erhalten
+    		ExchangeRead(&fromCpu1, dataDac);
+    		// Kontinuierlich die Daten an den Hardware-Monitor senden. Die Funktion blockiert
+    		// nicht: Ist noch eine bertragung aktiv, wird der Satz am Ende der bertragung
+    		// aus der ISR gesendet. Die Anzahl der gesendeten Stze steht in "ad5664NumberOfSets"
+        AD5664SetChannels(dataDac);
+        // Auslastung von CPU 2 am Ende des Messfensters berechnen
+        OffloadLoadUpdate();
+
+        // Weitere Aufgaben von CPU 2
+        // ...
     }
 }
 
 
-
+//=== Function: MainHandleRequest =================================================================
+///
+/// @brief  Funktion bearbeitet eine Anfrage von CPU 1. Sie wird aus der IPC-ISR aufgerufen und
+///					muss daher kurz sein. Rckgabe "true": "response" wird an CPU 1 gesendet.
+///
+/// @param  const IpcMessage *request, IpcMessage *response
+///
+/// @return bool sendResponse
+///
+//=================================================================================================
+bool MainHandleRequest(const IpcMessage *request,
+											 IpcMessage *response)
+{
+		switch (request->command)
+		{
+				// Anzahl der gesendeten DAC-Werte-Stze (High-Word, Low-Word) und
+				// Auslastung von CPU 2 in 0,01 %
+				case MAIN_COMMAND_GET_STATUS:
+				{
+						uint32_t sets = ad5664NumberOfSets;
+						response->command = request->command;
+						response->length  = 3;
+						response->data[0] = (uint16_t)(sets >> 16);
+						response->data[1] = (uint16_t)(sets & 0xFFFF);
+						response->data[2] = (uint16_t)(offloadLoad * 100.0f);
+						return true;
+				}
+
+				// Unbekannter Befehl: keine Antwort (CPU 1 erkennt die Zeitberschreitung)
+				default:
+						return false;
+		}
+}
@@ -0,0 +1,393 @@
+//=================================================================================================
+/// @file       myIpc.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr den Austausch von Nachrichten zwischen
+///							CPU 1 und CPU 2. Jede CPU besitzt eine Warteschlange ("IpcSide") in einem eigenen
+///							GSx-RAM (CPU 1: GS2, CPU 2: GS3), in die nur sie schreibt und aus der die andere
+///							CPU nur liest. Nach dem Einreihen einer Nachricht wird die andere CPU ber das
+///							IPC-Flag IPC_FLAG_DOORBELL per Interrupt benachrichtigt ("Trklingel"), keine der
+///							beiden CPUs muss die Warteschlange abfragen. Eine Anfrage ("IpcSendRequest()")
+///							wird auf der anderen CPU in der ISR an die Bearbeitungsfunktion bergeben, deren
+///							Antwort wird ber die ID der Anfrage zugeordnet. Das Ende einer Anfrage (Antwort
+///							oder Zeitberschreitung) wird ber das Status-Element der Anfrage und optional eine
+///							Callback-Funktion gemeldet. Die Zeitberschreitung wird mit dem fr beide CPUs
+///							gemeinsamen Zhler IPCCOUNTERL (SYSCLK) gemessen. Die Datei ist in den Projekten
+///							beider CPUs identisch, die CPU wird ber die Prprozessor-Symbole CPU1 bzw. CPU2
+///							ausgewhlt.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myIpc.h"
+#include "myOffload.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Warteschlangen im gemeinsamen RAM. Beide Projekte legen die Variablen in dieselben Sektionen,
+// daher liegen sie auf beiden CPUs an derselben Adresse (die Sektionen drfen keine weiteren
+// Variablen enthalten)
+IpcSide ipcSideCpu1;
+#pragma DATA_SECTION(ipcSideCpu1,"SHARERAMGS2");
+IpcSide ipcSideCpu2;
+#pragma DATA_SECTION(ipcSideCpu2,"SHARERAMGS3");
+#ifdef CPU1
+IpcSide *const ipcLocal  = &ipcSideCpu1;
+const IpcSide *const ipcRemote = &ipcSideCpu2;
+#else
+IpcSide *const ipcLocal  = &ipcSideCpu2;
+const IpcSide *const ipcRemote = &ipcSideCpu1;
+#endif
+// Bearbeitungsfunktion fr empfangene Anfragen
+IpcHandler ipcHandler = 0;
+// Offene Anfragen (0: Platz frei) und ID der nchsten Anfrage
+IpcRequest *ipcPending[IPC_NUMBER_OF_PENDING] = {0};
+uint16_t ipcNextId = 1;
+// Puffer fr die Antwort der Bearbeitungsfunktion
+IpcMessage ipcResponse;
+// Anzahl der verworfenen Nachrichten (Warteschlange voll, unbekannte Antwort)
+uint32_t ipcErrors = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: IpcInit ===========================================================================
+///
+/// @brief  Funktion initialisiert die eigene Warteschlange und den IPC-Interrupt. "handler" wird
+///					fr jede empfangene Anfrage aus der ISR aufgerufen (0: Anfragen werden verworfen).
+///					CPU 1 weist dabei die GSx-RAMs den CPUs zu und muss die Funktion daher vor CPU 2
+///					aufrufen, CPU 2 wartet, bis CPU 1 bereit ist. Die eigene Bereitschaft wird der
+///					anderen CPU ber das Flag IPC_FLAG_READY gemeldet.
+///
+/// @param  IpcHandler handler
+///
+/// @return void
+///
+//=================================================================================================
+void IpcInit(IpcHandler handler)
+{
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+#ifdef CPU1
+    // Zugriffsberechtigung RAM-GSx (0: CPU1, 1: CPU2 hat Schreibzugriff):
+    // GS2 = Warteschlange CPU 1, GS3 = Warteschlange CPU 2
+    MemCfgRegs.GSxMSEL.bit.MSEL_GS2 = 0;
+    MemCfgRegs.GSxMSEL.bit.MSEL_GS3 = 1;
+#else
+		// Warten, bis CPU 1 die GSx-RAMs zugewiesen hat
+		while (IPC_STS_LOCAL(IPC_FLAG_READY) == 0);
+#endif
+
+		// Eigene Warteschlange zurcksetzen (der gemeinsame RAM wird beim Start nicht
+		// initialisiert). Die Indizes der anderen CPU werden erst nach deren Meldung gelesen
+		ipcLocal->writeIndex = 0;
+		ipcLocal->readIndex  = 0;
+		ipcHandler = handler;
+		for (uint16_t i = 0; i < IPC_NUMBER_OF_PENDING; i++)
+		{
+				ipcPending[i] = 0;
+		}
+
+    // CPU-Interrupts whrend der Konfiguration global sperren
+    DINT;
+    // ISR fr das Flag IPC1 der anderen CPU in der PIE-Vector Table speichern
+    PieVectTable.CIPC1_INT = &IpcISR;
+    // CIPC1-Interrupt freischalten (Zeile 1, Spalte 14 der Tabelle 3-2)
+    PieCtrlRegs.PIEIER1.bit.INTx14 = 1;
+    // CPU-Interrupt 1 einschalten
+    IER |= M_INT1;
+    // CPU-Interrupts nach Konfiguration global wieder freigeben
+    EINT;
+
+		// Bereitschaft melden (Flag bleibt gesetzt)
+		IPC_SET_REMOTE(IPC_FLAG_READY);
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: IpcIsReady ========================================================================
+///
+/// @brief  Funktion gibt "true" zurck, sobald die andere CPU ihre Warteschlange initialisiert hat.
+///					Vorher werden keine Nachrichten gesendet oder gelesen.
+///
+/// @param  void
+///
+/// @return bool ready
+///
+//=================================================================================================
+bool IpcIsReady(void)
+{
+		return (IPC_STS_LOCAL(IPC_FLAG_READY) != 0);
+}
+
+
+//=== Function: IpcSendRequest ====================================================================
+///
+/// @brief  Funktion sendet eine Anfrage (Befehl "command" mit "length" Datenworten) an die andere
+///					CPU und kehrt sofort zurck. Ist "request" 0, wird keine Antwort erwartet. Ansonsten
+///					wird die Antwort in "request->response" gespeichert und der Status auf
+///					IPC_STATUS_FINISHED gesetzt. Bleibt die Antwort lnger als "request->timeout" Takte
+///					aus, setzt "IpcCheckTimeouts()" den Status auf IPC_STATUS_TIMEOUT. Die Funktion gibt
+///					"false" zurck, falls die Anfrage nicht gesendet werden konnte (Warteschlange voll,
+///					zu viele offene Anfragen, andere CPU nicht bereit).
+///
+/// @param  IpcRequest *request, uint16_t command, const uint16_t *data, uint16_t length
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool IpcSendRequest(IpcRequest *request,
+										uint16_t command,
+										const uint16_t *data,
+										uint16_t length)
+{
+		uint16_t id = IPC_ID_NONE;
+		int16_t slot = -1;
+		bool sent;
+
+		// Interrupts sperren, damit die ISR die Anfrage erst nach dem Eintragen bearbeitet
+		uint16_t interruptState = __disable_interrupts();
+		if (request != 0)
+		{
+				for (uint16_t i = 0; i < IPC_NUMBER_OF_PENDING; i++)
+				{
+						if (ipcPending[i] == 0)
+						{
+								slot = i;
+								break;
+						}
+				}
+				if (slot < 0)
+				{
+						__restore_interrupts(interruptState);
+						return false;
+				}
+				id = ipcNextId;
+				ipcNextId = (ipcNextId == 0xFFFF) ? 1 : (ipcNextId + 1);
+				request->id     = id;
+				request->start  = IPC_REGS.IPCCOUNTERL;
+				request->status = IPC_STATUS_PENDING;
+		}
+		sent = IpcSend(IPC_TYPE_REQUEST, command, id, data, length);
+		if (sent && (slot >= 0))
+		{
+				ipcPending[slot] = request;
+		}
+		else if (request != 0)
+		{
+				request->status = IPC_STATUS_IDLE;
+		}
+		__restore_interrupts(interruptState);
+		return sent;
+}
+
+
+//=== Function: IpcSend ===========================================================================
+///
+/// @brief  Funktion schreibt eine Nachricht in die eigene Warteschlange und benachrichtigt die
+///					andere CPU per Interrupt. Die Funktion kann aus dem Hauptprogramm und aus einer ISR
+///					aufgerufen werden. Sie gibt "false" zurck, falls die Warteschlange voll, die Lnge
+///					ungltig oder die andere CPU nicht bereit ist.
+///
+/// @param  uint16_t type, uint16_t command, uint16_t id, const volatile uint16_t *data,
+///					uint16_t length
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool IpcSend(uint16_t type,
+						 uint16_t command,
+						 uint16_t id,
+						 const volatile uint16_t *data,
+						 uint16_t length)
+{
+		if (   (length > IPC_SIZE_MESSAGE_DATA)
+				|| !IpcIsReady())
+		{
+				return false;
+		}
+
+		uint16_t interruptState = __disable_interrupts();
+		uint16_t index = ipcLocal->writeIndex;
+		uint16_t next  = (index + 1) & (IPC_SIZE_QUEUE - 1);
+		// Warteschlange voll (die andere CPU hat die Nachricht noch nicht gelesen)
+		if (next == ipcRemote->readIndex)
+		{
+				__restore_interrupts(interruptState);
+				return false;
+		}
+		IpcMessage *message = &ipcLocal->messages[index];
+		message->type    = type;
+		message->command = command;
+		message->id      = id;
+		message->length  = length;
+		for (uint16_t i = 0; i < length; i++)
+		{
+				message->data[i] = data[i];
+		}
+		// Nachricht erst nach dem vollstndigen Schreiben freigeben
+		ipcLocal->writeIndex = next;
+		__restore_interrupts(interruptState);
+
+		// Andere CPU benachrichtigen
+		IPC_SET_REMOTE(IPC_FLAG_DOORBELL);
+		return true;
+}
+
+
+//=== Function: IpcCheckTimeouts ==================================================================
+///
+/// @brief  Funktion beendet alle offenen Anfragen, deren Wartezeit abgelaufen ist (Status
+///					IPC_STATUS_TIMEOUT). Die Funktion wird periodisch aufgerufen (z.B. im Hauptprogramm
+///					oder einer Timer-ISR), sie fragt nur den gemeinsamen Zhler ab, nicht die andere CPU.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void IpcCheckTimeouts(void)
+{
+		uint32_t now = IPC_REGS.IPCCOUNTERL;
+
+		for (uint16_t i = 0; i < IPC_NUMBER_OF_PENDING; i++)
+		{
+				uint16_t interruptState = __disable_interrupts();
+				IpcRequest *request = ipcPending[i];
+				// Differenz ist auch bei einem berlauf des Zhlers korrekt
+				if (   (request != 0)
+						&& ((now - request->start) > request->timeout))
+				{
+						ipcPending[i] = 0;
+						request->status = IPC_STATUS_TIMEOUT;
+				}
+				else
+				{
+						request = 0;
+				}
+				__restore_interrupts(interruptState);
+				if (   (request != 0)
+						&& (request->callback != 0))
+				{
+						request->callback(request->context);
+				}
+		}
+}
+
+
+//=== Function: IpcReceive ========================================================================
+///
+/// @brief  Funktion bearbeitet alle Nachrichten in der Warteschlange der anderen CPU: Anfragen
+///					werden an die Bearbeitungsfunktion bergeben und ggf. beantwortet, Antworten werden
+///					der offenen Anfrage mit derselben ID zugeordnet. Die Funktion wird aus der ISR
+///					aufgerufen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void IpcReceive(void)
+{
+		uint16_t index = ipcLocal->readIndex;
+
+		while (index != ipcRemote->writeIndex)
+		{
+				const IpcMessage *message = &ipcRemote->messages[index];
+
+				if (message->type == IPC_TYPE_REQUEST)
+				{
+						// Anfrage bearbeiten und ggf. beantworten
+						if (   (ipcHandler != 0)
+								&& ipcHandler(message, &ipcResponse)
+								&& (message->id != IPC_ID_NONE))
+						{
+								if (!IpcSend(IPC_TYPE_RESPONSE, ipcResponse.command, message->id,
+														 ipcResponse.data, ipcResponse.length))
+								{
+										ipcErrors++;
+								}
+						}
+				}
+				else
+				{
+						// Offene Anfrage mit derselben ID suchen
+						IpcRequest *request = 0;
+						for (uint16_t i = 0; i < IPC_NUMBER_OF_PENDING; i++)
+						{
+								if (   (ipcPending[i] != 0)
+										&& (ipcPending[i]->id == message->id))
+								{
+										request = ipcPending[i];
+										ipcPending[i] = 0;
+										break;
+								}
+						}
+						if (request != 0)
+						{
+								request->response.type    = message->type;
+								request->response.command = message->command;
+								request->response.id      = message->id;
+								request->response.length  = message->length;
+								for (uint16_t i = 0; (i < message->length) && (i < IPC_SIZE_MESSAGE_DATA); i++)
+								{
+										request->response.data[i] = message->data[i];
+								}
+								request->status = IPC_STATUS_FINISHED;
+								if (request->callback != 0)
+								{
+										request->callback(request->context);
+								}
+						}
+						else
+						{
+								// Antwort kam nach der Zeitberschreitung oder ist unbekannt
+								ipcErrors++;
+						}
+				}
+
+				// Nachricht freigeben
+				index = (index + 1) & (IPC_SIZE_QUEUE - 1);
+				ipcLocal->readIndex = index;
+		}
+}
+
+
+//=== Function: IpcISR ============================================================================
+///
+/// @brief	ISR wird aufgerufen, sobald die andere CPU eine Nachricht eingereiht hat. Das Flag wird
+///					vor dem Lesen der Warteschlange quittiert, damit eine whrend der Bearbeitung
+///					eingereihte Nachricht einen neuen Interrupt auslst. Die Laufzeit der ISR geht in die
+///					Messung der Auslastung ("offloadLoad") ein.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void IpcISR(void)
+{
+		// Beginn der ISR fr die Messung der Auslastung speichern
+		OffloadLoadBegin();
+
+		// Flag quittieren
+		IPC_ACK_LOCAL(IPC_FLAG_DOORBELL);
+		// Alle Nachrichten bearbeiten
+		IpcReceive();
+		// Interrupt-Flag der Gruppe 1 lschen (da gehren die IPC-Interrupts zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+
+		// Laufzeit der ISR erfassen
+		OffloadLoadEnd();
+}
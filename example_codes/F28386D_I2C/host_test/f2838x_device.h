@@ -0,0 +1,352 @@
+//=================================================================================================
+/// @file       f2838x_device.h
+///
+/// @brief      Ersatz fr die Registerdefinitionen aus C2000Ware fr die Host-Tests. Die Datei
+///							wird ber den Include-Pfad (-I) statt der Originaldatei eingebunden, so dass
+///							"myI2C.c" unverndert mit dem Host-Compiler (gcc) bersetzt werden kann. Es sind
+///							nur die Register und Bits enthalten, die vom Treiber verwendet werden. Die
+///							Register sind gewhnliche Variablen, die vom I2C-Modell ("i2cModel.c") gelesen und
+///							geschrieben werden.
+///
+///							Register mit Seiteneffekten beim Zugriff werden wie im SCI-Modell ber ein Makro
+///							auf ein Feld umgeleitet, dessen Index von einer Funktion des Modells bestimmt wird.
+///							Die Funktion wird vor dem eigentlichen Zugriff ausgefhrt:
+///
+///							- I2CDXR, I2CDRR: Schreiben hngt ein Byte an den Sende-FIFO an, Lesen entnimmt
+///							  ein Byte aus dem Empfangs-FIFO
+///							- I2CFFTX, I2CFFRX: Vor jedem Zugriff werden ein FIFO-Reset (TXFFRST/RXFFRST = 0)
+///							  und das Lschen der Interrupt-Flags (TXFFINTCLR/RXFFINTCLR) des vorherigen
+///							  Zugriffs ausgefhrt
+///							- I2CSTR: Die durch Schreiben einer 1 gelschten Flags SCD, NACK und ARDY sind im
+///							  Modell 2 Bit breit. Das Modell setzt ein Flag auf 2, der Treiber liest einen
+///							  Wert ungleich 0 und schreibt zum Lschen eine 1, die vor dem nchsten Zugriff
+///							  durch 0 ersetzt wird
+///
+///							Die CPU-Interrupts werden durch das Flag "hostInterruptsEnabled" nachgebildet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef F2838X_DEVICE_H_
+#define F2838X_DEVICE_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "f2838x_cla_typedefs.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Maskierung der CPU-Interrupt-Gruppen im Register IER
+#define M_INT8																	0x0080
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Compiler-Erweiterungen und Assembler-Befehle des C28x haben auf dem Host keine Funktion
+#define __interrupt
+#define __asm(x)
+#define EALLOW
+#define EDIS
+// Globales Sperren und Freigeben der CPU-Interrupts
+#define DINT																		(hostInterruptsEnabled = false)
+#define EINT																		(hostInterruptsEnabled = true)
+// Zugriffe auf Register mit Seiteneffekten ber das I2C-Modell (siehe oben)
+#define I2CDXR																	I2CDXR_MODEL[I2cModelWriteTx()]
+#define I2CDRR																	I2CDRR_MODEL[I2cModelReadRx()]
+#define I2CFFTX																	I2CFFTX_MODEL[I2cModelAccessFifo()]
+#define I2CFFRX																	I2CFFRX_MODEL[I2cModelAccessFifo()]
+#define I2CSTR																	I2CSTR_MODEL[I2cModelAccessStatus()]
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+typedef void (*PINT)(void);
+
+// I2C-Register
+struct I2CSAR_BITS
+{
+		uint16_t SAR:10;
+		uint16_t rsvd1:6;
+};
+union I2CSAR_REG
+{
+		uint16_t all;
+		struct I2CSAR_BITS bit;
+};
+
+struct I2CIER_BITS
+{
+		uint16_t ARBL:1;
+		uint16_t NACK:1;
+		uint16_t ARDY:1;
+		uint16_t RRDY:1;
+		uint16_t XRDY:1;
+		uint16_t SCD:1;
+		uint16_t AAS:1;
+		uint16_t rsvd1:9;
+};
+union I2CIER_REG
+{
+		uint16_t all;
+		struct I2CIER_BITS bit;
+};
+
+// Flags SCD, NACK und ARDY im Modell 2 Bit breit (siehe oben)
+struct I2CSTR_BITS
+{
+		uint16_t NACK:2;
+		uint16_t ARDY:2;
+		uint16_t SCD:2;
+		uint16_t BB:1;
+		uint16_t rsvd1:9;
+};
+union I2CSTR_REG
+{
+		uint16_t all;
+		struct I2CSTR_BITS bit;
+};
+
+struct I2CDRR_BITS
+{
+		uint16_t DATA:8;
+		uint16_t rsvd1:8;
+};
+union I2CDRR_REG
+{
+		uint16_t all;
+		struct I2CDRR_BITS bit;
+};
+
+struct I2CDXR_BITS
+{
+		uint16_t DATA:8;
+		uint16_t rsvd1:8;
+};
+union I2CDXR_REG
+{
+		uint16_t all;
+		struct I2CDXR_BITS bit;
+};
+
+struct I2CMDR_BITS
+{
+		uint16_t BC:3;
+		uint16_t FDF:1;
+		uint16_t STB:1;
+		uint16_t IRS:1;
+		uint16_t DLB:1;
+		uint16_t RM:1;
+		uint16_t XA:1;
+		uint16_t TRX:1;
+		uint16_t MST:1;
+		uint16_t STP:1;
+		uint16_t rsvd1:1;
+		uint16_t STT:1;
+		uint16_t FREE:1;
+		uint16_t NACKMOD:1;
+};
+union I2CMDR_REG
+{
+		uint16_t all;
+		struct I2CMDR_BITS bit;
+};
+
+struct I2CPSC_BITS
+{
+		uint16_t IPSC:8;
+		uint16_t rsvd1:8;
+};
+union I2CPSC_REG
+{
+		uint16_t all;
+		struct I2CPSC_BITS bit;
+};
+
+struct I2CFFTX_BITS
+{
+		uint16_t TXFFIL:5;
+		uint16_t TXFFIENA:1;
+		uint16_t TXFFINTCLR:1;
+		uint16_t TXFFINT:1;
+		uint16_t TXFFST:5;
+		uint16_t TXFFRST:1;
+		uint16_t I2CFFEN:1;
+		uint16_t rsvd1:1;
+};
+union I2CFFTX_REG
+{
+		uint16_t all;
+		struct I2CFFTX_BITS bit;
+};
+
+struct I2CFFRX_BITS
+{
+		uint16_t RXFFIL:5;
+		uint16_t RXFFIENA:1;
+		uint16_t RXFFINTCLR:1;
+		uint16_t RXFFINT:1;
+		uint16_t RXFFST:5;
+		uint16_t RXFFRST:1;
+		uint16_t rsvd1:2;
+};
+union I2CFFRX_REG
+{
+		uint16_t all;
+		struct I2CFFRX_BITS bit;
+};
+
+// Register eines I2C-Moduls. Register mit Seiteneffekten sind im Modell Felder, deren Index
+// von den Zugriffsfunktionen des Modells bestimmt wird
+struct I2C_REGS
+{
+		uint16_t I2COAR;
+		union I2CIER_REG I2CIER;
+		union I2CSTR_REG I2CSTR_MODEL[1];
+		uint16_t I2CCLKL;
+		uint16_t I2CCLKH;
+		uint16_t I2CCNT;
+		union I2CDRR_REG I2CDRR_MODEL[1];
+		union I2CSAR_REG I2CSAR;
+		union I2CDXR_REG I2CDXR_MODEL[16];
+		union I2CMDR_REG I2CMDR;
+		union I2CPSC_REG I2CPSC;
+		union I2CFFTX_REG I2CFFTX_MODEL[1];
+		union I2CFFRX_REG I2CFFRX_MODEL[1];
+};
+
+// Systemregister
+struct PCLKCR9_BITS
+{
+		uint32_t I2C_A:1;
+		uint32_t I2C_B:1;
+		uint32_t rsvd1:30;
+};
+union PCLKCR9_REG
+{
+		uint32_t all;
+		struct PCLKCR9_BITS bit;
+};
+struct CPU_SYS_REGS
+{
+		union PCLKCR9_REG PCLKCR9;
+};
+
+// GPIO-Steuerregister (nur GPIO 0 und 1 von Port A)
+struct GPA_1BIT_BITS
+{
+		uint32_t GPIO0:1;
+		uint32_t GPIO1:1;
+		uint32_t rsvd1:30;
+};
+union GPA_1BIT_REG
+{
+		uint32_t all;
+		struct GPA_1BIT_BITS bit;
+};
+struct GPA_2BIT_BITS
+{
+		uint32_t GPIO0:2;
+		uint32_t GPIO1:2;
+		uint32_t rsvd1:28;
+};
+union GPA_2BIT_REG
+{
+		uint32_t all;
+		struct GPA_2BIT_BITS bit;
+};
+struct GPIO_CTRL_REGS
+{
+		union GPA_2BIT_REG GPAQSEL1;
+		union GPA_2BIT_REG GPAMUX1;
+		union GPA_1BIT_REG GPAPUD;
+		union GPA_2BIT_REG GPAGMUX1;
+		union GPA_1BIT_REG GPALOCK;
+};
+
+// PIE-Register und PIE-Vector Table
+struct PIEACK_BITS
+{
+		uint16_t ACK1:1;
+		uint16_t ACK2:1;
+		uint16_t ACK3:1;
+		uint16_t ACK4:1;
+		uint16_t ACK5:1;
+		uint16_t ACK6:1;
+		uint16_t ACK7:1;
+		uint16_t ACK8:1;
+		uint16_t ACK9:1;
+		uint16_t ACK10:1;
+		uint16_t ACK11:1;
+		uint16_t ACK12:1;
+		uint16_t rsvd1:4;
+};
+union PIEACK_REG
+{
+		uint16_t all;
+		struct PIEACK_BITS bit;
+};
+struct PIEIER_BITS
+{
+		uint16_t INTx1:1;
+		uint16_t INTx2:1;
+		uint16_t INTx3:1;
+		uint16_t INTx4:1;
+		uint16_t INTx5:1;
+		uint16_t INTx6:1;
+		uint16_t INTx7:1;
+		uint16_t INTx8:1;
+		uint16_t rsvd1:8;
+};
+union PIEIER_REG
+{
+		uint16_t all;
+		struct PIEIER_BITS bit;
+};
+struct PIE_CTRL_REGS
+{
+		union PIEACK_REG PIEACK;
+		union PIEIER_REG PIEIER8;
+};
+struct PIE_VECT_TABLE
+{
+		PINT I2CA_INT;
+		PINT I2CA_FIFO_INT;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+extern volatile struct I2C_REGS I2caRegs;
+extern volatile struct CPU_SYS_REGS CpuSysRegs;
+extern volatile struct GPIO_CTRL_REGS GpioCtrlRegs;
+extern volatile struct PIE_CTRL_REGS PieCtrlRegs;
+extern struct PIE_VECT_TABLE PieVectTable;
+extern volatile uint16_t IER;
+// Nachbildung des globalen Interrupt-Flags (INTM = !hostInterruptsEnabled)
+extern volatile bool hostInterruptsEnabled;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktionen des I2C-Modells fr die Zugriffe auf Register mit Seiteneffekten
+extern uint16_t I2cModelWriteTx(void);
+extern uint16_t I2cModelReadRx(void);
+extern uint16_t I2cModelAccessFifo(void);
+extern uint16_t I2cModelAccessStatus(void);
+// Intrinsics des C28x-Compilers zum Sperren und Wiederherstellen der CPU-Interrupts
+extern uint16_t __disable_interrupts(void);
+extern void __restore_interrupts(uint16_t state);
+
+
+#endif
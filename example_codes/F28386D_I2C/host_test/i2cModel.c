@@ -0,0 +1,584 @@
+//=================================================================================================
+/// @file       i2cModel.c
+///
+/// @brief      Datei enthlt ein Modell des I2C-Moduls I2C-A (Master, Non-Repeat Mode) und eines
+///							Slaves fr die Host-Tests von "myI2C.c" (siehe "i2cModel.h").
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <string.h>
+#include "i2cModel.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Register (siehe "f2838x_device.h")
+volatile struct I2C_REGS I2caRegs;
+volatile struct CPU_SYS_REGS CpuSysRegs;
+volatile struct GPIO_CTRL_REGS GpioCtrlRegs;
+volatile struct PIE_CTRL_REGS PieCtrlRegs;
+struct PIE_VECT_TABLE PieVectTable;
+volatile uint16_t IER;
+volatile bool hostInterruptsEnabled;
+// Zustand des Modells
+I2cModel i2cModel;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+// Dauer einer SCL-Periode in ns aus I2CPSC, I2CCLKL und I2CCLKH (SYSCLK = 200 MHz). Der Wert d
+// hngt vom Vorteiler ab (siehe S. 3630 Reference Manual TMS320F2838x, SPRUII0D)
+static uint64_t I2cModelBitTime(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		uint64_t ipsc = regs->I2CPSC.bit.IPSC;
+		uint64_t d    = (ipsc == 0) ? 7U : ((ipsc == 1) ? 6U : 5U);
+		return (regs->I2CCLKL + d + regs->I2CCLKH + d) * (ipsc + 1U) * 5U;
+}
+
+
+// Aktion des Masters starten, die nach "bits" SCL-Perioden abgeschlossen ist
+static void I2cModelSchedule(uint16_t state,
+														 uint16_t bits)
+{
+		i2cModel.state        = state;
+		i2cModel.eventPending = true;
+		i2cModel.eventTime    = i2cModel.time + (uint64_t)bits * i2cModel.bitTime;
+}
+
+
+// (Wiederholte) START-Bedingung und Adress-Byte senden
+static void I2cModelStartAddress(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		regs->I2CMDR.bit.STT = 0;
+		regs->I2CSTR_MODEL[0].bit.BB = 1;
+		i2cModel.transmit = regs->I2CMDR.bit.TRX;
+		i2cModel.bitTime  = I2cModelBitTime();
+		// START + 7 Bit Adresse + R/W + ACK
+		I2cModelSchedule(I2C_MODEL_STATE_ADDRESS, 10);
+}
+
+
+// Adress-Byte gesendet: Slave antwortet mit ACK oder NACK
+static void I2cModelAddressDone(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		I2cModelSlave *slave = &i2cModel.slave;
+		if (   (regs->I2CSAR.bit.SAR != slave->address)
+				|| (i2cModel.time < slave->busyUntil))
+		{
+				// Im Non-Repeat Mode wird ohne STP zustzlich ARDY gesetzt
+				regs->I2CSTR_MODEL[0].bit.NACK = 2;
+				if (!regs->I2CMDR.bit.STP)
+				{
+						regs->I2CSTR_MODEL[0].bit.ARDY = 2;
+				}
+				i2cModel.nacks++;
+				i2cModel.state = I2C_MODEL_STATE_HOLD;
+				return;
+		}
+		i2cModel.count = regs->I2CCNT;
+		if (i2cModel.transmit)
+		{
+				slave->bytesWritten   = 0;
+				slave->writeLogLength = 0;
+				i2cModel.state = I2C_MODEL_STATE_TRANSMIT;
+		}
+		else
+		{
+				slave->bytesRead = 0;
+				i2cModel.state = I2C_MODEL_STATE_RECEIVE;
+		}
+}
+
+
+// Slave empfngt ein Byte
+static void I2cModelSlaveWrite(uint16_t data)
+{
+		I2cModelSlave *slave = &i2cModel.slave;
+		if (slave->writeLogLength < I2C_MODEL_SIZE_LOG)
+		{
+				slave->writeLog[slave->writeLogLength++] = data;
+		}
+		if (slave->bytesWritten < slave->addressBytes)
+		{
+				slave->pointer = (slave->bytesWritten == 0) ? data : (uint16_t)((slave->pointer << 8) | data);
+		}
+		else
+		{
+				slave->memory[slave->pointer % I2C_MODEL_SIZE_MEMORY] = data;
+				slave->pointer++;
+		}
+		slave->bytesWritten++;
+}
+
+
+// Slave sendet ein Byte
+static uint16_t I2cModelSlaveRead(void)
+{
+		I2cModelSlave *slave = &i2cModel.slave;
+		uint16_t data = slave->memory[slave->pointer % I2C_MODEL_SIZE_MEMORY];
+		slave->pointer++;
+		slave->bytesRead++;
+		return data;
+}
+
+
+// STOP-Bedingung gesendet
+static void I2cModelStopDone(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		I2cModelSlave *slave = &i2cModel.slave;
+		regs->I2CMDR.bit.STP = 0;
+		regs->I2CSTR_MODEL[0].bit.BB  = 0;
+		regs->I2CSTR_MODEL[0].bit.SCD = 2;
+		i2cModel.stops++;
+		i2cModel.rxFifoAtStop = regs->I2CFFRX_MODEL[0].bit.RXFFST;
+		// Nach dem Schreiben von Daten startet der Schreibzyklus des Slaves
+		if (   i2cModel.transmit
+				&& (slave->bytesWritten > slave->addressBytes))
+		{
+				slave->busyUntil = i2cModel.time + slave->writeCycleTime;
+		}
+		i2cModel.state = I2C_MODEL_STATE_IDLE;
+}
+
+
+// Nchste Aktion des Masters bis zum Zeitpunkt "end" ausfhren. Gibt "false" zurck, falls
+// der Master bis dahin wartet (Bus frei, Clock Stretching oder laufende Aktion)
+static bool I2cModelStep(uint64_t end)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		I2cModelAccessFifo();
+		I2cModelAccessStatus();
+
+		// Laufende Aktion abschlieen
+		if (i2cModel.eventPending)
+		{
+				if (i2cModel.eventTime > end)
+				{
+						return false;
+				}
+				i2cModel.time         = i2cModel.eventTime;
+				i2cModel.eventPending = false;
+				switch (i2cModel.state)
+				{
+						case I2C_MODEL_STATE_ADDRESS:
+								I2cModelAddressDone();
+								break;
+						case I2C_MODEL_STATE_TRANSMIT:
+								I2cModelSlaveWrite(i2cModel.shifterData);
+								i2cModel.count--;
+								break;
+						case I2C_MODEL_STATE_RECEIVE:
+								i2cModel.rxFifo[i2cModel.rxHead % I2C_MODEL_SIZE_FIFO] = I2cModelSlaveRead();
+								i2cModel.rxHead++;
+								regs->I2CFFRX_MODEL[0].bit.RXFFST++;
+								i2cModel.count--;
+								break;
+						case I2C_MODEL_STATE_STOP:
+								I2cModelStopDone();
+								break;
+						default:
+								break;
+				}
+				return true;
+		}
+
+		// Nchste Aktion starten
+		switch (i2cModel.state)
+		{
+				case I2C_MODEL_STATE_IDLE:
+						if (   regs->I2CMDR.bit.IRS
+								&& regs->I2CMDR.bit.MST
+								&& regs->I2CMDR.bit.STT)
+						{
+								i2cModel.starts++;
+								I2cModelStartAddress();
+								return true;
+						}
+						return false;
+
+				case I2C_MODEL_STATE_TRANSMIT:
+				case I2C_MODEL_STATE_RECEIVE:
+						// Alle Bytes bertragen: STOP-Bedingung oder ARDY
+						if (i2cModel.count == 0)
+						{
+								if (regs->I2CMDR.bit.STP)
+								{
+										I2cModelSchedule(I2C_MODEL_STATE_STOP, 1);
+								}
+								else
+								{
+										regs->I2CSTR_MODEL[0].bit.ARDY = 2;
+										i2cModel.state = I2C_MODEL_STATE_HOLD;
+								}
+								return true;
+						}
+						// Clock Stretching bei leerem Sende- bzw. vollem Empfangs-FIFO
+						if (i2cModel.transmit)
+						{
+								if (regs->I2CFFTX_MODEL[0].bit.TXFFST == 0)
+								{
+										if (!i2cModel.stalled)
+										{
+												i2cModel.stalled = true;
+												i2cModel.stallsTx++;
+										}
+										return false;
+								}
+								i2cModel.shifterData = regs->I2CDXR_MODEL[i2cModel.txTail % I2C_MODEL_SIZE_FIFO].bit.DATA;
+								i2cModel.txTail++;
+								regs->I2CFFTX_MODEL[0].bit.TXFFST--;
+						}
+						else if (regs->I2CFFRX_MODEL[0].bit.RXFFST >= I2C_MODEL_SIZE_FIFO)
+						{
+								if (!i2cModel.stalled)
+								{
+										i2cModel.stalled = true;
+										i2cModel.stallsRx++;
+								}
+								return false;
+						}
+						i2cModel.stalled = false;
+						// 8 Datenbits + ACK
+						I2cModelSchedule(i2cModel.state, 9);
+						return true;
+
+				case I2C_MODEL_STATE_HOLD:
+						// Master hlt den Bus bis zur wiederholten START- oder zur STOP-Bedingung
+						if (regs->I2CMDR.bit.STT)
+						{
+								i2cModel.repeatedStarts++;
+								I2cModelStartAddress();
+								return true;
+						}
+						if (regs->I2CMDR.bit.STP)
+						{
+								I2cModelSchedule(I2C_MODEL_STATE_STOP, 1);
+								return true;
+						}
+						return false;
+
+				default:
+						return false;
+		}
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: __disable_interrupts ==============================================================
+///
+/// @brief  Nachbildung des Intrinsics: Sperrt die CPU-Interrupts und gibt den vorherigen Zustand
+///					zurck (1: gesperrt, entspricht INTM).
+///
+/// @param  void
+///
+/// @return uint16_t state
+///
+//=================================================================================================
+uint16_t __disable_interrupts(void)
+{
+		uint16_t state = hostInterruptsEnabled ? 0 : 1;
+		hostInterruptsEnabled = false;
+		return state;
+}
+
+
+//=== Function: __restore_interrupts ==============================================================
+///
+/// @brief  Nachbildung des Intrinsics: Stellt den mit "__disable_interrupts()" gesicherten Zustand
+///					der CPU-Interrupts wieder her.
+///
+/// @param  uint16_t state
+///
+/// @return void
+///
+//=================================================================================================
+void __restore_interrupts(uint16_t state)
+{
+		hostInterruptsEnabled = (state == 0);
+}
+
+
+//=== Function: I2cModelReset =====================================================================
+///
+/// @brief  Funktion setzt alle Register und den Zustand des Modells zurck. Der Slave antwortet
+///					auf die 7-Bit Adresse "slaveAddress" und erwartet "addressBytes" Adress-Bytes (0, 1
+///					oder 2). Der Speicher des Slaves ist mit 0 gefllt, die CPU-Interrupts sind gesperrt.
+///
+/// @param  uint16_t slaveAddress, uint16_t addressBytes
+///
+/// @return void
+///
+//=================================================================================================
+void I2cModelReset(uint16_t slaveAddress,
+									 uint16_t addressBytes)
+{
+		memset((void *)&I2caRegs, 0, sizeof(I2caRegs));
+		memset((void *)&PieCtrlRegs, 0, sizeof(PieCtrlRegs));
+		memset(&PieVectTable, 0, sizeof(PieVectTable));
+		memset(&i2cModel, 0, sizeof(i2cModel));
+		i2cModel.slave.address      = slaveAddress;
+		i2cModel.slave.addressBytes = addressBytes;
+		IER = 0;
+		hostInterruptsEnabled = false;
+}
+
+
+//=== Function: I2cModelClearStatistics ===========================================================
+///
+/// @brief  Funktion setzt die Statistik zurck, damit sie fr die nchste bertragung einzeln
+///					geprft werden kann.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void I2cModelClearStatistics(void)
+{
+		i2cModel.starts                 = 0;
+		i2cModel.repeatedStarts         = 0;
+		i2cModel.stops                  = 0;
+		i2cModel.nacks                  = 0;
+		i2cModel.stallsTx               = 0;
+		i2cModel.stallsRx               = 0;
+		i2cModel.txFifoOverflow         = 0;
+		i2cModel.isrCalls               = 0;
+		i2cModel.isrCallsFifo           = 0;
+		i2cModel.interruptLoops         = 0;
+		i2cModel.interruptsEnabledInIsr = 0;
+		i2cModel.rxFifoAtStop           = 0;
+		i2cModel.rxLevelLogLength       = 0;
+}
+
+
+//=== Function: I2cModelWriteTx ===================================================================
+///
+/// @brief  Funktion wird bei jedem Schreiben von I2CDXR ausgefhrt (siehe "f2838x_device.h")
+///					und gibt den Platz im Sende-FIFO zurck, in den das Byte geschrieben wird. Wird in
+///					einen vollen FIFO geschrieben, geht das Byte verloren ("txFifoOverflow").
+///
+/// @param  void
+///
+/// @return uint16_t index
+///
+//=================================================================================================
+uint16_t I2cModelWriteTx(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		if (regs->I2CFFTX_MODEL[0].bit.TXFFST >= I2C_MODEL_SIZE_FIFO)
+		{
+				i2cModel.txFifoOverflow++;
+				// Byte in einen Platz schreiben, der nicht gesendet wird
+				return (i2cModel.txTail + I2C_MODEL_SIZE_FIFO - 1U) % I2C_MODEL_SIZE_FIFO;
+		}
+		uint16_t index = i2cModel.txHead % I2C_MODEL_SIZE_FIFO;
+		i2cModel.txHead++;
+		regs->I2CFFTX_MODEL[0].bit.TXFFST++;
+		return index;
+}
+
+
+//=== Function: I2cModelReadRx ====================================================================
+///
+/// @brief  Funktion wird bei jedem Lesen von I2CDRR ausgefhrt (siehe "f2838x_device.h"). Das
+///					lteste Byte wird aus dem Empfangs-FIFO entnommen und in I2CDRR bereitgestellt.
+///
+/// @param  void
+///
+/// @return uint16_t index
+///
+//=================================================================================================
+uint16_t I2cModelReadRx(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		if (regs->I2CFFRX_MODEL[0].bit.RXFFST > 0)
+		{
+				regs->I2CDRR_MODEL[0].bit.DATA = i2cModel.rxFifo[i2cModel.rxTail % I2C_MODEL_SIZE_FIFO];
+				i2cModel.rxTail++;
+				regs->I2CFFRX_MODEL[0].bit.RXFFST--;
+		}
+		return 0;
+}
+
+
+//=== Function: I2cModelAccessFifo ================================================================
+///
+/// @brief  Funktion wird vor jedem Zugriff auf I2CFFTX und I2CFFRX ausgefhrt (siehe
+///					"f2838x_device.h") und fhrt einen FIFO-Reset bzw. das Lschen der Interrupt-Flags
+///					aus, die beim vorherigen Zugriff geschrieben wurden.
+///
+/// @param  void
+///
+/// @return uint16_t index
+///
+//=================================================================================================
+uint16_t I2cModelAccessFifo(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		if (!regs->I2CFFTX_MODEL[0].bit.TXFFRST)
+		{
+				regs->I2CFFTX_MODEL[0].bit.TXFFST = 0;
+				i2cModel.txHead = 0;
+				i2cModel.txTail = 0;
+		}
+		if (!regs->I2CFFRX_MODEL[0].bit.RXFFRST)
+		{
+				regs->I2CFFRX_MODEL[0].bit.RXFFST = 0;
+				i2cModel.rxHead = 0;
+				i2cModel.rxTail = 0;
+		}
+		if (regs->I2CFFTX_MODEL[0].bit.TXFFINTCLR)
+		{
+				regs->I2CFFTX_MODEL[0].bit.TXFFINT    = 0;
+				regs->I2CFFTX_MODEL[0].bit.TXFFINTCLR = 0;
+		}
+		if (regs->I2CFFRX_MODEL[0].bit.RXFFINTCLR)
+		{
+				regs->I2CFFRX_MODEL[0].bit.RXFFINT    = 0;
+				regs->I2CFFRX_MODEL[0].bit.RXFFINTCLR = 0;
+		}
+		return 0;
+}
+
+
+//=== Function: I2cModelAccessStatus ==============================================================
+///
+/// @brief  Funktion wird vor jedem Zugriff auf I2CSTR ausgefhrt (siehe "f2838x_device.h") und
+///					lscht die Flags, in die beim vorherigen Zugriff eine 1 geschrieben wurde.
+///
+/// @param  void
+///
+/// @return uint16_t index
+///
+//=================================================================================================
+uint16_t I2cModelAccessStatus(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		if (regs->I2CSTR_MODEL[0].bit.SCD == 1)
+		{
+				regs->I2CSTR_MODEL[0].bit.SCD = 0;
+		}
+		if (regs->I2CSTR_MODEL[0].bit.NACK == 1)
+		{
+				regs->I2CSTR_MODEL[0].bit.NACK = 0;
+		}
+		if (regs->I2CSTR_MODEL[0].bit.ARDY == 1)
+		{
+				regs->I2CSTR_MODEL[0].bit.ARDY = 0;
+		}
+		return 0;
+}
+
+
+//=== Function: I2cModelService ===================================================================
+///
+/// @brief  Funktion aktualisiert die pegelgesteuerten FIFO-Flags und ruft die ISRs auf, solange
+///					ein Interrupt anliegt und die CPU-Interrupts freigegeben sind. Der I2C-Interrupt
+///					(INT8.1) hat Vorrang vor dem FIFO-Interrupt (INT8.2). Whrend der ISR sind die CPU-
+///					Interrupts gesperrt (wie in der Hardware). Gibt eine ISR die Interrupts frei, wird
+///					dies in "interruptsEnabledInIsr" gezhlt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void I2cModelService(void)
+{
+		volatile struct I2C_REGS *regs = &I2caRegs;
+		for (uint16_t i = 0; i < I2C_MODEL_MAX_ISR_CALLS; i++)
+		{
+				I2cModelAccessFifo();
+				I2cModelAccessStatus();
+				// FIFO-Flags werden gesetzt, solange die Bedingung erfllt ist
+				if (regs->I2CFFTX_MODEL[0].bit.I2CFFEN)
+				{
+						if (regs->I2CFFTX_MODEL[0].bit.TXFFST <= regs->I2CFFTX_MODEL[0].bit.TXFFIL)
+						{
+								regs->I2CFFTX_MODEL[0].bit.TXFFINT = 1;
+						}
+						if (regs->I2CFFRX_MODEL[0].bit.RXFFST >= regs->I2CFFRX_MODEL[0].bit.RXFFIL)
+						{
+								regs->I2CFFRX_MODEL[0].bit.RXFFINT = 1;
+						}
+				}
+				if (   !hostInterruptsEnabled
+						|| !(IER & M_INT8))
+				{
+						return;
+				}
+
+				PINT isr = 0;
+				if (   PieCtrlRegs.PIEIER8.bit.INTx1
+						&& (   (regs->I2CSTR_MODEL[0].bit.SCD  && regs->I2CIER.bit.SCD)
+								|| (regs->I2CSTR_MODEL[0].bit.NACK && regs->I2CIER.bit.NACK)
+								|| (regs->I2CSTR_MODEL[0].bit.ARDY && regs->I2CIER.bit.ARDY)))
+				{
+						isr = PieVectTable.I2CA_INT;
+						i2cModel.isrCalls++;
+				}
+				else if (   PieCtrlRegs.PIEIER8.bit.INTx2
+								 && (   (regs->I2CFFTX_MODEL[0].bit.TXFFINT && regs->I2CFFTX_MODEL[0].bit.TXFFIENA)
+										 || (regs->I2CFFRX_MODEL[0].bit.RXFFINT && regs->I2CFFRX_MODEL[0].bit.RXFFIENA)))
+				{
+						isr = PieVectTable.I2CA_FIFO_INT;
+						i2cModel.isrCallsFifo++;
+						if (   regs->I2CFFRX_MODEL[0].bit.RXFFINT
+								&& regs->I2CFFRX_MODEL[0].bit.RXFFIENA
+								&& (i2cModel.rxLevelLogLength < I2C_MODEL_SIZE_LEVEL_LOG))
+						{
+								i2cModel.rxLevelLog[i2cModel.rxLevelLogLength++] = regs->I2CFFRX_MODEL[0].bit.RXFFIL;
+						}
+				}
+				if (isr == 0)
+				{
+						return;
+				}
+				hostInterruptsEnabled = false;
+				isr();
+				if (hostInterruptsEnabled)
+				{
+						i2cModel.interruptsEnabledInIsr++;
+				}
+				hostInterruptsEnabled = true;
+		}
+		i2cModel.interruptLoops++;
+}
+
+
+//=== Function: I2cModelRun =======================================================================
+///
+/// @brief  Funktion lsst "duration" ns vergehen. Der Master fhrt dabei die angeforderten
+///					Aktionen aus (START, Adresse, Datenbytes, STOP), nach jeder nderung werden die ISRs
+///					aufgerufen.
+///
+/// @param  uint64_t duration
+///
+/// @return void
+///
+//=================================================================================================
+void I2cModelRun(uint64_t duration)
+{
+		uint64_t end = i2cModel.time + duration;
+		I2cModelService();
+		while (I2cModelStep(end))
+		{
+				I2cModelService();
+		}
+		i2cModel.time = end;
+}
@@ -0,0 +1,146 @@
+//=================================================================================================
+/// @file       i2cModel.h
+///
+/// @brief      Datei enthlt ein Modell des I2C-Moduls I2C-A (Master, Non-Repeat Mode) und eines
+///							Slaves fr die Host-Tests von "myI2C.c". Nachgebildet werden:
+///
+///							- Der 16 Bytes tiefe Sende- und Empfangs-FIFO mit den pegelgesteuerten
+///							  FIFO-Interrupts (TXFFST <= TXFFIL bzw. RXFFST >= RXFFIL)
+///							- START (STT), Adress-Byte, I2CCNT Datenbytes und STOP (STP) mit einer Dauer von
+///							  9 SCL-Perioden pro Byte (SCL aus I2CPSC, I2CCLKL und I2CCLKH)
+///							- Clock Stretching: Ist der Sende-FIFO leer bzw. der Empfangs-FIFO voll, hlt der
+///							  Master SCL und wartet (es geht kein Byte verloren)
+///							- ARDY nach I2CCNT Bytes ohne STP, wiederholte START-Bedingung, SCD nach STOP
+///							- NACK, falls der Slave nicht antwortet (falsche Adresse oder Schreibzyklus)
+///
+///							Der Slave verhlt sich wie ein EEPROM: Die ersten "addressBytes" geschriebenen
+///							Bytes setzen den Adress-Zeiger, weitere Bytes werden in den Speicher geschrieben
+///							bzw. ab dem Adress-Zeiger gelesen. Die Zeit wird in ns mit "I2cModelRun()"
+///							weitergezhlt, die ISRs werden dabei ber die PIE-Vector Table aufgerufen.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef I2CMODEL_H_
+#define I2CMODEL_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "f2838x_device.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Gre der Hardware-FIFOs
+#define I2C_MODEL_SIZE_FIFO											16
+// Gre des Speichers des Slaves
+#define I2C_MODEL_SIZE_MEMORY										4096
+// Max. Anzahl an protokollierten Bytes einer Schreib-bertragung
+#define I2C_MODEL_SIZE_LOG											1024
+// Max. Anzahl an protokollierten Schwellwerten des Empfangs-FIFOs
+#define I2C_MODEL_SIZE_LEVEL_LOG								64
+// Max. Anzahl an ISR-Aufrufen ohne Fortschritt der Zeit (Erkennung einer Interrupt-Schleife)
+#define I2C_MODEL_MAX_ISR_CALLS									64
+
+// Zustnde des Masters
+#define I2C_MODEL_STATE_IDLE										0
+#define I2C_MODEL_STATE_ADDRESS									1
+#define I2C_MODEL_STATE_TRANSMIT								2
+#define I2C_MODEL_STATE_RECEIVE									3
+#define I2C_MODEL_STATE_HOLD										4
+#define I2C_MODEL_STATE_STOP										5
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Zustand des Slaves
+typedef struct
+{
+		// 7-Bit Adresse und Anzahl der Adress-Bytes (0: kein Adress-Zeiger)
+		uint16_t address;
+		uint16_t addressBytes;
+		// Speicher und Adress-Zeiger
+		uint16_t memory[I2C_MODEL_SIZE_MEMORY];
+		uint16_t pointer;
+		// Anzahl der in der aktuellen Schreib-bertragung empfangenen Bytes
+		uint16_t bytesWritten;
+		// Dauer des Schreibzyklus in ns nach einer Schreib-bertragung (Slave antwortet mit NACK)
+		uint64_t writeCycleTime;
+		uint64_t busyUntil;
+		// Alle Bytes der letzten Schreib-bertragung (inkl. Adress-Bytes)
+		uint16_t writeLog[I2C_MODEL_SIZE_LOG];
+		uint16_t writeLogLength;
+		// Anzahl der gelesenen Bytes der letzten Lese-bertragung
+		uint16_t bytesRead;
+} I2cModelSlave;
+
+// Zustand und Statistik des Modells
+typedef struct
+{
+		// Aktuelle Zeit und Dauer einer SCL-Periode in ns
+		uint64_t time;
+		uint64_t bitTime;
+		// Zustand des Masters, Ende der laufenden Aktion und verbleibende Bytes (I2CCNT)
+		uint16_t state;
+		bool eventPending;
+		uint64_t eventTime;
+		bool transmit;
+		uint16_t count;
+		uint16_t shifterData;
+		// Empfangs-FIFO (die Bytes des Sende-FIFOs liegen in I2caRegs.I2CDXR_MODEL)
+		uint16_t rxFifo[I2C_MODEL_SIZE_FIFO];
+		uint16_t rxHead;
+		uint16_t rxTail;
+		uint16_t txHead;
+		uint16_t txTail;
+		// Slave
+		I2cModelSlave slave;
+		// Statistik
+		uint32_t starts;
+		uint32_t repeatedStarts;
+		uint32_t stops;
+		uint32_t nacks;
+		uint32_t stallsTx;
+		uint32_t stallsRx;
+		bool stalled;
+		uint32_t txFifoOverflow;
+		uint32_t isrCalls;
+		uint32_t isrCallsFifo;
+		uint32_t interruptLoops;
+		uint32_t interruptsEnabledInIsr;
+		// Bytes im Empfangs-FIFO beim Ende der STOP-Bedingung
+		uint16_t rxFifoAtStop;
+		// Schwellwert RXFFIL bei jedem Aufruf der FIFO-ISR fr den Empfangs-FIFO
+		uint16_t rxLevelLog[I2C_MODEL_SIZE_LEVEL_LOG];
+		uint16_t rxLevelLogLength;
+} I2cModel;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+extern I2cModel i2cModel;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion setzt alle Register und den Zustand des Modells zurck
+extern void I2cModelReset(uint16_t slaveAddress,
+													uint16_t addressBytes);
+// Funktion setzt die Statistik einer bertragung zurck
+extern void I2cModelClearStatistics(void);
+// Funktion lsst "duration" ns vergehen und ruft dabei die ISRs auf
+extern void I2cModelRun(uint64_t duration);
+// Funktion ruft die ISRs auf, solange ein Interrupt anliegt
+extern void I2cModelService(void);
+
+
+#endif
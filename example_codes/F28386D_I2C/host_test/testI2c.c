@@ -0,0 +1,442 @@
+//=================================================================================================
+/// @file       testI2c.c
+///
+/// @brief      Host-Test des I2C-Treibers ("myI2C.c") mit dem I2C-Modell ("i2cModel.c"). Der
+///							Treiber wird unverndert bersetzt und kommuniziert mit 400 kHz mit einem Slave,
+///							der sich wie ein EEPROM mit 2 Adress-Bytes verhlt. Geprft werden:
+///
+///							- Schreiben: "I2cFillFifoTxA()" ldt den Sende-FIFO beim Start und aus der
+///							  FIFO-ISR nach, alle Bytes kommen in der richtigen Reihenfolge an
+///							- Lesen: "I2cEmptyFifoRxA()" leert den Empfangs-FIFO in Blcken von
+///							  I2C_FIFO_LEVEL_RX Bytes, fr den letzten Block wird RXFFIL auf die Anzahl der
+///							  fehlenden Bytes verkleinert (der FIFO ist beim STOP bereits leer)
+///							- Schreiben-Lesen: Schreiben -> ARDY -> wiederholte START-Bedingung -> Lesen
+///							- bertragungen ber 64 Bytes mit eigenen Puffern ("I2cTransferA()")
+///							- Clock Stretching bei verzgerter FIFO-ISR ohne Datenverlust
+///							- NACK (falsche Adresse, Schreibzyklus des Slaves) ergibt I2C_STATUS_ERROR ohne
+///							  wiederholte START-Bedingung, die nchste bertragung ist wieder fehlerfrei
+///
+///							Aufruf: make test
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include "i2cModel.h"
+#include "../myI2C.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Adresse des Slaves
+#define TEST_SLAVE_ADDRESS											0x50
+// Zeit in ns
+#define TEST_US																	1000ULL
+#define TEST_MS																	1000000ULL
+// Max. Dauer einer bertragung
+#define TEST_TIMEOUT														(100ULL * TEST_MS)
+// Gre der Puffer fr lange bertragungen
+#define TEST_SIZE_LONG													300
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+#define CHECK(condition)																																	\
+		do																																										\
+		{																																											\
+				if (!(condition))																																	\
+				{																																									\
+						printf("  FEHLER %s:%d: %s\n", __FILE__, __LINE__, #condition);								\
+						testErrors++;																																	\
+				}																																									\
+		} while (0)
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+static uint32_t testErrors = 0;
+// Aufrufe der Callback-Funktion und zuletzt gemeldeter Status
+static uint32_t testCallbacks = 0;
+static uint16_t testCallbackStatus = I2C_STATUS_IDLE;
+// Puffer fr lange bertragungen
+static uint16_t testWrite[TEST_SIZE_LONG];
+static uint16_t testRead[TEST_SIZE_LONG];
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+// Wird vom Treiber am Ende jeder bertragung aufgerufen
+static void TestCallback(uint16_t status)
+{
+		testCallbacks++;
+		testCallbackStatus = status;
+}
+
+
+// Inhalt des Slave-Speichers an der Adresse "address"
+static uint16_t TestPattern(uint16_t address)
+{
+		return (uint16_t)((address * 7U + 3U) & 0x00FF);
+}
+
+
+// Modell zurcksetzen und I2C-A mit 400 kHz initialisieren
+static void TestInit(void)
+{
+		I2cModelReset(TEST_SLAVE_ADDRESS, 2);
+		for (uint16_t i = 0; i < I2C_MODEL_SIZE_MEMORY; i++)
+		{
+				i2cModel.slave.memory[i] = TestPattern(i);
+		}
+		I2cInitA(I2C_CLOCK_400_KHZ);
+		I2cSetCallbackA(TestCallback);
+}
+
+
+// Statistik vor einer bertragung zurcksetzen
+static void TestBegin(void)
+{
+		I2cModelClearStatistics();
+		testCallbacks      = 0;
+		testCallbackStatus = I2C_STATUS_IDLE;
+}
+
+
+// Modell laufen lassen, bis die bertragung abgeschlossen ist, und Status zurckgeben
+static uint16_t TestWait(void)
+{
+		uint64_t start = i2cModel.time;
+		while (   (I2cGetStatusA() == I2C_STATUS_IN_PROGRESS)
+					 && ((i2cModel.time - start) < TEST_TIMEOUT))
+		{
+				I2cModelRun(10U * TEST_US);
+		}
+		uint16_t status = I2cGetStatusA();
+		CHECK(status != I2C_STATUS_IN_PROGRESS);
+		// Am Ende jeder bertragung wird die Callback-Funktion genau einmal aufgerufen
+		CHECK(testCallbacks == 1);
+		CHECK(testCallbackStatus == status);
+		CHECK(i2cModel.state == I2C_MODEL_STATE_IDLE);
+		CHECK(i2cModel.txFifoOverflow == 0);
+		CHECK(i2cModel.interruptLoops == 0);
+		CHECK(i2cModel.interruptsEnabledInIsr == 0);
+		// FIFO-Interrupts sind nach der bertragung ausgeschaltet
+		CHECK(!I2caRegs.I2CFFTX_MODEL[0].bit.TXFFIENA);
+		CHECK(!I2caRegs.I2CFFRX_MODEL[0].bit.RXFFIENA);
+		return status;
+}
+
+
+// Erwartete Schwellwerte RXFFIL bei den Aufrufen der FIFO-ISR fr "length" Bytes
+static uint16_t TestLevels(uint16_t length,
+													 uint16_t *levels)
+{
+		uint16_t count = 0;
+		uint16_t level = (length < I2C_FIFO_LEVEL_RX) ? length : I2C_FIFO_LEVEL_RX;
+		while (length)
+		{
+				levels[count++] = level;
+				length -= level;
+				if (length < I2C_FIFO_LEVEL_RX)
+				{
+						level = length;
+				}
+		}
+		return count;
+}
+
+
+// Prft die Schwellwerte des Empfangs-FIFOs und dass der letzte Block vor dem STOP gelesen wurde
+static void TestCheckLevels(uint16_t length)
+{
+		uint16_t levels[I2C_MODEL_SIZE_LEVEL_LOG];
+		uint16_t count = TestLevels(length, levels);
+		CHECK(i2cModel.rxLevelLogLength == count);
+		for (uint16_t i = 0; (i < count) && (i < i2cModel.rxLevelLogLength); i++)
+		{
+				CHECK(i2cModel.rxLevelLog[i] == levels[i]);
+		}
+		CHECK(i2cModel.rxFifoAtStop == 0);
+}
+
+
+// Schreiben (Adress-Bytes + Daten) mit "I2cWriteA()"
+static void TestWrite(void)
+{
+		static const uint16_t lengths[] = {1, 2, 3, 15, 16, 17, 20, 21, 33, 64};
+		printf("Schreiben\n");
+		TestInit();
+		for (uint16_t n = 0; n < (sizeof(lengths) / sizeof(lengths[0])); n++)
+		{
+				uint16_t length  = lengths[n];
+				uint16_t address = (uint16_t)(0x0100U + n * 0x40U);
+				i2cBufferWriteA[0] = address >> 8;
+				i2cBufferWriteA[1] = address & 0x00FF;
+				for (uint16_t i = 2; i < length; i++)
+				{
+						i2cBufferWriteA[i] = (uint16_t)((0xA0U + n + i) & 0x00FF);
+				}
+				TestBegin();
+				CHECK(I2cWriteA(TEST_SLAVE_ADDRESS, length));
+				// Whrend der bertragung wird keine weitere gestartet
+				CHECK(!I2cWriteA(TEST_SLAVE_ADDRESS, length));
+				CHECK(TestWait() == I2C_STATUS_FINISHED);
+				CHECK(i2cModel.starts == 1);
+				CHECK(i2cModel.repeatedStarts == 0);
+				CHECK(i2cModel.stops == 1);
+				CHECK(i2cModel.stallsTx == 0);
+				CHECK(i2cModel.slave.writeLogLength == length);
+				for (uint16_t i = 0; i < length; i++)
+				{
+						CHECK(i2cModel.slave.writeLog[i] == i2cBufferWriteA[i]);
+				}
+				for (uint16_t i = 2; i < length; i++)
+				{
+						CHECK(i2cModel.slave.memory[address + i - 2U] == i2cBufferWriteA[i]);
+				}
+				printf("  %2u Bytes: FIFO-ISR %lu\n", length, (unsigned long)i2cModel.isrCallsFifo);
+		}
+}
+
+
+// Lesen ab dem aktuellen Adress-Zeiger des Slaves mit "I2cReadA()"
+static void TestRead(void)
+{
+		static const uint16_t lengths[] = {1, 2, 7, 8, 9, 15, 16, 17, 20, 40, 63, 64};
+		printf("Lesen\n");
+		TestInit();
+		for (uint16_t n = 0; n < (sizeof(lengths) / sizeof(lengths[0])); n++)
+		{
+				uint16_t length  = lengths[n];
+				uint16_t address = (uint16_t)(0x0200U + n * 0x40U);
+				i2cModel.slave.pointer = address;
+				I2cInitBufferReadA();
+				TestBegin();
+				CHECK(I2cReadA(TEST_SLAVE_ADDRESS, length));
+				CHECK(TestWait() == I2C_STATUS_FINISHED);
+				CHECK(i2cModel.starts == 1);
+				CHECK(i2cModel.repeatedStarts == 0);
+				CHECK(i2cModel.stops == 1);
+				CHECK(i2cModel.stallsRx == 0);
+				CHECK(i2cModel.slave.bytesRead == length);
+				for (uint16_t i = 0; i < length; i++)
+				{
+						CHECK(i2cBufferReadA[i] == TestPattern(address + i));
+				}
+				TestCheckLevels(length);
+				printf("  %2u Bytes: FIFO-ISR %lu, RXFFIL", length, (unsigned long)i2cModel.isrCallsFifo);
+				for (uint16_t i = 0; i < i2cModel.rxLevelLogLength; i++)
+				{
+						printf(" %u", i2cModel.rxLevelLog[i]);
+				}
+				printf("\n");
+		}
+}
+
+
+// Schreiben der Adresse, ARDY, wiederholte START-Bedingung und Lesen mit "I2cWriteReadA()"
+static void TestWriteRead(void)
+{
+		static const uint16_t lengths[] = {1, 8, 9, 20, 64};
+		printf("Schreiben-Lesen\n");
+		TestInit();
+		for (uint16_t n = 0; n < (sizeof(lengths) / sizeof(lengths[0])); n++)
+		{
+				uint16_t length  = lengths[n];
+				uint16_t address = (uint16_t)(0x0300U + n * 0x55U);
+				i2cBufferWriteA[0] = address >> 8;
+				i2cBufferWriteA[1] = address & 0x00FF;
+				I2cInitBufferReadA();
+				TestBegin();
+				CHECK(I2cWriteReadA(TEST_SLAVE_ADDRESS, 2, length));
+				CHECK(TestWait() == I2C_STATUS_FINISHED);
+				CHECK(i2cModel.starts == 1);
+				CHECK(i2cModel.repeatedStarts == 1);
+				CHECK(i2cModel.stops == 1);
+				CHECK(i2cModel.slave.writeLogLength == 2);
+				CHECK(i2cModel.slave.bytesRead == length);
+				for (uint16_t i = 0; i < length; i++)
+				{
+						CHECK(i2cBufferReadA[i] == TestPattern(address + i));
+				}
+				TestCheckLevels(length);
+				// ARDY wird nur fr die eine wiederholte START-Bedingung bentigt
+				CHECK(!I2caRegs.I2CIER.bit.ARDY);
+				CHECK(!I2caRegs.I2CSTR_MODEL[0].bit.ARDY);
+		}
+}
+
+
+// bertragungen ber die Gre der Software-Puffer mit "I2cTransferA()"
+static void TestLong(void)
+{
+		printf("Lange Uebertragungen (%u Bytes)\n", TEST_SIZE_LONG);
+		TestInit();
+		uint16_t address = 0x0400;
+		testWrite[0] = address >> 8;
+		testWrite[1] = address & 0x00FF;
+		for (uint16_t i = 2; i < TEST_SIZE_LONG; i++)
+		{
+				testWrite[i] = (uint16_t)((i * 13U) & 0x00FF);
+		}
+		TestBegin();
+		CHECK(I2cTransferA(TEST_SLAVE_ADDRESS, testWrite, TEST_SIZE_LONG, 0, 0));
+		uint64_t start = i2cModel.time;
+		CHECK(TestWait() == I2C_STATUS_FINISHED);
+		printf("  Schreiben: %.2f ms, FIFO-ISR %lu\n",
+					 (double)(i2cModel.time - start) / 1.0e6, (unsigned long)i2cModel.isrCallsFifo);
+		CHECK(i2cModel.stallsTx == 0);
+		CHECK(i2cModel.slave.writeLogLength == TEST_SIZE_LONG);
+		for (uint16_t i = 0; i < TEST_SIZE_LONG; i++)
+		{
+				CHECK(i2cModel.slave.writeLog[i] == testWrite[i]);
+		}
+
+		TestBegin();
+		CHECK(I2cTransferA(TEST_SLAVE_ADDRESS, testWrite, 2, testRead, TEST_SIZE_LONG - 2U));
+		start = i2cModel.time;
+		CHECK(TestWait() == I2C_STATUS_FINISHED);
+		printf("  Schreiben-Lesen: %.2f ms, FIFO-ISR %lu\n",
+					 (double)(i2cModel.time - start) / 1.0e6, (unsigned long)i2cModel.isrCallsFifo);
+		CHECK(i2cModel.repeatedStarts == 1);
+		CHECK(i2cModel.stallsRx == 0);
+		for (uint16_t i = 0; i < (TEST_SIZE_LONG - 2U); i++)
+		{
+				CHECK(testRead[i] == testWrite[i + 2U]);
+		}
+		TestCheckLevels(TEST_SIZE_LONG - 2U);
+
+		// Ungltige Parameter
+		CHECK(!I2cTransferA(TEST_SLAVE_ADDRESS, 0, 2, 0, 0));
+		CHECK(!I2cTransferA(TEST_SLAVE_ADDRESS, testWrite, 2, 0, 2));
+		CHECK(!I2cTransferA(TEST_SLAVE_ADDRESS, testWrite, 0, testRead, 0));
+}
+
+
+// Verzgerte FIFO-ISR: Der Master hlt SCL, bis der FIFO nachgeladen bzw. geleert wurde
+static void TestStall(void)
+{
+		printf("Clock Stretching\n");
+		TestInit();
+		uint16_t address = 0x0500;
+		testWrite[0] = address >> 8;
+		testWrite[1] = address & 0x00FF;
+		for (uint16_t i = 2; i < 64; i++)
+		{
+				testWrite[i] = (uint16_t)((i * 29U) & 0x00FF);
+		}
+
+		// Sende-FIFO luft leer
+		TestBegin();
+		PieCtrlRegs.PIEIER8.bit.INTx2 = 0;
+		CHECK(I2cTransferA(TEST_SLAVE_ADDRESS, testWrite, 64, 0, 0));
+		I2cModelRun(2U * TEST_MS);
+		CHECK(i2cModel.stallsTx == 1);
+		CHECK(i2cModel.slave.writeLogLength == I2C_MODEL_SIZE_FIFO);
+		PieCtrlRegs.PIEIER8.bit.INTx2 = 1;
+		CHECK(TestWait() == I2C_STATUS_FINISHED);
+		CHECK(i2cModel.slave.writeLogLength == 64);
+		for (uint16_t i = 0; i < 64; i++)
+		{
+				CHECK(i2cModel.slave.writeLog[i] == testWrite[i]);
+		}
+
+		// Empfangs-FIFO luft voll
+		TestBegin();
+		PieCtrlRegs.PIEIER8.bit.INTx2 = 0;
+		CHECK(I2cTransferA(TEST_SLAVE_ADDRESS, testWrite, 2, testRead, 62));
+		I2cModelRun(2U * TEST_MS);
+		CHECK(i2cModel.stallsRx == 1);
+		CHECK(I2caRegs.I2CFFRX_MODEL[0].bit.RXFFST == I2C_MODEL_SIZE_FIFO);
+		PieCtrlRegs.PIEIER8.bit.INTx2 = 1;
+		CHECK(TestWait() == I2C_STATUS_FINISHED);
+		for (uint16_t i = 0; i < 62; i++)
+		{
+				CHECK(testRead[i] == testWrite[i + 2U]);
+		}
+		CHECK(i2cModel.rxFifoAtStop == 0);
+}
+
+
+// NACK des Slaves
+static void TestNack(void)
+{
+		printf("NACK\n");
+		TestInit();
+		i2cBufferWriteA[0] = 0x00;
+		i2cBufferWriteA[1] = 0x10;
+		i2cBufferWriteA[2] = 0x55;
+
+		// Falsche Adresse beim Schreiben, Lesen und Schreiben-Lesen
+		TestBegin();
+		CHECK(I2cWriteA(TEST_SLAVE_ADDRESS + 1U, 3));
+		CHECK(TestWait() == I2C_STATUS_ERROR);
+		CHECK(i2cModel.nacks == 1);
+		CHECK(i2cModel.stops == 1);
+		// Nicht gesendete Bytes wurden verworfen
+		CHECK(I2caRegs.I2CFFTX_MODEL[0].bit.TXFFST == 0);
+
+		TestBegin();
+		CHECK(I2cReadA(TEST_SLAVE_ADDRESS + 1U, 20));
+		CHECK(TestWait() == I2C_STATUS_ERROR);
+		CHECK(i2cModel.nacks == 1);
+		CHECK(i2cModel.stops == 1);
+
+		TestBegin();
+		CHECK(I2cWriteReadA(TEST_SLAVE_ADDRESS + 1U, 2, 8));
+		CHECK(TestWait() == I2C_STATUS_ERROR);
+		CHECK(i2cModel.nacks == 1);
+		CHECK(i2cModel.repeatedStarts == 0);
+		CHECK(i2cModel.stops == 1);
+
+		// Schreibzyklus des Slaves: Die nchste bertragung wird erst danach besttigt
+		i2cModel.slave.writeCycleTime = 5U * TEST_MS;
+		TestBegin();
+		CHECK(I2cWriteA(TEST_SLAVE_ADDRESS, 3));
+		CHECK(TestWait() == I2C_STATUS_FINISHED);
+		CHECK(i2cModel.slave.memory[0x0010] == 0x55);
+		TestBegin();
+		CHECK(I2cWriteReadA(TEST_SLAVE_ADDRESS, 2, 1));
+		CHECK(TestWait() == I2C_STATUS_ERROR);
+		CHECK(i2cModel.repeatedStarts == 0);
+		I2cModelRun(5U * TEST_MS);
+
+		// Die nchste bertragung ist wieder fehlerfrei
+		TestBegin();
+		CHECK(I2cWriteReadA(TEST_SLAVE_ADDRESS, 2, 1));
+		CHECK(TestWait() == I2C_STATUS_FINISHED);
+		CHECK(i2cModel.nacks == 0);
+		CHECK(i2cBufferReadA[0] == 0x55);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Main
+//-------------------------------------------------------------------------------------------------
+int main(void)
+{
+		TestWrite();
+		TestRead();
+		TestWriteRead();
+		TestLong();
+		TestStall();
+		TestNack();
+
+		if (testErrors != 0)
+		{
+				printf("testI2c: %lu Fehler\n", (unsigned long)testErrors);
+				return 1;
+		}
+		printf("testI2c: OK\n");
+		return 0;
+}
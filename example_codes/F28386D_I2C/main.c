@@ -7,10 +7,16 @@
 ///						Funktion sind im Modul zu finden.
 ///
 ///						nderung myI2C.c V2.0: Verwendung der Hardware-FIFOs zum Senden und Empfangen
+///						nderung myI2C.c V3.0: bertragungen beliebiger Lnge ber die FIFO-Interrupts
+///						nderung main.c V1.5  : Periodische Auftrge ("myI2cJobs.c"), zwei Sensoren werden
+///						nach dem Beispiel ohne Zutun des Hauptprogramms mit festen Raten gelesen
+///						nderung main.c V1.6  : Kalibrierung wird beim Start aus dem EEPROM geladen
+///						("myEeprom.c"), beim ersten Start werden die Standardwerte gespeichert (nur wenn
+///						kein Datensatz vorhanden ist, nicht bei einem Lesefehler)
 ///
-/// @version	V1.3
+/// @version	V1.6
 ///
-/// @date			27.03.2023
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -18,6 +24,8 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myI2C.h"
+#include "myI2cJobs.h"
+#include "myEeprom.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -33,6 +41,24 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Eigener Lese-Puffer fr das Beispiel mit "I2cTransferA()" (grer als die Hardware-FIFOs)
+uint16_t mainData[256];
+// Kalibrierung der Platine (Beispiel: Offset und Verstrkung zweier Messkanle), wird
+// beim Start aus dem EEPROM geladen. Die Initialwerte sind die Standardwerte
+uint16_t mainCalibration[4] = {2048, 32768, 2048, 32768};
+// Ziel-Puffer der periodischen Auftrge (werden von der I2C-ISR beschrieben)
+uint16_t mainTemperature[2];
+uint16_t mainVoltage[2];
+// Periodische Auftrge: Slave-Adresse, Register, Anzahl der Bytes, Periode in ms, Ziel-Puffer
+// (Zeitberschreitung nicht angegeben: I2C_JOBS_TIMEOUT_DEFAULT, die brigen Elemente setzt
+// der Scheduler)
+I2cJob mainJobs[] =
+{
+		// 0: Temperatur (z.B. TMP1075, Register 0x00) alle 100 ms
+		{0x48, 0x00, 2, 100, mainTemperature},
+		// 1: Busspannung (z.B. INA226, Register 0x02) alle 10 ms
+		{0x40, 0x02, 2, 10,  mainVoltage}
+};
 
 
 //=== Function: main ==============================================================================
@@ -52,6 +78,26 @@ void main(void)
 		// I2C initialisieren mit 400 kHz SCL-Takt
 		I2cInitA(I2C_CLOCK_400_KHZ);
 
+		// Kalibrierung mit einer bertragung aus dem EEPROM laden. Ist noch kein
+		// gltiger Datensatz vorhanden (erster Start), die Standardwerte speichern.
+		// Bei einem Lesefehler mit den Standardwerten weiterarbeiten, aber nichts
+		// schreiben (der vorhandene Datensatz knnte berschrieben werden)
+		EepromInit();
+		uint16_t loadStatus = EepromLoadRecord(mainCalibration, sizeof(mainCalibration) / sizeof(uint16_t));
+		if (loadStatus == EEPROM_LOAD_NO_RECORD)
+		{
+				if (!EepromSaveRecord(mainCalibration, sizeof(mainCalibration) / sizeof(uint16_t)))
+				{
+						// Fehlerbehandlung:
+
+				}
+		}
+		else if (loadStatus == EEPROM_LOAD_ERROR)
+		{
+				// Fehlerbehandlung:
+
+		}
+
     // Register-Schreibschutz ausschalten
     EALLOW;
 
@@ -70,7 +116,8 @@ void main(void)
 		// Um Daten ber I2C an einen Slave zu senden,  mssen diese in den Sende-Puffer "i2cBufferWriteA[]"
 		// geschrieben werden. Dabei mssen die Daten am Anfang des Puffers geschrieben werden (beginnend
 		// vom Element 0 an). Es ist darauf zu achten, dass nicht mehr Daten geschrieben, als der Puffer
-		// gro ist (I2C_SIZE_BUFFER_WRITE).
+		// gro ist (I2C_SIZE_BUFFER). Fr grere Datenmengen oder eigene Puffer kann die Funktion
+		// "I2cTransferA()" verwendet werden.
 		i2cBufferWriteA[0] = 0xAA;
 		i2cBufferWriteA[1] = 0xFF;
 		i2cBufferWriteA[2] = 0x0F;
@@ -99,6 +146,15 @@ void main(void)
 				{
 						// Fehlerbehandlung:
 
+				}
+
+				// 2 Bytes (z.B. Speicheradresse) an Slave-Adresse 0x50 senden und 256 Bytes in einen
+				// eigenen Puffer lesen. Die FIFO-ISR holt die Bytes in Blcken ab, die CPU muss
+				// whrend der bertragung nicht warten
+				if (!I2cTransferA(0x50, i2cBufferWriteA, 2, mainData, 256))
+				{
+						// Fehlerbehandlung:
+
 				}
 				*/
 		}
@@ -122,6 +178,15 @@ void main(void)
 				I2cInitA(I2C_CLOCK_100_KHZ);
 		}
 
+		// Periodische Auftrge starten. Ab hier gehrt der Bus dem Scheduler, die Ziel-Puffer
+		// werden ohne Zutun des Hauptprogramms aktualisiert. Ob neue Daten vorliegen, zeigt
+		// "count" des jeweiligen Auftrags, Fehler und Latenzen stehen ebenfalls im Auftrag
+		if (!I2cJobsInit(mainJobs, sizeof(mainJobs) / sizeof(I2cJob)))
+		{
+				// Fehlerbehandlung:
+
+		}
+
     // Register-Schreibschutz ausschalten
     EALLOW;
 
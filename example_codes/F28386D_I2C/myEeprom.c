@@ -0,0 +1,399 @@
+//=================================================================================================
+/// @file       myEeprom.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein I2C-EEPROM (z.B. 24LC256, 32 kByte,
+///							Seiten zu 64 Byte, 2 Byte Speicheradresse) am Modul I2C-A ("myI2C.c"), um die
+///							Kalibrierung und Konfiguration einer Platine dauerhaft zu speichern. Schreibzugriffe
+///							werden an den Seitengrenzen aufgeteilt, das Ende des internen Schreibzyklus wird
+///							durch Abfragen des ACK erkannt ("Acknowledge Polling") statt mit einer festen
+///							Wartezeit. Gelesen wird mit einer einzigen bertragung beliebiger Lnge.
+///
+///							Die Kalibrierung wird als Datensatz ("Record") gespeichert. Fr die Datenstze
+///							gibt es EEPROM_RECORD_SLOTS Pltze zu je einer Seite, die reihum beschrieben werden,
+///							sodass sich die Schreibzyklen auf alle Pltze verteilen. Aufbau eines Platzes
+///							(Bytes): Kennung (2), Sequenznummer (2), Anzahl der Datenworte (2), Datenworte
+///							(je 2, MSB zuerst), CRC-16 ber alle vorherigen Bytes (2, letzte Bytes des Platzes).
+///							Beim Start werden alle Pltze mit einer bertragung gelesen und der gltige
+///							Datensatz mit der hchsten Sequenznummer bernommen. Ein beim Schreiben
+///							unterbrochener Datensatz wird ber die CRC erkannt, der vorherige bleibt gltig.
+///
+///							Die Funktionen warten auf das Ende der bertragung und sind fr den Start bzw.
+///							seltene Zugriffe gedacht. Sie drfen nicht verwendet werden, whrend periodische
+///							Auftrge ("myI2cJobs.c") laufen.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myEeprom.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Abbild aller Pltze der Datenstze (ein Byte pro Element)
+uint16_t eepromImage[EEPROM_RECORD_SLOTS * EEPROM_SIZE_RECORD];
+// Sende-Puffer: Speicheradresse (2 Byte) und Daten einer Seite
+uint16_t eepromBuffer[2 + EEPROM_SIZE_PAGE];
+// Platz und Sequenznummer des aktuellen Datensatzes (EEPROM_RECORD_NONE: keiner)
+uint16_t eepromRecordSlot = EEPROM_RECORD_NONE;
+uint16_t eepromRecordSequence = 0;
+// Ergebnis des letzten Aufrufs von "EepromLoadRecord()"
+uint16_t eepromLoadStatus = EEPROM_LOAD_ERROR;
+// Max. gemessene Dauer eines internen Schreibzyklus in us
+uint32_t eepromWriteCycleMax = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: EepromInit ========================================================================
+///
+/// @brief  Funktion setzt den Zustand des Treibers zurck (kein Datensatz geladen). Das I2C-Modul
+///					muss zuvor mit "I2cInitA()" initialisiert werden (empfohlen: I2C_CLOCK_400_KHZ, das
+///					EEPROM untersttzt 400 kHz).
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void EepromInit(void)
+{
+		eepromRecordSlot     = EEPROM_RECORD_NONE;
+		eepromRecordSequence = 0;
+		eepromLoadStatus     = EEPROM_LOAD_ERROR;
+		eepromWriteCycleMax  = 0;
+}
+
+
+//=== Function: EepromRead ========================================================================
+///
+/// @brief  Funktion liest "length" Bytes ab der Speicheradresse "address" nach "data" (ein Byte
+///					pro Element). Die Speicheradresse wird geschrieben, nach einer wiederholten START-
+///					Bedingung werden alle Bytes mit einer bertragung gelesen (das EEPROM erhht die
+///					Adresse selbststndig, auch ber Seitengrenzen). Die Funktion wartet auf das Ende
+///					der bertragung und gibt "false" zurck, falls sie nicht gestartet werden konnte
+///					oder fehlerhaft war.
+///
+/// @param  uint16_t address, uint16_t *data, uint16_t length
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool EepromRead(uint16_t address,
+								uint16_t *data,
+								uint16_t length)
+{
+		if (   (length == 0)
+				|| ((uint32_t)address + length > EEPROM_SIZE))
+		{
+				return false;
+		}
+		eepromBuffer[0] = address >> 8;
+		eepromBuffer[1] = address & 0xFF;
+		if (!I2cTransferA(EEPROM_SLAVE_ADDRESS, eepromBuffer, 2, data, length))
+		{
+				return false;
+		}
+		return (EepromWaitForTransfer() == I2C_STATUS_FINISHED);
+}
+
+
+//=== Function: EepromWrite =======================================================================
+///
+/// @brief  Funktion schreibt "length" Bytes aus "data" (ein Byte pro Element) ab der Speicher-
+///					adresse "address". Die Daten werden an den Seitengrenzen aufgeteilt, da das EEPROM
+///					innerhalb einer Seite sonst wieder am Seitenanfang weiterschreibt. Nach jeder Seite
+///					wird per Acknowledge Polling auf das Ende des internen Schreibzyklus gewartet. Die
+///					Funktion gibt "false" zurck, falls eine bertragung fehlerhaft war oder der
+///					Schreibzyklus nicht rechtzeitig beendet wurde.
+///
+/// @param  uint16_t address, const uint16_t *data, uint16_t length
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool EepromWrite(uint16_t address,
+								 const uint16_t *data,
+								 uint16_t length)
+{
+		if (   (length == 0)
+				|| ((uint32_t)address + length > EEPROM_SIZE))
+		{
+				return false;
+		}
+		while (length)
+		{
+				// Anzahl der Bytes bis zum Ende der aktuellen Seite
+				uint16_t chunk = EEPROM_SIZE_PAGE - (address % EEPROM_SIZE_PAGE);
+				if (chunk > length)
+				{
+						chunk = length;
+				}
+				eepromBuffer[0] = address >> 8;
+				eepromBuffer[1] = address & 0xFF;
+				for (uint16_t i = 0; i < chunk; i++)
+				{
+						eepromBuffer[2 + i] = data[i] & 0xFF;
+				}
+				if (   !I2cTransferA(EEPROM_SLAVE_ADDRESS, eepromBuffer, 2 + chunk, 0, 0)
+						|| (EepromWaitForTransfer() != I2C_STATUS_FINISHED)
+						|| !EepromPollAck())
+				{
+						return false;
+				}
+				address += chunk;
+				data    += chunk;
+				length  -= chunk;
+		}
+		return true;
+}
+
+
+//=== Function: EepromLoadRecord ==================================================================
+///
+/// @brief  Funktion liest alle Pltze der Datenstze mit einer einzigen bertragung in das Abbild
+///					"eepromImage[]" und kopiert die Datenworte des gltigen Datensatzes mit der hchsten
+///					Sequenznummer nach "data". Enthlt der Datensatz weniger als "numberOfWords" Worte
+///					(z.B. ltere Firmware), bleiben die brigen Elemente von "data" unverndert. Ein
+///					Lesefehler und ein fehlender Datensatz werden unterschieden: Nur bei
+///					EEPROM_LOAD_NO_RECORD (z.B. erster Start) drfen die Standardwerte gespeichert
+///					werden. Bei EEPROM_LOAD_ERROR ist der Inhalt des EEPROMs unbekannt, ein Speichern
+///					knnte den neuesten Datensatz berschreiben und wird von "EepromSaveRecord()"
+///					abgelehnt.
+///
+/// @param  uint16_t *data, uint16_t numberOfWords
+///
+/// @return uint16_t status (EEPROM_LOAD_ERROR, EEPROM_LOAD_NO_RECORD oder EEPROM_LOAD_OK)
+///
+//=================================================================================================
+uint16_t EepromLoadRecord(uint16_t *data,
+													uint16_t numberOfWords)
+{
+		eepromRecordSlot = EEPROM_RECORD_NONE;
+		eepromLoadStatus = EEPROM_LOAD_ERROR;
+		if (!EepromRead(EEPROM_RECORD_ADDRESS, eepromImage, EEPROM_RECORD_SLOTS * EEPROM_SIZE_RECORD))
+		{
+				return EEPROM_LOAD_ERROR;
+		}
+		// Gltigen Datensatz mit der hchsten Sequenznummer suchen (Vergleich mit
+		// Vorzeichen, damit der berlauf der Sequenznummer keine Rolle spielt)
+		for (uint16_t slot = 0; slot < EEPROM_RECORD_SLOTS; slot++)
+		{
+				if (!EepromCheckSlot(slot))
+				{
+						continue;
+				}
+				const uint16_t *record = &eepromImage[slot * EEPROM_SIZE_RECORD];
+				uint16_t sequence = (record[2] << 8) | record[3];
+				if (   (eepromRecordSlot == EEPROM_RECORD_NONE)
+						|| ((int16_t)(sequence - eepromRecordSequence) > 0))
+				{
+						eepromRecordSlot     = slot;
+						eepromRecordSequence = sequence;
+				}
+		}
+		if (eepromRecordSlot == EEPROM_RECORD_NONE)
+		{
+				eepromLoadStatus = EEPROM_LOAD_NO_RECORD;
+				return EEPROM_LOAD_NO_RECORD;
+		}
+		const uint16_t *record = &eepromImage[eepromRecordSlot * EEPROM_SIZE_RECORD];
+		uint16_t length = (record[4] << 8) | record[5];
+		if (length > numberOfWords)
+		{
+				length = numberOfWords;
+		}
+		for (uint16_t i = 0; i < length; i++)
+		{
+				data[i] = (record[EEPROM_RECORD_HEADER + 2 * i] << 8)
+								| record[EEPROM_RECORD_HEADER + 2 * i + 1];
+		}
+		eepromLoadStatus = EEPROM_LOAD_OK;
+		return EEPROM_LOAD_OK;
+}
+
+
+//=== Function: EepromSaveRecord ==================================================================
+///
+/// @brief  Funktion schreibt "numberOfWords" Datenworte aus "data" als neuen Datensatz in den Platz
+///					nach dem aktuellen Datensatz (reihum, gleichmige Abnutzung). Der Datensatz belegt
+///					genau eine Seite und wird daher mit einem Schreibzyklus geschrieben. Anschlieend wird
+///					er zurckgelesen und geprft. Erst dann gilt er als aktueller Datensatz, bei einem
+///					Fehler bleibt der vorherige Datensatz gltig. "EepromLoadRecord()" muss vorher
+///					erfolgreich aufgerufen worden sein (EEPROM_LOAD_OK oder EEPROM_LOAD_NO_RECORD),
+///					damit die Sequenznummer fortgesetzt wird, sonst gibt die Funktion "false" zurck.
+///
+/// @param  const uint16_t *data, uint16_t numberOfWords
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool EepromSaveRecord(const uint16_t *data,
+											uint16_t numberOfWords)
+{
+		if (   (numberOfWords > EEPROM_RECORD_MAX_WORDS)
+				|| (eepromLoadStatus == EEPROM_LOAD_ERROR))
+		{
+				return false;
+		}
+		uint16_t slot = 0;
+		uint16_t sequence = 0;
+		if (eepromRecordSlot != EEPROM_RECORD_NONE)
+		{
+				slot     = (eepromRecordSlot + 1) % EEPROM_RECORD_SLOTS;
+				sequence = eepromRecordSequence + 1;
+		}
+		// Datensatz im Abbild aufbauen, nicht benutzte Bytes auf 0xFF (gelschter Zustand)
+		uint16_t *record = &eepromImage[slot * EEPROM_SIZE_RECORD];
+		for (uint16_t i = 0; i < EEPROM_SIZE_RECORD; i++)
+		{
+				record[i] = 0xFF;
+		}
+		record[0] = EEPROM_RECORD_MAGIC >> 8;
+		record[1] = EEPROM_RECORD_MAGIC & 0xFF;
+		record[2] = sequence >> 8;
+		record[3] = sequence & 0xFF;
+		record[4] = numberOfWords >> 8;
+		record[5] = numberOfWords & 0xFF;
+		for (uint16_t i = 0; i < numberOfWords; i++)
+		{
+				record[EEPROM_RECORD_HEADER + 2 * i]     = data[i] >> 8;
+				record[EEPROM_RECORD_HEADER + 2 * i + 1] = data[i] & 0xFF;
+		}
+		uint16_t crc = EepromCrc16(record, EEPROM_SIZE_RECORD - EEPROM_RECORD_CRC);
+		record[EEPROM_SIZE_RECORD - 2] = crc >> 8;
+		record[EEPROM_SIZE_RECORD - 1] = crc & 0xFF;
+
+		// Schreiben, zurcklesen und prfen
+		uint16_t address = EEPROM_RECORD_ADDRESS + slot * EEPROM_SIZE_RECORD;
+		if (   !EepromWrite(address, record, EEPROM_SIZE_RECORD)
+				|| !EepromRead(address, record, EEPROM_SIZE_RECORD)
+				|| !EepromCheckSlot(slot))
+		{
+				return false;
+		}
+		eepromRecordSlot     = slot;
+		eepromRecordSequence = sequence;
+		eepromLoadStatus     = EEPROM_LOAD_OK;
+		return true;
+}
+
+
+//=== Function: EepromCheckSlot ===================================================================
+///
+/// @brief  Funktion prft den Platz "slot" im Abbild "eepromImage[]": Kennung, Anzahl der
+///					Datenworte und CRC mssen stimmen.
+///
+/// @param  uint16_t slot
+///
+/// @return bool slotValid
+///
+//=================================================================================================
+bool EepromCheckSlot(uint16_t slot)
+{
+		const uint16_t *record = &eepromImage[slot * EEPROM_SIZE_RECORD];
+		uint16_t magic  = (record[0] << 8) | record[1];
+		uint16_t length = (record[4] << 8) | record[5];
+		uint16_t crc    = (record[EEPROM_SIZE_RECORD - 2] << 8) | record[EEPROM_SIZE_RECORD - 1];
+		return (   (magic == EEPROM_RECORD_MAGIC)
+						&& (length <= EEPROM_RECORD_MAX_WORDS)
+						&& (crc == EepromCrc16(record, EEPROM_SIZE_RECORD - EEPROM_RECORD_CRC)));
+}
+
+
+//=== Function: EepromCrc16 =======================================================================
+///
+/// @brief  Funktion berechnet die CRC-16 (CCITT, Polynom 0x1021, Startwert 0xFFFF) ber "length"
+///					Bytes aus "data" (ein Byte pro Element).
+///
+/// @param  const uint16_t *data, uint16_t length
+///
+/// @return uint16_t crc
+///
+//=================================================================================================
+uint16_t EepromCrc16(const uint16_t *data,
+										 uint16_t length)
+{
+		uint16_t crc = 0xFFFF;
+		for (uint16_t i = 0; i < length; i++)
+		{
+				crc ^= (data[i] & 0xFF) << 8;
+				for (uint16_t bit = 0; bit < 8; bit++)
+				{
+						crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+				}
+		}
+		return crc;
+}
+
+
+//=== Function: EepromWaitForTransfer =============================================================
+///
+/// @brief  Funktion wartet auf das Ende der laufenden bertragung, setzt den Status auf "idle" und
+///					gibt den Status der bertragung zurck. Nach EEPROM_TIMEOUT_US wird das I2C-Modul neu
+///					initialisiert und I2C_STATUS_ERROR zurckgegeben.
+///
+/// @param  void
+///
+/// @return uint16_t status (I2C_STATUS_FINISHED oder I2C_STATUS_ERROR)
+///
+//=================================================================================================
+uint16_t EepromWaitForTransfer(void)
+{
+		uint32_t start = EEPROM_COUNTER;
+		while (I2cGetStatusA() == I2C_STATUS_IN_PROGRESS)
+		{
+				if ((EEPROM_COUNTER - start) > EEPROM_CYCLES_US(EEPROM_TIMEOUT_US))
+				{
+						// Fehlerbehandlung: I2C-Modul neu initialisieren
+						I2cInitA(I2C_CLOCK_400_KHZ);
+						return I2C_STATUS_ERROR;
+				}
+		}
+		uint16_t status = I2cGetStatusA();
+		I2cSetStatusIdleA();
+		return status;
+}
+
+
+//=== Function: EepromPollAck =====================================================================
+///
+/// @brief  Funktion wartet auf das Ende des internen Schreibzyklus des EEPROMs. Whrend des
+///					Schreibzyklus antwortet das EEPROM auf seine Adresse mit NACK. Es wird daher
+///					wiederholt ein Byte von der aktuellen Adresse gelesen (verndert den Speicher nicht),
+///					bis das EEPROM mit ACK antwortet. So wird nur so lange gewartet wie ntig (typ.
+///					wenige ms) statt der max. Zeit laut Datenblatt. Die Funktion gibt "false" zurck,
+///					falls das EEPROM nach EEPROM_WRITE_TIMEOUT_US noch nicht bereit ist.
+///
+/// @param  void
+///
+/// @return bool ready
+///
+//=================================================================================================
+bool EepromPollAck(void)
+{
+		uint16_t dummy;
+		uint32_t start = EEPROM_COUNTER;
+		do
+		{
+				if (   I2cTransferA(EEPROM_SLAVE_ADDRESS, 0, 0, &dummy, 1)
+						&& (EepromWaitForTransfer() == I2C_STATUS_FINISHED))
+				{
+						// Dauer des Schreibzyklus in us (SYSCLK = 200 MHz)
+						uint32_t cycle = (EEPROM_COUNTER - start) / 200UL;
+						if (cycle > eepromWriteCycleMax)
+						{
+								eepromWriteCycleMax = cycle;
+						}
+						return true;
+				}
+		} while ((EEPROM_COUNTER - start) < EEPROM_CYCLES_US(EEPROM_WRITE_TIMEOUT_US));
+		return false;
+}
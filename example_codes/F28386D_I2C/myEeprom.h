@@ -0,0 +1,122 @@
+//=================================================================================================
+/// @file       myEeprom.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein I2C-EEPROM (z.B. 24LC256, 32 kByte,
+///							Seiten zu 64 Byte, 2 Byte Speicheradresse) am Modul I2C-A ("myI2C.c"), um die
+///							Kalibrierung und Konfiguration einer Platine dauerhaft zu speichern. Schreibzugriffe
+///							werden an den Seitengrenzen aufgeteilt, das Ende des internen Schreibzyklus wird
+///							durch Abfragen des ACK erkannt ("Acknowledge Polling") statt mit einer festen
+///							Wartezeit. Gelesen wird mit einer einzigen bertragung beliebiger Lnge.
+///
+///							Die Kalibrierung wird als Datensatz ("Record") gespeichert. Fr die Datenstze
+///							gibt es EEPROM_RECORD_SLOTS Pltze zu je einer Seite, die reihum beschrieben werden,
+///							sodass sich die Schreibzyklen auf alle Pltze verteilen. Aufbau eines Platzes
+///							(Bytes): Kennung (2), Sequenznummer (2), Anzahl der Datenworte (2), Datenworte
+///							(je 2, MSB zuerst), CRC-16 ber alle vorherigen Bytes (2, letzte Bytes des Platzes).
+///							Beim Start werden alle Pltze mit einer bertragung gelesen und der gltige
+///							Datensatz mit der hchsten Sequenznummer bernommen. Ein beim Schreiben
+///							unterbrochener Datensatz wird ber die CRC erkannt, der vorherige bleibt gltig.
+///
+///							Die Funktionen warten auf das Ende der bertragung und sind fr den Start bzw.
+///							seltene Zugriffe gedacht. Sie drfen nicht verwendet werden, whrend periodische
+///							Auftrge ("myI2cJobs.c") laufen.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYEEPROM_H_
+#define MYEEPROM_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myI2C.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// 7-Bit Adresse des EEPROMs (A2 ... A0 = 0)
+#define EEPROM_SLAVE_ADDRESS										0x50
+// Speichergre und Seitengre in Byte
+#define EEPROM_SIZE															32768UL
+#define EEPROM_SIZE_PAGE												64
+// Max. Dauer einer bertragung bzw. eines internen Schreibzyklus (Datenblatt: 5 ms) in us
+#define EEPROM_TIMEOUT_US												20000
+#define EEPROM_WRITE_TIMEOUT_US									10000
+// Datenstze: Adresse des ersten Platzes (Seitenanfang), Anzahl der Pltze, Gre eines Platzes
+#define EEPROM_RECORD_ADDRESS										0x0000
+#define EEPROM_RECORD_SLOTS											4
+#define EEPROM_SIZE_RECORD											EEPROM_SIZE_PAGE
+// Kennung am Anfang eines Datensatzes
+#define EEPROM_RECORD_MAGIC											0xCA1B
+// Gre des Kopfes (Kennung, Sequenznummer, Anzahl) und der CRC in Byte
+#define EEPROM_RECORD_HEADER										6
+#define EEPROM_RECORD_CRC												2
+// Max. Anzahl der Datenworte eines Datensatzes
+#define EEPROM_RECORD_MAX_WORDS									((EEPROM_SIZE_RECORD - EEPROM_RECORD_HEADER \
+																								 - EEPROM_RECORD_CRC) / 2)
+// Kein gltiger Datensatz vorhanden
+#define EEPROM_RECORD_NONE											0xFFFF
+
+// Ergebnis von "EepromLoadRecord()"
+#define EEPROM_LOAD_ERROR												0		// EEPROM nicht lesbar, Inhalt unbekannt
+#define EEPROM_LOAD_NO_RECORD										1		// Kein gltiger Datensatz (erster Start)
+#define EEPROM_LOAD_OK													2		// Datensatz geladen
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Freilaufender Zhler fr die Zeitberschreitung (SYSCLK, 200 MHz)
+#define EEPROM_COUNTER													(Cpu1toCpu2IpcRegs.IPCCOUNTERL)
+// Umrechnung von Mikrosekunden in Takte des Zhlers
+#define EEPROM_CYCLES_US(us)										((uint32_t)(us) * 200UL)
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Platz und Sequenznummer des aktuellen Datensatzes (EEPROM_RECORD_NONE: keiner)
+extern uint16_t eepromRecordSlot;
+extern uint16_t eepromRecordSequence;
+// Ergebnis des letzten Aufrufs von "EepromLoadRecord()"
+extern uint16_t eepromLoadStatus;
+// Max. gemessene Dauer eines internen Schreibzyklus in us
+extern uint32_t eepromWriteCycleMax;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion setzt den Zustand des Treibers zurck
+extern void EepromInit(void);
+// Funktion liest "length" Bytes ab "address" mit einer bertragung
+extern bool EepromRead(uint16_t address,
+											 uint16_t *data,
+											 uint16_t length);
+// Funktion schreibt "length" Bytes ab "address" seitenweise
+extern bool EepromWrite(uint16_t address,
+												const uint16_t *data,
+												uint16_t length);
+// Funktion liest alle Pltze und bernimmt den neuesten gltigen Datensatz
+extern uint16_t EepromLoadRecord(uint16_t *data,
+														 uint16_t numberOfWords);
+// Funktion schreibt einen neuen Datensatz in den nchsten Platz
+extern bool EepromSaveRecord(const uint16_t *data,
+														 uint16_t numberOfWords);
+// Funktion prft Kennung, Anzahl und CRC eines Platzes im Abbild
+extern bool EepromCheckSlot(uint16_t slot);
+// Funktion berechnet die CRC-16 (CCITT) ber "length" Bytes
+extern uint16_t EepromCrc16(const uint16_t *data,
+														uint16_t length);
+// Funktion wartet auf das Ende der laufenden bertragung
+extern uint16_t EepromWaitForTransfer(void);
+// Funktion wartet per Acknowledge Polling auf das Ende des internen Schreibzyklus
+extern bool EepromPollAck(void);
+
+
+#endif
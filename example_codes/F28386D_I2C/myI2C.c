@@ -8,10 +8,18 @@
 ///							Das Modul B kann analog zu den hier gezeigten Funktionen verwendet werden.
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///							nderung in Version 3.0: bertragungen beliebiger Lnge. Die Hardware-FIFOs werden
+///							ber die FIFO-Interrupts (Schwellwerte I2C_FIFO_LEVEL_TX/_RX) in Blcken nachgeladen
+///							bzw. geleert, die CPU muss whrend der bertragung nicht warten. Mit
+///							"I2cTransferA()" knnen beliebige Puffer der aufrufenden Stelle verwendet werden
+///							nderung in Version 3.1: Optionale Callback-Funktion am Ende jeder bertragung, damit
+///							z.B. ein Scheduler ("myI2cJobs.c") die nchste bertragung aus der ISR starten kann
+///							nderung in Version 3.2: "I2cResetA()" bricht eine hngende bertragung ab (z.B. nach
+///							einer Zeitberschreitung), ohne die Interrupts global zu sperren
 ///
-/// @version    V1.4
+/// @version    V3.2
 ///
-/// @date       27.03.2023
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -25,14 +33,23 @@
 // Global variables
 //-------------------------------------------------------------------------------------------------
 // Software-Puffer fr die I2C-Kommunikation
-uint16_t i2cBufferWriteA[I2C_SIZE_HARDWARE_FIFO];
-uint16_t i2cBufferReadA[I2C_SIZE_HARDWARE_FIFO];
+uint16_t i2cBufferWriteA[I2C_SIZE_BUFFER];
+uint16_t i2cBufferReadA[I2C_SIZE_BUFFER];
+// Nchstes zu sendendes Byte und Anzahl der noch nicht in den Sende-FIFO geladenen Bytes
+const uint16_t *i2cDataWriteA;
+uint16_t i2cBytesToWriteA;
+// Nchste Stelle im Lese-Puffer und Anzahl der noch nicht aus dem Empfangs-FIFO gelesenen Bytes
+uint16_t *i2cDataReadA;
+uint16_t i2cBytesToReadA;
 // bernimmt die Anzahl der zu lesenden Bytes beim Aufruf der Funktion "I2cWriteReadA()"
 // und bergibt sie dem Register I2CCNT nach einer wiederholten START-Bedingung um die
 // gewnschte Anzahl von Bytes vom Slave zu lesen
 uint16_t i2cBytesToReadAfterRSA;
 // Flag speichert den aktuellen Zustand der I2C-Kommunikation
 uint16_t i2cStatusFlagA;
+// Wird am Ende jeder bertragung aus der ISR aufgerufen (0: kein Aufruf). Wird von
+// "I2cInitA()" nicht zurckgesetzt, damit sie eine Neu-Initialisierung bersteht
+I2cCallback i2cCallbackA = 0;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -130,14 +147,18 @@ void I2cInitA(uint32_t clock)
 		// sprechende Byte noch im Sende-Shift-Register befindet und Bit fr Bit
 		// ausgesendet wird, whrend der Wert bereits um 1 reduziert wurde. Somit
 		// wird auch der Interrupt ausgelst, bevor das Byte vollstndig gesendet wurde
-		I2caRegs.I2CFFTX.bit.TXFFIL = 0;
+		// Der Schwellwert wird so gewhlt, dass der Sende-FIFO nachgeladen wird,
+		// bevor er leer ist (siehe I2C_FIFO_LEVEL_TX)
+		I2caRegs.I2CFFTX.bit.TXFFIL = I2C_FIFO_LEVEL_TX;
 		// Wenn der Wert im Feld I2CFFRX.RXFFST gleich oder grer als der Wert in
 		// I2CFFRX.RXFFIL ist, wird ein Interrupt ausgelst. Der Wert I2CFFRX.RXFFST
 		// speichert die Zahl an Bytes, die im Empfangs-FIFO stehen. Anders als beim
 		// Sendevorgang wird der Interrupt also genau zu dem Zeitpunkt ausgelst,
-		// wenn das letzte Byte vollstndig empfangen wurde
-		I2caRegs.I2CFFRX.bit.RXFFIL = 0;
-		// Sende- und Empfangs-FIFO-Interrupt ausschalten
+		// wenn das letzte Byte vollstndig empfangen wurde. Der Schwellwert wird
+		// bei jeder bertragung in Abhngigkeit der noch fehlenden Bytes gesetzt
+		I2caRegs.I2CFFRX.bit.RXFFIL = I2C_FIFO_LEVEL_RX;
+		// Sende- und Empfangs-FIFO-Interrupt ausschalten (werden nur
+		// whrend einer bertragung eingeschaltet)
 		I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
 		I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
 		// Sende- und Empfangs-FIFO aus den Reset holen
@@ -156,9 +177,13 @@ void I2cInitA(uint32_t clock)
 		// Interrupt-Service-Routinen fr den I2C-Interrupt an die
     // entsprechende Stelle (I2CA_INT) der PIE-Vector Table speichern
     PieVectTable.I2CA_INT = &I2cISRA;
+    // Interrupt-Service-Routine fr die FIFO-Interrupts (I2CA_FIFO_INT)
+    PieVectTable.I2CA_FIFO_INT = &I2cFifoISRA;
     // I2CA-Interrupt freischalten (Zeile 8, Spalte 1 der Tabelle 3-2)
     // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
     PieCtrlRegs.PIEIER8.bit.INTx1 = 1;
+    // I2CA-FIFO-Interrupt freischalten (Zeile 8, Spalte 2 der Tabelle 3-2)
+    PieCtrlRegs.PIEIER8.bit.INTx2 = 1;
     // CPU-Interrupt 8 einschalten (Zeile 8 der Tabelle)
     IER |= M_INT8;
     // Interrupts global einschalten
@@ -172,6 +197,10 @@ void I2cInitA(uint32_t clock)
     I2cInitBufferWriteA();
     // Steuervariable fr die Puffer-Verwaltung initialisieren
     i2cBytesToReadAfterRSA = 0;
+    i2cDataWriteA    = i2cBufferWriteA;
+    i2cBytesToWriteA = 0;
+    i2cDataReadA     = i2cBufferReadA;
+    i2cBytesToReadA  = 0;
     // Status-Flag fr die I2C-Kommunikation auf "idle" setzen
     i2cStatusFlagA = I2C_STATUS_IDLE;
 }
@@ -188,7 +217,7 @@ void I2cInitA(uint32_t clock)
 //=================================================================================================
 void I2cInitBufferReadA(void)
 {
-    for(uint16_t i=0; i<I2C_SIZE_HARDWARE_FIFO; i++)
+    for(uint16_t i=0; i<I2C_SIZE_BUFFER; i++)
     {
         i2cBufferReadA[i] = 0;
     }
@@ -206,7 +235,7 @@ void I2cInitBufferReadA(void)
 //=================================================================================================
 void I2cInitBufferWriteA(void)
 {
-    for(uint16_t i=0; i<I2C_SIZE_HARDWARE_FIFO; i++)
+    for(uint16_t i=0; i<I2C_SIZE_BUFFER; i++)
     {
     		i2cBufferWriteA[i] = 0;
     }
@@ -272,15 +301,55 @@ extern bool I2cSetStatusIdleA(void)
 }
 
 
+//=== Function: I2cResetA =========================================================================
+///
+/// @brief	Funktion bricht eine laufende bertragung ab, z.B. wenn ein Slave den Bus blockiert und
+///					keine STOP-Bedingung mehr erkannt wird. Das I2C-A Modul wird in den Reset versetzt
+///					(alle Status-Flags werden gelscht), die FIFOs geleert und das Modul mit der
+///					Konfiguration aus "I2cInitA()" als Master wieder freigegeben. Die Callback-Funktion
+///					wird nicht aufgerufen, das Status-Flag wird auf "idle" gesetzt. Im Gegensatz zu
+///					"I2cInitA()" werden die Interrupts nicht global gesperrt, die Funktion kann daher
+///					aus einer ISR aufgerufen werden.
+///
+/// @param	void
+///
+/// @return void
+///
+//=================================================================================================
+void I2cResetA(void)
+{
+		// I2C-Modul in den Reset versetzen (bricht die bertragung ab
+		// und setzt I2CSTR zurck, die Konfiguration bleibt erhalten)
+		I2caRegs.I2CMDR.bit.IRS = 0;
+		// FIFO-Interrupts ausschalten und FIFOs leeren
+		I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
+		I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
+		I2caRegs.I2CFFTX.bit.TXFFRST  = 0;
+		I2caRegs.I2CFFRX.bit.RXFFRST  = 0;
+		I2caRegs.I2CFFTX.bit.TXFFRST  = 1;
+		I2caRegs.I2CFFRX.bit.RXFFRST  = 1;
+		I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+		I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+		// Restliche Bytes verwerfen
+		i2cBytesToWriteA = 0;
+		i2cBytesToReadA  = 0;
+		// I2C-Modul als Master wieder freigeben
+		I2caRegs.I2CMDR.bit.MST = 1;
+		I2caRegs.I2CMDR.bit.IRS = 1;
+		i2cStatusFlagA = I2C_STATUS_IDLE;
+}
+
+
 //=== Function: I2cWriteA =========================================================================
 ///
 /// @brief  Funktion schreibt Daten ber IC auf einen Slave (Master Transmitter Mode). Der erste
 ///					Parameter ist die 7-Bit Adresse des Slaves, an den die Daten gesendet werden sollen.
 ///					Der zweite Parameter gibt die Anzahl der zu sendenen Bytes (ohne die Slave-Adresse)
 ///					an. Die zu schreibenden Daten mssen von der aufrufenden Stelle in das globale Array
-///					"i2cBufferWrite" kopiert werden. Es knnen maximal 16 Bytes geschrieben werden. Der
-///					Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine vorangegegangene
-///					Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er "false".
+///					"i2cBufferWrite" kopiert werden. Es knnen maximal I2C_SIZE_BUFFER Bytes geschrieben
+///					werden. Der Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine
+///					vorangegegangene Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er
+///					"false".
 ///
 /// @param  uint16_t slaveAddress, uint16_t numberOfBytes
 ///
@@ -290,41 +359,14 @@ extern bool I2cSetStatusIdleA(void)
 bool I2cWriteA(uint16_t slaveAddress,
 						   uint16_t numberOfBytes)
 {
-		// Ergebnis des Funktionsaufrufes (Vorgang gestartet / nicht gestartet)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist,
-		// der Bus frei ist, zuvor eine STOP-Bedingung gesendet wurde und die
-		// Anzahl der zu schreibenden Bytes die Gre des Software-Puffers nicht
-		// berschreitet und mindestens 1 ist
-		if ((i2cStatusFlagA != I2C_STATUS_IN_PROGRESS)
-				&& !I2caRegs.I2CSTR.bit.BB
-				&& !I2caRegs.I2CMDR.bit.STP
-				&& (numberOfBytes <= I2C_SIZE_HARDWARE_FIFO)
-				&& numberOfBytes)
+		// Anzahl der zu schreibenden Bytes darf die Gre des Software-Puffers
+		// nicht berschreiten und muss mindestens 1 sein
+		if ((numberOfBytes > I2C_SIZE_BUFFER)
+				|| !numberOfBytes)
 		{
-				// Rckgabewert auf "Operation durchgefhrt" setzen
-				operationPerformed = true;
-				// Status-Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine I2C-Kommunikation gestartet wurde
-				i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
-				// Master-Transmitter Mode setzen
-				I2caRegs.I2CMDR.bit.MST = 1;
-				I2caRegs.I2CMDR.bit.TRX = 1;
-				// Slave-Adresse setzen
-				I2caRegs.I2CSAR.bit.SAR = slaveAddress;
-				// Zu sendene Daten in den Sende-FIFO kopieren
-				for (uint16_t i=0; i<numberOfBytes; i++)
-				{
-						I2caRegs.I2CDXR.bit.DATA = i2cBufferWriteA[i];
-				}
-				// Anzahl der zu schreibenden Bytes setzen (Adress-Byte zhlt nicht dazu)
-				I2caRegs.I2CCNT = numberOfBytes;
-				// bertragung starten
-				I2caRegs.I2CMDR.bit.STT = 1;
-				// STOP-Bedingung senden, nachdem alle Bytes an den Slave gesendet wurden
-				I2caRegs.I2CMDR.bit.STP = 1;
+				return false;
 		}
-		return operationPerformed;
+		return I2cTransferA(slaveAddress, i2cBufferWriteA, numberOfBytes, 0, 0);
 }
 
 
@@ -334,9 +376,10 @@ bool I2cWriteA(uint16_t slaveAddress,
 ///					Parameter ist die 7-Bit Adresse des Slaves, von dem die Daten gelesen werden sollen.
 ///					Der zweite Parameter gibt die Anzahl der zu lesenden Bytes (ohne die Slave-Adresse).
 ///					an. Die gelesenen Daten knnen von der aufrufenden Stelle aus dem globale Array
-///					"i2cBufferRead" gelesen werden. Es knnen maximal 16 Bytes gelesen werden. Der
-///					Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine vorangegegangene
-///					Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er "false".
+///					"i2cBufferRead" gelesen werden. Es knnen maximal I2C_SIZE_BUFFER Bytes gelesen
+///					werden. Der Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine
+///					vorangegegangene Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er
+///					"false".
 ///
 /// @param  uint16_t slaveAddress, uint16_t numberOfBytes
 ///
@@ -346,36 +389,14 @@ bool I2cWriteA(uint16_t slaveAddress,
 bool I2cReadA(uint16_t slaveAddress,
 						  uint16_t numberOfBytes)
 {
-		// Ergebnis des Funktionsaufrufes (Vorgang gestartet/nicht gestartet)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist,
-		// der Bus frei ist, zuvor eine STOP-Bedingung gesendet wurde und die
-		// Anzahl der zu lesenden Bytes die Gre des Software-Puffers nicht
-		// berschreitet und mindestens 1 ist
-		if ((i2cStatusFlagA != I2C_STATUS_IN_PROGRESS)
-				&& !I2caRegs.I2CSTR.bit.BB
-				&& !I2caRegs.I2CMDR.bit.STP
-				&& (numberOfBytes <= I2C_SIZE_HARDWARE_FIFO)
-				&& numberOfBytes)
+		// Anzahl der zu lesenden Bytes darf die Gre des Software-Puffers
+		// nicht berschreiten und muss mindestens 1 sein
+		if ((numberOfBytes > I2C_SIZE_BUFFER)
+				|| !numberOfBytes)
 		{
-				// Rckgabewert auf "Operation durchgefhrt" setzen
-				operationPerformed = true;
-				// Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine I2C-Kommunikation gestartet wurde
-				i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
-				// Master-Receiver Mode setzen
-				I2caRegs.I2CMDR.bit.MST = 1;
-				I2caRegs.I2CMDR.bit.TRX = 0;
-				// Slave-Adresse setzen
-				I2caRegs.I2CSAR.bit.SAR = slaveAddress;
-				// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu)
-				I2caRegs.I2CCNT = numberOfBytes;
-				// bertragung starten
-				I2caRegs.I2CMDR.bit.STT = 1;
-				// STOP-Bedingung senden, nachdem alle Bytes vom Slave gelesen wurden
-				I2caRegs.I2CMDR.bit.STP = 1;
+				return false;
 		}
-		return operationPerformed;
+		return I2cTransferA(slaveAddress, 0, 0, i2cBufferReadA, numberOfBytes);
 }
 
 
@@ -385,11 +406,12 @@ bool I2cReadA(uint16_t slaveAddress,
 ///					Transmitter + Receiver Mode). Der erste Parameter ist die 7-Bit Adresse des Slaves,
 ///					mit dem kommuniziert werden soll. Der zweite Parameter gibt die Anzahl der zu
 ///					schreibenden Bytes an, der dritte Parameter die Anzahl der zu lesenden Bytes (beides
-///					jeweils ohne die Slave-Adresse). Es knnen maximal 16 Bytes geschreiben bzw. gelesen
-///					werden. Der Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine
-///					vorangegangene Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er
-///					"false". Die zu schreibenen Daten werden aus dem Software-Puffer "i2cBufferWriteA[]"
-///					kopiert. Die gelesenen Daten werden in den Software-Puffer "i2cBufferReadA[]" kopiert.
+///					jeweils ohne die Slave-Adresse). Es knnen maximal I2C_SIZE_BUFFER Bytes geschreiben
+///					bzw. gelesen werden. Der Rckgabwert ist "true" falls die Kommunikation gestartet
+///					wurde (keine vorangegangene Kommunikation ist aktiv und der Bus ist frei),
+///					andernfalls ist er "false". Die zu schreibenen Daten werden aus dem Software-Puffer
+///					"i2cBufferWriteA[]" kopiert. Die gelesenen Daten werden in den Software-Puffer
+///					"i2cBufferReadA[]" kopiert.
 ///
 /// @param  uint16_t slaveAddress, uint16_t numberOfBytesWrite, uint16_t numberOfBytesRead
 ///
@@ -400,48 +422,186 @@ bool I2cWriteReadA(uint16_t slaveAddress,
 						       uint16_t numberOfBytesWrite,
 									 uint16_t numberOfBytesRead)
 {
-		// Ergebnis des Funktionsaufrufes (Vorgang gestartet / nicht gestartet)
-		bool operationPerformed = false;
+		// Anzahl der zu schreibenden und lesenden Bytes darf die Gre der
+		// Software-Puffer nicht berschreiten und muss mindestens 1 sein
+		if ((numberOfBytesWrite > I2C_SIZE_BUFFER)
+				|| (numberOfBytesRead > I2C_SIZE_BUFFER)
+				|| !numberOfBytesWrite
+				|| !numberOfBytesRead)
+		{
+				return false;
+		}
+		return I2cTransferA(slaveAddress, i2cBufferWriteA, numberOfBytesWrite,
+												i2cBufferReadA, numberOfBytesRead);
+}
+
+
+//=== Function: I2cTransferA ======================================================================
+///
+/// @brief  Funktion startet eine bertragung beliebiger Lnge (max. 65535 Bytes je Richtung).
+///					Ist "numberOfBytesWrite" ungleich 0, werden zuerst die Bytes aus "dataWrite" an den
+///					Slave gesendet (Master Transmitter Mode). Ist "numberOfBytesRead" ungleich 0, werden
+///					anschlieend (bei vorherigem Schreiben nach einer wiederholten START-Bedingung) die
+///					Bytes vom Slave nach "dataRead" gelesen (Master Receiver Mode). Die ersten (max. 16)
+///					Bytes werden direkt in den Sende-FIFO kopiert, die weiteren ldt die FIFO-ISR nach,
+///					sobald der Sende-FIFO den Schwellwert I2C_FIFO_LEVEL_TX erreicht. Empfangene Bytes
+///					werden von der FIFO-ISR in Blcken von I2C_FIFO_LEVEL_RX Bytes abgeholt. Die Puffer
+///					mssen bis zum Ende der bertragung ("I2cGetStatusA()") gltig bleiben. Der
+///					Rckgabwert ist "true" falls die Kommunikation gestartet wurde (keine vorangegegangene
+///					Kommunikation ist aktiv und der Bus ist frei), andernfalls ist er "false".
+///
+/// @param  uint16_t slaveAddress, const uint16_t *dataWrite, uint16_t numberOfBytesWrite,
+///					uint16_t *dataRead, uint16_t numberOfBytesRead
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool I2cTransferA(uint16_t slaveAddress,
+									const uint16_t *dataWrite,
+									uint16_t numberOfBytesWrite,
+									uint16_t *dataRead,
+									uint16_t numberOfBytesRead)
+{
 		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist,
-		// der Bus frei ist, zuvor eine STOP-Bedingung gesendet wurde und die
-		// Anzahl der zu schreibenden und lesenden Bytes die Gre der Software-
-		// Puffer nicht berschreitet und mindesten 1 ist
-		if ((i2cStatusFlagA != I2C_STATUS_IN_PROGRESS)
-				&& !I2caRegs.I2CSTR.bit.BB
-				&& !I2caRegs.I2CMDR.bit.STP
-				&& (numberOfBytesWrite <= I2C_SIZE_HARDWARE_FIFO)
-				&& (numberOfBytesRead  <= I2C_SIZE_HARDWARE_FIFO)
-				&& numberOfBytesWrite
-				&& numberOfBytesRead)
+		// der Bus frei ist, zuvor eine STOP-Bedingung gesendet wurde und
+		// mindestens ein Byte geschrieben oder gelesen werden soll
+		if ((i2cStatusFlagA == I2C_STATUS_IN_PROGRESS)
+				|| I2caRegs.I2CSTR.bit.BB
+				|| I2caRegs.I2CMDR.bit.STP
+				|| (numberOfBytesWrite && (dataWrite == 0))
+				|| (numberOfBytesRead  && (dataRead  == 0))
+				|| (!numberOfBytesWrite && !numberOfBytesRead))
+		{
+				return false;
+		}
+		// Status-Flag setzen um der aufrufenden Stelle zu signalisieren,
+		// dass eine I2C-Kommunikation gestartet wurde
+		i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
+		// Puffer und Anzahl der Bytes fr die FIFO-ISR bernehmen
+		i2cDataWriteA    = dataWrite;
+		i2cBytesToWriteA = numberOfBytesWrite;
+		i2cDataReadA     = dataRead;
+		i2cBytesToReadA  = numberOfBytesRead;
+		// Slave-Adresse setzen
+		I2caRegs.I2CSAR.bit.SAR = slaveAddress;
+		I2caRegs.I2CMDR.bit.MST = 1;
+		if (numberOfBytesWrite)
 		{
-				// Rckgabewert auf "Operation durchgefhrt" setzen
-				operationPerformed = true;
-				// Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine I2C-Kommunikation gestartet wurde
-				i2cStatusFlagA = I2C_STATUS_IN_PROGRESS;
 				// Master-Transmitter Mode setzen
-				I2caRegs.I2CMDR.bit.MST = 1;
 				I2caRegs.I2CMDR.bit.TRX = 1;
-				// Slave-Adresse setzen
-				I2caRegs.I2CSAR.bit.SAR = slaveAddress;
-				// Zu sendene Daten in den TX-FIFO kopieren
-				for (uint16_t i=0; i<numberOfBytesWrite; i++)
+				// Ersten Block der zu sendenen Daten in den Sende-FIFO kopieren
+				I2cFillFifoTxA();
+				// Sende-FIFO-Interrupt einschalten, falls nicht alle Bytes in den FIFO passen
+				if (i2cBytesToWriteA)
 				{
-						I2caRegs.I2CDXR.bit.DATA = i2cBufferWriteA[i];
+						I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+						I2caRegs.I2CFFTX.bit.TXFFIENA   = 1;
 				}
 				// Anzahl der zu schreibenden Bytes setzen (Adress-Byte zhlt nicht dazu)
 				I2caRegs.I2CCNT = numberOfBytesWrite;
-				// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu).
-				// Dieser Wert wird nach Ende der Schreib-Operation in der ISR in das
-				// Register I2CCNT geschrieben
-				i2cBytesToReadAfterRSA = numberOfBytesRead;
-				// ARDY-Interrupt einschalten damit das Ende der
-				// Schreib-Operation detektiert werden kann
-				I2caRegs.I2CIER.bit.ARDY = 1;
+				if (numberOfBytesRead)
+				{
+						// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu).
+						// Dieser Wert wird nach Ende der Schreib-Operation in der ISR in das
+						// Register I2CCNT geschrieben
+						i2cBytesToReadAfterRSA = numberOfBytesRead;
+						// ARDY-Interrupt einschalten damit das Ende der
+						// Schreib-Operation detektiert werden kann
+						I2caRegs.I2CIER.bit.ARDY = 1;
+						// bertragung starten
+						I2caRegs.I2CMDR.bit.STT = 1;
+				}
+				else
+				{
+						// bertragung starten
+						I2caRegs.I2CMDR.bit.STT = 1;
+						// STOP-Bedingung senden, nachdem alle Bytes an den Slave gesendet wurden
+						I2caRegs.I2CMDR.bit.STP = 1;
+				}
+		}
+		else
+		{
+				// Master-Receiver Mode setzen
+				I2caRegs.I2CMDR.bit.TRX = 0;
+				// Schwellwert setzen und Empfangs-FIFO-Interrupt einschalten
+				I2caRegs.I2CFFRX.bit.RXFFIL = (numberOfBytesRead < I2C_FIFO_LEVEL_RX) ?
+																				numberOfBytesRead : I2C_FIFO_LEVEL_RX;
+				I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+				I2caRegs.I2CFFRX.bit.RXFFIENA   = 1;
+				// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu)
+				I2caRegs.I2CCNT = numberOfBytesRead;
 				// bertragung starten
 				I2caRegs.I2CMDR.bit.STT = 1;
+				// STOP-Bedingung senden, nachdem alle Bytes vom Slave gelesen wurden
+				I2caRegs.I2CMDR.bit.STP = 1;
+		}
+		return true;
+}
+
+
+//=== Function: I2cFillFifoTxA ====================================================================
+///
+/// @brief  Funktion kopiert so viele der noch zu sendenden Bytes in den Sende-FIFO, wie in ihm
+///					Platz ist. Wird beim Start einer bertragung und von der FIFO-ISR aufgerufen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void I2cFillFifoTxA(void)
+{
+		uint16_t space = I2C_SIZE_HARDWARE_FIFO - I2caRegs.I2CFFTX.bit.TXFFST;
+		while (space && i2cBytesToWriteA)
+		{
+				I2caRegs.I2CDXR.bit.DATA = *i2cDataWriteA++;
+				i2cBytesToWriteA--;
+				space--;
+		}
+}
+
+
+//=== Function: I2cEmptyFifoRxA ===================================================================
+///
+/// @brief  Funktion kopiert alle im Empfangs-FIFO stehenden Bytes in den Lese-Puffer. Bytes, die
+///					ber die angeforderte Anzahl hinausgehen, werden verworfen. Wird von der FIFO-ISR
+///					und beim Erkennen der STOP-Bedingung aufgerufen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void I2cEmptyFifoRxA(void)
+{
+		uint16_t count = I2caRegs.I2CFFRX.bit.RXFFST;
+		while (count--)
+		{
+				uint16_t data = I2caRegs.I2CDRR.bit.DATA;
+				if (i2cBytesToReadA)
+				{
+						*i2cDataReadA++ = data;
+						i2cBytesToReadA--;
+				}
 		}
-		return operationPerformed;
+}
+
+
+//=== Function: I2cSetCallbackA ===================================================================
+///
+/// @brief  Funktion setzt die Funktion, die am Ende jeder bertragung (nach Erkennen der STOP-
+///					Bedingung) aus der ISR mit dem Status der bertragung aufgerufen wird. Die Funktion
+///					darf die nchste bertragung starten, muss dazu aber zuerst "I2cSetStatusIdleA()"
+///					aufrufen. Mit 0 wird der Aufruf ausgeschaltet.
+///
+/// @param  I2cCallback callback
+///
+/// @return void
+///
+//=================================================================================================
+void I2cSetCallbackA(I2cCallback callback)
+{
+		i2cCallbackA = callback;
 }
 
 
@@ -474,20 +634,26 @@ __interrupt void I2cISRA(void)
 		{
 				// STOP-Flag lschen
 				I2caRegs.I2CSTR.bit.SCD = 1;
-				// Daten auslesen, fallsReceiver-Mode aktiv
+				// Restliche Daten auslesen, falls Receiver-Mode aktiv
+				// (der letzte Block ist ggf. kleiner als der Schwellwert)
 				if (!I2caRegs.I2CMDR.bit.TRX)
 				{
-						// Empfangene Daten auslesen
-						for (uint16_t i=0; i<I2caRegs.I2CCNT; i++)
-						{
-								i2cBufferReadA[i] = I2caRegs.I2CDRR.bit.DATA;
-						}
+						I2cEmptyFifoRxA();
 				}
-				// Status-Flag setzen um das Ende der bertragung zu
-				// signalisieren, falls kein Fehler aufgetreten ist
+				// FIFO-Interrupts ausschalten
+				I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
+				I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
+				// Status-Flag setzen um das Ende der bertragung zu signalisieren, falls
+				// kein Fehler aufgetreten ist und alle Bytes bertragen wurden
 				if (i2cStatusFlagA == I2C_STATUS_IN_PROGRESS)
 				{
-						i2cStatusFlagA = I2C_STATUS_FINISHED;
+						i2cStatusFlagA = (i2cBytesToWriteA || i2cBytesToReadA) ?
+														 I2C_STATUS_ERROR : I2C_STATUS_FINISHED;
+				}
+				// Ende der bertragung melden
+				if (i2cCallbackA != 0)
+				{
+						i2cCallbackA(i2cStatusFlagA);
 				}
 		}
 		// Ein NACK wurde empfangen. Im Master-Receiver-Mode
@@ -498,6 +664,16 @@ __interrupt void I2cISRA(void)
 				I2caRegs.I2CSTR.bit.NACK = 1;
 				// STOP-Bedingung senden
 				I2caRegs.I2CMDR.bit.STP = 1;
+				// FIFO-Interrupts ausschalten und noch nicht gesendete Bytes verwerfen
+				I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
+				I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
+				I2caRegs.I2CFFTX.bit.TXFFRST  = 0;
+				I2caRegs.I2CFFTX.bit.TXFFRST  = 1;
+				// Beim Schreib-Lese-Modus ist zustzlich ARDY gesetzt. Da das NACK-Flag
+				// bereits gelscht ist, werden ARDY-Interrupt und -Flag ebenfalls gelscht,
+				// damit unten keine wiederholte START-Bedingung getriggert wird
+				I2caRegs.I2CIER.bit.ARDY = 0;
+				I2caRegs.I2CSTR.bit.ARDY = 1;
 				// Status-Flag setzen um ein Fehler in der bertragung zu signalisieren
 				i2cStatusFlagA = I2C_STATUS_ERROR;
 		}
@@ -516,11 +692,19 @@ __interrupt void I2cISRA(void)
 				// bei einer Schreib-Lese-Operation bentigt um das Ende
 				// des Schreib-Datenpakets zu detektieren)
 				I2caRegs.I2CIER.bit.ARDY = 0;
+				// ARDY-Flag lschen, sonst wird beim Erkennen der STOP-Bedingung
+				// am Ende der Lese-Operation erneut gelesen
+				I2caRegs.I2CSTR.bit.ARDY = 1;
 				// Master-Receiver Mode setzen
 				I2caRegs.I2CMDR.bit.MST = 1;
 				I2caRegs.I2CMDR.bit.TRX = 0;
 				// Anzahl der zu lesenden Bytes setzen (Adress-Byte zhlt nicht dazu)
 				I2caRegs.I2CCNT = i2cBytesToReadAfterRSA;
+				// Schwellwert setzen und Empfangs-FIFO-Interrupt einschalten
+				I2caRegs.I2CFFRX.bit.RXFFIL = (i2cBytesToReadAfterRSA < I2C_FIFO_LEVEL_RX) ?
+																				i2cBytesToReadAfterRSA : I2C_FIFO_LEVEL_RX;
+				I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+				I2caRegs.I2CFFRX.bit.RXFFIENA   = 1;
 				// Wiederholte START-Bedingung senden
 				I2caRegs.I2CMDR.bit.STT = 1;
 				// STOP-Bedingung senden, nachdem alle Bytes vom Slave gelesen wurden
@@ -530,3 +714,56 @@ __interrupt void I2cISRA(void)
 		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der INT_I2CA-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
 }
+
+
+//=== Function: I2cFifoISRA =======================================================================
+///
+/// @brief	Funktion wird aufgerufen, wenn im Sende-FIFO hchstens I2C_FIFO_LEVEL_TX Bytes bzw. im
+///					Empfangs-FIFO mindestens der eingestellte Schwellwert an Bytes stehen. Der Sende-FIFO
+///					wird mit den nchsten Bytes aufgefllt, der Empfangs-FIFO wird in den Lese-Puffer
+///					kopiert. Sind alle Bytes geladen bzw. gelesen, wird der jeweilige Interrupt
+///					ausgeschaltet. Den Abschluss der bertragung meldet weiterhin "I2cISRA()" (STOP-
+///					Bedingung).
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void I2cFifoISRA(void)
+{
+		// Sende-FIFO hat den Schwellwert erreicht
+		if (I2caRegs.I2CFFTX.bit.TXFFINT)
+		{
+				// Nchsten Block in den Sende-FIFO kopieren
+				I2cFillFifoTxA();
+				// Interrupt ausschalten, wenn alle Bytes im FIFO stehen
+				if (!i2cBytesToWriteA)
+				{
+						I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
+				}
+				// Interrupt-Flag lschen
+				I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+		}
+		// Empfangs-FIFO hat den Schwellwert erreicht
+		if (I2caRegs.I2CFFRX.bit.RXFFINT)
+		{
+				// Empfangene Bytes in den Lese-Puffer kopieren
+				I2cEmptyFifoRxA();
+				// Interrupt ausschalten, wenn alle Bytes gelesen wurden, sonst den
+				// Schwellwert an die Anzahl der noch fehlenden Bytes anpassen
+				if (!i2cBytesToReadA)
+				{
+						I2caRegs.I2CFFRX.bit.RXFFIENA = 0;
+				}
+				else if (i2cBytesToReadA < I2C_FIFO_LEVEL_RX)
+				{
+						I2caRegs.I2CFFRX.bit.RXFFIL = i2cBytesToReadA;
+				}
+				// Interrupt-Flag lschen
+				I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1;
+		}
+
+		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der INT_I2CA_FIFO-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
+}
@@ -8,10 +8,18 @@
 ///							Das Modul B kann analog zu den hier gezeigten Funktionen verwendet werden.
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///							nderung in Version 3.0: bertragungen beliebiger Lnge. Die Hardware-FIFOs werden
+///							ber die FIFO-Interrupts (Schwellwerte I2C_FIFO_LEVEL_TX/_RX) in Blcken nachgeladen
+///							bzw. geleert, die CPU muss whrend der bertragung nicht warten. Mit
+///							"I2cTransferA()" knnen beliebige Puffer der aufrufenden Stelle verwendet werden
+///							nderung in Version 3.1: Optionale Callback-Funktion am Ende jeder bertragung, damit
+///							z.B. ein Scheduler ("myI2cJobs.c") die nchste bertragung aus der ISR starten kann
+///							nderung in Version 3.2: "I2cResetA()" bricht eine hngende bertragung ab (z.B. nach
+///							einer Zeitberschreitung), ohne die Interrupts global zu sperren
 ///
-/// @version    V1.4
+/// @version    V3.2
 ///
-/// @date       27.03.2023
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -38,9 +46,19 @@
 #define I2C_DATA_BITS_6  								6
 #define I2C_DATA_BITS_7  								7
 #define I2C_DATA_BITS_8  								0
-// Gre der Software-Puffer fr I2C-Kommunikation. Darf nicht grer
-// als die Hardware-Puffer (16 Byte) des I2C-Moduls gewhlt werden
+// Gre der Hardware-Puffer (FIFOs) des I2C-Moduls
 #define I2C_SIZE_HARDWARE_FIFO					16
+// Gre der Software-Puffer fr I2C-Kommunikation. Kann unabhngig von
+// der Gre der Hardware-Puffer gewhlt werden (max. 65535, I2CCNT)
+#define I2C_SIZE_BUFFER									64
+// Schwellwerte der FIFO-Interrupts: Der Sende-FIFO wird nachgeladen, sobald
+// hchstens I2C_FIFO_LEVEL_TX Bytes in ihm stehen, der Empfangs-FIFO wird
+// geleert, sobald mindestens I2C_FIFO_LEVEL_RX Bytes in ihm stehen. Die
+// Differenz zur FIFO-Gre ist die Reserve fr die Latenz der ISR (bei
+// 400 kHz ca. 23 us pro Byte). Ist der Empfangs-FIFO voll, hlt der Master
+// SCL auf 0, es gehen also keine Daten verloren
+#define I2C_FIFO_LEVEL_TX								4
+#define I2C_FIFO_LEVEL_RX								8
 // Zustnde der I2C-Kommunikation (i2cStatusFlag)
 #define I2C_STATUS_IDLE									0
 #define I2C_STATUS_IN_PROGRESS					1
@@ -53,12 +71,20 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Funktion, die am Ende jeder bertragung aus der ISR aufgerufen wird
+// (Parameter: I2C_STATUS_FINISHED oder I2C_STATUS_ERROR)
+typedef void (*I2cCallback)(uint16_t status);
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
 // Software-Puffer fr die I2C-Kommunikation
-extern uint16_t i2cBufferWriteA[I2C_SIZE_HARDWARE_FIFO];
-extern uint16_t i2cBufferReadA[I2C_SIZE_HARDWARE_FIFO];
+extern uint16_t i2cBufferWriteA[I2C_SIZE_BUFFER];
+extern uint16_t i2cBufferReadA[I2C_SIZE_BUFFER];
 
 
 //-------------------------------------------------------------------------------------------------
@@ -75,6 +101,8 @@ extern void I2cInitBufferWriteA(void);
 extern uint16_t I2cGetStatusA(void);
 // Funktion setzt das Status-Flag auf "idle", falls die vorherige Kommunikation abgeschlossen ist
 extern bool I2cSetStatusIdleA(void);
+// Funktion bricht eine laufende bertragung ab und gibt das I2C-A Modul wieder frei
+extern void I2cResetA(void);
 // Funktion schreibt ber I2C die mit dem Parameter "numberOfBytes" angegebene
 // Anzahl an Bytes aus dem Software-Puffer "i2cBufferWrite[]" an den ber den
 // Parameter "slaveAddress" adressierten Slave (Master Transmitter Mode)
@@ -94,8 +122,25 @@ extern bool I2cReadA(uint16_t slaveAddress,
 extern bool I2cWriteReadA(uint16_t slaveAddress,
 													uint16_t numberOfBytesWrite,
 													uint16_t numberOfBytesRead);
+// Funktion schreibt "numberOfBytesWrite" Bytes aus "dataWrite" an den Slave und/oder
+// liest "numberOfBytesRead" Bytes vom Slave nach "dataRead" (bei Schreiben und Lesen
+// mit wiederholter START-Bedingung). Die Puffer mssen bis zum Ende der bertragung
+// gltig bleiben
+extern bool I2cTransferA(uint16_t slaveAddress,
+												 const uint16_t *dataWrite,
+												 uint16_t numberOfBytesWrite,
+												 uint16_t *dataRead,
+												 uint16_t numberOfBytesRead);
+// Funktion ldt die nchsten zu sendenden Bytes in den Sende-FIFO
+extern void I2cFillFifoTxA(void);
+// Funktion kopiert die empfangenen Bytes aus dem Empfangs-FIFO in den Lese-Puffer
+extern void I2cEmptyFifoRxA(void);
+// Funktion setzt die Callback-Funktion fr das Ende einer bertragung (0: keine)
+extern void I2cSetCallbackA(I2cCallback callback);
 // Interrupt-Service-Routine fr die I2C-Kommunikation
 __interrupt void I2cISRA(void);
+// Interrupt-Service-Routine fr die FIFO-Interrupts (Nachladen bzw. Leeren der FIFOs)
+__interrupt void I2cFifoISRA(void);
 
 
 #endif
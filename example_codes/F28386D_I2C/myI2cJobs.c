@@ -0,0 +1,332 @@
+//=================================================================================================
+/// @file       myI2cJobs.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr periodische I2C-Auftrge ("Jobs"), z.B. um
+///							mehrere Temperatur- und Spannungssensoren mit festen Abtastraten zu lesen, ohne dass
+///							das Hauptprogramm beteiligt ist. Jeder Auftrag beschreibt eine bertragung (Slave-
+///							Adresse, Register, Anzahl der Bytes, Periode, Ziel-Puffer). Der CPU-Timer 0 erzeugt
+///							einen Takt von I2C_JOBS_TICK_US und markiert fllige Auftrge als wartend, die
+///							Warteschlange wird anschlieend reihum abgearbeitet: Am Ende jeder bertragung
+///							startet die Callback-Funktion des I2C-Treibers ("myI2C.c") direkt aus der ISR den
+///							nchsten wartenden Auftrag. Fr jeden Auftrag werden die Anzahl der bertragungen,
+///							der Fehler und der bersprungenen Perioden sowie die Latenz (fllig bis Daten im
+///							Puffer) gezhlt bzw. gemessen. Solange Auftrge laufen, gehrt der Bus I2C-A dem
+///							Scheduler, "I2cWriteA()" usw. drfen dann nicht direkt aufgerufen werden.
+///
+///							nderung in Version 1.1: Zeitberschreitung je Auftrag. Ist eine bertragung nach
+///							"timeout" Ticks nicht beendet (z.B. Slave hlt SDA/SCL fest), wird sie als Fehler
+///							gezhlt, das I2C-A Modul mit "I2cResetA()" zurckgesetzt und der Bus freigegeben
+///
+/// @version    V1.1
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myI2cJobs.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Tabelle der Auftrge (muss whrend der Laufzeit gltig bleiben)
+I2cJob *i2cJobs = 0;
+uint16_t i2cJobsNumberOfJobs = 0;
+// Index des laufenden Auftrags (I2C_JOBS_NONE: Bus frei)
+uint16_t i2cJobsActive = I2C_JOBS_NONE;
+// Index des zuletzt gestarteten Auftrags (Start der Suche nach dem nchsten wartenden Auftrag)
+uint16_t i2cJobsLast = 0;
+// Anzahl der Ticks seit dem Start des Schedulers
+volatile uint32_t i2cJobsTicks = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: I2cJobsInit =======================================================================
+///
+/// @brief  Funktion bernimmt die Tabelle der Auftrge, setzt deren Zustand zurck, registriert
+///					"I2cJobsFinished()" als Callback-Funktion des I2C-Treibers und startet den CPU-Timer 0
+///					als Takt des Schedulers. Alle periodischen Auftrge sind einen Tick nach dem Start das
+///					erste Mal fllig. Auftrge ohne Zeitberschreitung ("timeout" = 0) erhalten
+///					I2C_JOBS_TIMEOUT_DEFAULT. Das I2C-Modul muss zuvor mit "I2cInitA()" initialisiert
+///					werden. Die Funktion gibt "false" zurck, falls die Tabelle ungltig ist.
+///
+/// @param  I2cJob *jobs, uint16_t numberOfJobs
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool I2cJobsInit(I2cJob *jobs,
+								 uint16_t numberOfJobs)
+{
+		if (   (jobs == 0)
+				|| (numberOfJobs == 0)
+				|| (numberOfJobs >= I2C_JOBS_NONE))
+		{
+				return false;
+		}
+		for (uint16_t i = 0; i < numberOfJobs; i++)
+		{
+				if (   (jobs[i].destination == 0)
+						|| (jobs[i].length == 0))
+				{
+						return false;
+				}
+				if (jobs[i].timeout == 0)
+				{
+						jobs[i].timeout = I2C_JOBS_TIMEOUT_DEFAULT;
+				}
+		}
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+		// CPU-Timer 0 anhalten, Interrupt whrend der Konfiguration sperren
+		CpuTimer0Regs.TCR.bit.TSS = 1;
+		CpuTimer0Regs.TCR.bit.TIE = 0;
+
+		i2cJobs             = jobs;
+		i2cJobsNumberOfJobs = numberOfJobs;
+		i2cJobsActive       = I2C_JOBS_NONE;
+		i2cJobsLast         = numberOfJobs - 1;
+		i2cJobsTicks        = 0;
+		for (uint16_t i = 0; i < numberOfJobs; i++)
+		{
+				jobs[i].due     = 1;
+				jobs[i].pending = false;
+		}
+		I2cJobsResetStatistics();
+		// Ende jeder bertragung an den Scheduler melden
+		I2cSetCallbackA(&I2cJobsFinished);
+
+		// Vorteiler 1, Periode laden
+		CpuTimer0Regs.TPR.all  = 0;
+		CpuTimer0Regs.TPRH.all = 0;
+		CpuTimer0Regs.PRD.all  = I2C_JOBS_TICK_CYCLES - 1;
+		CpuTimer0Regs.TCR.bit.TRB = 1;
+		// Interrupt-Service-Routine an die entsprechende Stelle
+		// (TIMER0_INT) der PIE-Vector Table speichern
+		PieVectTable.TIMER0_INT = &I2cJobsTimerISR;
+		// TIMER0-Interrupt freischalten (Zeile 1, Spalte 7 der Tabelle 3-2)
+		// (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		PieCtrlRegs.PIEIER1.bit.INTx7 = 1;
+		// CPU-Interrupt 1 einschalten (Zeile 1 der Tabelle)
+		IER |= M_INT1;
+		// Interrupt einschalten und Timer starten
+		CpuTimer0Regs.TCR.bit.TIE = 1;
+		CpuTimer0Regs.TCR.bit.TSS = 0;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+		return true;
+}
+
+
+//=== Function: I2cJobsTrigger ====================================================================
+///
+/// @brief  Funktion markiert den Auftrag mit dem Index "index" als wartend, er wird ausgefhrt,
+///					sobald der Bus frei ist (z.B. fr Auftrge mit der Periode 0). Wartet der Auftrag
+///					bereits oder luft er, wird "false" zurckgegeben.
+///
+/// @param  uint16_t index
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool I2cJobsTrigger(uint16_t index)
+{
+		bool operationPerformed = false;
+		if (index >= i2cJobsNumberOfJobs)
+		{
+				return false;
+		}
+		// Zugriff der ISRs auf die Warteschlange sperren
+		uint16_t interruptState = __disable_interrupts();
+		if (!i2cJobs[index].pending
+				&& (i2cJobsActive != index))
+		{
+				i2cJobs[index].pending = true;
+				i2cJobs[index].dueTime = I2C_JOBS_COUNTER;
+				operationPerformed     = true;
+				I2cJobsStartNext();
+		}
+		__restore_interrupts(interruptState);
+		return operationPerformed;
+}
+
+
+//=== Function: I2cJobsResetStatistics ============================================================
+///
+/// @brief  Funktion setzt die Zhler (bertragungen, Fehler, bersprungene Perioden) und die
+///					Latenzen aller Auftrge zurck.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void I2cJobsResetStatistics(void)
+{
+		uint16_t interruptState = __disable_interrupts();
+		for (uint16_t i = 0; i < i2cJobsNumberOfJobs; i++)
+		{
+				i2cJobs[i].count      = 0;
+				i2cJobs[i].errors     = 0;
+				i2cJobs[i].overruns   = 0;
+				i2cJobs[i].latency    = 0;
+				i2cJobs[i].latencyMax = 0;
+		}
+		__restore_interrupts(interruptState);
+}
+
+
+//=== Function: I2cJobsStartNext ==================================================================
+///
+/// @brief  Funktion startet den nchsten wartenden Auftrag, falls kein Auftrag luft. Die Suche
+///					beginnt nach dem zuletzt gestarteten Auftrag, sodass alle Auftrge reihum an die Reihe
+///					kommen. Kann die bertragung nicht gestartet werden (z.B. STOP-Bedingung noch nicht
+///					vollstndig gesendet), bleibt der Auftrag wartend und wird beim nchsten Tick erneut
+///					versucht. Die Funktion wird nur aus den ISRs bzw. mit gesperrten Interrupts
+///					aufgerufen.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void I2cJobsStartNext(void)
+{
+		if (i2cJobsActive != I2C_JOBS_NONE)
+		{
+				return;
+		}
+		for (uint16_t n = 0; n < i2cJobsNumberOfJobs; n++)
+		{
+				uint16_t index = i2cJobsLast + 1 + n;
+				if (index >= i2cJobsNumberOfJobs)
+				{
+						index -= i2cJobsNumberOfJobs;
+				}
+				I2cJob *job = &i2cJobs[index];
+				if (!job->pending)
+				{
+						continue;
+				}
+				// Status der vorherigen bertragung verwerfen (wurde bereits ausgewertet)
+				I2cSetStatusIdleA();
+				bool started;
+				if (job->reg == I2C_JOBS_NO_REGISTER)
+				{
+						started = I2cTransferA(job->slaveAddress, 0, 0, job->destination, job->length);
+				}
+				else
+				{
+						started = I2cTransferA(job->slaveAddress, &job->reg, 1, job->destination, job->length);
+				}
+				if (started)
+				{
+						job->pending  = false;
+						job->started  = i2cJobsTicks;
+						i2cJobsActive = index;
+						i2cJobsLast   = index;
+				}
+				return;
+		}
+}
+
+
+//=== Function: I2cJobsFinished ===================================================================
+///
+/// @brief  Funktion wird vom I2C-Treiber am Ende jeder bertragung (STOP-Bedingung) aus der ISR
+///					aufgerufen. Die bertragung des laufenden Auftrags wird ausgewertet (Zhler, Latenz)
+///					und der nchste wartende Auftrag gestartet.
+///
+/// @param  uint16_t status (I2C_STATUS_FINISHED oder I2C_STATUS_ERROR)
+///
+/// @return void
+///
+//=================================================================================================
+void I2cJobsFinished(uint16_t status)
+{
+		if (i2cJobsActive == I2C_JOBS_NONE)
+		{
+				return;
+		}
+		I2cJob *job = &i2cJobs[i2cJobsActive];
+		i2cJobsActive = I2C_JOBS_NONE;
+		if (status == I2C_STATUS_FINISHED)
+		{
+				// Latenz von der Flligkeit bis zum Ende der bertragung in us (SYSCLK = 200 MHz)
+				job->latency = (I2C_JOBS_COUNTER - job->dueTime) / 200UL;
+				if (job->latency > job->latencyMax)
+				{
+						job->latencyMax = job->latency;
+				}
+				job->count++;
+		}
+		else
+		{
+				job->errors++;
+		}
+		I2cJobsStartNext();
+}
+
+
+//=== Function: I2cJobsTimerISR ===================================================================
+///
+/// @brief  ISR wird alle I2C_JOBS_TICK_US aufgerufen und markiert alle flligen periodischen
+///					Auftrge als wartend. Wartet ein Auftrag noch oder luft er, wird die Periode
+///					bersprungen und gezhlt. Luft der aktive Auftrag lnger als "timeout" Ticks,
+///					wird die bertragung abgebrochen: Der Fehler wird gezhlt, das I2C-A Modul mit
+///					"I2cResetA()" zurckgesetzt und der Bus freigegeben. Anschlieend wird der nchste
+///					wartende Auftrag gestartet, falls der Bus frei ist.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void I2cJobsTimerISR(void)
+{
+		uint32_t now = I2C_JOBS_COUNTER;
+		i2cJobsTicks++;
+		// Zeitberschreitung des laufenden Auftrags (keine STOP-Bedingung erkannt)
+		if (i2cJobsActive != I2C_JOBS_NONE)
+		{
+				I2cJob *job = &i2cJobs[i2cJobsActive];
+				if ((i2cJobsTicks - job->started) > job->timeout)
+				{
+						job->errors++;
+						I2cResetA();
+						i2cJobsActive = I2C_JOBS_NONE;
+				}
+		}
+		for (uint16_t i = 0; i < i2cJobsNumberOfJobs; i++)
+		{
+				I2cJob *job = &i2cJobs[i];
+				// Vergleich mit Vorzeichen, damit der berlauf der Ticks keine Rolle spielt
+				if (   (job->period == 0)
+						|| ((int32_t)(i2cJobsTicks - job->due) < 0))
+				{
+						continue;
+				}
+				job->due += job->period;
+				if (   job->pending
+						|| (i2cJobsActive == i))
+				{
+						job->overruns++;
+				}
+				else
+				{
+						job->pending = true;
+						job->dueTime = now;
+				}
+		}
+		I2cJobsStartNext();
+
+		// Interrupt-Flag der Gruppe 1 lschen (da gehrt der TIMER0-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK1 = 1;
+}
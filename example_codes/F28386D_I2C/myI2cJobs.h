@@ -0,0 +1,123 @@
+//=================================================================================================
+/// @file       myI2cJobs.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr periodische I2C-Auftrge ("Jobs"), z.B. um
+///							mehrere Temperatur- und Spannungssensoren mit festen Abtastraten zu lesen, ohne dass
+///							das Hauptprogramm beteiligt ist. Jeder Auftrag beschreibt eine bertragung (Slave-
+///							Adresse, Register, Anzahl der Bytes, Periode, Ziel-Puffer). Der CPU-Timer 0 erzeugt
+///							einen Takt von I2C_JOBS_TICK_US und markiert fllige Auftrge als wartend, die
+///							Warteschlange wird anschlieend reihum abgearbeitet: Am Ende jeder bertragung
+///							startet die Callback-Funktion des I2C-Treibers ("myI2C.c") direkt aus der ISR den
+///							nchsten wartenden Auftrag. Fr jeden Auftrag werden die Anzahl der bertragungen,
+///							der Fehler und der bersprungenen Perioden sowie die Latenz (fllig bis Daten im
+///							Puffer) gezhlt bzw. gemessen. Solange Auftrge laufen, gehrt der Bus I2C-A dem
+///							Scheduler, "I2cWriteA()" usw. drfen dann nicht direkt aufgerufen werden.
+///
+///							nderung in Version 1.1: Zeitberschreitung je Auftrag. Ist eine bertragung nach
+///							"timeout" Ticks nicht beendet (z.B. Slave hlt SDA/SCL fest), wird sie als Fehler
+///							gezhlt, das I2C-A Modul mit "I2cResetA()" zurckgesetzt und der Bus freigegeben
+///
+/// @version    V1.1
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYI2CJOBS_H_
+#define MYI2CJOBS_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myI2C.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Takt des Schedulers in us (Einheit der Periode eines Auftrags)
+#define I2C_JOBS_TICK_US												1000
+// Takte des CPU-Timers 0 pro Tick (SYSCLK = 200 MHz)
+#define I2C_JOBS_TICK_CYCLES										((uint32_t)I2C_JOBS_TICK_US * 200UL)
+// Register fr Auftrge, die ohne vorheriges Schreiben des Registers lesen
+#define I2C_JOBS_NO_REGISTER										0xFFFF
+// Kein Auftrag aktiv
+#define I2C_JOBS_NONE														0xFFFF
+// Zeitberschreitung in Ticks fr Auftrge ohne eigene Angabe ("timeout" = 0)
+#define I2C_JOBS_TIMEOUT_DEFAULT								10
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Freilaufender Zhler fr die Messung der Latenz (SYSCLK, 200 MHz)
+#define I2C_JOBS_COUNTER												(Cpu1toCpu2IpcRegs.IPCCOUNTERL)
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Auftrag. Die Struktur muss whrend der Laufzeit gltig bleiben
+typedef struct
+{
+		// Konfiguration (wird von der Anwendung gesetzt):
+		// 7-Bit Adresse des Slaves
+		uint16_t slaveAddress;
+		// Register, das vor dem Lesen geschrieben wird (I2C_JOBS_NO_REGISTER: nur lesen)
+		uint16_t reg;
+		// Anzahl der zu lesenden Bytes
+		uint16_t length;
+		// Periode in Ticks (0: nur auf Anforderung ber "I2cJobsTrigger()")
+		uint16_t period;
+		// Ziel-Puffer fr die gelesenen Bytes (mind. "length" Elemente)
+		uint16_t *destination;
+		// Zeitberschreitung in Ticks (0: I2C_JOBS_TIMEOUT_DEFAULT)
+		uint16_t timeout;
+
+		// Zustand (wird vom Scheduler gesetzt):
+		// Tick, zu dem der Auftrag das nchste Mal fllig ist
+		uint32_t due;
+		// Zeitpunkt (I2C_JOBS_COUNTER), zu dem der Auftrag fllig wurde
+		uint32_t dueTime;
+		// Tick, zu dem die bertragung gestartet wurde
+		uint32_t started;
+		// Auftrag wartet auf den Bus
+		bool pending;
+		// Wird nach jeder erfolgreichen bertragung erhht (neue Daten im Ziel-Puffer)
+		volatile uint32_t count;
+		// Anzahl der fehlerhaften bertragungen (z.B. NACK, Zeitberschreitung)
+		uint32_t errors;
+		// Anzahl der bersprungenen Perioden (Auftrag war bei erneuter Flligkeit noch nicht beendet)
+		uint32_t overruns;
+		// Latenz der letzten bertragung und max. Latenz in us (fllig bis Daten im Puffer)
+		uint32_t latency;
+		uint32_t latencyMax;
+} I2cJob;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Ticks seit dem Start des Schedulers
+extern volatile uint32_t i2cJobsTicks;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion bernimmt die Tabelle der Auftrge und startet den Scheduler (CPU-Timer 0)
+extern bool I2cJobsInit(I2cJob *jobs,
+												uint16_t numberOfJobs);
+// Funktion markiert einen Auftrag als wartend (einmalige bertragung)
+extern bool I2cJobsTrigger(uint16_t index);
+// Funktion setzt die Zhler und die max. Latenz aller Auftrge zurck
+extern void I2cJobsResetStatistics(void);
+// Funktion startet den nchsten wartenden Auftrag, falls der Bus frei ist
+extern void I2cJobsStartNext(void);
+// Funktion wird vom I2C-Treiber am Ende jeder bertragung aufgerufen (aus der ISR)
+extern void I2cJobsFinished(uint16_t status);
+// Interrupt-Service-Routine fr den Takt des Schedulers (CPU-Timer 0)
+__interrupt void I2cJobsTimerISR(void);
+
+
+#endif
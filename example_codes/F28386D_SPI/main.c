@@ -7,10 +7,12 @@
 ///						Funktion sind im Modul zu finden.
 ///
 ///						nderung mySPI.c V2.0: Verwendung der Hardware-Puffer zum Senden und Empfangen
+///						nderung mySPI.c V3.0: DMA-Modus
+///						nderung mySPI.c V4.0: Warteschlange fr bertragungen an mehrere Gerte
 ///
-/// @version	V1.3
+/// @version	V1.5
 ///
-/// @date			24.03.2023
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -23,11 +25,17 @@
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Anzahl der Worte pro bertragung
+#define MAIN_LENGTH_SENSOR_1						3
+#define MAIN_LENGTH_SENSOR_2						2
+#define MAIN_LENGTH_DMA									64
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Wird am Ende einer bertragung aus der ISR aufgerufen
+void MainTransactionDone(void *context);
 
 
 //-------------------------------------------------------------------------------------------------
@@ -35,6 +43,28 @@
 //-------------------------------------------------------------------------------------------------
 // Zum Starten der Kommunikation
 uint32_t startSPI = 0;
+// Zum Starten einer Kommunikation im DMA-Modus
+uint32_t startSPIDMA = 0;
+// Gerte am SPI-A Bus:
+// Sensor 1: CS an GPIO 58, Modus 0 (CPOL = 0, CPHA = 0), 8 Bit, 1 MHz
+const SpiDevice sensor1 = {58, SPI_POLARITY_LOW,  SPI_PHASE_NORMAL,  8,  SPI_CLOCK_1_MHZ};
+// Sensor 2: CS an GPIO 59, Modus 3 (CPOL = 1, CPHA = 1), 16 Bit, 5 MHz
+const SpiDevice sensor2 = {59, SPI_POLARITY_HIGH, SPI_PHASE_DELAYED, 16, SPI_CLOCK_5_MHZ};
+// Puffer der bertragungen
+uint16_t sensor1Tx[MAIN_LENGTH_SENSOR_1] = {1, 2, 3};
+uint16_t sensor1Rx[MAIN_LENGTH_SENSOR_1];
+uint16_t sensor2Tx[MAIN_LENGTH_SENSOR_2] = {0x8000, 0x0000};
+uint16_t sensor2Rx[MAIN_LENGTH_SENSOR_2];
+// bertragungen (Gert, Sendedaten, Empfangsdaten, Anzahl, Modus, Callback, Kontext)
+SpiTransaction transactionSensor1 = {&sensor1, sensor1Tx, sensor1Rx, MAIN_LENGTH_SENSOR_1,
+																		 SPI_MODE_FIFO, &MainTransactionDone, 0};
+SpiTransaction transactionSensor2 = {&sensor2, sensor2Tx, sensor2Rx, MAIN_LENGTH_SENSOR_2,
+																		 SPI_MODE_FIFO, &MainTransactionDone, 0};
+// bertragung im DMA-Modus (Puffer im GSx-RAM)
+SpiTransaction transactionDma = {&sensor1, spiDmaBufferTxA, spiDmaBufferRxA, MAIN_LENGTH_DMA,
+																 SPI_MODE_DMA, &MainTransactionDone, 0};
+// Anzahl der abgeschlossenen bertragungen
+volatile uint32_t transactionsDone = 0;
 
 
 //=== Function: main ==============================================================================
@@ -50,68 +80,92 @@ void main(void)
 {
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
-    // SPI als Master mit 1 MHz CLK-Takt initialisieren
-    SpiInitA(SPI_CLOCK_1_MHZ);
+    // SPI-A als Master initialisieren
+    SpiInitA();
+    // DMA-Kanle fr den DMA-Modus initialisieren
+    SpiInitDmaA();
+    // CS-Leitungen der Gerte konfigurieren
+    if (   !SpiInitDeviceA(&sensor1)
+    		|| !SpiInitDeviceA(&sensor2))
+    {
+    		// Fehlerbehandlung:
+    		// ...
+    }
 
     // Register-Schreibschutz ausschalten
     EALLOW;
 
     // Grundstzlicher Ablauf einer SPI-Kommunikation:
     //
-    // 1) Prfen, ob eine SPI-Kommunikation aktiv ist. Ggf. warten
-    // 2) Puffer "spiBufferRxA[]" und "spiBufferTxA[]" initialisieren
-    // 3) Zu sendene Daten in "spiBufferTxA[]" schreiben, falls Daten an einen Slave
-    //		gesendet werden sollen. Dummy-Daten in "spiBufferTxA[]" schreiben, falls
-    //		Daten vom Slave nur empfangen werden sollen
-    // 4) Funktion "SpiSendDataA()" aufrufen
-    // 5) Rckgabewert prfen, ob die Kommunikation gestartet wurde
-    // 6) Warten bis die Kommunikation abgeschlossen ist durch Aufruf von "SpiGetStatusA()"
-    // 7) Slave abwhlen z.B. durch Aufruf des Makros "SPI_DISABLE_SLAVE_1"
-    // 8) Empfangene Daten aus "spiBufferRxA[]" lesen
-    // 9) SPI-Status auf "idle" setzen durch Aufruf von "SpiSetStatusIdleA()"
+    // 1) Gerte-Deskriptor ("SpiDevice") je Gert anlegen und mit "SpiInitDeviceA()" prfen
+    // 2) bertragung ("SpiTransaction") mit Gert, Puffern, Anzahl der Worte und Modus anlegen.
+    //		Sendedaten stehen rechtsbndig im Sendepuffer (im DMA-Modus linksbndig im GSx-RAM,
+    //		siehe Makro "SPI_DMA_DATA()")
+    // 3) bertragung mit "SpiQueueTransactionA()" einreihen und Rckgabewert prfen
+    // 4) Die ISR fhrt die bertragungen nacheinander aus und whlt die Gerte an und ab
+    // 5) Ende der bertragung ber das Element "status" (SPI_STATUS_FINISHED) oder die
+    //		Callback-Funktion erkennen und Empfangsdaten aus dem Empfangspuffer lesen (im
+    //		DMA-Modus mit dem Makro "SPI_DMA_RX_DATA()")
 
 
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-				// Vor jeder einer Kommunikation sicherstellen, das keine Kommunikation aktiv ist
-				if (   (SpiGetStatusA() == SPI_STATUS_IDLE)
-					  && (startSPI == 1))
+				// Beide Sensoren abfragen. Die bertragungen werden nur eingereiht, falls die
+				// vorherige bertragung abgeschlossen ist (Puffer werden nicht mehr verwendet)
+				if (   (startSPI == 1)
+					  && (transactionSensor1.status != SPI_STATUS_QUEUED)
+					  && (transactionSensor1.status != SPI_STATUS_IN_PROGRESS)
+					  && (transactionSensor2.status != SPI_STATUS_QUEUED)
+					  && (transactionSensor2.status != SPI_STATUS_IN_PROGRESS))
 				{
 						// Datenpaket nur einmal senden
         		startSPI = 0;
-						// 3 Bytes an Slave 1 senden und 3 Bytes von Slave 1 empfangen.
-						// Um Daten ber SPI an einen Slave zu senden,  mssen diese in den Sende-Puffer "spiBufferTxA[]"
-						// geschrieben werden. Dabei mssen die Daten am Anfang des Puffers geschrieben werden (beginnend
-						// vom Element 0 an). Es ist darauf zu achten, dass nicht mehr Daten geschrieben, als der Puffer
-						// gro ist (SPI_SIZE_BUFFER)
-						spiBufferTxA[0] = 1;
-						spiBufferTxA[1] = 2;
-						spiBufferTxA[2] = 3;
-
-						for (uint16_t i=0; i<SPI_SIZE_SOFTWARE_BUFFER; i++)
+						// bertragungen einreihen, die ISR fhrt sie direkt nacheinander aus.
+						// Falls der Rckgabewert "false" ist, wurde die bertragung nicht
+						// eingereiht, weil z.B. die Warteschlange voll ist
+						if (   !SpiQueueTransactionA(&transactionSensor1)
+								|| !SpiQueueTransactionA(&transactionSensor2))
 						{
-								spiBufferTxA[i] = 1;
+								// Fehlerbehandlung:
+								// ...
 						}
+				}
 
-						// Sende-Vorgang starten. Falls der Rckgabewert "false" ist, wurde der Vorgang
-						// nicht ausgefhrt, weil z.B. die Anzahl zu sendener Bytes zu gro ist
-						if (!SpiSendDataA(SPI_SLAVE_1, 3))
+				// bertragung im DMA-Modus: 64 Bytes an Sensor 1 senden (8 Bursts zu je 8 Bytes)
+				if (   (startSPIDMA == 1)
+					  && (transactionDma.status != SPI_STATUS_QUEUED)
+					  && (transactionDma.status != SPI_STATUS_IN_PROGRESS))
+				{
+						startSPIDMA = 0;
+						for (uint16_t i=0; i<MAIN_LENGTH_DMA; i++)
+						{
+								spiDmaBufferTxA[i] = SPI_DMA_DATA(i, sensor1.wordLength);
+						}
+						if (!SpiQueueTransactionA(&transactionDma))
 						{
 								// Fehlerbehandlung:
 								// ...
 						}
 				}
 
-				// Warten, bis die Kommunikation beendet ist
-				while (SpiGetStatusA() == SPI_STATUS_IN_PROGRESS);
+				// Empfangsdaten auswerten, sobald die bertragungen abgeschlossen sind
+				// ...
+    }
+}
 
-				// Slave abwhlen/inaktiv setzen
-				SPI_DISABLE_SLAVE_1;
 
-				// Status-Flag auf "idle" setzen, um die Bereitschaft der SPI-
-				// Schnittstelle zu signalisieren (Rckgabewert wird hier nicht
-				// gebraucht), da der Status oben bereits abgefragt wurde
-				SpiSetStatusIdleA();
-    }
+//=== Function: MainTransactionDone ===============================================================
+///
+/// @brief  Funktion wird am Ende jeder bertragung aus der SPI-ISR aufgerufen. Da sie im
+///					Interrupt luft, werden hier nur Flags bzw. Zhler gesetzt.
+///
+/// @param  void *context
+///
+/// @return void
+///
+//=================================================================================================
+void MainTransactionDone(void *context)
+{
+		transactionsDone++;
 }
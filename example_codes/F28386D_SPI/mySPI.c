@@ -3,18 +3,29 @@
 ///
 /// @brief      Datei enthlt Variablen und Funktionen um die SPI-Schnittstelle als Master zu
 ///							benutzen. Die Kommunikation ist Interrupt-basiert und nutzt die beiden 16x16-Bit
-///						  groen Hardware-FIFOs. Pro Kommunikationvorgang knnen bis zu 65.536 Bytes
-///							bertragen werden. Der Hardware-FIFO wird dabei so oft mit den Daten aus dem
-///							Software-Puffer beschrieben bzw. Daten aus dem FIFO in den Software-Puffer
-///							geschrieben, bis die gewnschte Zahl an Btes bertragen wurde.Der Status der
-///							Kommunikation (aktiv oder nicht aktiv) kann ber die Funktion "SpiGetStatus()"
-///							abgefragt werden.
+///						  groen Hardware-FIFOs. Mehrere Slaves (Gerte) teilen sich den Bus. Jedes Gert
+///							wird durch einen Gerte-Deskriptor ("SpiDevice") mit CS-Leitung (beliebiger
+///							GPIO), Taktpolaritt, Taktphase, Datenlnge (1 ... 16 Bit) und Taktrate
+///							beschrieben. bertragungen ("SpiTransaction") werden ber die Funktion
+///							"SpiQueueTransactionA()" in eine Warteschlange eingereiht und von der ISR ohne
+///							Zutun des Hauptprogramms direkt nacheinander ausgefhrt. Vor jeder bertragung
+///							werden die Einstellungen des Gerts bernommen (nur falls sich das Gert
+///							gendert hat) und die CS-Leitung aktiviert. Das Ende einer bertragung wird
+///							ber das Status-Element der bertragung und optional eine Callback-Funktion
+///							gemeldet. Eine bertragung wird entweder von der CPU ber den FIFO (Modus
+///							SPI_MODE_FIFO, ein Interrupt pro FIFO-Fllung) oder per DMA (Modus SPI_MODE_DMA,
+///							ein Interrupt pro bertragung) durchgefhrt.
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///							nderung in Version 3.0: DMA-Modus. Die Daten werden von zwei DMA-Kanlen, die
+///							durch die FIFO-Ereignisse des SPI-Moduls getriggert werden, in den Sende-FIFO
+///							bzw. aus dem Empfangs-FIFO kopiert
+///							nderung in Version 4.0: Warteschlange fr bertragungen und Gerte-Deskriptoren
+///							(ersetzt die festen Slave-Select-Leitungen GPIO 58/59 und "SpiSendDataA()")
 ///
-/// @version    V2.0
+/// @version    V4.0
 ///
-/// @date       24.03.2023
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -27,15 +38,32 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die SPI-Kommunikation
-uint16_t spiBufferTxA[SPI_SIZE_SOFTWARE_BUFFER];
-uint16_t spiBufferRxA[SPI_SIZE_SOFTWARE_BUFFER];
-// Steuern das Kopieren in und aus den Software-Puffern whrend der SPI-Kommunikation
-uint16_t spiBufferIndexTxA;
-uint16_t spiBufferIndexRxA;
-uint16_t spiBytesToTransferA;
-// Flag speichert den aktuellen Zustand der SPI-Kommunikation
+// Warteschlange der bertragungen (Schreib- und Leseindex laufen frei ber)
+SpiTransaction *spiQueueA[SPI_SIZE_TRANSACTION_QUEUE];
+uint16_t spiQueueHeadA;
+uint16_t spiQueueTailA;
+// Aktuelle bertragung (0: keine bertragung aktiv)
+SpiTransaction *spiCurrentA;
+// Gert, dessen Einstellungen aktuell im SPI-Modul stehen
+const SpiDevice *spiActiveDeviceA;
+// Steuern das Kopieren in und aus dem FIFO whrend einer bertragung im FIFO-Modus
+uint16_t spiIndexTxA;
+uint16_t spiIndexRxA;
+// Flag speichert den aktuellen Zustand der SPI-Schnittstelle
 uint16_t spiStatusFlagA;
+// Wird gesetzt, sobald die DMA-Kanle initialisiert wurden
+bool spiDmaReadyA = false;
+// Puffer fr den DMA-Modus. Der DMA hat nur Zugriff auf die GSx-RAMs,
+// daher liegen die Puffer in der Sektion "SPIDMA" (siehe .cmd-Datei)
+#pragma DATA_SECTION(spiDmaBufferTxA, "SPIDMA");
+uint16_t spiDmaBufferTxA[SPI_SIZE_DMA_BUFFER];
+#pragma DATA_SECTION(spiDmaBufferRxA, "SPIDMA");
+uint16_t spiDmaBufferRxA[SPI_SIZE_DMA_BUFFER];
+// Quelle fr Dummy-Daten und Ziel fr verworfene Empfangsdaten im DMA-Modus
+#pragma DATA_SECTION(spiDmaDummyTxA, "SPIDMA");
+uint16_t spiDmaDummyTxA;
+#pragma DATA_SECTION(spiDmaDummyRxA, "SPIDMA");
+uint16_t spiDmaDummyRxA;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -43,27 +71,27 @@ uint16_t spiStatusFlagA;
 //-------------------------------------------------------------------------------------------------
 //=== Function: SpiInitA ==========================================================================
 ///
-/// @brief  Funktion initialisiert GPIO 54 (MOSI), GPIO 55 (MISO), GPIO 56 (CLK) und GPIO 58 (SS)
-/// 				als SPI-Pins und das SPI-A Modul als Master mit Taktrate nach bergebenen Funktions-
-///					parameter "clock" und 8 Bit Datenlnge. Der SPI-Interrupt wird eingeschaltet und die
-///					ISR auf die PIE-Vector-Tabelle gesetzt. Die Konfiguration der SPI Module B, C und D
-///					sind analog zu dem hier gezeigten Modul A.
+/// @brief  Funktion initialisiert GPIO 54 (MOSI), GPIO 55 (MISO) und GPIO 56 (CLK) als SPI-Pins
+///					und das SPI-A Modul als Master. Die Einstellungen fr Takt, Phase und Datenlnge
+///					werden vor jeder bertragung aus dem Gerte-Deskriptor bernommen, die CS-Leitungen
+///					werden ber "SpiInitDeviceA()" konfiguriert. Der SPI-Interrupt wird eingeschaltet
+///					und die ISR auf die PIE-Vector-Tabelle gesetzt. Die Konfiguration der SPI Module B,
+///					C und D sind analog zu dem hier gezeigten Modul A.
 ///
-/// @param  uint32_t clock
+/// @param  void
 ///
 /// @return void
 ///
 //=================================================================================================
-void SpiInitA(uint32_t clock)
+void SpiInitA(void)
 {
     // Register-Schreibschutz aufheben
     EALLOW;
 
-    // GPIO-Sperre fr GPIO 54 (MOSI), 55 (MISO), 56 (CLK) und 58 (SS) aufheben
+    // GPIO-Sperre fr GPIO 54 (MOSI), 55 (MISO) und 56 (CLK) aufheben
     GpioCtrlRegs.GPBLOCK.bit.GPIO54  = 0;
     GpioCtrlRegs.GPBLOCK.bit.GPIO55 = 0;
     GpioCtrlRegs.GPBLOCK.bit.GPIO56 = 0;
-    GpioCtrlRegs.GPBLOCK.bit.GPIO58 = 0;
     // GPIO 54 auf SPI-Funktion setzen (MOSI).
     // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
     // GPAGMUX (MSB, 2 Bit) + GPAMUX (LSB, 2 Bit) als Dezimalzahl an
@@ -88,24 +116,6 @@ void SpiInitA(uint32_t clock)
     GpioCtrlRegs.GPBPUD.bit.GPIO56 = 1;
     // GPIO 56 Asynchroner Eingang (muss fr SPI gesetzt sein)
     GpioCtrlRegs.GPBQSEL2.bit.GPIO56 = 0x03;
-    // GPIO 58 auf GPIO-Funktionalitt setzen (SS Slave 1)
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO58 = (0 >> 2);
-    GpioCtrlRegs.GPBMUX2.bit.GPIO58  = (0 & 0x03);
-    // GPIO 58 Pull-Up-Widerstand deaktivieren
-    GpioCtrlRegs.GPBPUD.bit.GPIO58 = 1;
-    // Zustand von GPIO 58 auf high setzen
-    GpioDataRegs.GPBSET.bit.GPIO58 = 1;
-    // GPIO 58 als Ausgang setzen
-    GpioCtrlRegs.GPBDIR.bit.GPIO58 = 1;
-    // GPIO 59 auf GPIO-Funktionalitt setzen (SS Slave 2)
-    GpioCtrlRegs.GPBGMUX2.bit.GPIO59 = (0 >> 2);
-    GpioCtrlRegs.GPBMUX2.bit.GPIO59  = (0 & 0x03);
-    // GPIO 59 Pull-Up-Widerstand deaktivieren
-    GpioCtrlRegs.GPBPUD.bit.GPIO59 = 1;
-    // Zustand von GPIO 59 auf high setzen
-    GpioDataRegs.GPBSET.bit.GPIO59 = 1;
-    // GPIO 59 als Ausgang setzen
-    GpioCtrlRegs.GPBDIR.bit.GPIO59 = 1;
 
 
     // Takt fr das SPI-Modul einschalten und 5 Takte
@@ -115,6 +125,7 @@ void SpiInitA(uint32_t clock)
     __asm(" RPT #4 || NOP");
 		// SPI-Modul zum konfigurieren ausschalten
     SpiaRegs.SPICCR.bit.SPISWRESET = 0;
+    // Standard-Einstellungen bis zur ersten bertragung:
     // Polaritt = 0 (Ruhepegel: CLK = 0)
     SpiaRegs.SPICCR.bit.CLKPOLARITY = 0;
     // Phase = 0 (Daten bei der ersten (mit POL = 0 also einer steigenden) Flanke bernehmen)
@@ -125,10 +136,8 @@ void SpiInitA(uint32_t clock)
     SpiaRegs.SPICTL.bit.MASTER_SLAVE = 1;
     // bertragung aktivieren
     SpiaRegs.SPICTL.bit.TALK = 1;
-    // Taktrate setzen
-    // (Low-Speed CLK / clock) - 1
-    // Low-Speed CLK = 50 MHz (siehe "DeviceInit()")
-    SpiaRegs.SPIBRR.bit.SPI_BIT_RATE = (50000000 / clock) - 1;
+    // Taktrate 1 MHz
+    SpiaRegs.SPIBRR.bit.SPI_BIT_RATE = SpiCalcBitRate(SPI_CLOCK_1_MHZ);
     // FIFO-Reset whrend der Konfiguration setzen
     SpiaRegs.SPIFFTX.bit.TXFIFO = 0;
     // FIFO-Modus einschalten
@@ -159,194 +168,566 @@ void SpiInitA(uint32_t clock)
 		EDIS;
 
     // Steuervariablen initialisieren
-    SpiInitBufferRxA();
-    SpiInitBufferTxA();
-    spiBufferIndexTxA = 0;
-    spiBufferIndexRxA = 0;
-    spiBytesToTransferA = 0;
-    spiStatusFlagA = SPI_STATUS_IDLE;
+    spiQueueHeadA    = 0;
+    spiQueueTailA    = 0;
+    spiCurrentA      = 0;
+    spiActiveDeviceA = 0;
+    spiIndexTxA      = 0;
+    spiIndexRxA      = 0;
+    spiStatusFlagA   = SPI_STATUS_IDLE;
 }
 
 
-//=== Function: SpiInitBufferTxA ==================================================================
+//=== Function: SpiInitDmaA =======================================================================
 ///
-/// @brief	Funktion setzte alle Elemente des Sende-Software-Puffers "spiBufferTxA[]" zu 0
+/// @brief  Funktion initialisiert die DMA-Kanle SPI_DMA_CHANNEL_TX_A (Sendedaten in das Register
+///					SPITXBUF) und SPI_DMA_CHANNEL_RX_A (Empfangsdaten aus dem Register SPIRXBUF). Beide
+///					Kanle werden durch die FIFO-Ereignisse des SPI-Moduls (SPITXDMA bzw. SPIRXDMA)
+///					getriggert und kopieren pro Trigger einen Burst. Nur der Empfangs-Kanal lst am Ende
+///					der bertragung einen Interrupt aus, da zu diesem Zeitpunkt auch das letzte Wort
+///					vollstndig gesendet wurde. Die Pufferadressen werden beim Start jeder bertragung
+///					gesetzt. Die Funktion muss nach "SpiInitA()" aufgerufen werden, falls bertragungen
+///					im Modus SPI_MODE_DMA verwendet werden.
 ///
-/// @param	void
+/// @param  void
 ///
 /// @return void
 ///
 //=================================================================================================
-void SpiInitBufferTxA(void)
+void SpiInitDmaA(void)
 {
-		// Alle Elemente zu 0 setzen
-		for (uint16_t i=0; i<SPI_SIZE_SOFTWARE_BUFFER; i++)
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Zugriff auf das Peripheral Frame 2 (SPI) dem DMA statt dem CLA zuweisen
+		CpuSysRegs.SECMSEL.bit.PF2SEL = 1;
+		// Takt fr den DMA einschalten und 5 Takte warten
+		CpuSysRegs.PCLKCR0.bit.DMA = 1;
+		__asm(" RPT #4 || NOP");
+		// DMA zurcksetzen und auch bei angehaltener CPU (Debugger) weiterlaufen lassen
+		DmaRegs.DMACTRL.bit.HARDRESET = 1;
+		__asm(" NOP");
+		DmaRegs.DEBUGCTRL.bit.FREE = 1;
+
+		// Sende-Kanal: Trigger durch SPITXDMA (TXFFST <= TXFFIL)
+		DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH5 = SPI_DMA_TRIGGER_SPIATX;
+		DmaRegs.CH5.MODE.bit.PERINTSEL  = SPI_DMA_CHANNEL_TX_A;
+		DmaRegs.CH5.MODE.bit.PERINTE    = 1;
+		DmaRegs.CH5.MODE.bit.ONESHOT    = 0;
+		DmaRegs.CH5.MODE.bit.CONTINUOUS = 0;
+		DmaRegs.CH5.MODE.bit.DATASIZE   = 0;
+		DmaRegs.CH5.MODE.bit.OVRINTE    = 0;
+		DmaRegs.CH5.MODE.bit.CHINTE     = 0;
+		// Ziel: SPITXBUF (fest)
+		DmaRegs.CH5.DST_BURST_STEP    = 0;
+		DmaRegs.CH5.DST_TRANSFER_STEP = 0;
+		// Wrap-Funktion nicht verwenden (grer als jede mgliche bertragung)
+		DmaRegs.CH5.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH5.SRC_WRAP_STEP = 0;
+		DmaRegs.CH5.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH5.DST_WRAP_STEP = 0;
+		DmaRegs.CH5.DST_BEG_ADDR_SHADOW = (uint32_t)&SpiaRegs.SPITXBUF;
+		DmaRegs.CH5.DST_ADDR_SHADOW     = (uint32_t)&SpiaRegs.SPITXBUF;
+
+		// Empfangs-Kanal: Trigger durch SPIRXDMA (RXFFST >= RXFFIL)
+		DmaClaSrcSelRegs.DMACHSRCSEL2.bit.CH6 = SPI_DMA_TRIGGER_SPIARX;
+		DmaRegs.CH6.MODE.bit.PERINTSEL  = SPI_DMA_CHANNEL_RX_A;
+		DmaRegs.CH6.MODE.bit.PERINTE    = 1;
+		DmaRegs.CH6.MODE.bit.ONESHOT    = 0;
+		DmaRegs.CH6.MODE.bit.CONTINUOUS = 0;
+		DmaRegs.CH6.MODE.bit.DATASIZE   = 0;
+		DmaRegs.CH6.MODE.bit.OVRINTE    = 0;
+		// Interrupt am Ende der bertragung
+		DmaRegs.CH6.MODE.bit.CHINTMODE  = 1;
+		DmaRegs.CH6.MODE.bit.CHINTE     = 1;
+		// Quelle: SPIRXBUF (fest)
+		DmaRegs.CH6.SRC_BURST_STEP    = 0;
+		DmaRegs.CH6.SRC_TRANSFER_STEP = 0;
+		DmaRegs.CH6.SRC_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH6.SRC_WRAP_STEP = 0;
+		DmaRegs.CH6.DST_WRAP_SIZE = 0xFFFF;
+		DmaRegs.CH6.DST_WRAP_STEP = 0;
+		DmaRegs.CH6.SRC_BEG_ADDR_SHADOW = (uint32_t)&SpiaRegs.SPIRXBUF;
+		DmaRegs.CH6.SRC_ADDR_SHADOW     = (uint32_t)&SpiaRegs.SPIRXBUF;
+
+		// Fehler- und Trigger-Flags lschen
+		DmaRegs.CH5.CONTROL.bit.ERRCLR    = 1;
+		DmaRegs.CH5.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH6.CONTROL.bit.ERRCLR    = 1;
+		DmaRegs.CH6.CONTROL.bit.PERINTCLR = 1;
+		// Sende-FIFO kurz zurcksetzen. Beim Aufheben des Resets ist der FIFO leer und das
+		// SPI-Modul erzeugt ein SPITXDMA-Ereignis, das der Sende-Kanal bis zum Start der
+		// ersten bertragung speichert (der FIFO ist zu Beginn jeder bertragung leer)
+		SpiaRegs.SPIFFTX.bit.TXFIFO = 0;
+		SpiaRegs.SPIFFTX.bit.TXFFIL = SPI_SIZE_HARDWARE_FIFO - SPI_DMA_MAX_BURST;
+		SpiaRegs.SPIFFTX.bit.TXFIFO = 1;
+
+		// CPU-Interrupts whrend der Konfiguration global sperren
+		DINT;
+		// ISR fr das Ende des Empfangs-Kanals in der PIE-Vector Table speichern
+		PieVectTable.DMA_CH6_INT = &SpiDmaISRA;
+		// DMA_CH6-Interrupt freischalten (Zeile 7, Spalte 6 der Tabelle 3-2)
+		PieCtrlRegs.PIEIER7.bit.INTx6 = 1;
+		// CPU-Interrupt 7 einschalten
+		IER |= M_INT7;
+		// CPU-Interrupts nach Konfiguration global wieder freigeben
+		EINT;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		spiDmaReadyA = true;
+}
+
+
+//=== Function: SpiInitDeviceA ====================================================================
+///
+/// @brief  Funktion prft die Einstellungen eines Gerte-Deskriptors und konfiguriert die
+///					CS-Leitung des Gerts als Ausgang mit Pegel high (Gert nicht angewhlt). Da die
+///					CS-Leitung auf einem beliebigen Port liegen kann, wird auf die Register ber die
+///					Position innerhalb von "GpioCtrlRegs" zugegriffen. Die Funktion gibt "false" zurck,
+///					falls die Einstellungen ungltig sind (auch bei einer GPIO-Nummer grer als
+///					SPI_GPIO_MAX, da sonst Register auerhalb von "GpioCtrlRegs" beschrieben wrden).
+///
+/// @param  const SpiDevice *device
+///
+/// @return bool deviceValid
+///
+//=================================================================================================
+bool SpiInitDeviceA(const SpiDevice *device)
+{
+		if (   (device == 0)
+				|| (device->csGpio > SPI_GPIO_MAX)
+				|| (device->wordLength == 0)
+				|| (device->wordLength > 16)
+				|| (device->polarity > SPI_POLARITY_HIGH)
+				|| (device->phase > SPI_PHASE_DELAYED)
+				|| (device->clock == 0))
 		{
-				spiBufferTxA[i] = 0;
+				return false;
 		}
+
+		// Register des Ports, in dem der GPIO liegt
+		volatile uint32_t *port = (volatile uint32_t *)&GpioCtrlRegs
+														+ ((device->csGpio / 32U) * SPI_GPIO_PORT_STEP);
+		// Bit des GPIOs in den 1-Bit-Registern (LOCK, PUD, DIR)
+		uint32_t mask = 1UL << (device->csGpio % 32U);
+		// Register (x1 oder x2) und Position des GPIOs in den 2-Bit-Registern (MUX, GMUX)
+		uint16_t index = (device->csGpio % 32U) / 16U;
+		uint16_t shift = (device->csGpio % 16U) * 2U;
+
+		EALLOW;
+		// GPIO-Sperre aufheben
+		port[SPI_GPIO_LOCK] &= ~mask;
+		// GPIO-Funktionalitt (Mux-Nummer 0)
+		port[SPI_GPIO_GMUX1 + index] &= ~(3UL << shift);
+		port[SPI_GPIO_MUX1 + index]  &= ~(3UL << shift);
+		// Pull-Up-Widerstand deaktivieren
+		port[SPI_GPIO_PUD] |= mask;
+		// Pegel high setzen, bevor der GPIO als Ausgang geschaltet wird
+		SpiSetCs(device->csGpio, true);
+		port[SPI_GPIO_DIR] |= mask;
+		EDIS;
+
+		return true;
 }
 
 
-//=== Function: SpiInitBufferRxA ==================================================================
+//=== Function: SpiQueueTransactionA ==============================================================
 ///
-/// @brief	Funktion setzte alle Elemente des Empfangs-Software-Puffers "spiBufferRxA[]" zu 0
+/// @brief  Funktion reiht eine bertragung in die Warteschlange ein. Ist die Schnittstelle frei,
+///					wird die bertragung sofort gestartet, ansonsten startet die ISR sie direkt nach dem
+///					Ende der vorherigen bertragung. Das Element "status" der bertragung wechselt von
+///					SPI_STATUS_QUEUED ber SPI_STATUS_IN_PROGRESS zu SPI_STATUS_FINISHED. Die Funktion
+///					gibt "false" zurck, falls die Warteschlange voll ist, die bertragung ungltig ist
+///					oder fr den DMA-Modus "SpiInitDmaA()" nicht aufgerufen wurde bzw. die Puffer nicht
+///					vollstndig im GSx-RAM liegen (der DMA wrde sonst stillschweigend ins Leere
+///					kopieren). Die Funktion darf
+///					nur aus dem Hauptprogramm aufgerufen werden (nicht aus einer Callback-Funktion).
 ///
-/// @param	void
+/// @param  SpiTransaction *transaction
 ///
-/// @return void
+/// @return bool transactionQueued
 ///
 //=================================================================================================
-void SpiInitBufferRxA(void)
+bool SpiQueueTransactionA(SpiTransaction *transaction)
 {
-		// Alle Elemente zu 0 setzen
-		for (uint16_t i=0; i<SPI_SIZE_SOFTWARE_BUFFER; i++)
+		if (   (transaction == 0)
+				|| (transaction->device == 0)
+				|| (transaction->length == 0)
+				|| (transaction->mode > SPI_MODE_DMA)
+				|| (SpiGetFreeTransactionsA() == 0))
 		{
-				spiBufferRxA[i] = 0;
+				return false;
 		}
+		// Im DMA-Modus mssen die DMA-Kanle initialisiert sein und die Puffer im GSx-RAM liegen
+		if (transaction->mode == SPI_MODE_DMA)
+		{
+				if (   !spiDmaReadyA
+						|| (   (transaction->txData != 0)
+								&& !SpiIsDmaBuffer(transaction->txData, transaction->length))
+						|| (   (transaction->rxData != 0)
+								&& !SpiIsDmaBuffer(transaction->rxData, transaction->length)))
+				{
+						return false;
+				}
+		}
+
+		transaction->status = SPI_STATUS_QUEUED;
+		spiQueueA[spiQueueHeadA & (SPI_SIZE_TRANSACTION_QUEUE - 1U)] = transaction;
+		// CPU-Interrupts sperren, damit sich Hauptprogramm und ISR
+		// beim Start der nchsten bertragung nicht berschneiden
+		DINT;
+		spiQueueHeadA++;
+		if (spiStatusFlagA == SPI_STATUS_IDLE)
+		{
+				SpiStartNextA();
+		}
+		EINT;
+		return true;
+}
+
+
+//=== Function: SpiIsDmaBuffer ====================================================================
+///
+/// @brief  Funktion gibt "true" zurck, falls der Puffer "buffer" mit "length" Worten vollstndig
+///					im GSx-RAM (SPI_DMA_RAM_START ... SPI_DMA_RAM_END) liegt und damit vom DMA gelesen
+///					bzw. beschrieben werden kann.
+///
+/// @param  const uint16_t *buffer, uint16_t length
+///
+/// @return bool bufferValid
+///
+//=================================================================================================
+bool SpiIsDmaBuffer(const uint16_t *buffer,
+										uint16_t length)
+{
+		uint32_t address = (uint32_t)buffer;
+		return    (address >= SPI_DMA_RAM_START)
+					 && ((address + length) <= SPI_DMA_RAM_END);
+}
+
+
+//=== Function: SpiGetFreeTransactionsA ===========================================================
+///
+/// @brief  Funktion gibt die Anzahl der freien Pltze in der Warteschlange zurck.
+///
+/// @param  void
+///
+/// @return uint16_t numberOfTransactions
+///
+//=================================================================================================
+uint16_t SpiGetFreeTransactionsA(void)
+{
+		return SPI_SIZE_TRANSACTION_QUEUE - (uint16_t)(spiQueueHeadA - spiQueueTailA);
 }
 
 
 //=== Function: SpiGetStatusA =====================================================================
 ///
-/// @brief	Funktion gibt den aktuellen Status der SPI-Kommunikation zurck. Die SPI-
-///					Kommunikation ist Interrupt-basiert und kann folgende Zustnde annehmen:
+/// @brief	Funktion gibt den aktuellen Status der SPI-Schnittstelle zurck:
 ///
-///					- SPI_STATUS_IDLE       : Es ist keine Kommunikation aktiv
-///					- SPI_STATUS_IN_PROGRESS: Es wurde eine Kommunikation gestartet
-///					- SPI_STATUS_FINISHED   : Eine Kommunikation ist abgeschlossen
+///					- SPI_STATUS_IDLE       : Es ist keine bertragung aktiv und die Warteschlange ist leer
+///					- SPI_STATUS_IN_PROGRESS: Es ist eine bertragung aktiv
 ///
-///					Zum starten einer Kommunikation muss die Funktion "SpiSendDataA()"
-///					aufgerufen werden
+///					Der Status einzelner bertragungen steht im Element "status" der bertragung.
 ///
-/// @param 	uint16_t spiStatusFlag
+/// @param 	void
 ///
-/// @return void
+/// @return uint16_t spiStatusFlag
 ///
 //=================================================================================================
-extern uint16_t SpiGetStatusA(void)
+uint16_t SpiGetStatusA(void)
 {
 		return spiStatusFlagA;
 }
 
 
-//=== Function: SpiSetStatusIdleA =================================================================
+//=== Function: SpiStartNextA =====================================================================
 ///
-/// @brief	Funktion setzt das Status-Flag auf "idle" und gibt "true" zurck, falls die vorherige
-///					Kommunikation abgeschlossen ist. Ist noch eine Kommunikation aktiv, wird das Flag nicht
-///					verndert und es wird "false" zurck gegeben.
+/// @brief	Funktion startet die nchste bertragung der Warteschlange. Die Einstellungen des
+///					Gerts werden bernommen, die CS-Leitung aktiviert und die bertragung je nach
+///					Modus ber den FIFO oder per DMA gestartet. Ist die Warteschlange leer, wird der
+///					Status auf SPI_STATUS_IDLE gesetzt. Die Funktion wird aus der ISR oder bei
+///					gesperrten Interrupts aufgerufen.
 ///
-/// @param	void
+/// @param  void
 ///
-/// @return bool flagSetToIdle
+/// @return void
 ///
 //=================================================================================================
-extern bool SpiSetStatusIdleA(void)
+void SpiStartNextA(void)
 {
-		bool flagSetToIdle = false;
-		// Staus-Flag nur auf "idle" setzen, falls eine
-		// vorherige Kommunikation abgeschlossen ist
-		if (spiStatusFlagA == SPI_STATUS_FINISHED)
+		if (spiQueueTailA == spiQueueHeadA)
 		{
+				spiCurrentA    = 0;
 				spiStatusFlagA = SPI_STATUS_IDLE;
-				flagSetToIdle = true;
+				return;
+		}
+
+		spiCurrentA = spiQueueA[spiQueueTailA & (SPI_SIZE_TRANSACTION_QUEUE - 1U)];
+		// Platz in der Warteschlange sofort freigeben
+		spiQueueTailA++;
+		spiStatusFlagA      = SPI_STATUS_IN_PROGRESS;
+		spiCurrentA->status = SPI_STATUS_IN_PROGRESS;
+
+		// Einstellungen bernehmen und Gert anwhlen
+		SpiConfigDeviceA(spiCurrentA->device);
+		SpiSetCs(spiCurrentA->device->csGpio, false);
+
+		if (spiCurrentA->mode == SPI_MODE_DMA)
+		{
+				SpiStartDmaA();
+		}
+		else
+		{
+				spiIndexTxA = 0;
+				spiIndexRxA = 0;
+				SpiFillFifoA();
+				// RX-FIFO Interrupt einschalten
+				SpiaRegs.SPIFFRX.bit.RXFFIENA = 1;
 		}
-		return flagSetToIdle;
 }
 
 
-//=== Function: SpiSendDataA ======================================================================
+//=== Function: SpiConfigDeviceA ==================================================================
 ///
-/// @brief  Funktion sendet Daten ber SPI. Der Parameter "slave" gibt an, welche SS-Leitung
-///					aktiviert werden soll. Nach dem letzten gesendeten Byte (numberOfBytes), wird ein
-///					Interrupt ausgelst um die empfangenen Daten auslesen zu knnen. Sollen Bytes nur
-///				  empfangen werden (Slave abfragen), so wird die Byte-Anzahl ber den Parameter
-///					"numberOfBytes" bergeben und das Array "spiBufferTxA" mit Dummy-Daten gefllt.
+/// @brief	Funktion bernimmt Taktpolaritt, Taktphase, Datenlnge und Taktrate eines Gerts in
+///					das SPI-Modul. Das Modul wird dazu kurz in den Reset gesetzt (die FIFOs bleiben
+///					erhalten). Stehen die Einstellungen des Gerts bereits im Modul, wird nichts getan,
+///					damit aufeinanderfolgende bertragungen an dasselbe Gert ohne Verzgerung laufen.
 ///
-/// @param  uint16_t slave, uint16_t numberOfBytes
+/// @param  const SpiDevice *device
 ///
-/// @return bool operationPerformed
+/// @return void
 ///
 //=================================================================================================
-bool SpiSendDataA(uint16_t slave,
-									uint16_t numberOfBytes)
+void SpiConfigDeviceA(const SpiDevice *device)
 {
-		// Ergebnis des Funktionsaufrufes (Kommunikation gestartet / nicht gestartet)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv
-		// ist und die Anzahl der zu sendenen / empfangenen Bytes die
-		// Gre der Software-Puffer nicht berschreitet und mindestens 1 ist
-		if (   (spiStatusFlagA != SPI_STATUS_IN_PROGRESS)
-				&& (numberOfBytes <= SPI_SIZE_SOFTWARE_BUFFER)
-				&&  numberOfBytes)
+		if (device == spiActiveDeviceA)
 		{
-				// Slave auswhlen
-				if (slave == SPI_SLAVE_1)
-				{
-						SPI_DISABLE_SLAVE_2;
-						SPI_ENABLE_SLAVE_1;
-				}
-				else if (slave == SPI_SLAVE_2)
-				{
-						SPI_DISABLE_SLAVE_1;
-						SPI_ENABLE_SLAVE_2;
-				}
-				// Ggf. kurz warten, bis der Slave bereit ist
-				//DELAY_US(1);
-				// Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass die SPI-Kommunikation gestartet wurde
-				spiStatusFlagA = SPI_STATUS_IN_PROGRESS;
-				// Anzahl der zu sendenen Bytes an die Steuervariable bergeben.
-				// Diese koordiniert die restliche Kommunikation in der ISR
-				spiBytesToTransferA = numberOfBytes;
-				// Indexe zur Verwaltung der Software-Puffer auf das erste Element
-				// setzen, damit die zu sendenen Daten vom Anfang des Sende-Puffers
-				// kopiert bzw. die empfangenen Daten an den Anfang des Empfangs-
-				// Puffers geschrieben werden
-				spiBufferIndexTxA = 0;
-				spiBufferIndexRxA = 0;
-				// Zu sendene Daten von dem Software-Puffer in den SPI Sende-FIFO kopieren bis dieser
-				// gefllt ist oder der Software-Puffer leer ist. Dieser ist Datenbreite*16 Bit gro.
-				// Die Datenbreite kann zwischen 1 und 16 eingestellt werden (siehe S. 3904 Reference
-				// Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Die Reihenfolge, in der die Daten
-		    // ausgesendet werden ist:
-				// MSB: i = 0
-				// LSB: i = numberOfBytes-1
-				while (   (spiBufferIndexTxA < spiBytesToTransferA)
-							 &&	(SpiaRegs.SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
-				{
-						// Daten in den SPI-Hardware-Puffer kopieren. Daten mssen dabei linksbnig sein (S. 3915
-						// Reference Manual TTMS320F2838x, SPRUII0D, Rev. D, July 2022), da nur die Anzahl an Bits
-						// ausgesendet werden, die als Datenlnge festgelegt wurden (SPICHAR + 1). Sobald das erste
-						// Element in den FIFO-Puffer geschrieben wurde, beginnt der Sendevorgang
-						SpiaRegs.SPITXBUF = (spiBufferTxA[spiBufferIndexTxA] << 8);
-						spiBufferIndexTxA++;
-				}
-				// Interrupt auslsen, wenn "numberOfBytes" Bytes oder die maximale
-				// Anzahl an Bytes des FIFO-Empfangspuffers empfangen wurden, je nach
-				// dem was kleiner ist
-				SpiaRegs.SPIFFRX.bit.RXFFIL = spiBytesToTransferA;
-				if (spiBytesToTransferA > SPI_SIZE_HARDWARE_FIFO)
-				{
-						SpiaRegs.SPIFFRX.bit.RXFFIL = SPI_SIZE_HARDWARE_FIFO;
-				}
-				// RX-FIFO Interrupt einschalten
-				SpiaRegs.SPIFFRX.bit.RXFFIENA = 1;
+				return;
+		}
+		// SPI-Modul zum konfigurieren ausschalten
+		SpiaRegs.SPICCR.bit.SPISWRESET   = 0;
+		SpiaRegs.SPICCR.bit.CLKPOLARITY  = device->polarity;
+		SpiaRegs.SPICTL.bit.CLK_PHASE    = device->phase;
+		SpiaRegs.SPICCR.bit.SPICHAR      = device->wordLength - 1;
+		SpiaRegs.SPIBRR.bit.SPI_BIT_RATE = SpiCalcBitRate(device->clock);
+		// SPI-Modul wieder einschalten
+		SpiaRegs.SPICCR.bit.SPISWRESET   = 1;
+		spiActiveDeviceA = device;
+}
+
+
+//=== Function: SpiSetCs ==========================================================================
+///
+/// @brief	Funktion setzt den Pegel einer CS-Leitung ber die Register GPxSET bzw. GPxCLEAR
+///					(level = false: Gert angewhlt, level = true: Gert abgewhlt).
+///
+/// @param  uint16_t gpio, bool level
+///
+/// @return void
+///
+//=================================================================================================
+void SpiSetCs(uint16_t gpio,
+							bool level)
+{
+		volatile uint32_t *port = (volatile uint32_t *)&GpioDataRegs
+														+ ((gpio / 32U) * SPI_GPIO_DATA_PORT_STEP);
+		port[level ? SPI_GPIO_SET : SPI_GPIO_CLEAR] = 1UL << (gpio % 32U);
+}
+
+
+//=== Function: SpiCalcBitRate ====================================================================
+///
+/// @brief	Funktion berechnet den Wert des Registers SPIBRR fr die Taktrate "clock" in Hz
+///					(Taktrate = LSPCLK / (SPIBRR + 1)). Der Teiler wird aufgerundet, damit die Taktrate
+///					des Gerts nie berschritten wird, und auf den gltigen Bereich begrenzt.
+///
+/// @param  uint32_t clock
+///
+/// @return uint16_t bitRate
+///
+//=================================================================================================
+uint16_t SpiCalcBitRate(uint32_t clock)
+{
+		uint32_t bitRate = ((SPI_LSPCLK + clock - 1UL) / clock) - 1UL;
+		if (bitRate < SPI_BIT_RATE_MIN)
+		{
+				bitRate = SPI_BIT_RATE_MIN;
+		}
+		else if (bitRate > SPI_BIT_RATE_MAX)
+		{
+				bitRate = SPI_BIT_RATE_MAX;
+		}
+		return (uint16_t)bitRate;
+}
+
+
+//=== Function: SpiFillFifoA ======================================================================
+///
+/// @brief	Funktion kopiert die nchsten Sendedaten der aktuellen bertragung (FIFO-Modus) in den
+///					Sende-FIFO, bis dieser gefllt ist oder alle Worte kopiert wurden, und setzt die
+///					Schwelle des Empfangs-Interrupts. Die Daten werden dabei linksbndig geschrieben, da
+///					nur die eingestellte Datenlnge (SPICHAR + 1) ausgesendet wird (siehe Register
+///					SPITXBUF, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Sobald das
+///					erste Wort in den FIFO geschrieben wurde, beginnt der Sendevorgang.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpiFillFifoA(void)
+{
+		uint16_t shift  = 16U - spiCurrentA->device->wordLength;
+		uint16_t length = spiCurrentA->length;
+
+		while (   (spiIndexTxA < length)
+					 &&	(SpiaRegs.SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
+		{
+				uint16_t data = (spiCurrentA->txData != 0) ? spiCurrentA->txData[spiIndexTxA] : 0;
+				SpiaRegs.SPITXBUF = (data << shift);
+				spiIndexTxA++;
+		}
+		// Interrupt auslsen, wenn alle restlichen Worte oder die maximale Anzahl
+		// an Worten des Empfangs-FIFOs empfangen wurden, je nach dem was kleiner ist
+		if ((length - spiIndexRxA) > SPI_SIZE_HARDWARE_FIFO)
+		{
+				SpiaRegs.SPIFFRX.bit.RXFFIL = SPI_SIZE_HARDWARE_FIFO;
+		}
+		else
+		{
+				SpiaRegs.SPIFFRX.bit.RXFFIL = length - spiIndexRxA;
+		}
+}
+
+
+//=== Function: SpiStartDmaA ======================================================================
+///
+/// @brief	Funktion startet die DMA-Kanle fr die aktuelle bertragung (DMA-Modus). Die Sende-
+///					daten mssen linksbndig im GSx-RAM stehen (siehe Makro "SPI_DMA_DATA()"). Ohne
+///					Sendepuffer werden Nullen gesendet, ohne Empfangspuffer werden die Empfangsdaten
+///					in ein einzelnes Dummy-Wort geschrieben. Die Burst-Gre ist die grte Zweierpotenz
+///					(max. SPI_DMA_MAX_BURST), durch welche die Anzahl der Worte teilbar ist. Der Sende-
+///					FIFO wird so immer um einen Burst nachgefllt, sobald Platz dafr ist, und der
+///					Empfangs-FIFO nach jedem Burst geleert.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpiStartDmaA(void)
+{
+		uint16_t length = spiCurrentA->length;
+		// Burst-Gre bestimmen
+		uint16_t burst = SPI_DMA_MAX_BURST;
+		while (length % burst)
+		{
+				burst >>= 1;
+		}
+
+		EALLOW;
+		// CPU-Interrupt des Empfangs-FIFOs ausschalten (wird nur im FIFO-Modus verwendet)
+		// und Empfangs-FIFO leeren, damit keine alten Daten einen Trigger auslsen
+		SpiaRegs.SPIFFRX.bit.RXFFIENA    = 0;
+		SpiaRegs.SPIFFRX.bit.RXFIFORESET = 0;
+		SpiaRegs.SPIFFRX.bit.RXFFOVFCLR  = 1;
+		SpiaRegs.SPIFFRX.bit.RXFFINTCLR  = 1;
+		// Trigger-Schwellen: Sende-Trigger, sobald ein Burst in den FIFO passt,
+		// Empfangs-Trigger, sobald ein Burst empfangen wurde
+		SpiaRegs.SPIFFTX.bit.TXFFIL = SPI_SIZE_HARDWARE_FIFO - burst;
+		SpiaRegs.SPIFFRX.bit.RXFFIL = burst;
+		// Burst- und bertragungsgre (jeweils Anzahl - 1)
+		DmaRegs.CH5.BURST_SIZE.bit.BURSTSIZE = burst - 1;
+		DmaRegs.CH5.TRANSFER_SIZE            = (length / burst) - 1;
+		DmaRegs.CH6.BURST_SIZE.bit.BURSTSIZE = burst - 1;
+		DmaRegs.CH6.TRANSFER_SIZE            = (length / burst) - 1;
+		// Quelle des Sende-Kanals (fortlaufend bzw. festes Dummy-Wort)
+		if (spiCurrentA->txData != 0)
+		{
+				DmaRegs.CH5.SRC_BURST_STEP      = 1;
+				DmaRegs.CH5.SRC_TRANSFER_STEP   = 1;
+				DmaRegs.CH5.SRC_BEG_ADDR_SHADOW = (uint32_t)spiCurrentA->txData;
+				DmaRegs.CH5.SRC_ADDR_SHADOW     = (uint32_t)spiCurrentA->txData;
+		}
+		else
+		{
+				spiDmaDummyTxA = 0;
+				DmaRegs.CH5.SRC_BURST_STEP      = 0;
+				DmaRegs.CH5.SRC_TRANSFER_STEP   = 0;
+				DmaRegs.CH5.SRC_BEG_ADDR_SHADOW = (uint32_t)&spiDmaDummyTxA;
+				DmaRegs.CH5.SRC_ADDR_SHADOW     = (uint32_t)&spiDmaDummyTxA;
+		}
+		// Ziel des Empfangs-Kanals (fortlaufend bzw. festes Dummy-Wort)
+		if (spiCurrentA->rxData != 0)
+		{
+				DmaRegs.CH6.DST_BURST_STEP      = 1;
+				DmaRegs.CH6.DST_TRANSFER_STEP   = 1;
+				DmaRegs.CH6.DST_BEG_ADDR_SHADOW = (uint32_t)spiCurrentA->rxData;
+				DmaRegs.CH6.DST_ADDR_SHADOW     = (uint32_t)spiCurrentA->rxData;
+		}
+		else
+		{
+				DmaRegs.CH6.DST_BURST_STEP      = 0;
+				DmaRegs.CH6.DST_TRANSFER_STEP   = 0;
+				DmaRegs.CH6.DST_BEG_ADDR_SHADOW = (uint32_t)&spiDmaDummyRxA;
+				DmaRegs.CH6.DST_ADDR_SHADOW     = (uint32_t)&spiDmaDummyRxA;
+		}
+		// Alte Trigger des Empfangs-Kanals verwerfen
+		DmaRegs.CH6.CONTROL.bit.PERINTCLR = 1;
+		DmaRegs.CH6.CONTROL.bit.ERRCLR    = 1;
+		// Empfangs-Kanal vor dem Sende-Kanal starten, damit kein Burst verloren geht
+		DmaRegs.CH6.CONTROL.bit.RUN = 1;
+		SpiaRegs.SPIFFRX.bit.RXFIFORESET = 1;
+		// Sende-Kanal starten. Der gespeicherte SPITXDMA-Trigger (leerer FIFO)
+		// lst den ersten Burst aus, danach luft die bertragung selbststndig
+		DmaRegs.CH5.CONTROL.bit.RUN = 1;
+		EDIS;
+}
+
+
+//=== Function: SpiFinishTransactionA =============================================================
+///
+/// @brief	Funktion schliet die aktuelle bertragung ab (CS-Leitung deaktivieren, Status auf
+///					SPI_STATUS_FINISHED setzen), startet sofort die nchste bertragung der Warteschlange
+///					und ruft anschlieend die Callback-Funktion der abgeschlossenen bertragung auf.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SpiFinishTransactionA(void)
+{
+		SpiTransaction *transaction = spiCurrentA;
+
+		// Gert abwhlen und Ende der bertragung signalisieren
+		SpiSetCs(transaction->device->csGpio, true);
+		transaction->status = SPI_STATUS_FINISHED;
+		// Nchste bertragung direkt im Anschluss starten
+		SpiStartNextA();
+		if (transaction->callback != 0)
+		{
+				transaction->callback(transaction->context);
 		}
-		return operationPerformed;
 }
 
 
 //=== Function: SpiISRA ===========================================================================
 ///
-/// @brief	Funktion wird aufgerufen, sobald die im Register SPIFFRX.bit.RXFFIL stehende
-///					Anzahl an Bytes ber SPI empfangen wurde. Fr den reinen Sendebetrieb knnte
+/// @brief	Funktion wird im FIFO-Modus aufgerufen, sobald die im Register SPIFFRX.bit.RXFFIL
+///					stehende Anzahl an Worten ber SPI empfangen wurde. Fr den reinen Sendebetrieb knnte
 ///					zwar der SPI_TX_INT verwendet werden, aber die Konfiguration des Sende-Interrupts
 ///					ist komplizierter als die des Emfangs-Interrupts. Zudem wird der Sende-Interrupt
 ///					ausgelst, sobald der TX-Puffer leer ist. Zu diesem Zeitpunkt befindet sich das
-///					letzte zu sendene Byte jedoch noch im Ausgangsregister. Der Interrupt kommt also
+///					letzte zu sendene Wort jedoch noch im Ausgangsregister. Der Interrupt kommt also
 ///					zu frh. Aus diesem  Grund und weil beim Senden auch automatisch Daten empfangen
 ///					werden, wurde hier die Kommunikation ausschlielich mithilfe des Empfangs-Interrupts
-///					umgesetzt.
+///					umgesetzt. Am Ende einer bertragung wird direkt die nchste bertragung der
+///					Warteschlange gestartet.
 ///
 /// @param  void
 ///
@@ -364,58 +745,70 @@ __interrupt void SpiISRA(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Daten aus dem Empfangs-FIFO in den Software-Puffer kopieren bis die
-		// komplette Anzahl an Bytes empfangen wurde oder der Empfangs-FIFO leer ist
-		while (   (spiBufferIndexRxA < spiBytesToTransferA)
-					 && (SpiaRegs.SPIFFRX.bit.RXFFST > 0))
-		{
-				spiBufferRxA[spiBufferIndexRxA] = SpiaRegs.SPIRXBUF;
-				spiBufferIndexRxA++;
-		}
-		// Komplette Anzahl an Bytes wurde gesendet/empfangen
-		if (spiBufferIndexRxA == spiBytesToTransferA)
+		SpiTransaction *transaction = spiCurrentA;
+		if (transaction != 0)
 		{
-				// Empfangs-FIFO-Interrupt ausschalten
-		    SpiaRegs.SPIFFRX.bit.RXFFIENA = 0;
-				// Slaves abwhlen
-				SPI_DISABLE_SLAVE_1;
-				SPI_DISABLE_SLAVE_2;
-				// Flag setzen um das Ende der bertragung zu signalisieren
-				spiStatusFlagA = SPI_STATUS_FINISHED;
+				// Empfangsdaten sind rechtsbndig, nicht verwendete obere Bits ausblenden
+				uint16_t mask = 0xFFFFU >> (16U - transaction->device->wordLength);
+				// Daten aus dem Empfangs-FIFO kopieren bis die komplette Anzahl
+				// an Worten empfangen wurde oder der Empfangs-FIFO leer ist
+				while (   (spiIndexRxA < transaction->length)
+							 && (SpiaRegs.SPIFFRX.bit.RXFFST > 0))
+				{
+						uint16_t data = SpiaRegs.SPIRXBUF & mask;
+						if (transaction->rxData != 0)
+						{
+								transaction->rxData[spiIndexRxA] = data;
+						}
+						spiIndexRxA++;
+				}
 		}
-		// Es sollen noch weitere Bytes gesendet/empfangen werden
-		else
+
+    // RX-FIFO Interupt-Flag lschen (vor dem Start der nchsten bertragung)
+    SpiaRegs.SPIFFRX.bit.RXFFINTCLR = 1;
+
+		if (transaction != 0)
 		{
-				// Die nchsten Daten in den Sende-FIO kopieren. Dieser ist Datenbreite*16 Bit gro.
-				// Die Datenbreite kann zwischen 1 und 16 eingestellt werden (siehe S. 3904 Reference
-				// Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Die Reihenfolge, in der die Daten
-				// ausgesendet werden ist:
-				// MSB: i = 0
-				// LSB: i = numberOfBytes-1
-				while (   (spiBufferIndexTxA < spiBytesToTransferA)
-							 &&	(SpiaRegs.SPIFFTX.bit.TXFFST < SPI_SIZE_HARDWARE_FIFO))
+				// Komplette Anzahl an Worten wurde gesendet/empfangen
+				if (spiIndexRxA == transaction->length)
 				{
-						// Daten in den SPI-Hardware-Puffer kopieren. Daten mssen dabei linksbnig sein (S. 3915
-						// Reference Manual TTMS320F2838x, SPRUII0D, Rev. D, July 2022), da nur die Anzahl an Bits
-						// ausgesendet werden, die als Datenlnge festgelegt wurden (SPICHAR + 1). Sobald das erste
-						// Element in den FIFO-Puffer geschrieben wurde, beginnt der Sendevorgang
-						SpiaRegs.SPITXBUF = (spiBufferTxA[spiBufferIndexTxA] << 8);
-						spiBufferIndexTxA++;
+						// Empfangs-FIFO-Interrupt ausschalten (wird von der nchsten
+						// bertragung im FIFO-Modus wieder eingeschaltet)
+						SpiaRegs.SPIFFRX.bit.RXFFIENA = 0;
+						SpiFinishTransactionA();
 				}
-				// Interrupt auslsen, wenn "spiBytesToTransferA - spiBufferIndexRxA" Bytes oder
-				// die maximale Anzahl an Bytes des FIFO-Empfangspuffers empfangen wurden, je nach
-				// dem was kleiner ist
-				SpiaRegs.SPIFFRX.bit.RXFFIL = spiBytesToTransferA - spiBufferIndexRxA;
-				if ((spiBytesToTransferA - spiBufferIndexRxA) > SPI_SIZE_HARDWARE_FIFO)
+				// Es sollen noch weitere Worte gesendet/empfangen werden
+				else
 				{
-						SpiaRegs.SPIFFRX.bit.RXFFIL = SPI_SIZE_HARDWARE_FIFO;
+						SpiFillFifoA();
 				}
 		}
 
-    // RX-FIFO Interupt-Flag lschen
-    SpiaRegs.SPIFFRX.bit.RXFFINTCLR = 1;
 		// Interrupt-Flag der Gruppe 6 lschen (da gehrt der SPI-Interrupt zu)
     PieCtrlRegs.PIEACK.bit.ACK6 = 1;
 }
 
 
+//=== Function: SpiDmaISRA ========================================================================
+///
+/// @brief	Funktion wird im DMA-Modus aufgerufen, sobald der Empfangs-Kanal den letzten Burst
+///					kopiert hat. Zu diesem Zeitpunkt ist die bertragung vollstndig abgeschlossen. Die
+///					bertragung wird abgeschlossen und direkt die nchste bertragung gestartet. Die
+///					Empfangsdaten werden hier nicht bearbeitet (bis zu SPI_SIZE_DMA_BUFFER Worte wren
+///					zu lang fr die ISR), bei einer Datenlnge unter 16 Bit blendet die Anwendung die
+///					oberen Bits beim Lesen mit "SPI_DMA_RX_DATA()" aus.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void SpiDmaISRA(void)
+{
+		if (spiCurrentA != 0)
+		{
+				SpiFinishTransactionA();
+		}
+		// Interrupt-Flag der Gruppe 7 lschen (da gehren die DMA-Interrupts zu)
+		PieCtrlRegs.PIEACK.bit.ACK7 = 1;
+}
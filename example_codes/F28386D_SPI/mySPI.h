@@ -3,18 +3,29 @@
 ///
 /// @brief      Datei enthlt Variablen und Funktionen um die SPI-Schnittstelle als Master zu
 ///							benutzen. Die Kommunikation ist Interrupt-basiert und nutzt die beiden 16x16-Bit
-///						  groen Hardware-FIFOs. Pro Kommunikationvorgang knnen bis zu 65.536 Bytes
-///							bertragen werden. Der Hardware-FIFO wird dabei so oft mit den Daten aus dem
-///							Software-Puffer beschrieben bzw. Daten aus dem FIFO in den Software-Puffer
-///							geschrieben, bis die gewnschte Zahl an Btes bertragen wurde.Der Status der
-///							Kommunikation (aktiv oder nicht aktiv) kann ber die Funktion "SpiGetStatus()"
-///							abgefragt werden.
+///						  groen Hardware-FIFOs. Mehrere Slaves (Gerte) teilen sich den Bus. Jedes Gert
+///							wird durch einen Gerte-Deskriptor ("SpiDevice") mit CS-Leitung (beliebiger
+///							GPIO), Taktpolaritt, Taktphase, Datenlnge (1 ... 16 Bit) und Taktrate
+///							beschrieben. bertragungen ("SpiTransaction") werden ber die Funktion
+///							"SpiQueueTransactionA()" in eine Warteschlange eingereiht und von der ISR ohne
+///							Zutun des Hauptprogramms direkt nacheinander ausgefhrt. Vor jeder bertragung
+///							werden die Einstellungen des Gerts bernommen (nur falls sich das Gert
+///							gendert hat) und die CS-Leitung aktiviert. Das Ende einer bertragung wird
+///							ber das Status-Element der bertragung und optional eine Callback-Funktion
+///							gemeldet. Eine bertragung wird entweder von der CPU ber den FIFO (Modus
+///							SPI_MODE_FIFO, ein Interrupt pro FIFO-Fllung) oder per DMA (Modus SPI_MODE_DMA,
+///							ein Interrupt pro bertragung) durchgefhrt.
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///							nderung in Version 3.0: DMA-Modus. Die Daten werden von zwei DMA-Kanlen, die
+///							durch die FIFO-Ereignisse des SPI-Moduls getriggert werden, in den Sende-FIFO
+///							bzw. aus dem Empfangs-FIFO kopiert
+///							nderung in Version 4.0: Warteschlange fr bertragungen und Gerte-Deskriptoren
+///							(ersetzt die festen Slave-Select-Leitungen GPIO 58/59 und "SpiSendDataA()")
 ///
-/// @version    V2.0
+/// @version    V4.0
 ///
-/// @date       24.03.2023
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -34,39 +45,122 @@
 #define SPI_CLOCK_500_KHZ									500000
 #define SPI_CLOCK_1_MHZ										1000000
 #define SPI_CLOCK_2_MHZ										2000000
-// Gre der Software-Puffer
-#define SPI_SIZE_SOFTWARE_BUFFER		    	50
+#define SPI_CLOCK_5_MHZ										5000000
+#define SPI_CLOCK_10_MHZ									10000000
+// Low-Speed CLK = 50 MHz (siehe "DeviceInit()")
+#define SPI_LSPCLK												50000000UL
+// Gltiger Bereich des Registers SPIBRR (Taktrate = LSPCLK / (SPIBRR + 1))
+#define SPI_BIT_RATE_MIN									3
+#define SPI_BIT_RATE_MAX									127
 // Gre der Hardware-FIFOs
 #define SPI_SIZE_HARDWARE_FIFO						16
-// Zustnde der SPI-Kommunikation (spiStatusFlag)
+// Anzahl der bertragungen in der Warteschlange (muss eine Zweierpotenz sein)
+#define SPI_SIZE_TRANSACTION_QUEUE				8
+// Zustnde der SPI-Kommunikation bzw. einer bertragung
 #define SPI_STATUS_IDLE										0
 #define SPI_STATUS_IN_PROGRESS						1
 #define SPI_STATUS_FINISHED								2
-// Slave-Select
-#define SPI_SLAVE_1												0
-#define SPI_SLAVE_2												1
+#define SPI_STATUS_QUEUED									3
+// Art der bertragung
+// FIFO: Die CPU kopiert die Daten in der ISR in den bzw. aus dem FIFO
+// DMA : Die Daten werden per DMA kopiert, Puffer mssen im GSx-RAM liegen
+#define SPI_MODE_FIFO											0
+#define SPI_MODE_DMA											1
+// Taktpolaritt (Ruhepegel der CLK-Leitung) und Taktphase
+#define SPI_POLARITY_LOW									0
+#define SPI_POLARITY_HIGH									1
+#define SPI_PHASE_NORMAL									0
+#define SPI_PHASE_DELAYED									1
+// Register-Offsets (in 32-Bit-Worten) innerhalb von "GpioCtrlRegs" bzw. "GpioDataRegs"
+// fr den Zugriff auf die CS-Leitungen ber die GPIO-Nummer
+#define SPI_GPIO_PORT_STEP								0x20
+#define SPI_GPIO_DIR											0x05
+#define SPI_GPIO_MUX1											0x03
+#define SPI_GPIO_PUD											0x06
+#define SPI_GPIO_GMUX1										0x10
+#define SPI_GPIO_LOCK											0x1E
+#define SPI_GPIO_DATA_PORT_STEP						0x04
+#define SPI_GPIO_SET											0x01
+#define SPI_GPIO_CLEAR										0x02
+// Hchste GPIO-Nummer des F2838x (GPIO 0 ... 168)
+#define SPI_GPIO_MAX											168
+// DMA-Modus:
+// Gre der DMA-Puffer (liegen in der Sektion "SPIDMA" im GSx-RAM, siehe .cmd-Datei)
+#define SPI_SIZE_DMA_BUFFER								256
+// Max. Anzahl an Worten pro DMA-Burst (halber Hardware-FIFO)
+#define SPI_DMA_MAX_BURST									8
+// Adressbereich der GSx-RAMs (GS0 ... GS15), nur auf diese hat der DMA Zugriff
+#define SPI_DMA_RAM_START									0x00D000UL
+#define SPI_DMA_RAM_END										0x01D000UL
+// Verwendete DMA-Kanle (Sende- und Empfangskanal)
+#define SPI_DMA_CHANNEL_TX_A							5
+#define SPI_DMA_CHANNEL_RX_A							6
+// Trigger-Quellen der DMA-Kanle (Register DMACHSRCSELx)
+#define SPI_DMA_TRIGGER_SPIATX						109
+#define SPI_DMA_TRIGGER_SPIARX						110
 
 
 //-------------------------------------------------------------------------------------------------
 // Macros
 //-------------------------------------------------------------------------------------------------
-// Gibt true zurck, wenn der entsprechende Slave angewhlt ist (SS-Leitung auf logisch 0)
-// Gibt false zurck, wenn der entsprechende Slave nicht angewhlt ist (SS-Leitung auf logisch 1)
-#define SPI_SLAVE_1_IS_ENABLED						!((bool)GpioDataRegs.GPBDAT.bit.GPIO58)
-#define SPI_SLAVE_2_IS_ENABLED						!((bool)GpioDataRegs.GPBDAT.bit.GPIO59)
-// Whlt den entsprechenden Slave an oder ab
-#define SPI_ENABLE_SLAVE_1								GpioDataRegs.GPBCLEAR.bit.GPIO58 = 1
-#define SPI_DISABLE_SLAVE_1								GpioDataRegs.GPBSET.bit.GPIO58   = 1
-#define SPI_ENABLE_SLAVE_2								GpioDataRegs.GPBCLEAR.bit.GPIO59 = 1
-#define SPI_DISABLE_SLAVE_2								GpioDataRegs.GPBSET.bit.GPIO59   = 1
+// Wandelt einen Wert in ein linksbndiges Wort fr die Sendedaten im DMA-Modus um. Im DMA-Modus
+// werden die Daten ohne Zutun der CPU in das Register SPITXBUF kopiert und mssen daher bereits
+// linksbndig im Puffer stehen (im FIFO-Modus bernimmt dies die ISR)
+#define SPI_DMA_DATA(value, wordLength)		((uint16_t)(value) << (16U - (wordLength)))
+// Blendet die nicht verwendeten oberen Bits eines Empfangsworts im DMA-Modus aus. Der DMA
+// kopiert das Register SPIRXBUF unverndert, bei einer Datenlnge unter 16 Bit enthalten die
+// oberen Bits ungltige Daten (im FIFO-Modus bernimmt das Ausblenden die ISR)
+#define SPI_DMA_RX_DATA(value, wordLength)	((uint16_t)(value) & (0xFFFFU >> (16U - (wordLength))))
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Gerte-Deskriptor (Einstellungen eines Slaves)
+typedef struct
+{
+		// GPIO-Nummer der CS-Leitung (aktiv low, 0 ... SPI_GPIO_MAX)
+		uint16_t csGpio;
+		// Taktpolaritt (SPI_POLARITY_...) und Taktphase (SPI_PHASE_...)
+		uint16_t polarity;
+		uint16_t phase;
+		// Datenlnge in Bit (1 ... 16)
+		uint16_t wordLength;
+		// Taktrate in Hz
+		uint32_t clock;
+} SpiDevice;
+
+// Funktion, die am Ende einer bertragung aus der ISR aufgerufen wird
+typedef void (*SpiCallback)(void *context);
+
+// bertragung. Die Struktur und die Puffer mssen bis zum Ende der bertragung gltig bleiben
+typedef struct
+{
+		// Gert, mit dem kommuniziert wird
+		const SpiDevice *device;
+		// Sendedaten (rechtsbndig, im DMA-Modus linksbndig), 0: Dummy-Daten (0) senden
+		const uint16_t *txData;
+		// Empfangsdaten (rechtsbndig, im DMA-Modus mit ungltigen oberen Bits, siehe Makro
+		// "SPI_DMA_RX_DATA()"), 0: Empfangsdaten verwerfen
+		uint16_t *rxData;
+		// Anzahl der Worte
+		uint16_t length;
+		// Art der bertragung (SPI_MODE_FIFO oder SPI_MODE_DMA)
+		uint16_t mode;
+		// Wird am Ende der bertragung aus der ISR aufgerufen (0: kein Aufruf)
+		SpiCallback callback;
+		void *context;
+		// Zustand der bertragung (SPI_STATUS_...), wird vom Treiber gesetzt
+		volatile uint16_t status;
+} SpiTransaction;
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die SPI-Kommunikation
-extern uint16_t spiBufferTxA[SPI_SIZE_SOFTWARE_BUFFER];
-extern uint16_t spiBufferRxA[SPI_SIZE_SOFTWARE_BUFFER];
+// Puffer fr den DMA-Modus im GSx-RAM (knnen als Sende- und Empfangspuffer verwendet werden)
+extern uint16_t spiDmaBufferTxA[SPI_SIZE_DMA_BUFFER];
+extern uint16_t spiDmaBufferRxA[SPI_SIZE_DMA_BUFFER];
 
 
 //-------------------------------------------------------------------------------------------------
@@ -74,20 +168,39 @@ extern uint16_t spiBufferRxA[SPI_SIZE_SOFTWARE_BUFFER];
 //-------------------------------------------------------------------------------------------------
 // Funktion setzt GPIOs auf SPI-Funktionalitt, initialisiert das SPI-Modul
 // als Master und aktiviert den SPI-Interrupt inkl. Registrierung der ISR
-extern void SpiInitA(uint32_t clock);
-// Funktion initialisiert den SPI Software Sende-Puffer (alle Elemente zu 0)
-extern void SpiInitBufferTxA(void);
-// Funktion initialisiert den SPI Software Empfangs-Puffer (alle Elemente zu 0)
-extern void SpiInitBufferRxA(void);
-// Funktion gibt den aktuellen Status der SPI-Kommunikation zurck
+extern void SpiInitA(void);
+// Funktion initialisiert die DMA-Kanle fr den DMA-Modus
+extern void SpiInitDmaA(void);
+// Funktion prft einen Gerte-Deskriptor und konfiguriert dessen CS-Leitung
+extern bool SpiInitDeviceA(const SpiDevice *device);
+// Funktion reiht eine bertragung in die Warteschlange ein
+extern bool SpiQueueTransactionA(SpiTransaction *transaction);
+// Funktion gibt die Anzahl der freien Pltze in der Warteschlange zurck
+extern uint16_t SpiGetFreeTransactionsA(void);
+// Funktion prft, ob ein Puffer vollstndig im GSx-RAM liegt (DMA-Modus)
+extern bool SpiIsDmaBuffer(const uint16_t *buffer,
+													 uint16_t length);
+// Funktion gibt den aktuellen Status der SPI-Schnittstelle zurck
 extern uint16_t SpiGetStatusA(void);
-// Funktion setzt das Status-Flag auf "idle", falls die vorherige Kommunikation abgeschlossen ist
-extern bool SpiSetStatusIdleA(void);
-// Funktion zum Senden und Empfangen von Daten ber SPI
-extern bool SpiSendDataA(uint16_t slave,
-												 uint16_t numberOfBytes);
-// Interrupt-Service-Routine fr die SPI-Kommunikation
+// Funktion startet die nchste bertragung der Warteschlange
+extern void SpiStartNextA(void);
+// Funktion bernimmt die Einstellungen eines Gerts in das SPI-Modul
+extern void SpiConfigDeviceA(const SpiDevice *device);
+// Funktion setzt den Pegel einer CS-Leitung
+extern void SpiSetCs(uint16_t gpio,
+										 bool level);
+// Funktion berechnet den Wert des Registers SPIBRR fr eine Taktrate
+extern uint16_t SpiCalcBitRate(uint32_t clock);
+// Funktion kopiert Sendedaten in den Sende-FIFO (FIFO-Modus)
+extern void SpiFillFifoA(void);
+// Funktion startet die DMA-Kanle fr die aktuelle bertragung (DMA-Modus)
+extern void SpiStartDmaA(void);
+// Funktion schliet die aktuelle bertragung ab und startet die nchste
+extern void SpiFinishTransactionA(void);
+// Interrupt-Service-Routine fr die SPI-Kommunikation (FIFO-Modus)
 __interrupt void SpiISRA(void);
+// Interrupt-Service-Routine am Ende einer DMA-bertragung (DMA-Modus)
+__interrupt void SpiDmaISRA(void);
 
 
 #endif
@@ -8,9 +8,19 @@
 ///						Code ist fr den Mikrocontroller TMS320F2838x. Erklrungen zur genauen Funktion
 ///						sind im Modul zu finden.
 ///
-/// @version	V1.2
+///						nderung in Version 1.3: Konfiguration ber den Schutz-Manager "myProtection.c"
+///						(Digitalfilter, Grenzwerte in Volt, Identifikation des auslsenden Komparators)
 ///
-/// @date			08.09.2022
+///						nderung in Version 1.4: Fehlerspeicher "myFaultLog.c" (Eintrge mit Zeitstempel,
+///						Compare-Werten und ADC-Historie, berstehen einen Soft-Reset). Ausgabe ber UART
+///						(SCI-A, 115200 Baud, 8N1) mit dem Zeichen 'D', Lschen mit dem Zeichen 'C'
+///
+///						nderung in Version 1.5: Automatische Wiederinbetriebnahme nach einem Trip ber die
+///						Zustandsmaschine "myRecovery.c" (1 ms Takt aus dem IPC-Zhler)
+///
+/// @version	V1.5
+///
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -18,12 +28,20 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myTripzone.h"
+#include "myProtection.h"
+#include "myFaultLog.h"
+#include "myRecovery.h"
 #include "myADC.h"
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// Befehle ber UART (ein Zeichen)
+#define MAIN_COMMAND_DUMP				'D'
+#define MAIN_COMMAND_CLEAR			'C'
+// Periode fr "RecoveryTick()" in SYSCLK-Takten (1 ms bei 200 MHz)
+#define MAIN_TICK_CYCLES				200000UL
 
 
 //-------------------------------------------------------------------------------------------------
@@ -36,6 +54,58 @@
 //-------------------------------------------------------------------------------------------------
 // Messwert vom ADC A an Pin A2
 uint16_t ADCINA2 = 0;
+// Schutzkanle: CMPSS1 berwacht die Spannung an Pin A2 (Poti, 0 ... 3,3 V). Die Grenzwerte
+// entsprechen den DAC-Werten 3000 und 1000 aus "TripzoneInitCmpss1()". Ein Trip wird ausgelst,
+// wenn mindestens 24 von 32 Abtastungen (Abtasttakt 200 MHz / 4 = 50 MHz) auerhalb liegen
+const ProtectionChannelConfig protectionTable[] =
+{
+		{
+				.cmpss              = PROTECTION_CMPSS1,
+				.comparators        = PROTECTION_COMP_BOTH,
+				.scale              = 1.0f,
+				.offset             = 0.0f,
+				.limitHigh          = 2.4176f,
+				.limitLow           = 0.8059f,
+				.hysteresis         = PROTECTION_HYSTERESIS_1X,
+				.filterPrescale     = 3,
+				.filterSampleWindow = 32,
+				.filterThreshold    = 24,
+				.loadMode           = PROTECTION_LOAD_SYSCLK,
+				.rampSource         = PROTECTION_RAMP_DISABLED,
+				.rampDecrement      = 0,
+				.rampDelay          = 0,
+				.xbarTrip           = PROTECTION_XBAR_TRIP4,
+				.epwmMask           = PROTECTION_EPWM(1),
+				// One-Shot-Trip. Fr eine Spitzenstromregelung stattdessen z.B.:
+				// .tripMode = PROTECTION_TRIP_CBC, .cbcClear = PROTECTION_CBC_CLEAR_ZERO,
+				// .blankingStart = PROTECTION_BLANKING_AT_ZERO, .blankingOffset = 2500,
+				// .blankingWindow = 50 (Fenster ab der Einschaltflanke bei CTR = CMPA)
+				.tripMode           = PROTECTION_TRIP_OST,
+				.cbcClear           = PROTECTION_CBC_CLEAR_ZERO,
+				.blankingStart      = PROTECTION_BLANKING_AT_ZERO,
+				.blankingOffset     = 0,
+				.blankingWindow     = PROTECTION_BLANKING_DISABLED
+		}
+};
+// Wiederinbetriebnahme nach einem Trip: Nach 100 ms Abkhlzeit wird der Trip quittiert, sobald die
+// Spannung wieder innerhalb der Grenzen liegt (max. 1 s warten). Nach 3 Wiederholungen ohne 5 s
+// stabilen Betrieb wird dauerhaft abgeschaltet. Alle Zeiten in ms
+const RecoveryConfig recoveryConfigMain =
+{
+		.mode              = RECOVERY_MODE_AUTO,
+		.maxRetries        = 3,
+		.cooldownTicks     = 100,
+		.retryTimeoutTicks = 1000,
+		.stableTicks       = 5000
+};
+// Zeitpunkt des letzten Aufrufs von "RecoveryTick()" (unteres Wort des IPC-Zhlers)
+uint32_t tickTimestamp = 0;
+// Zum Quittieren eines Trips im Modus RECOVERY_MODE_LATCHED (z.B. ber den Debugger setzen)
+bool clearTrip = false;
+// Auslsende Komparatoren des letzten Trips (zur Anzeige im Debugger)
+uint16_t lastTripSource = 0;
+// ADC-Messung fr die Pre-Trigger-Historie des Fehlerspeichers (Kanal 0: Pin A2)
+uint16_t adcFrame[FAULTLOG_ADC_CHANNELS] = {0};
 
 
 //=== Function: main ==============================================================================
@@ -55,8 +125,30 @@ void main(void)
 		// im Debugger anzeigen zu knnen. Dient zur Kontrolle der Tripzone-Funktion
 		AdcAInit(ADC_RESOLUTION_12_BIT,
 						 ADC_SINGLE_ENDED_MODE);
-		// Tripzone initialisieren
-		TripzoneInitCmpss1();
+		// UART initialisieren (SCI-A, Ausgabe des Fehlerspeichers)
+		UartInitA(UART_BAUD_115200,
+							UART_DATA_8_BIT,
+							UART_STOP_1_BIT,
+							UART_PARITY_NONE);
+		// Fehlerspeicher prfen (Eintrge bleiben nach einem Soft-Reset
+		// erhalten) und Compare-Werte von ePWM1 speichern
+		FaultLogInit(PROTECTION_EPWM(1));
+		// ePWM1-Modul initialisieren (10 kHz, 50 %, Pins GPIO 0 und 1)
+		TripzoneInitPwm1();
+		// Schutz-Manager initialisieren (CMPSS1 -> TRIP4 -> ePWM1, Trip-Interrupt von ePWM1)
+		if (!ProtectionInit(protectionTable,
+										sizeof(protectionTable) / sizeof(protectionTable[0]),
+										1))
+		{
+				// Fehlerbehandlung (ungltige Tabelle):
+				// ...
+		}
+		// Zustandsmaschine zur Wiederinbetriebnahme initialisieren
+		RecoveryInit(&recoveryConfigMain);
+		tickTimestamp = Cpu1toCpu2IpcRegs.IPCCOUNTERL;
+
+		// Auf einen Befehl ber UART warten (ein Zeichen)
+		UartReceiveA(1, UART_NO_TIMEOUT);
 
     // Register-Schreibschutz ausschalten
     EALLOW;
@@ -72,30 +164,49 @@ void main(void)
 				while (AdcaRegs.ADCCTL1.bit.ADCBSY);
 				// Messwert auslesen
 				ADCINA2 = AdcaResultRegs.ADCRESULT0;
+				// Messwert in der Pre-Trigger-Historie des Fehlerspeichers ablegen
+				adcFrame[0] = ADCINA2;
+				FaultLogRecordFrame(adcFrame);
 
-
-				// Eingangssignal liegt oberhalb vom Grenzwert (DACHVALS.DACVAL)
-				if (EPwm1Regs.TZFLG.bit.DCAEVT1)
+				// Auslsende Komparatoren abfragen (wird im Trip-Interrupt
+				// gesetzt, siehe PROTECTION_SOURCE_HIGH() und PROTECTION_SOURCE_LOW())
+				if (ProtectionGetTripSource())
 				{
-						// DCAEVT1-Event Tripzone-Flag lschen. Falls die Bedingung fr das DCAEVT1-Event
-						// erfllt sind (Komparator-Ausgang = high), wird das Flag sofort wieder gesetzt
-						// (siehe 5. Absatz von oben S. 2908 Reference Manual TMS320F2838x)
-						EPwm1Regs.TZCLR.bit.DCAEVT1 = 1;
+						lastTripSource = ProtectionGetTripSource();
 				}
-				// Eingangssignal liegt unterhalb vom Grenzwert (DACLVALS.DACVAL)
-				if (EPwm1Regs.TZFLG.bit.DCBEVT1)
+				// Zustandsmaschine zur Wiederinbetriebnahme jede ms aufrufen. Die Differenz
+				// wird vorzeichenlos gebildet und ist damit auch beim berlauf korrekt
+				if ((Cpu1toCpu2IpcRegs.IPCCOUNTERL - tickTimestamp) >= MAIN_TICK_CYCLES)
 				{
-						// DCBEVT1-Event Tripzone-Flag lschen. Falls die Bedingung fr das DCEVT1-Event
-						// erfllt sind (Komparator-Ausgang = low), wird das Flag sofort wieder gesetzt
-						// (siehe 5. Absatz von oben S. 2908 Reference Manual TMS320F2838x)
-						EPwm1Regs.TZCLR.bit.DCBEVT1 = 1;
+						tickTimestamp += MAIN_TICK_CYCLES;
+						RecoveryTick();
 				}
-				// Ein One-Shot Event ist aufgetreten (DCAEVT1- oder DCBEVT1-Event)
-				if (EPwm1Regs.TZFLG.bit.OST)
+				// Gespeicherten Trip quittieren. Die PWM-Pins werden nur freigegeben,
+				// wenn das Eingangssignal wieder innerhalb der Grenzen liegt
+				if (clearTrip && RecoveryAcknowledge())
+				{
+						clearTrip = false;
+				}
+
+				// Befehl ber UART empfangen
+				if (UartGetStatusRxA() == UART_STATUS_FINISHED)
 				{
-						// Flag lschen
-						EPwm1Regs.TZCLR.bit.OST = 1;
+						// Fehlerspeicher ausgeben
+						if (uartBufferRxA[0] == MAIN_COMMAND_DUMP)
+						{
+								FaultLogDumpStart();
+						}
+						// Fehlerspeicher lschen (eine laufende Ausgabe wird beendet)
+						else if (uartBufferRxA[0] == MAIN_COMMAND_CLEAR)
+						{
+								FaultLogClear();
+						}
+						// Auf den nchsten Befehl warten
+						UartSetStatusIdleRxA();
+						UartReceiveA(1, UART_NO_TIMEOUT);
 				}
+				// Nchste Zeile des Fehlerspeichers ausgeben (kehrt sofort zurck)
+				FaultLogDumpTask();
     }
 }
 
@@ -0,0 +1,441 @@
+//=================================================================================================
+/// @file       myFaultLog.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Fehlerspeicher (Post-Mortem-Puffer),
+///							der bei jedem Trip einen Eintrag mit Zeitstempel, den auslsenden Flags, den
+///							Compare-Werten der ePWM-Module und den letzten ADC-Messwerten (Pre-Trigger-
+///							Historie) anlegt. Die Eintrge werden in einem Ringpuffer in der nicht
+///							initialisierten RAM-Sektion "FAULTLOG" (RAMGS15, type=NOINIT) abgelegt und
+///							berstehen damit einen Soft-Reset (z.B. Watchdog oder Debugger-Reset). ber
+///							eine Kennung und eine Prfsumme pro Eintrag wird beim Start erkannt, ob der
+///							Inhalt gltig ist. Der Fehlerspeicher kann ber UART (SCI-A, "myUART.c") als
+///							ASCII-Text ausgegeben werden. Die Ausgabe erfolgt zeilenweise aus dem Haupt-
+///							programm ("FaultLogDumpTask()") und blockiert dieses nicht.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myFaultLog.h"
+#include "myProtection.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Fehlerspeicher in der nicht initialisierten Sektion "FAULTLOG" (siehe .cmd-Datei).
+// Der Inhalt wird beim Start weder vom Boot-ROM noch vom C-Startup-Code verndert
+#pragma DATA_SECTION(faultLog, "FAULTLOG");
+FaultLog faultLog;
+// Pre-Trigger-Historie der ADC-Messungen (Ringpuffer, wird nicht ber einen Reset gerettet)
+uint16_t faultLogAdcHistory[FAULTLOG_ADC_FRAMES][FAULTLOG_ADC_CHANNELS];
+uint16_t faultLogAdcIndex = 0;
+// ePWM-Module, deren Compare-Werte gespeichert werden
+uint16_t faultLogPwm[FAULTLOG_NUMBER_OF_PWM];
+// Steuervariablen fr die Ausgabe ber UART
+bool faultLogDumpActive = false;
+uint16_t faultLogDumpRecord;
+uint16_t faultLogDumpLine;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: FaultLogInit ======================================================================
+///
+/// @brief  Funktion prft den Inhalt des Fehlerspeichers nach einem Reset. Ist die Kennung
+///					ungltig (z.B. nach dem Einschalten der Versorgungsspannung), wird der Speicher
+///					gelscht. Andernfalls bleiben alle Eintrge erhalten und der Zhler der Starts
+///					wird erhht. Aus "pwmMask" (Bit n-1 = ePWMn) werden die ersten FAULTLOG_NUMBER_
+///					OF_PWM Module bernommen, deren Compare-Werte bei einem Trip gespeichert werden.
+///
+/// @param  uint16_t pwmMask
+///
+/// @return void
+///
+//=================================================================================================
+void FaultLogInit(uint16_t pwmMask)
+{
+		// Inhalt nach dem Einschalten ungltig -> Fehlerspeicher lschen
+		if (   (faultLog.magic != FAULTLOG_MAGIC)
+				|| (faultLog.magicInverted != (uint16_t)~FAULTLOG_MAGIC)
+				|| (faultLog.writeIndex >= FAULTLOG_NUMBER_OF_RECORDS)
+				|| (faultLog.numberOfRecords > FAULTLOG_NUMBER_OF_RECORDS))
+		{
+				FaultLogClear();
+				faultLog.bootCount = 0;
+		}
+		faultLog.bootCount++;
+
+		// ePWM-Module aus der Bitmaske bernehmen
+		uint16_t index = 0;
+		for (uint16_t i = 0; i < FAULTLOG_NUMBER_OF_PWM; i++)
+		{
+				faultLogPwm[i] = FAULTLOG_NO_PWM;
+		}
+		for (uint16_t pwm = 0; (pwm < PROTECTION_NUMBER_OF_PWM) && (index < FAULTLOG_NUMBER_OF_PWM); pwm++)
+		{
+				if (pwmMask & (1U << pwm))
+				{
+						faultLogPwm[index] = pwm + 1U;
+						index++;
+				}
+		}
+
+		// Pre-Trigger-Historie initialisieren
+		for (uint16_t frame = 0; frame < FAULTLOG_ADC_FRAMES; frame++)
+		{
+				for (uint16_t channel = 0; channel < FAULTLOG_ADC_CHANNELS; channel++)
+				{
+						faultLogAdcHistory[frame][channel] = 0;
+				}
+		}
+		faultLogAdcIndex   = 0;
+		faultLogDumpActive = false;
+}
+
+
+//=== Function: FaultLogClear =====================================================================
+///
+/// @brief  Funktion lscht alle Eintrge des Fehlerspeichers und setzt die Kennung. Der Zhler
+///					der Starts bleibt erhalten. Whrend des Lschens sind die CPU-Interrupts gesperrt,
+///					damit die Trip-ISR ("FaultLogCapture()") keinen Eintrag in den halb gelschten
+///					Speicher schreibt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void FaultLogClear(void)
+{
+		// CPU-Interrupts sperren (vorherigen Zustand sichern, da die Funktion
+		// auch bei bereits gesperrten Interrupts aufgerufen werden kann)
+		uint16_t interruptState = __disable_interrupts();
+		uint16_t *word = (uint16_t *)faultLog.record;
+		for (uint16_t i = 0; i < sizeof(faultLog.record); i++)
+		{
+				word[i] = 0;
+		}
+		faultLog.writeIndex      = 0;
+		faultLog.numberOfRecords = 0;
+		faultLog.totalTrips      = 0;
+		faultLog.magic           = FAULTLOG_MAGIC;
+		faultLog.magicInverted   = (uint16_t)~FAULTLOG_MAGIC;
+		// CPU-Interrupts wieder auf den vorherigen Zustand setzen
+		__restore_interrupts(interruptState);
+}
+
+
+//=== Function: FaultLogRecordFrame ===============================================================
+///
+/// @brief  Funktion speichert eine ADC-Messung (FAULTLOG_ADC_CHANNELS Werte) in der Pre-Trigger-
+///					Historie. Die Funktion sollte einmal pro Regelzyklus (z.B. in der ADC-ISR) aufgerufen
+///					werden. Bei einem Trip werden die letzten FAULTLOG_ADC_FRAMES Messungen in den
+///					Eintrag kopiert.
+///
+/// @param  const uint16_t *adcResults
+///
+/// @return void
+///
+//=================================================================================================
+void FaultLogRecordFrame(const uint16_t *adcResults)
+{
+		uint16_t *frame = faultLogAdcHistory[faultLogAdcIndex & (FAULTLOG_ADC_FRAMES - 1U)];
+		for (uint16_t channel = 0; channel < FAULTLOG_ADC_CHANNELS; channel++)
+		{
+				frame[channel] = adcResults[channel];
+		}
+		faultLogAdcIndex++;
+}
+
+
+//=== Function: FaultLogCapture ===================================================================
+///
+/// @brief  Funktion legt einen Eintrag fr einen Trip im Fehlerspeicher an (Zeitstempel, Trip-
+///					Flags des ePWM-Moduls "interruptPwm", auslsende Komparatoren "tripSource", Compare-
+///					Werte und ADC-Historie). Ist der Fehlerspeicher voll, wird der lteste Eintrag
+///					berschrieben. Die Funktion wird aus der Trip-ISR aufgerufen, bevor die Trip-Flags
+///					gelscht werden.
+///
+/// @param  uint16_t interruptPwm, uint16_t tripSource
+///
+/// @return void
+///
+//=================================================================================================
+void FaultLogCapture(uint16_t interruptPwm,
+										 uint16_t tripSource)
+{
+		FaultLogRecord *record = &faultLog.record[faultLog.writeIndex];
+
+		// Zeitstempel aus dem freilaufenden 64-Bit IPC-Zhler (SYSCLK) lesen. Beim Lesen
+		// des unteren Worts wird das obere Wort zwischengespeichert, daher muss
+		// IPCCOUNTERL zuerst gelesen werden
+		record->timestampLow  = Cpu1toCpu2IpcRegs.IPCCOUNTERL;
+		record->timestampHigh = Cpu1toCpu2IpcRegs.IPCCOUNTERH;
+		record->bootCount     = faultLog.bootCount;
+		record->tripSource    = tripSource;
+
+		// Trip-Flags des Interrupt-ePWM-Moduls
+		if ((interruptPwm > 0) && (interruptPwm <= PROTECTION_NUMBER_OF_PWM))
+		{
+				volatile struct EPWM_REGS *regs = protectionPwmRegs[interruptPwm - 1U];
+				record->tzFlags    = regs->TZFLG.all;
+				record->tzOstFlags = regs->TZOSTFLG.all;
+				record->tzCbcFlags = regs->TZCBCFLG.all;
+		}
+		else
+		{
+				record->tzFlags    = 0;
+				record->tzOstFlags = 0;
+				record->tzCbcFlags = 0;
+		}
+
+		// Periode, Compare-Werte und Zhlerstand der ePWM-Module
+		for (uint16_t i = 0; i < FAULTLOG_NUMBER_OF_PWM; i++)
+		{
+				record->pwmNumber[i] = faultLogPwm[i];
+				if (faultLogPwm[i] != FAULTLOG_NO_PWM)
+				{
+						volatile struct EPWM_REGS *regs = protectionPwmRegs[faultLogPwm[i] - 1U];
+						record->pwmPeriod[i]   = regs->TBPRD;
+						record->pwmCompareA[i] = regs->CMPA.bit.CMPA;
+						record->pwmCompareB[i] = regs->CMPB.bit.CMPB;
+						record->pwmCounter[i]  = regs->TBCTR;
+				}
+				else
+				{
+						record->pwmPeriod[i]   = 0;
+						record->pwmCompareA[i] = 0;
+						record->pwmCompareB[i] = 0;
+						record->pwmCounter[i]  = 0;
+				}
+		}
+
+		// ADC-Historie kopieren (lteste Messung zuerst). "faultLogAdcIndex" zeigt
+		// auf den nchsten zu schreibenden und damit ltesten Frame
+		for (uint16_t frame = 0; frame < FAULTLOG_ADC_FRAMES; frame++)
+		{
+				uint16_t *source = faultLogAdcHistory[(faultLogAdcIndex + frame) & (FAULTLOG_ADC_FRAMES - 1U)];
+				for (uint16_t channel = 0; channel < FAULTLOG_ADC_CHANNELS; channel++)
+				{
+						record->adc[frame][channel] = source[channel];
+				}
+		}
+
+		// Prfsumme zuletzt setzen. Wird der Eintrag durch einen Reset unterbrochen,
+		// ist die Prfsumme ungltig und der Eintrag wird bei der Ausgabe markiert
+		record->checksum = FaultLogChecksum(record);
+
+		// Index des nchsten Eintrags (Ringpuffer)
+		faultLog.writeIndex++;
+		if (faultLog.writeIndex >= FAULTLOG_NUMBER_OF_RECORDS)
+		{
+				faultLog.writeIndex = 0;
+		}
+		if (faultLog.numberOfRecords < FAULTLOG_NUMBER_OF_RECORDS)
+		{
+				faultLog.numberOfRecords++;
+		}
+		faultLog.totalTrips++;
+}
+
+
+//=== Function: FaultLogChecksum ==================================================================
+///
+/// @brief  Funktion berechnet die Prfsumme eines Eintrags ber alle Worte nach dem Element
+///					"checksum" (Zweierkomplement der 16-Bit Summe). Die Summe ber alle Worte eines
+///					gltigen Eintrags inkl. Prfsumme ist damit 0.
+///
+/// @param  const FaultLogRecord *record
+///
+/// @return uint16_t checksum
+///
+//=================================================================================================
+uint16_t FaultLogChecksum(const FaultLogRecord *record)
+{
+		const uint16_t *word = (const uint16_t *)record;
+		uint16_t sum = 0;
+		// sizeof() liefert beim C28x die Gre in 16-Bit Worten
+		for (uint16_t i = 1; i < sizeof(FaultLogRecord); i++)
+		{
+				sum += word[i];
+		}
+		return (uint16_t)(0U - sum);
+}
+
+
+//=== Function: FaultLogDumpStart =================================================================
+///
+/// @brief  Funktion startet die Ausgabe des Fehlerspeichers ber UART (SCI-A). Die Ausgabe
+///					erfolgt anschlieend zeilenweise ber "FaultLogDumpTask()". Die Funktion gibt
+///					"false" zurck, falls bereits eine Ausgabe aktiv ist.
+///
+/// @param  void
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool FaultLogDumpStart(void)
+{
+		if (faultLogDumpActive)
+		{
+				return false;
+		}
+		faultLogDumpRecord = 0;
+		faultLogDumpLine   = 0;
+		faultLogDumpActive = true;
+		return true;
+}
+
+
+//=== Function: FaultLogDumpTask ==================================================================
+///
+/// @brief  Funktion gibt die nchste Zeile des Fehlerspeichers ber UART aus, sobald keine andere
+///					Sende-Kommunikation aktiv ist. Die Funktion wird regelmig aus dem Hauptprogramm
+///					aufgerufen und kehrt sofort zurck (kein Warten auf das Ende der bertragung).
+///					Pro Eintrag werden eine Kopfzeile, FAULTLOG_NUMBER_OF_PWM ePWM-Zeilen und
+///					FAULTLOG_ADC_FRAMES ADC-Zeilen ausgegeben, die Eintrge vom ltesten zum neuesten.
+///					Die Ausgabe endet mit der Zeile "E,<Anzahl Trips>". Rckgabewert ist "true",
+///					solange die Ausgabe aktiv ist.
+///
+/// @param  void
+///
+/// @return bool faultLogDumpActive
+///
+//=================================================================================================
+bool FaultLogDumpTask(void)
+{
+		if (!faultLogDumpActive)
+		{
+				return false;
+		}
+		// Vorherige Zeile wurde vollstndig gesendet
+		if (UartGetStatusTxA() == UART_STATUS_FINISHED)
+		{
+				UartSetStatusIdleTxA();
+		}
+		// Sende-Kommunikation ist noch aktiv -> beim nchsten Aufruf erneut versuchen
+		if (UartGetStatusTxA() != UART_STATUS_IDLE)
+		{
+				return true;
+		}
+
+		uint16_t *buffer = uartBufferTxA;
+		uint16_t length  = 0;
+		uint16_t linesPerRecord = 1U + FAULTLOG_NUMBER_OF_PWM + FAULTLOG_ADC_FRAMES;
+
+		// Alle Eintrge ausgegeben -> Abschlusszeile
+		if (faultLogDumpRecord >= faultLog.numberOfRecords)
+		{
+				buffer[length++] = 'E';
+				buffer[length++] = ',';
+				length = FaultLogAppendHex(buffer, length, faultLog.totalTrips, 8);
+				faultLogDumpActive = false;
+		}
+		else
+		{
+				// ltester Eintrag liegt bei vollem Ringpuffer am Schreibindex
+				uint16_t index = faultLogDumpRecord;
+				if (faultLog.numberOfRecords == FAULTLOG_NUMBER_OF_RECORDS)
+				{
+						index = (faultLog.writeIndex + faultLogDumpRecord) % FAULTLOG_NUMBER_OF_RECORDS;
+				}
+				const FaultLogRecord *record = &faultLog.record[index];
+
+				// Kopfzeile
+				if (faultLogDumpLine == 0)
+				{
+						buffer[length++] = (FaultLogChecksum(record) == record->checksum) ? 'F' : 'X';
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, faultLogDumpRecord, 2);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->bootCount, 4);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->timestampHigh, 8);
+						length = FaultLogAppendHex(buffer, length, record->timestampLow, 8);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->tzFlags, 4);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->tzOstFlags, 4);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->tzCbcFlags, 4);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->tripSource, 4);
+				}
+				// ePWM-Zeilen
+				else if (faultLogDumpLine <= FAULTLOG_NUMBER_OF_PWM)
+				{
+						uint16_t i = faultLogDumpLine - 1U;
+						buffer[length++] = 'P';
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->pwmNumber[i], 2);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->pwmPeriod[i], 4);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->pwmCompareA[i], 4);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->pwmCompareB[i], 4);
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, record->pwmCounter[i], 4);
+				}
+				// ADC-Zeilen
+				else
+				{
+						uint16_t frame = faultLogDumpLine - 1U - FAULTLOG_NUMBER_OF_PWM;
+						buffer[length++] = 'A';
+						buffer[length++] = ',';
+						length = FaultLogAppendHex(buffer, length, frame, 2);
+						for (uint16_t channel = 0; channel < FAULTLOG_ADC_CHANNELS; channel++)
+						{
+								buffer[length++] = ',';
+								length = FaultLogAppendHex(buffer, length, record->adc[frame][channel], 4);
+						}
+				}
+
+				// Nchste Zeile bzw. nchster Eintrag
+				faultLogDumpLine++;
+				if (faultLogDumpLine >= linesPerRecord)
+				{
+						faultLogDumpLine = 0;
+						faultLogDumpRecord++;
+				}
+		}
+		buffer[length++] = '\r';
+		buffer[length++] = '\n';
+
+		// Zeile senden (max. UART_SIZE_SOFTWARE_BUFFER_TX Zeichen)
+		UartTransmitA(length);
+
+		return true;
+}
+
+
+//=== Function: FaultLogAppendHex =================================================================
+///
+/// @brief  Funktion hngt den Wert "value" mit "digits" Stellen als Hexadezimalzahl (ASCII,
+///					Grobuchstaben) ab der Position "length" an den Puffer an und gibt die neue Lnge
+///					zurck.
+///
+/// @param  uint16_t *buffer, uint16_t length, uint32_t value, uint16_t digits
+///
+/// @return uint16_t length
+///
+//=================================================================================================
+uint16_t FaultLogAppendHex(uint16_t *buffer,
+													 uint16_t length,
+													 uint32_t value,
+													 uint16_t digits)
+{
+		for (uint16_t i = digits; i > 0; i--)
+		{
+				uint16_t nibble = (uint16_t)(value >> (4U * (i - 1U))) & 0x000F;
+				buffer[length++] = (nibble < 10) ? ('0' + nibble) : ('A' + nibble - 10);
+		}
+		return length;
+}
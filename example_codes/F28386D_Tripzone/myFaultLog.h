@@ -0,0 +1,141 @@
+//=================================================================================================
+/// @file       myFaultLog.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Fehlerspeicher (Post-Mortem-Puffer),
+///							der bei jedem Trip einen Eintrag mit Zeitstempel, den auslsenden Flags, den
+///							Compare-Werten der ePWM-Module und den letzten ADC-Messwerten (Pre-Trigger-
+///							Historie) anlegt. Die Eintrge werden in einem Ringpuffer in der nicht
+///							initialisierten RAM-Sektion "FAULTLOG" (RAMGS15, type=NOINIT) abgelegt und
+///							berstehen damit einen Soft-Reset (z.B. Watchdog oder Debugger-Reset). ber
+///							eine Kennung und eine Prfsumme pro Eintrag wird beim Start erkannt, ob der
+///							Inhalt gltig ist. Der Fehlerspeicher kann ber UART (SCI-A, "myUART.c") als
+///							ASCII-Text ausgegeben werden. Die Ausgabe erfolgt zeilenweise aus dem Haupt-
+///							programm ("FaultLogDumpTask()") und blockiert dieses nicht.
+///
+///							Format der Ausgabe (alle Werte hexadezimal):
+///							F,<Nr>,<Boot>,<Zeitstempel>,<TZFLG>,<TZOSTFLG>,<TZCBCFLG>,<CMPSS-Latches>
+///							P,<ePWM>,<TBPRD>,<CMPA>,<CMPB>,<TBCTR>
+///							A,<Frame>,<Kanal 0>,<Kanal 1>,<Kanal 2>,<Kanal 3>
+///							E,<Anzahl Trips gesamt>
+///							Bei einer fehlerhaften Prfsumme beginnt die Kopfzeile mit "X" statt "F".
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYFAULTLOG_H_
+#define MYFAULTLOG_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myUART.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Eintrge im Fehlerspeicher (Ringpuffer)
+#define FAULTLOG_NUMBER_OF_RECORDS					8
+// Anzahl der gespeicherten ADC-Messungen vor dem Trip (muss eine Zweierpotenz sein)
+#define FAULTLOG_ADC_FRAMES									16
+// Anzahl der ADC-Kanle pro Messung
+#define FAULTLOG_ADC_CHANNELS								4
+// Anzahl der ePWM-Module, deren Compare-Werte gespeichert werden
+#define FAULTLOG_NUMBER_OF_PWM							4
+// Kennung eines gltigen Fehlerspeichers ("FL")
+#define FAULTLOG_MAGIC											0x464C
+// Kein ePWM-Modul in einem Eintrag
+#define FAULTLOG_NO_PWM											0
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Eintrag im Fehlerspeicher. Die Prfsumme muss das erste Element sein,
+// sie wird ber alle folgenden Worte des Eintrags gebildet
+typedef struct
+{
+		// Prfsumme ber alle folgenden Worte (Zweierkomplement der Summe)
+		uint16_t checksum;
+		// Zhlerstand der Starts des Mikrocontrollers zum Zeitpunkt des Trips
+		uint16_t bootCount;
+		// Zeitstempel (SYSCLK-Takte seit dem Start, 64 Bit)
+		uint32_t timestampLow;
+		uint32_t timestampHigh;
+		// Auslsende Komparatoren (siehe "protectionTripSource")
+		uint16_t tripSource;
+		// Trip-Flags des Interrupt-ePWM-Moduls
+		uint16_t tzFlags;
+		uint16_t tzOstFlags;
+		uint16_t tzCbcFlags;
+		// Nummer (1 ... 16), Periode, Compare-Werte und Zhlerstand der ePWM-Module
+		uint16_t pwmNumber[FAULTLOG_NUMBER_OF_PWM];
+		uint16_t pwmPeriod[FAULTLOG_NUMBER_OF_PWM];
+		uint16_t pwmCompareA[FAULTLOG_NUMBER_OF_PWM];
+		uint16_t pwmCompareB[FAULTLOG_NUMBER_OF_PWM];
+		uint16_t pwmCounter[FAULTLOG_NUMBER_OF_PWM];
+		// Letzte ADC-Messungen vor dem Trip (lteste Messung zuerst)
+		uint16_t adc[FAULTLOG_ADC_FRAMES][FAULTLOG_ADC_CHANNELS];
+} FaultLogRecord;
+
+// Fehlerspeicher (liegt in der nicht initialisierten RAM-Sektion "FAULTLOG")
+typedef struct
+{
+		// Kennung und invertierte Kennung (gltiger Inhalt)
+		uint16_t magic;
+		uint16_t magicInverted;
+		// Anzahl der Starts des Mikrocontrollers
+		uint16_t bootCount;
+		// Index des nchsten zu schreibenden Eintrags
+		uint16_t writeIndex;
+		// Anzahl der gltigen Eintrge (max. FAULTLOG_NUMBER_OF_RECORDS)
+		uint16_t numberOfRecords;
+		// Anzahl aller Trips (auch der berschriebenen Eintrge)
+		uint32_t totalTrips;
+		// Eintrge
+		FaultLogRecord record[FAULTLOG_NUMBER_OF_RECORDS];
+} FaultLog;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Fehlerspeicher (berlebt einen Soft-Reset)
+extern FaultLog faultLog;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion prft den Fehlerspeicher nach einem Reset und legt
+// die ePWM-Module fest, deren Compare-Werte gespeichert werden
+extern void FaultLogInit(uint16_t pwmMask);
+// Funktion lscht alle Eintrge des Fehlerspeichers
+extern void FaultLogClear(void);
+// Funktion speichert eine ADC-Messung in der Pre-Trigger-Historie
+extern void FaultLogRecordFrame(const uint16_t *adcResults);
+// Funktion legt einen Eintrag fr einen Trip an (Aufruf aus der Trip-ISR)
+extern void FaultLogCapture(uint16_t interruptPwm,
+														uint16_t tripSource);
+// Funktion berechnet die Prfsumme eines Eintrags
+extern uint16_t FaultLogChecksum(const FaultLogRecord *record);
+// Funktion startet die Ausgabe des Fehlerspeichers ber UART
+extern bool FaultLogDumpStart(void);
+// Funktion gibt die nchste Zeile des Fehlerspeichers ber UART aus
+extern bool FaultLogDumpTask(void);
+// Funktion hngt einen Wert als Hexadezimalzahl an einen Puffer an
+extern uint16_t FaultLogAppendHex(uint16_t *buffer,
+																	uint16_t length,
+																	uint32_t value,
+																	uint16_t digits);
+
+
+#endif
@@ -0,0 +1,1102 @@
+//=================================================================================================
+/// @file       myProtection.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen tabellengesteuerten Schutz-Manager
+///							auf Basis der Komparator-Subsysteme CMPSS1 ... CMPSS8. Jeder Eintrag der ber-
+///							gebenen Tabelle beschreibt einen Schutzkanal (ein CMPSS-Modul): Grenzwerte in
+///							physikalischen Einheiten (z.B. Ampere), Skalierung des Sensors, Hysterese,
+///							Digitalfilter (Abtastfenster und Schwelle), optional den Rampengenerator und
+///							das Routing der Komparatorausgnge ber die ePWM X-Bar auf beliebige ePWM-
+///							Module. Die Komparatorausgnge werden in den ePWM-Modulen ber das Digital-
+///							Compare-Modul (DCAEVT1) als One-Shot-Trip verarbeitet, so dass alle Brcken-
+///							zweige ohne CPU-Beteiligung abgeschaltet werden. Die Grenzwerte knnen zur
+///							Laufzeit ber die Shadow-Register der DACs gendert werden. Im Trip-Interrupt
+///							wird ber die Latch-Bits der Komparatoren ermittelt, welcher Komparator den
+///							Trip ausgelst hat ("protectionTripSource").
+///
+///							Alternativ kann ein Kanal im Cycle-by-Cycle-Modus (CBC) betrieben werden, z.B.
+///							fr eine Spitzenstromregelung (Peak Current Mode): Der Komparatorausgang wird
+///							ber DCBEVT2 als CBC-Trip verarbeitet, d.h. die PWM-Pins werden nur bis zum
+///							Ende der aktuellen Periode (CTR = 0 und/oder CTR = PRD) abgeschaltet. Ein
+///							Austastfenster (Blanking), das mit der Periode des ePWM-Moduls synchronisiert
+///							ist, unterdrckt Stromspitzen beim Einschalten der Leistungshalbleiter. ber
+///							den Rampengenerator des CMPSS-Moduls kann eine Slope-Kompensation realisiert
+///							werden. Die Anzahl der Perioden mit aktiver Strombegrenzung wird im Interrupt
+///							gezhlt ("protectionCbcCount"). Damit der Tripzone-Interrupt bei anhaltender
+///							Grenzwertverletzung nicht dauernd erneut auslst, wird er nach dem ersten CBC-
+///							Event gesperrt und erst am Lschzeitpunkt ber den ePWM-Interrupt (EPWMx_INT)
+///							des Interrupt-ePWM-Moduls wieder freigegeben (hchstens ein Aufruf pro Periode).
+///
+///							Der Low-Komparator wird invertiert betrieben, d.h. beide Komparatoren eines
+///							Kanals liefern bei einer Grenzwertverletzung ein High-Signal. Dadurch knnen
+///							die Ausgnge beliebig vieler Komparatoren in der ePWM X-Bar verodert und ber
+///							ein einziges DCAEVT1-Event ausgewertet werden.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myProtection.h"
+#include "myFaultLog.h"
+#include "myRecovery.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Zeiger auf die Register der Komparator-Subsysteme und ePWM-Module
+volatile struct CMPSS_REGS *const protectionCmpssRegs[PROTECTION_NUMBER_OF_CMPSS] =
+{
+		&Cmpss1Regs, &Cmpss2Regs, &Cmpss3Regs, &Cmpss4Regs,
+		&Cmpss5Regs, &Cmpss6Regs, &Cmpss7Regs, &Cmpss8Regs
+};
+volatile struct EPWM_REGS *const protectionPwmRegs[PROTECTION_NUMBER_OF_PWM] =
+{
+		&EPwm1Regs,  &EPwm2Regs,  &EPwm3Regs,  &EPwm4Regs,
+		&EPwm5Regs,  &EPwm6Regs,  &EPwm7Regs,  &EPwm8Regs,
+		&EPwm9Regs,  &EPwm10Regs, &EPwm11Regs, &EPwm12Regs,
+		&EPwm13Regs, &EPwm14Regs, &EPwm15Regs, &EPwm16Regs
+};
+// Eintrge der PIE-Vector Table fr die Tripzone-Interrupts (EPWMx_TZ_INT). Die Interrupts
+// von ePWM9 ... ePWM16 liegen nicht direkt hinter denen von ePWM1 ... ePWM8 (erweiterter
+// Bereich INTx9 ... INTx16), daher werden die Adressen einzeln hinterlegt
+volatile PINT *const protectionTzVectors[PROTECTION_NUMBER_OF_PWM] =
+{
+		&PieVectTable.EPWM1_TZ_INT,  &PieVectTable.EPWM2_TZ_INT,
+		&PieVectTable.EPWM3_TZ_INT,  &PieVectTable.EPWM4_TZ_INT,
+		&PieVectTable.EPWM5_TZ_INT,  &PieVectTable.EPWM6_TZ_INT,
+		&PieVectTable.EPWM7_TZ_INT,  &PieVectTable.EPWM8_TZ_INT,
+		&PieVectTable.EPWM9_TZ_INT,  &PieVectTable.EPWM10_TZ_INT,
+		&PieVectTable.EPWM11_TZ_INT, &PieVectTable.EPWM12_TZ_INT,
+		&PieVectTable.EPWM13_TZ_INT, &PieVectTable.EPWM14_TZ_INT,
+		&PieVectTable.EPWM15_TZ_INT, &PieVectTable.EPWM16_TZ_INT
+};
+// Eintrge der PIE-Vector Table fr die ePWM-Interrupts (EPWMx_INT, Gruppe 3)
+volatile PINT *const protectionPwmVectors[PROTECTION_NUMBER_OF_PWM] =
+{
+		&PieVectTable.EPWM1_INT,  &PieVectTable.EPWM2_INT,
+		&PieVectTable.EPWM3_INT,  &PieVectTable.EPWM4_INT,
+		&PieVectTable.EPWM5_INT,  &PieVectTable.EPWM6_INT,
+		&PieVectTable.EPWM7_INT,  &PieVectTable.EPWM8_INT,
+		&PieVectTable.EPWM9_INT,  &PieVectTable.EPWM10_INT,
+		&PieVectTable.EPWM11_INT, &PieVectTable.EPWM12_INT,
+		&PieVectTable.EPWM13_INT, &PieVectTable.EPWM14_INT,
+		&PieVectTable.EPWM15_INT, &PieVectTable.EPWM16_INT
+};
+// Aktive Konfigurationstabelle (muss whrend der Laufzeit gltig bleiben)
+const ProtectionChannelConfig *protectionTable = 0;
+uint16_t protectionNumberOfChannels = 0;
+// Alle ePWM-Module, die von mindestens einem Kanal abgeschaltet werden
+uint16_t protectionPwmMask = 0;
+// ePWM-Modul, dessen Tripzone-Interrupt verwendet wird
+uint16_t protectionInterruptPwm = PROTECTION_NO_INTERRUPT;
+// Komparatoren, die seit dem letzten Aufruf von "ProtectionClearTrip()" ausgelst haben
+uint16_t protectionTripSource = 0;
+// Anzahl der Trip-Interrupts seit der Initialisierung
+uint32_t protectionTripCount = 0;
+// Anzahl der Perioden mit aktiver Strombegrenzung (CBC-Trip) des Interrupt-ePWM-Moduls
+uint32_t protectionCbcCount = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: ProtectionInit ====================================================================
+///
+/// @brief  Funktion konfiguriert alle in der Tabelle "table" beschriebenen Schutzkanle:
+///					- Komparator-Subsysteme (DACs, Hysterese, Digitalfilter, Rampengenerator)
+///					- ePWM X-Bar (Komparatorausgnge auf die gewhlten TRIP-Ausgnge legen)
+///					- Digital-Compare- und Tripzone-Module aller betroffenen ePWM-Module
+///					  (DCAEVT1 als One-Shot-Trip, beide PWM-Pins auf Low-Pegel)
+///					Optional wird der Tripzone-Interrupt des ePWM-Moduls "interruptPwm" (1 ... 16)
+///					eingeschaltet (PROTECTION_NO_INTERRUPT: kein Interrupt). Hat dieses Modul CBC-Kanle,
+///					wird zustzlich sein ePWM-Interrupt (EPWMx_INT) belegt. Die Tabelle wird nicht
+///					kopiert und muss daher whrend der gesamten Laufzeit gltig bleiben. Die Funktion
+///					gibt "false" zurck, wenn ein Eintrag der Tabelle ungltig ist. In diesem Fall
+///					wird keine Hardware konfiguriert.
+///
+/// @param  const ProtectionChannelConfig *table, uint16_t numberOfChannels, uint16_t interruptPwm
+///
+/// @return bool tableValid
+///
+//=================================================================================================
+bool ProtectionInit(const ProtectionChannelConfig *table,
+										uint16_t numberOfChannels,
+										uint16_t interruptPwm)
+{
+		// TRIP-Eingnge (Bit x-1 = TRIPINx) pro ePWM-Modul fr OST- und CBC-Kanle
+		uint16_t tripMask[PROTECTION_NUMBER_OF_PWM] = {0};
+		uint16_t cbcTripMask[PROTECTION_NUMBER_OF_PWM] = {0};
+		// Erster CBC-Kanal pro ePWM-Modul (Einstellungen des Austastfensters)
+		const ProtectionChannelConfig *cbcChannel[PROTECTION_NUMBER_OF_PWM] = {0};
+		uint16_t pwmMask = 0;
+
+		// bergabeparameter prfen
+		if (   (table == 0)
+				|| (numberOfChannels == 0)
+				|| (numberOfChannels > PROTECTION_NUMBER_OF_CMPSS)
+				|| (interruptPwm > PROTECTION_NUMBER_OF_PWM))
+		{
+				return false;
+		}
+		for (uint16_t i = 0; i < numberOfChannels; i++)
+		{
+				const ProtectionChannelConfig *channel = &table[i];
+				// Gltiges CMPSS-Modul, mindestens ein Komparator
+				// und mindestens ein ePWM-Modul ausgewhlt
+				if (   (channel->cmpss < PROTECTION_CMPSS1)
+						|| (channel->cmpss > PROTECTION_CMPSS8)
+						|| !(channel->comparators & PROTECTION_COMP_BOTH)
+						|| (channel->epwmMask == 0))
+				{
+						return false;
+				}
+				// Der Ausgang der ePWM X-Bar muss existieren (TRIP6 geht
+				// nicht ber die X-Bar, TRIP1 ... 3 sind die TZ-Eingnge)
+				if (   (channel->xbarTrip < PROTECTION_XBAR_TRIP4)
+						|| (channel->xbarTrip > PROTECTION_XBAR_TRIP12)
+						|| (channel->xbarTrip == 6))
+				{
+						return false;
+				}
+				// Digitalfilter: Die Mehrheitsentscheidung ist nur gltig, wenn
+				// die Schwelle grer als die Hlfte des Abtastfensters ist
+				// (siehe CMPSS Digital Filter, Reference Manual TMS320F2838x)
+				if (   (channel->filterSampleWindow == 0)
+						|| (channel->filterSampleWindow > PROTECTION_FILTER_WINDOW_MAX)
+						|| (channel->filterThreshold > channel->filterSampleWindow)
+						|| ((2U * channel->filterThreshold) <= channel->filterSampleWindow)
+						|| (channel->filterPrescale > PROTECTION_FILTER_PRESCALE_MAX))
+				{
+						return false;
+				}
+				// Rampengenerator kann nur von ePWM1 ... ePWM16 gestartet werden
+				if (   (channel->rampSource > PROTECTION_NUMBER_OF_PWM)
+						|| (channel->loadMode > PROTECTION_LOAD_PWMSYNC))
+				{
+						return false;
+				}
+				// Der obere Grenzwert muss ber dem unteren liegen
+				if (!(channel->limitHigh > channel->limitLow))
+				{
+						return false;
+				}
+				// CBC-Modus: Gltiger Lschzeitpunkt und gltiges Austastfenster
+				if (   (channel->tripMode > PROTECTION_TRIP_CBC)
+						|| (   (channel->tripMode == PROTECTION_TRIP_CBC)
+								&& (   (channel->cbcClear > PROTECTION_CBC_CLEAR_ZERO_PERIOD)
+										|| (channel->blankingStart > PROTECTION_BLANKING_AT_ZERO)
+										|| (channel->blankingWindow > PROTECTION_BLANKING_WINDOW_MAX))))
+				{
+						return false;
+				}
+				for (uint16_t j = 0; j < i; j++)
+				{
+						// Jedes CMPSS-Modul darf nur einmal in der Tabelle vorkommen
+						if (table[j].cmpss == channel->cmpss)
+						{
+								return false;
+						}
+						// Ein X-Bar-Ausgang kann nur OST- oder nur CBC-Kanle fhren
+						if (   (table[j].xbarTrip == channel->xbarTrip)
+								&& (table[j].tripMode != channel->tripMode))
+						{
+								return false;
+						}
+						// CBC-Kanle eines ePWM-Moduls teilen sich ein Austastfenster
+						if (   (channel->tripMode == PROTECTION_TRIP_CBC)
+								&& (table[j].tripMode == PROTECTION_TRIP_CBC)
+								&& (table[j].epwmMask & channel->epwmMask)
+								&& (   (table[j].cbcClear != channel->cbcClear)
+										|| (table[j].blankingStart != channel->blankingStart)
+										|| (table[j].blankingOffset != channel->blankingOffset)
+										|| (table[j].blankingWindow != channel->blankingWindow)))
+						{
+								return false;
+						}
+				}
+				pwmMask |= channel->epwmMask;
+		}
+		// Das Interrupt-ePWM-Modul muss von der Tabelle verwendet werden
+		if (   (interruptPwm != PROTECTION_NO_INTERRUPT)
+				&& !(pwmMask & PROTECTION_EPWM(interruptPwm)))
+		{
+				return false;
+		}
+
+		// Tabelle bernehmen
+		protectionTable            = table;
+		protectionNumberOfChannels = numberOfChannels;
+		protectionPwmMask          = pwmMask;
+		protectionInterruptPwm     = interruptPwm;
+		protectionTripSource       = 0;
+		protectionTripCount        = 0;
+		protectionCbcCount         = 0;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Noch ggf. aktive Signalquellen der verwendeten X-Bar-Ausgnge sperren.
+		// Das muss vor dem Routing aller Kanle geschehen, da sich mehrere
+		// Kanle einen Ausgang teilen knnen (die Signale werden verodert)
+		for (uint16_t i = 0; i < numberOfChannels; i++)
+		{
+				switch (table[i].xbarTrip)
+				{
+						case PROTECTION_XBAR_TRIP4:  EPwmXbarRegs.TRIP4MUXENABLE.all  = 0; break;
+						case PROTECTION_XBAR_TRIP5:  EPwmXbarRegs.TRIP5MUXENABLE.all  = 0; break;
+						case PROTECTION_XBAR_TRIP7:  EPwmXbarRegs.TRIP7MUXENABLE.all  = 0; break;
+						case PROTECTION_XBAR_TRIP8:  EPwmXbarRegs.TRIP8MUXENABLE.all  = 0; break;
+						case PROTECTION_XBAR_TRIP9:  EPwmXbarRegs.TRIP9MUXENABLE.all  = 0; break;
+						case PROTECTION_XBAR_TRIP10: EPwmXbarRegs.TRIP10MUXENABLE.all = 0; break;
+						case PROTECTION_XBAR_TRIP11: EPwmXbarRegs.TRIP11MUXENABLE.all = 0; break;
+						default:                     EPwmXbarRegs.TRIP12MUXENABLE.all = 0; break;
+				}
+		}
+
+		// Komparator-Subsysteme konfigurieren und Ausgnge auf die ePWM X-Bar legen
+		for (uint16_t i = 0; i < numberOfChannels; i++)
+		{
+				const ProtectionChannelConfig *channel = &table[i];
+				ProtectionInitCmpss(channel);
+				// Die Multiplexer der ePWM X-Bar sind den CMPSS-Modulen fest zugeordnet
+				// (siehe S. 2142 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022):
+				// MUX 2*(n-1)  : CMPSSn.CTRIPH (Auswahl 0)
+				// MUX 2*(n-1)+1: CMPSSn.CTRIPL (Auswahl 0)
+				if (channel->comparators & PROTECTION_COMP_HIGH)
+				{
+						ProtectionRouteXbar(channel->xbarTrip, 2U * (channel->cmpss - 1U));
+				}
+				if (channel->comparators & PROTECTION_COMP_LOW)
+				{
+						ProtectionRouteXbar(channel->xbarTrip, 2U * (channel->cmpss - 1U) + 1U);
+				}
+				// TRIP-Eingang bei allen zugeordneten ePWM-Modulen vermerken
+				for (uint16_t pwm = 0; pwm < PROTECTION_NUMBER_OF_PWM; pwm++)
+				{
+						if (channel->epwmMask & (1U << pwm))
+						{
+								if (channel->tripMode == PROTECTION_TRIP_CBC)
+								{
+										cbcTripMask[pwm] |= (1U << (channel->xbarTrip - 1U));
+										if (cbcChannel[pwm] == 0)
+										{
+												cbcChannel[pwm] = channel;
+										}
+								}
+								else
+								{
+										tripMask[pwm] |= (1U << (channel->xbarTrip - 1U));
+								}
+						}
+				}
+		}
+
+		// Digital-Compare- und Tripzone-Module der ePWM-Module konfigurieren
+		for (uint16_t pwm = 0; pwm < PROTECTION_NUMBER_OF_PWM; pwm++)
+		{
+				if (tripMask[pwm] || cbcTripMask[pwm])
+				{
+						ProtectionInitPwm(pwm + 1U, tripMask[pwm]);
+				}
+				if (cbcTripMask[pwm])
+				{
+						ProtectionInitPwmCbc(pwm + 1U, cbcTripMask[pwm], cbcChannel[pwm]);
+				}
+		}
+
+		// Tripzone-Interrupt einschalten
+		if (interruptPwm != PROTECTION_NO_INTERRUPT)
+		{
+				// Interrupt auslsen, wenn ein OST-Event auftritt. Fr jedes
+				// Event wird immer der gleiche Interrupt ausgelst (EPWMxTZINT)
+				protectionPwmRegs[interruptPwm - 1U]->TZEINT.bit.OST = PWM_DC_OST_INT_ENABLE;
+				// CPU-Interrupts whrend der Konfiguration global sperren
+				DINT;
+				// Bei CBC-Kanlen zustzlich einen Interrupt pro Periode mit aktiver
+				// Strombegrenzung auslsen (Zhler "protectionCbcCount"). Der ePWM-Interrupt
+				// am Lschzeitpunkt des CBC-Trips gibt den CBC-Interrupt nach jedem Event
+				// wieder frei, er wird erst in der Trip-ISR eingeschaltet
+				if (cbcTripMask[interruptPwm - 1U])
+				{
+						volatile struct EPWM_REGS *regs = protectionPwmRegs[interruptPwm - 1U];
+						regs->TZEINT.bit.CBC = PWM_DC_INT_ENABLE;
+						// Lschzeitpunkt: CTR = 0, CTR = PRD oder beide (wie TZCLR.CBCPULSE)
+						switch (cbcChannel[interruptPwm - 1U]->cbcClear)
+						{
+								case PROTECTION_CBC_CLEAR_PERIOD:
+										regs->ETSEL.bit.INTSEL = PWM_ET_CTR_PRD;
+										break;
+								case PROTECTION_CBC_CLEAR_ZERO_PERIOD:
+										regs->ETSEL.bit.INTSEL = PWM_ET_CTR_PRDZERO;
+										break;
+								default:
+										regs->ETSEL.bit.INTSEL = PWM_ET_CTR_ZERO;
+										break;
+						}
+						regs->ETPS.bit.INTPRD = PWM_ET_1ST;
+						regs->ETSEL.bit.INTEN = PWM_ET_INT_DISABLE;
+						regs->ETCLR.bit.INT   = 1;
+						*protectionPwmVectors[interruptPwm - 1U] = &ProtectionCbcPeriodISR;
+						// EPWMx-Interrupt freischalten (Zeile 3, Spalte x der Tabelle 3-2)
+						PieCtrlRegs.PIEIER3.all |= (1U << (interruptPwm - 1U));
+						IER |= M_INT3;
+				}
+				// Interrupt-Service-Routine fr den TZ-Interrupt an die
+				// entsprechende Stelle der PIE-Vector Table speichern
+				*protectionTzVectors[interruptPwm - 1U] = &ProtectionTripISR;
+				// EPWMx-TZ-Interrupt freischalten (Zeile 2, Spalte x der Tabelle 3-2)
+				// (siehe S. 150 Reference Manual TMS320F2838x , SPRUII0D, Rev. D, July 2022)
+				PieCtrlRegs.PIEIER2.all |= (1U << (interruptPwm - 1U));
+				// CPU-Interrupt 2 einschalten (Zeile 2 der Tabelle)
+				IER |= M_INT2;
+				// CPU-Interrupts nach Konfiguration global wieder freigeben
+				EINT;
+		}
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: ProtectionInitCmpss ===============================================================
+///
+/// @brief  Funktion konfiguriert ein Komparator-Subsystem entsprechend dem bergebenen Tabellen-
+///					eintrag. Der High-Komparator vergleicht den Analogeingang mit DACHVALS (oder dem
+///					Rampengenerator), der Low-Komparator (invertiert) mit DACLVALS. Das EPWMSYNCPER-
+///					Signal fr den Rampengenerator und fr PROTECTION_LOAD_PWMSYNC kommt vom ePWM-Modul
+///					"rampSource" bzw. ohne Rampe vom ersten ePWM-Modul aus "epwmMask". Die Grenzwerte
+///					werden bei der Initialisierung sofort bernommen. Beide Ausgnge
+///					werden ber das Digitalfilter (Mehrheitsentscheidung im Abtastfenster) auf die
+///					ePWM X-Bar gefhrt. Dadurch lsen kurze Strimpulse (z.B. beim Schalten der
+///					Leistungshalbleiter) keinen Trip aus.
+///
+/// @param  const ProtectionChannelConfig *channel
+///
+/// @return void
+///
+//=================================================================================================
+void ProtectionInitCmpss(const ProtectionChannelConfig *channel)
+{
+		volatile struct CMPSS_REGS *cmpss = protectionCmpssRegs[channel->cmpss - 1U];
+		uint16_t dacHigh = ProtectionLimitToDac(channel, channel->limitHigh);
+		uint16_t dacLow  = ProtectionLimitToDac(channel, channel->limitLow);
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Takt fr das CMPSS-Modul einschalten (PCLKCR14: Bit n-1 = CMPSSn) und
+		// 5 Takte warten, bis der Takt zum Modul durchgestellt ist
+		// (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		CpuSysRegs.PCLKCR14.all |= (1UL << (channel->cmpss - 1U));
+		__asm(" RPT #4 || NOP");
+
+		// Komparatorsystem einschalten
+		cmpss->COMPCTL.bit.COMPDACE = 1;
+		// VDDA als Referenzspannung fr die DACs setzen
+		cmpss->COMPDACCTL.bit.SELREF = 0;
+		// Shadow-Register DACHVALS und DACLVALS bei der Initialisierung sofort bernehmen
+		// (SYSCLK), sonst blieben die DACs bis zum ersten EPWMSYNCPER-Signal auf 0
+		cmpss->COMPDACCTL.bit.SWLOADSEL = PROTECTION_LOAD_SYSCLK;
+		// Hysterese einstellen
+		cmpss->COMPHYSCTL.bit.COMPHYS = channel->hysteresis;
+
+		// High-Komparator konfigurieren:
+		// DAC an den invertierenden Eingang des Komparators anlegen
+		cmpss->COMPCTL.bit.COMPHSOURCE = 0;
+		// Ausgang nicht invertieren (High-Pegel bei berschreitung)
+		cmpss->COMPCTL.bit.COMPHINV = 0;
+		// Wert DAC setzen (12 Bit Shadow-Register)
+		cmpss->DACHVALS.bit.DACVAL = dacHigh;
+		// ePWM-Modul fr das EPWMSYNCPER-Signal (Rampengenerator und PROTECTION_LOAD_PWMSYNC):
+		// Startsignal der Rampe bzw. erstes abgeschaltetes ePWM-Modul (1 ... 16)
+		uint16_t syncPwm = channel->rampSource;
+		if (syncPwm == PROTECTION_RAMP_DISABLED)
+		{
+				syncPwm = 1;
+				while (!(channel->epwmMask & PROTECTION_EPWM(syncPwm)))
+				{
+						syncPwm++;
+				}
+		}
+		if (   (channel->rampSource != PROTECTION_RAMP_DISABLED)
+				|| (channel->loadMode == PROTECTION_LOAD_PWMSYNC))
+		{
+				// ePWM-Modul als Quelle whlen (0: EPWM1SYNCPER ... 15: EPWM16SYNCPER)
+				cmpss->COMPDACCTL.bit.RAMPSOURCE = syncPwm - 1U;
+				// EPWMSYNCPER-Signal des ePWM-Moduls bei CTR = 0 erzeugen, damit die Rampe
+				// (Slope-Kompensation) mit jeder Periode neu startet und die Shadow-Register
+				// am Periodenanfang bernommen werden. Der Takt des ePWM-Moduls muss dafr
+				// bereits eingeschaltet sein (sonst geht der Schreibzugriff verloren),
+				// "ProtectionInitPwm()" wird erst nach allen CMPSS-Modulen aufgerufen
+				CpuSysRegs.PCLKCR2.all |= (1UL << (syncPwm - 1U));
+				__asm(" RPT #4 || NOP");
+				protectionPwmRegs[syncPwm - 1U]->HRPCTL.bit.PWMSYNCSEL  = 1;
+				protectionPwmRegs[syncPwm - 1U]->HRPCTL.bit.PWMSYNCSELX = 0;
+		}
+		// Rampengenerator: Der Zhler RAMPSTS wird bei jedem EPWMSYNCPER-Signal des
+		// gewhlten ePWM-Moduls mit RAMPMAXREFS geladen und nach der Verzgerung RAMPDLYS
+		// mit jedem SYSCLK um RAMPDECVALS verringert. Der DAC-Wert ist RAMPSTS >> 4
+		// (siehe Ramp Generator, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		if (channel->rampSource != PROTECTION_RAMP_DISABLED)
+		{
+				// RAMPSTS aus dem Shadow-Register RAMPMAXREFS laden
+				cmpss->COMPDACCTL.bit.RAMPLOADSEL = 1;
+				cmpss->RAMPMAXREFS                = (dacHigh << 4);
+				cmpss->RAMPDECVALS                = channel->rampDecrement;
+				cmpss->RAMPDLYS.bit.DELAY         = channel->rampDelay;
+				// DAC-Wert vom Rampengenerator bernehmen
+				// 0: DAC-Wert wird gesetzt durch Register DACHVALS
+				// 1: DAC-Wert wird gesetzt vom Rampengenerator
+				cmpss->COMPDACCTL.bit.DACSOURCE = 1;
+		}
+		else
+		{
+				cmpss->COMPDACCTL.bit.DACSOURCE = 0;
+		}
+		// Digitalfilter: Abtasttakt = SYSCLK / (CLKPRESCALE + 1). Der Filterausgang
+		// wechselt, sobald mindestens THRESH+1 der letzten SAMPWIN+1 Abtastwerte
+		// den neuen Pegel haben
+		cmpss->CTRIPHFILCLKCTL.bit.CLKPRESCALE = channel->filterPrescale;
+		cmpss->CTRIPHFILCTL.bit.SAMPWIN        = channel->filterSampleWindow - 1U;
+		cmpss->CTRIPHFILCTL.bit.THRESH         = channel->filterThreshold - 1U;
+		// Filter mit dem aktuellen Komparatorwert initialisieren
+		cmpss->CTRIPHFILCTL.bit.FILINIT        = 1;
+		// Gefiltertes Komparator-Ausgangssignal zu der ePWM X-Bar
+		// und der Output X-Bar fhren
+		// 0: Asynchron, 1: Synchron zu SYSCLK, 2: Gefiltert, 3: Gefiltert + Latch
+		cmpss->COMPCTL.bit.CTRIPHSEL    = 2;
+		cmpss->COMPCTL.bit.CTRIPOUTHSEL = 2;
+
+		// Low-Komparator konfigurieren:
+		// DAC an den invertierenden Eingang des Komparators anlegen
+		cmpss->COMPCTL.bit.COMPLSOURCE = 0;
+		// Ausgang invertieren (High-Pegel bei Unterschreitung), damit High- und
+		// Low-Komparator in der ePWM X-Bar verodert werden knnen
+		cmpss->COMPCTL.bit.COMPLINV = 1;
+		// Wert DAC setzen (12 Bit Shadow-Register)
+		cmpss->DACLVALS.bit.DACVAL = dacLow;
+		// Digitalfilter (gleiche Einstellungen wie High-Komparator)
+		cmpss->CTRIPLFILCLKCTL.bit.CLKPRESCALE = channel->filterPrescale;
+		cmpss->CTRIPLFILCTL.bit.SAMPWIN        = channel->filterSampleWindow - 1U;
+		cmpss->CTRIPLFILCTL.bit.THRESH         = channel->filterThreshold - 1U;
+		cmpss->CTRIPLFILCTL.bit.FILINIT        = 1;
+		// Gefiltertes Komparator-Ausgangssignal zu der ePWM X-Bar fhren
+		cmpss->COMPCTL.bit.CTRIPLSEL    = 2;
+		cmpss->COMPCTL.bit.CTRIPOUTLSEL = 2;
+
+		// bernahme der Shadow-Register DACHVALS und DACLVALS bei spteren nderungen
+		// 0: Wert bei jedem SYSCLK bernehmen
+		// 1: Wert bei EPWMSYNCPER bernehmen
+		cmpss->COMPDACCTL.bit.SWLOADSEL = channel->loadMode;
+
+		// Latch-Bits beider Komparatoren lschen. Diese werden vom Filter-
+		// ausgang gesetzt und dienen zur Identifikation der Trip-Quelle
+		cmpss->COMPSTSCLR.bit.HLATCHCLR = 1;
+		cmpss->COMPSTSCLR.bit.LLATCHCLR = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: ProtectionRouteXbar ===============================================================
+///
+/// @brief  Funktion legt das Signal mit der Auswahl 0 des Multiplexers "mux" (0 ... 15) auf den
+///					Ausgang "xbarTrip" der ePWM X-Bar (= TRIPINx der ePWM-Module). Bereits freigegebene
+///					Multiplexer bleiben freigegeben, die Signale werden verodert. Der Ausgang wird
+///					nicht invertiert (active-high).
+///
+/// @param  uint16_t xbarTrip, uint16_t mux
+///
+/// @return void
+///
+//=================================================================================================
+void ProtectionRouteXbar(uint16_t xbarTrip,
+												 uint16_t mux)
+{
+		volatile uint32_t *muxConfig;
+		volatile uint32_t *muxEnable;
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Register des gewhlten Ausgangs auswhlen und den Ausgang nicht invertieren
+		switch (xbarTrip)
+		{
+				case PROTECTION_XBAR_TRIP4:
+						muxConfig = &EPwmXbarRegs.TRIP4MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP4MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP4 = 0;
+						break;
+				case PROTECTION_XBAR_TRIP5:
+						muxConfig = &EPwmXbarRegs.TRIP5MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP5MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP5 = 0;
+						break;
+				case PROTECTION_XBAR_TRIP7:
+						muxConfig = &EPwmXbarRegs.TRIP7MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP7MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP7 = 0;
+						break;
+				case PROTECTION_XBAR_TRIP8:
+						muxConfig = &EPwmXbarRegs.TRIP8MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP8MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP8 = 0;
+						break;
+				case PROTECTION_XBAR_TRIP9:
+						muxConfig = &EPwmXbarRegs.TRIP9MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP9MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP9 = 0;
+						break;
+				case PROTECTION_XBAR_TRIP10:
+						muxConfig = &EPwmXbarRegs.TRIP10MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP10MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP10 = 0;
+						break;
+				case PROTECTION_XBAR_TRIP11:
+						muxConfig = &EPwmXbarRegs.TRIP11MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP11MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP11 = 0;
+						break;
+				default:
+						muxConfig = &EPwmXbarRegs.TRIP12MUX0TO15CFG.all;
+						muxEnable = &EPwmXbarRegs.TRIP12MUXENABLE.all;
+						EPwmXbarRegs.TRIPOUTINV.bit.TRIP12 = 0;
+						break;
+		}
+		// Auswahl 0 des Multiplexers setzen (2 Bit pro Multiplexer)
+		*muxConfig &= ~(3UL << (2U * mux));
+		// Eingangssignal des Multiplexers freigeben
+		*muxEnable |= (1UL << mux);
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: ProtectionInitPwm =================================================================
+///
+/// @brief  Funktion konfiguriert das Digital-Compare- und Tripzone-Modul des ePWM-Moduls "pwm"
+///					(1 ... 16). Alle TRIP-Eingnge aus "xbarTripMask" (Bit x-1 = TRIPINx) werden
+///					verodert als DCAH-Signal verwendet. Ist DCAH high, wird das DCAEVT1-Event als
+///					One-Shot-Trip ausgelst und beide PWM-Pins werden auf Low-Pegel gesetzt, bis der
+///					Trip ber "ProtectionClearTrip()" quittiert wird. Die Konfiguration des Zeit-
+///					gebers und der Action-Qualifier wird nicht verndert.
+///
+/// @param  uint16_t pwm, uint16_t xbarTripMask
+///
+/// @return void
+///
+//=================================================================================================
+void ProtectionInitPwm(uint16_t pwm,
+											 uint16_t xbarTripMask)
+{
+		volatile struct EPWM_REGS *regs = protectionPwmRegs[pwm - 1U];
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Takt fr das ePWM-Modul einschalten (PCLKCR2: Bit n-1 = EPWMn) und
+		// 5 Takte warten, bis der Takt zum Modul durchgestellt ist
+		// (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		CpuSysRegs.PCLKCR2.all |= (1UL << (pwm - 1U));
+		__asm(" RPT #4 || NOP");
+
+		// Alle gewhlten TRIP-Eingnge verodert als DCAH-Signal verwenden
+		// (siehe S. 2917 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		regs->DCAHTRIPSEL.all           = xbarTripMask;
+		regs->DCTRIPSEL.bit.DCAHCOMPSEL = PWM_DC_TRIP_COMBINATION;
+		// Event DCAEVT1 auslsen, wenn das DCAH-Signal high ist (nur bei OST-Kanlen)
+		regs->TZDCSEL.bit.DCAEVT1 = xbarTripMask ? PWM_DC_DCXH_HIGH : PWM_DC_EVENT_DISABLED;
+		// Ungefiltertes DCAEVT1-Signal verwenden (die Filterung
+		// erfolgt bereits im Digitalfilter des CMPSS-Moduls)
+		regs->DCACTL.bit.EVT1SRCSEL = PWM_DC_RAW_EVENT;
+		// DCAEVT1-Signal asynchron zu SYSCLK und ohne Flip-Flop verwenden
+		regs->DCACTL.bit.EVT1FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
+		regs->DCACTL.bit.EVT1LATSEL     = PWM_DC_EVENT_UNLATCHED;
+		// Tripzone-Einstellungen aus dem TZCTL-Register benutzen
+		regs->TZCTL2.bit.ETZE = PWM_TZ_CONFIG_BY_TZCTL;
+		// DCAEVT1-Signal als One-Shot-Trip Quelle setzen
+		regs->TZSEL.bit.DCAEVT1 = PWM_TZ_ENABLE;
+		// Bei einem Trip beide PWM-Pins auf Low-Pegel setzen
+		regs->TZCTL.bit.TZA = PWM_TZ_FORCE_LO;
+		regs->TZCTL.bit.TZB = PWM_TZ_FORCE_LO;
+		// Evtl. gesetzte Flags aus der Initialisierung lschen
+		regs->TZCLR.bit.DCAEVT1 = 1;
+		regs->TZCLR.bit.OST     = 1;
+		regs->TZCLR.bit.INT     = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: ProtectionInitPwmCbc ==============================================================
+///
+/// @brief  Funktion konfiguriert den Cycle-by-Cycle-Trip des ePWM-Moduls "pwm" (1 ... 16). Alle
+///					TRIP-Eingnge aus "xbarTripMask" (Bit x-1 = TRIPINx) werden verodert als DCBH-
+///					Signal verwendet. Ist DCBH high, wird das DCBEVT2-Event als CBC-Trip ausgelst
+///					und beide PWM-Pins werden bis zum nchsten CBC-Lschzeitpunkt ("cbcClear") auf
+///					Low-Pegel gesetzt. Damit wird der Spitzenstrom in jeder Periode ohne CPU-Beteili-
+///					gung begrenzt. Das DCBEVT2-Signal luft ber das Austastfenster (Blanking) des
+///					Digital-Compare-Moduls: Das Fenster startet "blankingOffset" TBCLK nach dem
+///					gewhlten Zeitpunkt (CTR = 0 oder CTR = PRD) und ist "blankingWindow" TBCLK lang.
+///					Innerhalb des Fensters wird das Signal ignoriert, z.B. die Stromspitze beim
+///					Einschalten des Leistungshalbleiters (Reverse Recovery, Umladen von Kapazitten).
+///					Die Funktion muss nach "ProtectionInitPwm()" aufgerufen werden.
+///
+/// @param  uint16_t pwm, uint16_t xbarTripMask, const ProtectionChannelConfig *channel
+///
+/// @return void
+///
+//=================================================================================================
+void ProtectionInitPwmCbc(uint16_t pwm,
+													uint16_t xbarTripMask,
+													const ProtectionChannelConfig *channel)
+{
+		volatile struct EPWM_REGS *regs = protectionPwmRegs[pwm - 1U];
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Alle gewhlten TRIP-Eingnge verodert als DCBH-Signal verwenden
+		regs->DCBHTRIPSEL.all           = xbarTripMask;
+		regs->DCTRIPSEL.bit.DCBHCOMPSEL = PWM_DC_TRIP_COMBINATION;
+		// Event DCBEVT2 auslsen, wenn das DCBH-Signal high ist
+		regs->TZDCSEL.bit.DCBEVT2 = PWM_DC_DCXH_HIGH;
+		// DCBEVT2-Signal asynchron zu SYSCLK und ohne Flip-Flop verwenden
+		regs->DCBCTL.bit.EVT2FRCSYNCSEL = PWM_DC_EVENT_ASYNC;
+		regs->DCBCTL.bit.EVT2LATSEL     = PWM_DC_EVENT_UNLATCHED;
+
+		// Austastfenster konfigurieren (siehe Digital Compare Event Filtering,
+		// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+		if (channel->blankingWindow != PROTECTION_BLANKING_DISABLED)
+		{
+				// DCBEVT2 als Eingangssignal des Filters whlen
+				// 0: DCAEVT1, 1: DCAEVT2, 2: DCBEVT1, 3: DCBEVT2
+				regs->DCFCTL.bit.SRCSEL   = 3;
+				// Startzeitpunkt des Fensters (0: CTR = PRD, 1: CTR = 0)
+				regs->DCFCTL.bit.PULSESEL = channel->blankingStart;
+				// Signal innerhalb (nicht auerhalb) des Fensters ausblenden
+				regs->DCFCTL.bit.BLANKINV = 0;
+				// Verzgerung und Lnge des Fensters in TBCLK. DCFOFFSET wird
+				// ber ein Shadow-Register zum Startzeitpunkt bernommen
+				regs->DCFOFFSET = channel->blankingOffset;
+				regs->DCFWINDOW = channel->blankingWindow;
+				regs->DCFCTL.bit.BLANKE = 1;
+				// Gefiltertes DCBEVT2-Signal verwenden
+				regs->DCBCTL.bit.EVT2SRCSEL = PWM_DC_FILTERED_EVENT;
+		}
+		else
+		{
+				regs->DCFCTL.bit.BLANKE     = 0;
+				regs->DCBCTL.bit.EVT2SRCSEL = PWM_DC_RAW_EVENT;
+		}
+
+		// CBC-Trip automatisch lschen (0: CTR = 0, 1: CTR = PRD, 2: CTR = 0 oder CTR = PRD)
+		regs->TZCLR.bit.CBCPULSE = channel->cbcClear;
+		// DCBEVT2-Signal als Cycle-by-Cycle-Trip Quelle setzen. Die Aktion bei
+		// einem Trip (beide PWM-Pins auf Low-Pegel) ist in TZCTL bereits gesetzt
+		regs->TZSEL.bit.DCBEVT2 = PWM_TZ_ENABLE;
+		// Evtl. gesetzte Flags aus der Initialisierung lschen
+		regs->TZCBCCLR.bit.DCBEVT2 = 1;
+		regs->TZCLR.bit.DCBEVT2    = 1;
+		regs->TZCLR.bit.CBC        = 1;
+		regs->TZCLR.bit.INT        = 1;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: ProtectionSetBlanking =============================================================
+///
+/// @brief  Funktion ndert Verzgerung und Lnge des Austastfensters des ePWM-Moduls "pwm"
+///					(1 ... 16) zur Laufzeit, z.B. um das Fenster einer genderten Einschaltflanke (CMPA)
+///					nachzufhren. Die Verzgerung wird ber das Shadow-Register zum nchsten Start-
+///					zeitpunkt bernommen. Die Funktion gibt "false" zurck, falls das ePWM-Modul keinen
+///					CBC-Kanal mit Austastfenster besitzt oder die Lnge ungltig ist.
+///
+/// @param  uint16_t pwm, uint16_t blankingOffset, uint16_t blankingWindow
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool ProtectionSetBlanking(uint16_t pwm,
+													 uint16_t blankingOffset,
+													 uint16_t blankingWindow)
+{
+		if (   (pwm == 0)
+				|| (pwm > PROTECTION_NUMBER_OF_PWM)
+				|| (blankingWindow == PROTECTION_BLANKING_DISABLED)
+				|| (blankingWindow > PROTECTION_BLANKING_WINDOW_MAX)
+				|| !protectionPwmRegs[pwm - 1U]->DCFCTL.bit.BLANKE)
+		{
+				return false;
+		}
+		volatile struct EPWM_REGS *regs = protectionPwmRegs[pwm - 1U];
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		regs->DCFOFFSET = blankingOffset;
+		regs->DCFWINDOW = blankingWindow;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: ProtectionLimitToDac ==============================================================
+///
+/// @brief  Funktion rechnet einen Grenzwert in physikalischen Einheiten ber die Skalierung des
+///					Kanals in einen 12-Bit DAC-Wert um (gerundet und auf 0 ... 4095 begrenzt):
+///
+///					DAC = (offset + scale * limit) / 3,3 V * 4095
+///
+/// @param  const ProtectionChannelConfig *channel, float limit
+///
+/// @return uint16_t dacValue
+///
+//=================================================================================================
+uint16_t ProtectionLimitToDac(const ProtectionChannelConfig *channel,
+															float limit)
+{
+		float dacValue = ((channel->offset + channel->scale * limit) / PROTECTION_DAC_VREF)
+									 * (float)PROTECTION_DAC_MAX;
+		// Wert begrenzen
+		if (dacValue <= 0.0f)
+		{
+				return 0;
+		}
+		if (dacValue >= (float)PROTECTION_DAC_MAX)
+		{
+				return PROTECTION_DAC_MAX;
+		}
+		return (uint16_t)(dacValue + 0.5f);
+}
+
+
+//=== Function: ProtectionSetLimits ===============================================================
+///
+/// @brief  Funktion ndert die Grenzwerte des Kanals "channelIndex" (Index in der Tabelle) zur
+///					Laufzeit. Die Werte werden in die Shadow-Register DACHVALS/DACLVALS (bzw. bei
+///					aktivem Rampengenerator in RAMPMAXREFS) geschrieben und abhngig von "loadMode"
+///					sofort oder mit dem nchsten EPWMSYNCPER-Signal bernommen. Nicht aktive Kompara-
+///					toren werden ebenfalls aktualisiert. Die Funktion gibt "false" zurck, falls der
+///					Index ungltig ist oder "limitHigh" nicht grer als "limitLow" ist.
+///
+/// @param  uint16_t channelIndex, float limitHigh, float limitLow
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool ProtectionSetLimits(uint16_t channelIndex,
+												 float limitHigh,
+												 float limitLow)
+{
+		if (   (channelIndex >= protectionNumberOfChannels)
+				|| !(limitHigh > limitLow))
+		{
+				return false;
+		}
+		const ProtectionChannelConfig *channel = &protectionTable[channelIndex];
+		volatile struct CMPSS_REGS *cmpss = protectionCmpssRegs[channel->cmpss - 1U];
+		uint16_t dacHigh = ProtectionLimitToDac(channel, limitHigh);
+		uint16_t dacLow  = ProtectionLimitToDac(channel, limitLow);
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		if (channel->rampSource != PROTECTION_RAMP_DISABLED)
+		{
+				cmpss->RAMPMAXREFS = (dacHigh << 4);
+		}
+		else
+		{
+				cmpss->DACHVALS.bit.DACVAL = dacHigh;
+		}
+		cmpss->DACLVALS.bit.DACVAL = dacLow;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: ProtectionGetComparatorLatches ====================================================
+///
+/// @brief  Funktion liest die Latch-Bits (COMPSTS.COMPHLATCH/COMPLLATCH) aller aktiven Komparatoren
+///					der Tabelle und gibt diese als Bitmaske zurck (siehe PROTECTION_SOURCE_HIGH() und
+///					PROTECTION_SOURCE_LOW()). Die Latch-Bits werden vom Ausgang des Digitalfilters
+///					gesetzt und bleiben gesetzt, bis sie ber "ProtectionClearTrip()" gelscht werden.
+///
+/// @param  void
+///
+/// @return uint16_t latches
+///
+//=================================================================================================
+uint16_t ProtectionGetComparatorLatches(void)
+{
+		uint16_t latches = 0;
+		for (uint16_t i = 0; i < protectionNumberOfChannels; i++)
+		{
+				const ProtectionChannelConfig *channel = &protectionTable[i];
+				volatile struct CMPSS_REGS *cmpss = protectionCmpssRegs[channel->cmpss - 1U];
+				if (   (channel->comparators & PROTECTION_COMP_HIGH)
+						&& cmpss->COMPSTS.bit.COMPHLATCH)
+				{
+						latches |= PROTECTION_SOURCE_HIGH(channel->cmpss);
+				}
+				if (   (channel->comparators & PROTECTION_COMP_LOW)
+						&& cmpss->COMPSTS.bit.COMPLLATCH)
+				{
+						latches |= PROTECTION_SOURCE_LOW(channel->cmpss);
+				}
+		}
+		return latches;
+}
+
+
+//=== Function: ProtectionGetTripSource ==========================================================
+///
+/// @brief  Funktion gibt die Komparatoren zurck, die seit dem letzten Aufruf von
+///					"ProtectionClearTrip()" einen Trip ausgelst haben. Ohne Trip-Interrupt werden
+///					die Latch-Bits direkt gelesen.
+///
+/// @param  void
+///
+/// @return uint16_t protectionTripSource
+///
+//=================================================================================================
+uint16_t ProtectionGetTripSource(void)
+{
+		if (protectionInterruptPwm == PROTECTION_NO_INTERRUPT)
+		{
+				protectionTripSource |= ProtectionGetComparatorLatches();
+		}
+		return protectionTripSource;
+}
+
+
+//=== Function: ProtectionGetCbcCount =============================================================
+///
+/// @brief  Funktion gibt die Anzahl der Perioden des Interrupt-ePWM-Moduls zurck, in denen die
+///					Strombegrenzung (CBC-Trip) aktiv war. Da ein CBC-Trip die PWM-Pins bis zum Ende
+///					der Periode abschaltet, wird pro Periode hchstens ein Event gezhlt. Mit "reset"
+///					wird der Zhler nach dem Lesen gelscht, z.B. um die Anzahl pro Zeitintervall zu
+///					ermitteln.
+///
+/// @param  bool reset
+///
+/// @return uint32_t protectionCbcCount
+///
+//=================================================================================================
+uint32_t ProtectionGetCbcCount(bool reset)
+{
+		// CPU-Interrupts sperren, damit zwischen Lesen und Lschen kein Event verloren geht
+		// (vorherigen Zustand sichern, da die Funktion auch bei gesperrten Interrupts
+		// aufgerufen werden kann)
+		uint16_t interruptState = __disable_interrupts();
+		uint32_t count = protectionCbcCount;
+		if (reset)
+		{
+				protectionCbcCount = 0;
+		}
+		__restore_interrupts(interruptState);
+		return count;
+}
+
+
+//=== Function: ProtectionClearTrip ===============================================================
+///
+/// @brief  Funktion quittiert einen Trip: Die Latch-Bits der Komparatoren und die Trip-Flags
+///					(DCAEVT1, OST) aller betroffenen ePWM-Module werden gelscht, wodurch die PWM-Pins
+///					wieder vom ePWM-Signal gesteuert werden. Liegt an einem Komparator noch eine
+///					Grenzwertverletzung an (Filterausgang high), wird nichts verndert und "false"
+///					zurckgegeben.
+///
+/// @param  void
+///
+/// @return bool tripCleared
+///
+//=================================================================================================
+bool ProtectionClearTrip(void)
+{
+		// Prfen, ob noch ein Komparator aktiv ist
+		for (uint16_t i = 0; i < protectionNumberOfChannels; i++)
+		{
+				const ProtectionChannelConfig *channel = &protectionTable[i];
+				volatile struct CMPSS_REGS *cmpss = protectionCmpssRegs[channel->cmpss - 1U];
+				if (   ((channel->comparators & PROTECTION_COMP_HIGH) && cmpss->COMPSTS.bit.COMPHSTS)
+						|| ((channel->comparators & PROTECTION_COMP_LOW)  && cmpss->COMPSTS.bit.COMPLSTS))
+				{
+						return false;
+				}
+		}
+
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Latch-Bits der Komparatoren lschen
+		for (uint16_t i = 0; i < protectionNumberOfChannels; i++)
+		{
+				volatile struct CMPSS_REGS *cmpss = protectionCmpssRegs[protectionTable[i].cmpss - 1U];
+				cmpss->COMPSTSCLR.bit.HLATCHCLR = 1;
+				cmpss->COMPSTSCLR.bit.LLATCHCLR = 1;
+		}
+		// Trip-Flags aller betroffenen ePWM-Module lschen. Das
+		// Lschen von OST gibt die PWM-Pins wieder frei. Die CBC-Flags
+		// werden nur in der Trip-ISR gelscht und gezhlt, da ein CBC-Trip
+		// von der Hardware selbst beendet wird
+		for (uint16_t pwm = 0; pwm < PROTECTION_NUMBER_OF_PWM; pwm++)
+		{
+				if (protectionPwmMask & (1U << pwm))
+				{
+						protectionPwmRegs[pwm]->TZCLR.bit.DCAEVT1    = 1;
+						protectionPwmRegs[pwm]->TZCLR.bit.OST        = 1;
+						protectionPwmRegs[pwm]->TZCLR.bit.INT        = 1;
+				}
+		}
+		protectionTripSource = 0;
+
+		// Register-Schreibschutz setzen
+		EDIS;
+
+		return true;
+}
+
+
+//=== Function: ProtectionForceTrip ===============================================================
+///
+/// @brief  Funktion lst in allen ePWM-Modulen des Schutz-Managers per Software einen One-Shot-
+///					Trip aus (TZFRC.OST). Die PWM-Pins werden auf Low-Pegel gesetzt, bis der Trip ber
+///					"ProtectionClearTrip()" quittiert wird. Es wird kein Eintrag im Fehlerspeicher
+///					angelegt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void ProtectionForceTrip(void)
+{
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		for (uint16_t pwm = 0; pwm < PROTECTION_NUMBER_OF_PWM; pwm++)
+		{
+				if (protectionPwmMask & (1U << pwm))
+				{
+						protectionPwmRegs[pwm]->TZFRC.bit.OST = 1;
+				}
+		}
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: ProtectionTripISR =================================================================
+///
+/// @brief  ISR wird aufgerufen, wenn im Interrupt-ePWM-Modul ein One-Shot-Trip oder ein Cycle-by-
+///					Cycle-Trip auftritt. Bei einem One-Shot-Trip werden die auslsenden Komparatoren in
+///					"protectionTripSource" gespeichert und ein Eintrag im Fehlerspeicher ("myFaultLog.c")
+///					angelegt. Das OST-Flag bleibt gesetzt, d.h. die PWM-Pins bleiben auf Low-Pegel, bis
+///					der Trip ber "ProtectionClearTrip()" quittiert wird. Bei einem CBC-Trip wird nur
+///					der Zhler "protectionCbcCount" erhht, der Trip wird von der Hardware am Ende der
+///					Periode gelscht. Der CBC-Interrupt wird bis zum Lschzeitpunkt gesperrt (siehe
+///					"ProtectionCbcPeriodISR()"), sodass die ISR bei anhaltender Grenzwertverletzung
+///					hchstens einmal pro Periode aufgerufen wird.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void ProtectionTripISR(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht (siehe S. 148 Punkt 9, Reference Manual TMS320F2838x,
+		// SPRUII0D, Rev. D, July 2022). TZCLR ist schreibgeschtzt
+		EALLOW;
+
+		volatile struct EPWM_REGS *regs = protectionPwmRegs[protectionInterruptPwm - 1U];
+
+		// One-Shot-Trip (DCAEVT1)
+		if (regs->TZFLG.bit.DCAEVT1)
+		{
+				// Auslsende Komparatoren speichern
+				protectionTripSource |= ProtectionGetComparatorLatches();
+				protectionTripCount++;
+				// Eintrag im Fehlerspeicher anlegen (vor dem Lschen der Trip-Flags)
+				FaultLogCapture(protectionInterruptPwm, protectionTripSource);
+				// Trip an die Zustandsmaschine zur Wiederinbetriebnahme melden
+				RecoveryNotifyTrip();
+				// Trip-Flag des DCAEVT1-Events lschen
+				regs->TZCLR.bit.DCAEVT1 = 1;
+		}
+		// Cycle-by-Cycle-Trip (DCBEVT2): Liegt die Grenzwertverletzung noch an, wrden die
+		// Flags nach dem Lschen sofort wieder gesetzt. Der CBC-Interrupt wird daher bis zum
+		// Lschzeitpunkt gesperrt und dort vom ePWM-Interrupt wieder freigegeben
+		if (regs->TZFLG.bit.CBC && regs->TZEINT.bit.CBC)
+		{
+				protectionCbcCount++;
+				regs->TZEINT.bit.CBC       = PWM_DC_INT_DISABLE;
+				regs->TZCBCCLR.bit.DCBEVT2 = 1;
+				regs->TZCLR.bit.DCBEVT2    = 1;
+				regs->TZCLR.bit.CBC        = 1;
+				regs->ETCLR.bit.INT        = 1;
+				regs->ETSEL.bit.INTEN      = PWM_ET_INT_ENABLE;
+		}
+
+		// Allgemeines Trip-Flag lschen (ohne Lschen von INT wird kein weiterer Interrupt ausgelst)
+		regs->TZCLR.bit.INT = 1;
+		// Interrupt-Flag der Gruppe 2 lschen (da gehren die EPWMx-TZ-Interrupts zu)
+		PieCtrlRegs.PIEACK.bit.ACK2 = 1;
+}
+
+
+//=== Function: ProtectionCbcPeriodISR ============================================================
+///
+/// @brief  ISR wird am CBC-Lschzeitpunkt (CTR = 0 und/oder CTR = PRD) des Interrupt-ePWM-Moduls
+///					aufgerufen, nachdem in der abgelaufenen Periode ein CBC-Trip gezhlt wurde. Die in
+///					dieser Periode erneut gesetzten CBC-Flags werden gelscht und der CBC-Interrupt
+///					wieder freigegeben. Liegt die Grenzwertverletzung weiter an, wird das Flag sofort
+///					wieder gesetzt und die neue Periode in "ProtectionTripISR()" gezhlt. Danach wird
+///					der ePWM-Interrupt wieder gesperrt, er luft also nur in Perioden nach einem Event.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void ProtectionCbcPeriodISR(void)
+{
+		// TZCLR, TZCBCCLR und TZEINT sind schreibgeschtzt
+		EALLOW;
+
+		volatile struct EPWM_REGS *regs = protectionPwmRegs[protectionInterruptPwm - 1U];
+
+		// CBC-Flags der abgelaufenen Periode lschen und CBC-Interrupt wieder freigeben
+		regs->TZCBCCLR.bit.DCBEVT2 = 1;
+		regs->TZCLR.bit.DCBEVT2    = 1;
+		regs->TZCLR.bit.CBC        = 1;
+		regs->TZEINT.bit.CBC       = PWM_DC_INT_ENABLE;
+		// ePWM-Interrupt bis zum nchsten CBC-Event sperren
+		regs->ETSEL.bit.INTEN      = PWM_ET_INT_DISABLE;
+		regs->ETCLR.bit.INT        = 1;
+		// Interrupt-Flag der Gruppe 3 lschen (da gehren die EPWMx-Interrupts zu)
+		PieCtrlRegs.PIEACK.bit.ACK3 = 1;
+}
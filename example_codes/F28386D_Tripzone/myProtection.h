@@ -0,0 +1,235 @@
+//=================================================================================================
+/// @file       myProtection.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen tabellengesteuerten Schutz-Manager
+///							auf Basis der Komparator-Subsysteme CMPSS1 ... CMPSS8. Jeder Eintrag der ber-
+///							gebenen Tabelle beschreibt einen Schutzkanal (ein CMPSS-Modul): Grenzwerte in
+///							physikalischen Einheiten (z.B. Ampere), Skalierung des Sensors, Hysterese,
+///							Digitalfilter (Abtastfenster und Schwelle), optional den Rampengenerator und
+///							das Routing der Komparatorausgnge ber die ePWM X-Bar auf beliebige ePWM-
+///							Module. Die Komparatorausgnge werden in den ePWM-Modulen ber das Digital-
+///							Compare-Modul (DCAEVT1) als One-Shot-Trip verarbeitet, so dass alle Brcken-
+///							zweige ohne CPU-Beteiligung abgeschaltet werden. Die Grenzwerte knnen zur
+///							Laufzeit ber die Shadow-Register der DACs gendert werden. Im Trip-Interrupt
+///							wird ber die Latch-Bits der Komparatoren ermittelt, welcher Komparator den
+///							Trip ausgelst hat ("protectionTripSource").
+///
+///							Alternativ kann ein Kanal im Cycle-by-Cycle-Modus (CBC) betrieben werden, z.B.
+///							fr eine Spitzenstromregelung (Peak Current Mode): Der Komparatorausgang wird
+///							ber DCBEVT2 als CBC-Trip verarbeitet, d.h. die PWM-Pins werden nur bis zum
+///							Ende der aktuellen Periode (CTR = 0 und/oder CTR = PRD) abgeschaltet. Ein
+///							Austastfenster (Blanking), das mit der Periode des ePWM-Moduls synchronisiert
+///							ist, unterdrckt Stromspitzen beim Einschalten der Leistungshalbleiter. ber
+///							den Rampengenerator des CMPSS-Moduls kann eine Slope-Kompensation realisiert
+///							werden. Die Anzahl der Perioden mit aktiver Strombegrenzung wird im Interrupt
+///							gezhlt ("protectionCbcCount"). Damit der Tripzone-Interrupt bei anhaltender
+///							Grenzwertverletzung nicht dauernd erneut auslst, wird er nach dem ersten CBC-
+///							Event gesperrt und erst am Lschzeitpunkt ber den ePWM-Interrupt (EPWMx_INT)
+///							des Interrupt-ePWM-Moduls wieder freigegeben (hchstens ein Aufruf pro Periode).
+///
+///							Verkabelung (Beispiel in main.c):
+///							- ADCINA2/CMPIN1P an Mittelabgriff Poti (0 ... 3,3 V)
+///							- GPIO 0 und 1 an Oszilloskop
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYPROTECTION_H_
+#define MYPROTECTION_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myTripzone.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Komparator-Subsysteme und ePWM-Module
+#define PROTECTION_NUMBER_OF_CMPSS					8
+#define PROTECTION_NUMBER_OF_PWM						16
+// Komparator-Subsysteme
+#define PROTECTION_CMPSS1										1
+#define PROTECTION_CMPSS2										2
+#define PROTECTION_CMPSS3										3
+#define PROTECTION_CMPSS4										4
+#define PROTECTION_CMPSS5										5
+#define PROTECTION_CMPSS6										6
+#define PROTECTION_CMPSS7										7
+#define PROTECTION_CMPSS8										8
+// Aktive Komparatoren eines Kanals
+#define PROTECTION_COMP_HIGH								0x01
+#define PROTECTION_COMP_LOW									0x02
+#define PROTECTION_COMP_BOTH								(PROTECTION_COMP_HIGH | PROTECTION_COMP_LOW)
+// Referenzspannung und Auflsung der Komparator-DACs (VDDA als Referenz)
+#define PROTECTION_DAC_VREF									3.3f
+#define PROTECTION_DAC_MAX									4095
+// Hysterese der Komparatoren (Vielfache der typ. Hysterese, siehe COMPHYSCTL)
+#define PROTECTION_HYSTERESIS_NONE					0
+#define PROTECTION_HYSTERESIS_1X						1
+#define PROTECTION_HYSTERESIS_2X						2
+#define PROTECTION_HYSTERESIS_3X						3
+#define PROTECTION_HYSTERESIS_4X						4
+// Grenzen des Digitalfilters (Abtastfenster 1 ... 32 Abtastungen,
+// Schwelle muss grer als die Hlfte des Abtastfensters sein)
+#define PROTECTION_FILTER_WINDOW_MAX				32
+#define PROTECTION_FILTER_PRESCALE_MAX			1023
+// bernahme der Shadow-Register (DACHVALS/DACLVALS, RAMPMAXREFS)
+#define PROTECTION_LOAD_SYSCLK							0
+#define PROTECTION_LOAD_PWMSYNC							1
+// Rampengenerator aus (sonst Nummer des ePWM-Moduls 1 ... 16, dessen
+// EPWMSYNCPER-Signal den Rampengenerator startet)
+#define PROTECTION_RAMP_DISABLED						0
+// Ausgnge der ePWM X-Bar (= TRIPINx der ePWM-Module), auf
+// welche die Komparatorausgnge gelegt werden knnen
+#define PROTECTION_XBAR_TRIP4								4
+#define PROTECTION_XBAR_TRIP5								5
+#define PROTECTION_XBAR_TRIP7								7
+#define PROTECTION_XBAR_TRIP8								8
+#define PROTECTION_XBAR_TRIP9								9
+#define PROTECTION_XBAR_TRIP10							10
+#define PROTECTION_XBAR_TRIP11							11
+#define PROTECTION_XBAR_TRIP12							12
+// Kein ePWM-Modul fr den Trip-Interrupt
+#define PROTECTION_NO_INTERRUPT							0
+// Verhalten bei einer Grenzwertverletzung
+// OST: PWM-Pins bleiben bis zum Quittieren auf Low-Pegel (DCAEVT1)
+// CBC: PWM-Pins werden bis zum Ende der Periode auf Low-Pegel gesetzt (DCBEVT2)
+#define PROTECTION_TRIP_OST									0
+#define PROTECTION_TRIP_CBC									1
+// Zeitpunkt, an dem ein CBC-Trip automatisch gelscht wird (TZCLR.CBCPULSE)
+#define PROTECTION_CBC_CLEAR_ZERO						0
+#define PROTECTION_CBC_CLEAR_PERIOD					1
+#define PROTECTION_CBC_CLEAR_ZERO_PERIOD		2
+// Startzeitpunkt des Austastfensters (DCFCTL.PULSESEL)
+#define PROTECTION_BLANKING_AT_PERIOD				0
+#define PROTECTION_BLANKING_AT_ZERO					1
+// Austastfenster aus bzw. max. Lnge des Fensters in TBCLK (DCFWINDOW, 8 Bit)
+#define PROTECTION_BLANKING_DISABLED				0
+#define PROTECTION_BLANKING_WINDOW_MAX			255
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Bit eines ePWM-Moduls (1 ... 16) in der Bitmaske "epwmMask"
+#define PROTECTION_EPWM(n)									(1U << ((n) - 1U))
+// Bits eines Komparators in der Variable "protectionTripSource"
+// (Bit 2*(n-1): High-Komparator CMPSSn, Bit 2*(n-1)+1: Low-Komparator CMPSSn)
+#define PROTECTION_SOURCE_HIGH(n)						(1U << (2U * ((n) - 1U)))
+#define PROTECTION_SOURCE_LOW(n)						(1U << (2U * ((n) - 1U) + 1U))
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Konfiguration eines Schutzkanals (ein Eintrag der Tabelle). Die Spannung am Analogeingang
+// berechnet sich aus der physikalischen Gre x zu: U = offset + scale * x
+typedef struct
+{
+		// Komparator-Subsystem (PROTECTION_CMPSS1 ... PROTECTION_CMPSS8)
+		uint16_t cmpss;
+		// Aktive Komparatoren (PROTECTION_COMP_HIGH, PROTECTION_COMP_LOW, PROTECTION_COMP_BOTH)
+		uint16_t comparators;
+		// Skalierung des Sensors in V pro Einheit und Spannung bei x = 0 in V
+		float scale;
+		float offset;
+		// Obere und untere Grenze in physikalischen Einheiten
+		float limitHigh;
+		float limitLow;
+		// Hysterese (PROTECTION_HYSTERESIS_...)
+		uint16_t hysteresis;
+		// Digitalfilter: Vorteiler des Abtasttakts (0 ... 1023, f = SYSCLK / (prescale + 1)),
+		// Abtastfenster (1 ... 32) und Schwelle (> Abtastfenster / 2)
+		uint16_t filterPrescale;
+		uint16_t filterSampleWindow;
+		uint16_t filterThreshold;
+		// bernahme der Shadow-Register (PROTECTION_LOAD_SYSCLK oder PROTECTION_LOAD_PWMSYNC)
+		uint16_t loadMode;
+		// Rampengenerator fr den High-Komparator (PROTECTION_RAMP_DISABLED oder ePWM 1 ... 16),
+		// Dekrement pro SYSCLK (16 Bit, RAMPDECVALS) und Verzgerung in SYSCLK (13 Bit, RAMPDLYS)
+		uint16_t rampSource;
+		uint16_t rampDecrement;
+		uint16_t rampDelay;
+		// Ausgang der ePWM X-Bar (PROTECTION_XBAR_TRIP4 ... PROTECTION_XBAR_TRIP12)
+		uint16_t xbarTrip;
+		// ePWM-Module, die abgeschaltet werden (z.B. PROTECTION_EPWM(1) | PROTECTION_EPWM(2))
+		uint16_t epwmMask;
+		// Verhalten bei einer Grenzwertverletzung (PROTECTION_TRIP_OST oder PROTECTION_TRIP_CBC).
+		// Kanle mit unterschiedlichem Verhalten bentigen verschiedene X-Bar-Ausgnge
+		uint16_t tripMode;
+		// Nur CBC: Lschen des Trips (PROTECTION_CBC_CLEAR_...), Startzeitpunkt (PROTECTION_
+		// BLANKING_AT_...), Verzgerung (16 Bit) und Lnge (0 ... 255) des Austastfensters in
+		// TBCLK. Alle CBC-Kanle eines ePWM-Moduls mssen die gleichen Werte verwenden
+		uint16_t cbcClear;
+		uint16_t blankingStart;
+		uint16_t blankingOffset;
+		uint16_t blankingWindow;
+} ProtectionChannelConfig;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Komparatoren, die seit dem letzten Aufruf von "ProtectionClearTrip()"
+// ausgelst haben (siehe PROTECTION_SOURCE_HIGH() und PROTECTION_SOURCE_LOW())
+extern uint16_t protectionTripSource;
+// Anzahl der Trip-Interrupts seit der Initialisierung
+extern uint32_t protectionTripCount;
+// Anzahl der Perioden mit aktiver Strombegrenzung (CBC-Trip) des Interrupt-ePWM-Moduls
+extern uint32_t protectionCbcCount;
+// Register der ePWM-Module ePWM1 ... ePWM16
+extern volatile struct EPWM_REGS *const protectionPwmRegs[PROTECTION_NUMBER_OF_PWM];
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion konfiguriert alle Komparator-Subsysteme aus der bergebenen Tabelle, die
+// ePWM X-Bar und die Digital-Compare- und Tripzone-Module der betroffenen ePWM-Module
+extern bool ProtectionInit(const ProtectionChannelConfig *table,
+													 uint16_t numberOfChannels,
+													 uint16_t interruptPwm);
+// Funktion konfiguriert ein einzelnes Komparator-Subsystem
+extern void ProtectionInitCmpss(const ProtectionChannelConfig *channel);
+// Funktion legt den Ausgang eines Komparators auf einen Ausgang der ePWM X-Bar
+extern void ProtectionRouteXbar(uint16_t xbarTrip,
+																uint16_t mux);
+// Funktion konfiguriert das Digital-Compare- und Tripzone-Modul eines ePWM-Moduls
+extern void ProtectionInitPwm(uint16_t pwm,
+															uint16_t xbarTripMask);
+// Funktion konfiguriert den Cycle-by-Cycle-Trip und das Austastfenster eines ePWM-Moduls
+extern void ProtectionInitPwmCbc(uint16_t pwm,
+																 uint16_t xbarTripMask,
+																 const ProtectionChannelConfig *channel);
+// Funktion ndert das Austastfenster eines ePWM-Moduls zur Laufzeit
+extern bool ProtectionSetBlanking(uint16_t pwm,
+																	uint16_t blankingOffset,
+																	uint16_t blankingWindow);
+// Funktion rechnet einen Wert in physikalischen Einheiten in einen DAC-Wert um
+extern uint16_t ProtectionLimitToDac(const ProtectionChannelConfig *channel,
+																		 float limit);
+// Funktion ndert die Grenzwerte eines Kanals zur Laufzeit (ber die Shadow-Register)
+extern bool ProtectionSetLimits(uint16_t channelIndex,
+																float limitHigh,
+																float limitLow);
+// Funktion liest die Latch-Bits aller konfigurierten Komparatoren
+extern uint16_t ProtectionGetComparatorLatches(void);
+// Funktion gibt die auslsenden Komparatoren zurck
+extern uint16_t ProtectionGetTripSource(void);
+// Funktion gibt die Anzahl der Perioden mit aktiver Strombegrenzung zurck
+extern uint32_t ProtectionGetCbcCount(bool reset);
+// Funktion quittiert einen Trip und gibt die ePWM-Ausgnge wieder frei
+extern bool ProtectionClearTrip(void);
+// Funktion lst einen One-Shot-Trip per Software aus
+extern void ProtectionForceTrip(void);
+// ISR fr das Tripzone-Event des Interrupt-ePWM-Moduls
+__interrupt void ProtectionTripISR(void);
+// ISR am CBC-Lschzeitpunkt des Interrupt-ePWM-Moduls (gibt den CBC-Interrupt wieder frei)
+__interrupt void ProtectionCbcPeriodISR(void);
+
+
+#endif
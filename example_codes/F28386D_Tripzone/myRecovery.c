@@ -0,0 +1,264 @@
+//=================================================================================================
+/// @file       myRecovery.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Zustandsmaschine, die nach einem
+///							Trip des Schutz-Managers ("myProtection.c") die PWM-Ausgnge automatisch wieder
+///							freigibt. Nach einem Trip wird eine Abkhlzeit abgewartet und anschlieend
+///							versucht, den Trip zu quittieren (nur mglich, wenn alle Eingangssignale wieder
+///							innerhalb der Grenzen liegen). Treten innerhalb kurzer Zeit mehr Trips auf als
+///							Wiederholungen erlaubt sind, wird in die dauerhafte Abschaltung gewechselt, die
+///							nur durch einen Reset verlassen werden kann. Alternativ kann ein Trip gespeichert
+///							werden (Modus "latched"), bis er ber "RecoveryAcknowledge()" quittiert wird.
+///							Die Zustandsmaschine wird ber "RecoveryTick()" periodisch (z.B. jede ms) aus dem
+///							Hauptprogramm aufgerufen, der Trip wird aus der Trip-ISR gemeldet. Es wird nie
+///							aktiv gewartet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myRecovery.h"
+#include "myProtection.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Aktive Konfiguration (muss whrend der Laufzeit gltig bleiben)
+const RecoveryConfig *recoveryConfig = 0;
+// Aktueller Zustand (RECOVERY_STATE_...)
+uint16_t recoveryState = RECOVERY_STATE_RUNNING;
+// Anzahl der Wiederholungen seit dem letzten stabilen Betrieb
+uint16_t recoveryRetryCount = 0;
+// Anzahl aller gemeldeten Trips seit der Initialisierung
+uint32_t recoveryTripCount = 0;
+// Wird in der Trip-ISR gesetzt und in "RecoveryTick()" ausgewertet
+volatile bool recoveryTripPending = false;
+// Zhler fr die Zeit im aktuellen Zustand bzw. die Zeit ohne Trip
+uint32_t recoveryTimer = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: RecoveryInit ======================================================================
+///
+/// @brief  Funktion bernimmt die Konfiguration und setzt die Zustandsmaschine in den Zustand
+///					RECOVERY_STATE_RUNNING. Die Funktion gibt "false" zurck, falls die Konfiguration
+///					ungltig ist.
+///
+/// @param  const RecoveryConfig *config
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool RecoveryInit(const RecoveryConfig *config)
+{
+		if (   (config == 0)
+				|| (config->mode > RECOVERY_MODE_AUTO))
+		{
+				return false;
+		}
+		recoveryConfig      = config;
+		recoveryState       = RECOVERY_STATE_RUNNING;
+		recoveryRetryCount  = 0;
+		recoveryTripCount   = 0;
+		recoveryTripPending = false;
+		recoveryTimer       = 0;
+		return true;
+}
+
+
+//=== Function: RecoveryNotifyTrip ================================================================
+///
+/// @brief  Funktion meldet der Zustandsmaschine einen Trip. Die Funktion wird aus der Trip-ISR
+///					aufgerufen und setzt nur ein Flag, die Auswertung erfolgt in "RecoveryTick()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void RecoveryNotifyTrip(void)
+{
+		recoveryTripPending = true;
+}
+
+
+//=== Function: RecoveryTick ======================================================================
+///
+/// @brief  Funktion fhrt einen Schritt der Zustandsmaschine aus und muss periodisch (z.B. jede
+///					ms) aufgerufen werden. Alle Zeiten der Konfiguration beziehen sich auf diese
+///					Periode. Ablauf im Modus RECOVERY_MODE_AUTO:
+///
+///					RUNNING  -> Trip                                  -> COOLDOWN (Wiederholung + 1)
+///					COOLDOWN -> Abkhlzeit abgelaufen                 -> RETRY
+///					RETRY    -> Trip quittiert                        -> RUNNING
+///					RETRY    -> Signale nach Timeout noch ungltig    -> COOLDOWN (Wiederholung + 1)
+///					RUNNING  -> "stableTicks" ohne Trip               -> Wiederholungen = 0
+///
+///					berschreitet die Anzahl der Wiederholungen "maxRetries", wird in den Zustand
+///					SHUTDOWN gewechselt. Im Modus RECOVERY_MODE_LATCHED wird nach einem Trip in den
+///					Zustand LATCHED gewechselt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void RecoveryTick(void)
+{
+		if (recoveryConfig == 0)
+		{
+				return;
+		}
+
+		switch (recoveryState)
+		{
+				case RECOVERY_STATE_RUNNING:
+						if (recoveryTripPending)
+						{
+								recoveryTripPending = false;
+								recoveryTripCount++;
+								if (recoveryConfig->mode == RECOVERY_MODE_LATCHED)
+								{
+										recoveryState = RECOVERY_STATE_LATCHED;
+								}
+								else if (recoveryRetryCount >= recoveryConfig->maxRetries)
+								{
+										RecoveryShutdown();
+								}
+								else
+								{
+										recoveryRetryCount++;
+										recoveryTimer = 0;
+										recoveryState = RECOVERY_STATE_COOLDOWN;
+								}
+						}
+						// Stabiler Betrieb ohne Trip -> Zhler der Wiederholungen lschen
+						else if (recoveryRetryCount)
+						{
+								recoveryTimer++;
+								if (recoveryTimer >= recoveryConfig->stableTicks)
+								{
+										recoveryRetryCount = 0;
+								}
+						}
+						break;
+
+				case RECOVERY_STATE_COOLDOWN:
+						// Weitere Trips whrend der Abkhlzeit ignorieren
+						// (die PWM-Ausgnge sind bereits abgeschaltet)
+						recoveryTripPending = false;
+						recoveryTimer++;
+						if (recoveryTimer >= recoveryConfig->cooldownTicks)
+						{
+								recoveryTimer = 0;
+								recoveryState = RECOVERY_STATE_RETRY;
+						}
+						break;
+
+				case RECOVERY_STATE_RETRY:
+						recoveryTripPending = false;
+						// Trip quittieren (nur mglich, wenn alle Signale gltig sind)
+						if (ProtectionClearTrip())
+						{
+								recoveryTimer = 0;
+								recoveryState = RECOVERY_STATE_RUNNING;
+						}
+						else
+						{
+								recoveryTimer++;
+								if (recoveryTimer >= recoveryConfig->retryTimeoutTicks)
+								{
+										// Wiederholung fehlgeschlagen
+										if (recoveryRetryCount >= recoveryConfig->maxRetries)
+										{
+												RecoveryShutdown();
+										}
+										else
+										{
+												recoveryRetryCount++;
+												recoveryTimer = 0;
+												recoveryState = RECOVERY_STATE_COOLDOWN;
+										}
+								}
+						}
+						break;
+
+				case RECOVERY_STATE_LATCHED:
+						recoveryTripPending = false;
+						break;
+
+				default:
+						// RECOVERY_STATE_SHUTDOWN: PWM-Ausgnge bleiben abgeschaltet
+						recoveryTripPending = false;
+						break;
+		}
+}
+
+
+//=== Function: RecoveryAcknowledge ===============================================================
+///
+/// @brief  Funktion quittiert einen gespeicherten Trip im Zustand RECOVERY_STATE_LATCHED und gibt
+///					die PWM-Ausgnge wieder frei. Die Funktion gibt "false" zurck, falls kein Trip
+///					gespeichert ist oder die Signale noch nicht gltig sind. Die dauerhafte Abschaltung
+///					kann nicht quittiert werden.
+///
+/// @param  void
+///
+/// @return bool tripCleared
+///
+//=================================================================================================
+bool RecoveryAcknowledge(void)
+{
+		if (   (recoveryState != RECOVERY_STATE_LATCHED)
+				|| !ProtectionClearTrip())
+		{
+				return false;
+		}
+		recoveryRetryCount = 0;
+		recoveryTimer      = 0;
+		recoveryState      = RECOVERY_STATE_RUNNING;
+		return true;
+}
+
+
+//=== Function: RecoveryShutdown ==================================================================
+///
+/// @brief  Funktion schaltet die PWM-Ausgnge aller ePWM-Module des Schutz-Managers ber einen
+///					Software-Trip dauerhaft ab. Der Zustand RECOVERY_STATE_SHUTDOWN wird nur durch einen
+///					Reset oder einen erneuten Aufruf von "RecoveryInit()" verlassen. Die Funktion kann
+///					auch von der Anwendung aufgerufen werden (z.B. bei einem externen Fehler).
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void RecoveryShutdown(void)
+{
+		ProtectionForceTrip();
+		recoveryTripPending = false;
+		recoveryState       = RECOVERY_STATE_SHUTDOWN;
+}
+
+
+//=== Function: RecoveryGetState ==================================================================
+///
+/// @brief  Funktion gibt den aktuellen Zustand der Zustandsmaschine zurck (RECOVERY_STATE_...).
+///
+/// @param  void
+///
+/// @return uint16_t recoveryState
+///
+//=================================================================================================
+uint16_t RecoveryGetState(void)
+{
+		return recoveryState;
+}
@@ -0,0 +1,105 @@
+//=================================================================================================
+/// @file       myRecovery.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr eine Zustandsmaschine, die nach einem
+///							Trip des Schutz-Managers ("myProtection.c") die PWM-Ausgnge automatisch wieder
+///							freigibt. Nach einem Trip wird eine Abkhlzeit abgewartet und anschlieend
+///							versucht, den Trip zu quittieren (nur mglich, wenn alle Eingangssignale wieder
+///							innerhalb der Grenzen liegen). Treten innerhalb kurzer Zeit mehr Trips auf als
+///							Wiederholungen erlaubt sind, wird in die dauerhafte Abschaltung gewechselt, die
+///							nur durch einen Reset verlassen werden kann. Alternativ kann ein Trip gespeichert
+///							werden (Modus "latched"), bis er ber "RecoveryAcknowledge()" quittiert wird.
+///							Die Zustandsmaschine wird ber "RecoveryTick()" periodisch (z.B. jede ms) aus dem
+///							Hauptprogramm aufgerufen, der Trip wird aus der Trip-ISR gemeldet. Es wird nie
+///							aktiv gewartet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYRECOVERY_H_
+#define MYRECOVERY_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Verhalten nach einem Trip
+// LATCHED: Trip bleibt bis zum Aufruf von "RecoveryAcknowledge()" bestehen
+// AUTO   : Trip wird nach der Abkhlzeit automatisch quittiert
+#define RECOVERY_MODE_LATCHED								0
+#define RECOVERY_MODE_AUTO									1
+// Zustnde der Zustandsmaschine
+// RUNNING : PWM-Ausgnge freigegeben, kein Trip aktiv
+// COOLDOWN: Trip aufgetreten, Abkhlzeit luft
+// RETRY   : Abkhlzeit abgelaufen, Trip wird quittiert, sobald die Signale gltig sind
+// LATCHED : Trip aufgetreten, warten auf "RecoveryAcknowledge()"
+// SHUTDOWN: Dauerhafte Abschaltung (nur durch Reset oder "RecoveryInit()" verlassen)
+#define RECOVERY_STATE_RUNNING							0
+#define RECOVERY_STATE_COOLDOWN							1
+#define RECOVERY_STATE_RETRY								2
+#define RECOVERY_STATE_LATCHED							3
+#define RECOVERY_STATE_SHUTDOWN							4
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Konfiguration der Zustandsmaschine. Alle Zeiten in Vielfachen
+// der Periode, mit der "RecoveryTick()" aufgerufen wird
+typedef struct
+{
+		// Verhalten nach einem Trip (RECOVERY_MODE_LATCHED oder RECOVERY_MODE_AUTO)
+		uint16_t mode;
+		// Max. Anzahl automatischer Wiederholungen, bevor dauerhaft abgeschaltet wird
+		uint16_t maxRetries;
+		// Wartezeit nach einem Trip, bevor der Trip quittiert wird
+		uint32_t cooldownTicks;
+		// Max. Wartezeit nach der Abkhlzeit, bis die Signale wieder gltig sind
+		// (danach gilt die Wiederholung als fehlgeschlagen)
+		uint32_t retryTimeoutTicks;
+		// Zeit ohne Trip, nach welcher der Zhler der Wiederholungen gelscht wird
+		uint32_t stableTicks;
+} RecoveryConfig;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Aktueller Zustand (RECOVERY_STATE_...)
+extern uint16_t recoveryState;
+// Anzahl der Wiederholungen seit dem letzten stabilen Betrieb
+extern uint16_t recoveryRetryCount;
+// Anzahl aller gemeldeten Trips seit der Initialisierung
+extern uint32_t recoveryTripCount;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert die Zustandsmaschine
+extern bool RecoveryInit(const RecoveryConfig *config);
+// Funktion meldet einen Trip (Aufruf aus der Trip-ISR)
+extern void RecoveryNotifyTrip(void);
+// Funktion fhrt einen Schritt der Zustandsmaschine aus (periodischer Aufruf)
+extern void RecoveryTick(void);
+// Funktion quittiert einen gespeicherten Trip (Modus "latched")
+extern bool RecoveryAcknowledge(void);
+// Funktion schaltet die PWM-Ausgnge dauerhaft ab
+extern void RecoveryShutdown(void);
+// Funktion gibt den aktuellen Zustand zurck
+extern uint16_t RecoveryGetState(void);
+
+
+#endif
@@ -295,7 +295,38 @@ void TripzoneInitCmpss1(void)
 		// Bei einem TZB-Event den ePWM1B-Pin auf Low-Pegel setzen
 		EPwm1Regs.TZCTL.bit.TZB = PWM_TZ_FORCE_LO;
 
-		// Nicht Tripzone-spezifische PWM-Konfiguration:
+		// Nicht Tripzone-spezifische PWM-Konfiguration (Zeitgeber,
+		// Action-Qualifier, Totzeiten und GPIOs)
+		TripzoneInitPwm1();
+
+		// Register-Schreibschutz setzen
+		EDIS;
+}
+
+
+//=== Function: TripzoneInitPwm1 ==================================================================
+///
+/// @brief  Funktion initialisiert das ePWM1-Modul (10 kHz, 50 % Tastverhltnis, Totzeiten) und
+///					legt die Signale ePWM1A und ePWM1B auf GPIO 0 und 1. Die Tripzone-spezifische
+///					Konfiguration erfolgt in "TripzoneInitCmpss1()" bzw. ber den Schutz-Manager
+///					(siehe "myProtection.c").
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void TripzoneInitPwm1(void)
+{
+		// Register-Schreibschutz aufheben
+		EALLOW;
+
+		// Takt fr das ePWM1-Modul einschalten und 5 Takte
+		// warten, bis der Takt zum Modul durchgestellt ist
+		// (siehe S. 169 Reference Manual TMS320F2838x,SPRUII0D, Rev. D, July 2022)
+		CpuSysRegs.PCLKCR2.bit.EPWM1 = 1;
+		__asm(" RPT #4 || NOP");
+
     // Takt-Teiler des PWM-Moduls setzen
     // PWM-Takt = SYSCLKOUT / (CLKDIV * HSPCLKDIV)
     EPwm1Regs.TBCTL.bit.CLKDIV    = PWM_CLK_DIV_1;
@@ -240,6 +240,8 @@
 // der Komparatoren, DAC mt VDDA als Referenz, Komparatorausgnge auf X-Bar legen), die
 // ePWM X-Bar und das ePWM1-Modul
 extern void TripzoneInitCmpss1(void);
+// Funktion initialisiert das ePWM1-Modul (ohne Tripzone) und die GPIOs 0 und 1
+extern void TripzoneInitPwm1(void);
 // ISR fr das Tripzone-Event des ePWM1-Moduls
 __interrupt void TripzonePwm1ISR(void);
 
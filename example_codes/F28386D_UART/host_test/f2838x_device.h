@@ -0,0 +1,334 @@
+//=================================================================================================
+/// @file       f2838x_device.h
+///
+/// @brief      Ersatz fr die Registerdefinitionen aus C2000Ware fr die Host-Tests. Die Datei
+///							wird ber den Include-Pfad (-I) statt der Originaldatei eingebunden, so dass
+///							"myUART.c" und "myTelemetry.c" unverndert mit dem Host-Compiler (gcc) bersetzt
+///							werden knnen. Es sind nur die Register und Bits enthalten, die von diesen
+///							Dateien verwendet werden. Die Register sind gewhnliche Variablen, die vom
+///							SCI-Modell ("sciModel.c") gelesen und geschrieben werden.
+///
+///							Der Empfangs- und Sendepuffer (SCIRXBUF, SCITXBUF) verhalten sich in der Hardware
+///							beim Zugriff wie ein FIFO (Lesen entnimmt ein Byte, Schreiben hngt ein Byte an).
+///							Um dies ohne nderung der Treiber nachzubilden, wird jeder Zugriff ber ein Makro
+///							auf ein Feld umgeleitet, dessen Index von einer Funktion des Modells bestimmt
+///							wird. Die Funktion wird vor dem eigentlichen Zugriff ausgefhrt und aktualisiert
+///							dabei den FIFO. Das Modell bildet nur SCI-A nach.
+///
+///							Die CPU-Interrupts werden durch das Flag "hostInterruptsEnabled" nachgebildet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef F2838X_DEVICE_H_
+#define F2838X_DEVICE_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "f2838x_cla_typedefs.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Maskierung der CPU-Interrupt-Gruppen im Register IER
+#define M_INT8																	0x0080
+#define M_INT9																	0x0100
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+// Compiler-Erweiterungen und Assembler-Befehle des C28x haben auf dem Host keine Funktion
+#define __interrupt
+#define __asm(x)
+#define EALLOW
+#define EDIS
+// Globales Sperren und Freigeben der CPU-Interrupts
+#define DINT																		(hostInterruptsEnabled = false)
+#define EINT																		(hostInterruptsEnabled = true)
+// Zugriffe auf den Empfangs- und Sendepuffer ber das SCI-Modell (siehe oben)
+#define SCIRXBUF																SCIRXBUF_MODEL[SciModelReadRx()]
+#define SCITXBUF																SCITXBUF_MODEL[SciModelWriteTx()]
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+typedef void (*PINT)(void);
+
+// SCI-Register
+struct SCICCR_BITS
+{
+		uint16_t SCICHAR:3;
+		uint16_t ADDRIDLE_MODE:1;
+		uint16_t LOOPBKENA:1;
+		uint16_t PARITYENA:1;
+		uint16_t PARITY:1;
+		uint16_t STOPBITS:1;
+		uint16_t rsvd1:8;
+};
+union SCICCR_REG
+{
+		uint16_t all;
+		struct SCICCR_BITS bit;
+};
+
+struct SCICTL1_BITS
+{
+		uint16_t RXERRINTENA:1;
+		uint16_t TXENA:1;
+		uint16_t SLEEP:1;
+		uint16_t TXWAKE:1;
+		uint16_t rsvd1:1;
+		uint16_t SWRESET:1;
+		uint16_t RXENA:1;
+		uint16_t rsvd2:9;
+};
+union SCICTL1_REG
+{
+		uint16_t all;
+		struct SCICTL1_BITS bit;
+};
+
+struct SCIBAUD_BITS
+{
+		uint16_t BAUD:8;
+		uint16_t rsvd1:8;
+};
+union SCIBAUD_REG
+{
+		uint16_t all;
+		struct SCIBAUD_BITS bit;
+};
+
+struct SCICTL2_BITS
+{
+		uint16_t TXINTENA:1;
+		uint16_t RXBKINTENA:1;
+		uint16_t rsvd1:4;
+		uint16_t TXEMPTY:1;
+		uint16_t TXRDY:1;
+		uint16_t rsvd2:8;
+};
+union SCICTL2_REG
+{
+		uint16_t all;
+		struct SCICTL2_BITS bit;
+};
+
+struct SCIRXST_BITS
+{
+		uint16_t rsvd1:1;
+		uint16_t RXWAKE:1;
+		uint16_t PE:1;
+		uint16_t OE:1;
+		uint16_t FE:1;
+		uint16_t BRKDT:1;
+		uint16_t RXRDY:1;
+		uint16_t RXERROR:1;
+		uint16_t rsvd2:8;
+};
+union SCIRXST_REG
+{
+		uint16_t all;
+		struct SCIRXST_BITS bit;
+};
+
+struct SCIRXBUF_BITS
+{
+		uint16_t SAR:8;
+		uint16_t rsvd1:6;
+		uint16_t SCIFFPE:1;
+		uint16_t SCIFFFE:1;
+};
+union SCIRXBUF_REG
+{
+		uint16_t all;
+		struct SCIRXBUF_BITS bit;
+};
+
+struct SCITXBUF_BITS
+{
+		uint16_t TXDT:8;
+		uint16_t rsvd1:8;
+};
+union SCITXBUF_REG
+{
+		uint16_t all;
+		struct SCITXBUF_BITS bit;
+};
+
+struct SCIFFTX_BITS
+{
+		uint16_t TXFFIL:5;
+		uint16_t TXFFIENA:1;
+		uint16_t TXFFINTCLR:1;
+		uint16_t TXFFINT:1;
+		uint16_t TXFFST:5;
+		uint16_t TXFIFORESET:1;
+		uint16_t SCIFFENA:1;
+		uint16_t SCIRST:1;
+};
+union SCIFFTX_REG
+{
+		uint16_t all;
+		struct SCIFFTX_BITS bit;
+};
+
+struct SCIFFRX_BITS
+{
+		uint16_t RXFFIL:5;
+		uint16_t RXFFIENA:1;
+		uint16_t RXFFINTCLR:1;
+		uint16_t RXFFINT:1;
+		uint16_t RXFFST:5;
+		uint16_t RXFIFORESET:1;
+		uint16_t RXFFOVRCLR:1;
+		uint16_t RXFFOVF:1;
+};
+union SCIFFRX_REG
+{
+		uint16_t all;
+		struct SCIFFRX_BITS bit;
+};
+
+// Register eines SCI-Moduls. Empfangs- und Sendepuffer sind im Modell Felder, deren Index
+// von "SciModelReadRx()" bzw. "SciModelWriteTx()" bestimmt wird
+struct SCI_REGS
+{
+		union SCICCR_REG SCICCR;
+		union SCICTL1_REG SCICTL1;
+		union SCIBAUD_REG SCIHBAUD;
+		union SCIBAUD_REG SCILBAUD;
+		union SCICTL2_REG SCICTL2;
+		union SCIRXST_REG SCIRXST;
+		union SCIRXBUF_REG SCIRXBUF_MODEL[1];
+		union SCITXBUF_REG SCITXBUF_MODEL[16];
+		union SCIFFTX_REG SCIFFTX;
+		union SCIFFRX_REG SCIFFRX;
+};
+
+// Takt- und Systemregister
+struct LOSPCP_BITS
+{
+		uint32_t LSPCLKDIV:3;
+		uint32_t rsvd1:29;
+};
+union LOSPCP_REG
+{
+		uint32_t all;
+		struct LOSPCP_BITS bit;
+};
+struct CLK_CFG_REGS
+{
+		union LOSPCP_REG LOSPCP;
+};
+
+union PCLKCR_REG
+{
+		uint32_t all;
+};
+struct CPU_SYS_REGS
+{
+		union PCLKCR_REG PCLKCR7;
+};
+
+// GPIO-Steuerregister (Ports A bis F mit je 0x20 32-Bit-Worten)
+struct GPIO_CTRL_REGS
+{
+		uint32_t port[6 * 0x20];
+};
+
+// PIE-Register und PIE-Vector Table
+struct PIEACK_BITS
+{
+		uint16_t ACK1:1;
+		uint16_t ACK2:1;
+		uint16_t ACK3:1;
+		uint16_t ACK4:1;
+		uint16_t ACK5:1;
+		uint16_t ACK6:1;
+		uint16_t ACK7:1;
+		uint16_t ACK8:1;
+		uint16_t ACK9:1;
+		uint16_t ACK10:1;
+		uint16_t ACK11:1;
+		uint16_t ACK12:1;
+		uint16_t rsvd1:4;
+};
+union PIEACK_REG
+{
+		uint16_t all;
+		struct PIEACK_BITS bit;
+};
+struct PIEIER_BITS
+{
+		uint16_t INTx1:1;
+		uint16_t INTx2:1;
+		uint16_t INTx3:1;
+		uint16_t INTx4:1;
+		uint16_t INTx5:1;
+		uint16_t INTx6:1;
+		uint16_t INTx7:1;
+		uint16_t INTx8:1;
+		uint16_t rsvd1:8;
+};
+union PIEIER_REG
+{
+		uint16_t all;
+		struct PIEIER_BITS bit;
+};
+struct PIE_CTRL_REGS
+{
+		union PIEACK_REG PIEACK;
+		union PIEIER_REG PIEIER8;
+		union PIEIER_REG PIEIER9;
+};
+struct PIE_VECT_TABLE
+{
+		PINT SCIA_RX_INT;
+		PINT SCIA_TX_INT;
+		PINT SCIB_RX_INT;
+		PINT SCIB_TX_INT;
+		PINT SCIC_RX_INT;
+		PINT SCIC_TX_INT;
+		PINT SCID_RX_INT;
+		PINT SCID_TX_INT;
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+extern volatile struct SCI_REGS SciaRegs;
+extern volatile struct SCI_REGS ScibRegs;
+extern volatile struct SCI_REGS ScicRegs;
+extern volatile struct SCI_REGS ScidRegs;
+extern volatile struct CLK_CFG_REGS ClkCfgRegs;
+extern volatile struct CPU_SYS_REGS CpuSysRegs;
+extern volatile struct GPIO_CTRL_REGS GpioCtrlRegs;
+extern volatile struct PIE_CTRL_REGS PieCtrlRegs;
+extern struct PIE_VECT_TABLE PieVectTable;
+extern volatile uint16_t IER;
+// Nachbildung des globalen Interrupt-Flags (INTM = !hostInterruptsEnabled)
+extern volatile bool hostInterruptsEnabled;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktionen des SCI-Modells fr die Zugriffe auf SCIRXBUF und SCITXBUF
+extern uint16_t SciModelReadRx(void);
+extern uint16_t SciModelWriteTx(void);
+// Intrinsics des C28x-Compilers zum Sperren und Wiederherstellen der CPU-Interrupts
+extern uint16_t __disable_interrupts(void);
+extern void __restore_interrupts(uint16_t state);
+
+
+#endif
@@ -0,0 +1,298 @@
+//=================================================================================================
+/// @file       sciModel.c
+///
+/// @brief      Datei enthlt ein Modell des SCI-Moduls SCI-A fr die Host-Tests von "myUART.c".
+///							Nachgebildet werden der 16 Bytes tiefe Sende- und Empfangs-FIFO, das
+///							Ausgangs-Schieberegister mit einer Zeichendauer von 10 Bit (8N1), die
+///							FIFO-Interrupts (pegelgesteuert ber TXFFIL und RXFFIL) und der berlauf des
+///							Empfangs-FIFOs (RXFFOVF). Die gesendeten Bytes werden auf den Empfang
+///							zurckgefhrt (Loopback). Die Zeit wird in ns mit "SciModelRun()" weitergezhlt,
+///							die ISRs werden dabei ber die PIE-Vector Table aufgerufen, sobald ein Interrupt
+///							anliegt und die CPU-Interrupts freigegeben sind.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <string.h>
+#include "sciModel.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Register (siehe "f2838x_device.h")
+volatile struct SCI_REGS SciaRegs;
+volatile struct SCI_REGS ScibRegs;
+volatile struct SCI_REGS ScicRegs;
+volatile struct SCI_REGS ScidRegs;
+volatile struct CLK_CFG_REGS ClkCfgRegs;
+volatile struct CPU_SYS_REGS CpuSysRegs;
+volatile struct GPIO_CTRL_REGS GpioCtrlRegs;
+volatile struct PIE_CTRL_REGS PieCtrlRegs;
+struct PIE_VECT_TABLE PieVectTable;
+volatile uint16_t IER;
+volatile bool hostInterruptsEnabled;
+// Zustand des Modells
+SciModel sciModel;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: __disable_interrupts ==============================================================
+///
+/// @brief  Nachbildung des Intrinsics: Sperrt die CPU-Interrupts und gibt den vorherigen Zustand
+///					zurck (1: gesperrt, entspricht INTM).
+///
+/// @param  void
+///
+/// @return uint16_t state
+///
+//=================================================================================================
+uint16_t __disable_interrupts(void)
+{
+		uint16_t state = hostInterruptsEnabled ? 0 : 1;
+		hostInterruptsEnabled = false;
+		return state;
+}
+
+
+//=== Function: __restore_interrupts ==============================================================
+///
+/// @brief  Nachbildung des Intrinsics: Stellt den mit "__disable_interrupts()" gesicherten Zustand
+///					der CPU-Interrupts wieder her.
+///
+/// @param  uint16_t state
+///
+/// @return void
+///
+//=================================================================================================
+void __restore_interrupts(uint16_t state)
+{
+		hostInterruptsEnabled = (state == 0);
+}
+
+
+//=== Function: SciModelReset =====================================================================
+///
+/// @brief  Funktion setzt alle Register und den Zustand des Modells zurck. "lspclkDiv" ist der
+///					Wert von LOSPCP.LSPCLKDIV (2: LSPCLK = 50 MHz wie nach "DeviceInit()", 0: LSPCLK =
+///					SYSCLK). Die CPU-Interrupts sind anschlieend gesperrt.
+///
+/// @param  uint16_t lspclkDiv
+///
+/// @return void
+///
+//=================================================================================================
+void SciModelReset(uint16_t lspclkDiv)
+{
+		memset((void *)&SciaRegs, 0, sizeof(SciaRegs));
+		memset((void *)&PieCtrlRegs, 0, sizeof(PieCtrlRegs));
+		memset(&PieVectTable, 0, sizeof(PieVectTable));
+		memset(&sciModel, 0, sizeof(sciModel));
+		ClkCfgRegs.LOSPCP.bit.LSPCLKDIV = lspclkDiv;
+		SciaRegs.SCICTL2.bit.TXEMPTY = 1;
+		IER = 0;
+		hostInterruptsEnabled = false;
+		SciModelSetBaud(115200);
+}
+
+
+//=== Function: SciModelSetBaud ===================================================================
+///
+/// @brief  Funktion setzt die Baudrate des Modells. Die Dauer eines Zeichens betrgt 10 Bit
+///					(Startbit, 8 Datenbits, Stopbit).
+///
+/// @param  uint32_t baud
+///
+/// @return void
+///
+//=================================================================================================
+void SciModelSetBaud(uint32_t baud)
+{
+		sciModel.charTime = (10ULL * 1000000000ULL + (baud / 2U)) / baud;
+}
+
+
+//=== Function: SciModelReadRx ====================================================================
+///
+/// @brief  Funktion wird bei jedem Lesen von SCIRXBUF ausgefhrt (siehe "f2838x_device.h"). Das
+///					lteste Byte wird aus dem Empfangs-FIFO entnommen und in SCIRXBUF bereitgestellt.
+///					Ist der FIFO leer, bleibt das letzte Byte stehen (wie in der Hardware).
+///
+/// @param  void
+///
+/// @return uint16_t index
+///
+//=================================================================================================
+uint16_t SciModelReadRx(void)
+{
+		if (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+		{
+				SciaRegs.SCIRXBUF_MODEL[0].bit.SAR = sciModel.rxFifo[sciModel.rxTail % SCI_MODEL_SIZE_FIFO];
+				sciModel.rxTail++;
+				SciaRegs.SCIFFRX.bit.RXFFST--;
+		}
+		return 0;
+}
+
+
+//=== Function: SciModelWriteTx ===================================================================
+///
+/// @brief  Funktion wird bei jedem Schreiben von SCITXBUF ausgefhrt (siehe "f2838x_device.h")
+///					und gibt den Platz im Sende-FIFO zurck, in den das Byte geschrieben wird. Wird in
+///					einen vollen FIFO geschrieben, geht das Byte verloren ("txFifoOverflow").
+///
+/// @param  void
+///
+/// @return uint16_t index
+///
+//=================================================================================================
+uint16_t SciModelWriteTx(void)
+{
+		if (SciaRegs.SCIFFTX.bit.TXFFST >= SCI_MODEL_SIZE_FIFO)
+		{
+				sciModel.txFifoOverflow++;
+				// Byte in einen Platz schreiben, der nicht gesendet wird
+				return (sciModel.txTail + SCI_MODEL_SIZE_FIFO - 1U) % SCI_MODEL_SIZE_FIFO;
+		}
+		uint16_t index = sciModel.txHead % SCI_MODEL_SIZE_FIFO;
+		sciModel.txHead++;
+		SciaRegs.SCIFFTX.bit.TXFFST++;
+		SciaRegs.SCICTL2.bit.TXEMPTY = 0;
+		return index;
+}
+
+
+//=== Function: SciModelService ===================================================================
+///
+/// @brief  Funktion bearbeitet die Flags, die durch Schreiben einer 1 gelscht werden, und ruft
+///					die ISRs auf, solange ein FIFO-Interrupt anliegt und die CPU-Interrupts freigegeben
+///					sind. Whrend der ISR sind die CPU-Interrupts gesperrt (wie in der Hardware). Gibt
+///					eine ISR die Interrupts frei, wird dies in "interruptsEnabledInIsr" gezhlt.
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+void SciModelService(void)
+{
+		volatile struct SCI_REGS *regs = &SciaRegs;
+		for (uint16_t i = 0; i < SCI_MODEL_MAX_ISR_CALLS; i++)
+		{
+				// Durch Schreiben einer 1 gelschte Flags
+				if (regs->SCIFFRX.bit.RXFFOVRCLR)
+				{
+						regs->SCIFFRX.bit.RXFFOVF    = 0;
+						regs->SCIFFRX.bit.RXFFOVRCLR = 0;
+				}
+				regs->SCIFFRX.bit.RXFFINTCLR = 0;
+				regs->SCIFFTX.bit.TXFFINTCLR = 0;
+				if (   !hostInterruptsEnabled
+						|| !(IER & M_INT9))
+				{
+						return;
+				}
+
+				// Pegelgesteuerte FIFO-Interrupts
+				PINT isr = 0;
+				if (   regs->SCIFFRX.bit.RXFFIENA
+						&& PieCtrlRegs.PIEIER9.bit.INTx1
+						&& (regs->SCIFFRX.bit.RXFFST >= regs->SCIFFRX.bit.RXFFIL))
+				{
+						isr = PieVectTable.SCIA_RX_INT;
+						sciModel.isrCallsRx++;
+				}
+				else if (   regs->SCIFFTX.bit.TXFFIENA
+								 && PieCtrlRegs.PIEIER9.bit.INTx2
+								 && (regs->SCIFFTX.bit.TXFFST <= regs->SCIFFTX.bit.TXFFIL))
+				{
+						isr = PieVectTable.SCIA_TX_INT;
+						sciModel.isrCallsTx++;
+				}
+				if (isr == 0)
+				{
+						return;
+				}
+				hostInterruptsEnabled = false;
+				isr();
+				if (hostInterruptsEnabled)
+				{
+						sciModel.interruptsEnabledInIsr++;
+				}
+				hostInterruptsEnabled = true;
+		}
+		sciModel.interruptLoops++;
+}
+
+
+//=== Function: SciModelRun =======================================================================
+///
+/// @brief  Funktion lsst "duration" ns vergehen. Ist das Ausgangs-Schieberegister frei, wird
+///					das nchste Byte aus dem Sende-FIFO bernommen und nach einer Zeichendauer in den
+///					Empfangs-FIFO geschrieben (Loopback). Ist der Empfangs-FIFO voll, geht das Byte
+///					verloren und RXFFOVF wird gesetzt. Nach jeder nderung werden die ISRs aufgerufen.
+///
+/// @param  uint64_t duration
+///
+/// @return void
+///
+//=================================================================================================
+void SciModelRun(uint64_t duration)
+{
+		volatile struct SCI_REGS *regs = &SciaRegs;
+		uint64_t end = sciModel.time + duration;
+		SciModelService();
+		while (true)
+		{
+				// Nchstes Byte aus dem Sende-FIFO in das Schieberegister bernehmen
+				if (   !sciModel.shifterBusy
+						&& regs->SCICTL1.bit.TXENA
+						&& (regs->SCIFFTX.bit.TXFFST > 0))
+				{
+						sciModel.shifterData = regs->SCITXBUF_MODEL[sciModel.txTail % SCI_MODEL_SIZE_FIFO].bit.TXDT;
+						sciModel.txTail++;
+						regs->SCIFFTX.bit.TXFFST--;
+						sciModel.shifterBusy = true;
+						sciModel.shifterEnd  = sciModel.time + sciModel.charTime;
+						SciModelService();
+						continue;
+				}
+				if (   !sciModel.shifterBusy
+						|| (sciModel.shifterEnd > end))
+				{
+						break;
+				}
+
+				// Zeichen vollstndig gesendet und empfangen
+				sciModel.time = sciModel.shifterEnd;
+				sciModel.shifterBusy = false;
+				sciModel.busyTime += sciModel.charTime;
+				sciModel.bytesTx++;
+				if (regs->SCICTL1.bit.RXENA)
+				{
+						if (regs->SCIFFRX.bit.RXFFST < SCI_MODEL_SIZE_FIFO)
+						{
+								sciModel.rxFifo[sciModel.rxHead % SCI_MODEL_SIZE_FIFO] = sciModel.shifterData;
+								sciModel.rxHead++;
+								regs->SCIFFRX.bit.RXFFST++;
+						}
+						else
+						{
+								regs->SCIFFRX.bit.RXFFOVF = 1;
+								sciModel.rxLost++;
+						}
+				}
+				regs->SCICTL2.bit.TXEMPTY = (regs->SCIFFTX.bit.TXFFST == 0);
+				SciModelService();
+		}
+		sciModel.time = end;
+		regs->SCICTL2.bit.TXEMPTY = (!sciModel.shifterBusy && (regs->SCIFFTX.bit.TXFFST == 0));
+}
@@ -0,0 +1,89 @@
+//=================================================================================================
+/// @file       sciModel.h
+///
+/// @brief      Datei enthlt ein Modell des SCI-Moduls SCI-A fr die Host-Tests von "myUART.c".
+///							Nachgebildet werden der 16 Bytes tiefe Sende- und Empfangs-FIFO, das
+///							Ausgangs-Schieberegister mit einer Zeichendauer von 10 Bit (8N1), die
+///							FIFO-Interrupts (pegelgesteuert ber TXFFIL und RXFFIL) und der berlauf des
+///							Empfangs-FIFOs (RXFFOVF). Die gesendeten Bytes werden auf den Empfang
+///							zurckgefhrt (Loopback). Die Zeit wird in ns mit "SciModelRun()" weitergezhlt,
+///							die ISRs werden dabei ber die PIE-Vector Table aufgerufen, sobald ein Interrupt
+///							anliegt und die CPU-Interrupts freigegeben sind.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef SCIMODEL_H_
+#define SCIMODEL_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "f2838x_device.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Gre der Hardware-FIFOs
+#define SCI_MODEL_SIZE_FIFO											16
+// Max. Anzahl an ISR-Aufrufen ohne Fortschritt der Zeit (Erkennung einer Interrupt-Schleife)
+#define SCI_MODEL_MAX_ISR_CALLS									64
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Zustand und Statistik des Modells
+typedef struct
+{
+		// Aktuelle Zeit und Dauer eines Zeichens in ns
+		uint64_t time;
+		uint64_t charTime;
+		// Empfangs-FIFO (Lese- und Schreibindex)
+		uint16_t rxFifo[SCI_MODEL_SIZE_FIFO];
+		uint16_t rxHead;
+		uint16_t rxTail;
+		// Lese- und Schreibindex des Sende-FIFOs (die Bytes liegen in SciaRegs.SCITXBUF_MODEL)
+		uint16_t txHead;
+		uint16_t txTail;
+		// Ausgangs-Schieberegister
+		bool shifterBusy;
+		uint16_t shifterData;
+		uint64_t shifterEnd;
+		// Statistik
+		uint32_t bytesTx;
+		uint64_t busyTime;
+		uint32_t rxLost;
+		uint32_t txFifoOverflow;
+		uint32_t isrCallsRx;
+		uint32_t isrCallsTx;
+		uint32_t interruptLoops;
+		uint32_t interruptsEnabledInIsr;
+} SciModel;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+extern SciModel sciModel;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion setzt alle Register und den Zustand des Modells zurck
+extern void SciModelReset(uint16_t lspclkDiv);
+// Funktion setzt die Baudrate, aus der die Zeichendauer berechnet wird
+extern void SciModelSetBaud(uint32_t baud);
+// Funktion lsst "duration" ns vergehen und ruft dabei die ISRs auf
+extern void SciModelRun(uint64_t duration);
+// Funktion ruft die ISRs auf, solange ein Interrupt anliegt
+extern void SciModelService(void);
+
+
+#endif
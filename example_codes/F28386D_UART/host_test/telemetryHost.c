@@ -0,0 +1,225 @@
+//=================================================================================================
+/// @file       telemetryHost.c
+///
+/// @brief      Host-Bibliothek (PC-Seite) fr das Telemetrie-Protokoll aus "myTelemetry.c". Die
+///							Bibliothek ist unabhngig vom Treiber in Standard-C (C99) geschrieben und kann in
+///							Host-Programme (z.B. Auswertung ber den virtuellen COM-Port des XDS100)
+///							eingebunden werden. Sie enthlt einen Kodierer fr vollstndige Pakete und einen
+///							Dekodierer, dem die empfangenen Bytes einzeln bergeben werden.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "telemetryHost.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TelemetryHostCrc16 ================================================================
+///
+/// @brief  Funktion berechnet die CRC-16 (CCITT, Polynom 0x1021) bitweise ber "length" Bytes.
+///					Die Berechnung ist absichtlich unabhngig von der Tabelle der Firmware.
+///
+/// @param  uint16_t crc, const uint8_t *data, size_t length
+///
+/// @return uint16_t crc
+///
+//=================================================================================================
+uint16_t TelemetryHostCrc16(uint16_t crc,
+														const uint8_t *data,
+														size_t length)
+{
+		for (size_t i = 0; i < length; i++)
+		{
+				crc ^= (uint16_t)data[i] << 8;
+				for (uint16_t bit = 0; bit < 8; bit++)
+				{
+						crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+				}
+		}
+		return crc;
+}
+
+
+//=== Function: TelemetryHostEncode ===============================================================
+///
+/// @brief  Funktion bildet das Paket aus ID, Sequenznummer, Nutzdaten und CRC, kodiert es mit
+///					COBS nach "encoded" (mind. TELEMETRY_HOST_SIZE_ENCODED_MAX Bytes) und hngt die
+///					Endekennung an. Die Funktion gibt die Anzahl der Bytes zurck bzw. 0, falls die
+///					Nutzdaten zu lang sind.
+///
+/// @param  uint8_t id, uint8_t sequence, const uint8_t *payload, uint16_t length,
+///					uint8_t *encoded
+///
+/// @return size_t numberOfBytes
+///
+//=================================================================================================
+size_t TelemetryHostEncode(uint8_t id,
+													 uint8_t sequence,
+													 const uint8_t *payload,
+													 uint16_t length,
+													 uint8_t *encoded)
+{
+		if (length > TELEMETRY_HOST_SIZE_PAYLOAD_MAX)
+		{
+				return 0;
+		}
+		uint8_t frame[TELEMETRY_HOST_SIZE_FRAME_MAX];
+		size_t lengthFrame = 0;
+		frame[lengthFrame++] = id;
+		frame[lengthFrame++] = sequence;
+		for (uint16_t i = 0; i < length; i++)
+		{
+				frame[lengthFrame++] = payload[i];
+		}
+		uint16_t crc = TelemetryHostCrc16(TELEMETRY_HOST_CRC_INIT, frame, lengthFrame);
+		frame[lengthFrame++] = (uint8_t)(crc >> 8);
+		frame[lengthFrame++] = (uint8_t)(crc & 0x00FF);
+
+		// COBS: Code-Byte vor jedem Block gibt den Abstand zum nchsten 0x00-Byte an
+		size_t positionCode = 0;
+		size_t position     = 1;
+		uint8_t code        = 1;
+		for (size_t i = 0; i < lengthFrame; i++)
+		{
+				if (frame[i] != 0)
+				{
+						encoded[position++] = frame[i];
+						code++;
+				}
+				if (   (frame[i] == 0)
+						|| (code == 0xFF))
+				{
+						encoded[positionCode] = code;
+						positionCode = position++;
+						code = 1;
+				}
+		}
+		encoded[positionCode] = code;
+		encoded[position++]   = 0x00;
+		return position;
+}
+
+
+//=== Function: TelemetryHostDecoderInit ==========================================================
+///
+/// @brief  Funktion initialisiert den Dekodierer und setzt die Statistik zurck.
+///
+/// @param  TelemetryHostDecoder *decoder
+///
+/// @return void
+///
+//=================================================================================================
+void TelemetryHostDecoderInit(TelemetryHostDecoder *decoder)
+{
+		decoder->length         = 0;
+		decoder->discard        = false;
+		decoder->sequence       = 0;
+		decoder->sequenceValid  = false;
+		decoder->framesRx       = 0;
+		decoder->crcErrors      = 0;
+		decoder->framingErrors  = 0;
+		decoder->sequenceErrors = 0;
+}
+
+
+//=== Function: TelemetryHostDecode ===============================================================
+///
+/// @brief  Funktion bergibt ein empfangenes Byte an den Dekodierer. Bei einer Endekennung wird
+///					das Paket dekodiert und die CRC geprft. Ist das Paket gltig, wird es in "frame"
+///					gespeichert und "true" zurckgegeben. Fehler werden wie in "TelemetryPoll()"
+///					gezhlt.
+///
+/// @param  TelemetryHostDecoder *decoder, uint8_t data, TelemetryHostFrame *frame
+///
+/// @return bool frameReceived
+///
+//=================================================================================================
+bool TelemetryHostDecode(TelemetryHostDecoder *decoder,
+												 uint8_t data,
+												 TelemetryHostFrame *frame)
+{
+		if (data != 0x00)
+		{
+				if (decoder->length < sizeof(decoder->buffer))
+				{
+						decoder->buffer[decoder->length++] = data;
+				}
+				else if (!decoder->discard)
+				{
+						decoder->discard = true;
+						decoder->framingErrors++;
+				}
+				return false;
+		}
+
+		// Endekennung
+		size_t length = decoder->length;
+		bool discard  = decoder->discard;
+		decoder->length  = 0;
+		decoder->discard = false;
+		if (discard || (length == 0))
+		{
+				return false;
+		}
+
+		// COBS-Dekodierung
+		uint8_t decoded[sizeof(decoder->buffer)];
+		size_t read  = 0;
+		size_t write = 0;
+		while (read < length)
+		{
+				uint8_t code = decoder->buffer[read++];
+				if (   (code == 0)
+						|| ((read + code - 1U) > length))
+				{
+						decoder->framingErrors++;
+						return false;
+				}
+				for (uint8_t i = 1; i < code; i++)
+				{
+						decoded[write++] = decoder->buffer[read++];
+				}
+				if (   (code != 0xFF)
+						&& (read < length))
+				{
+						decoded[write++] = 0;
+				}
+		}
+		if (   (write < 4U)
+				|| (write > TELEMETRY_HOST_SIZE_FRAME_MAX))
+		{
+				decoder->framingErrors++;
+				return false;
+		}
+		if (TelemetryHostCrc16(TELEMETRY_HOST_CRC_INIT, decoded, write) != 0)
+		{
+				decoder->crcErrors++;
+				return false;
+		}
+
+		if (   decoder->sequenceValid
+				&& (decoded[1] != (uint8_t)(decoder->sequence + 1U)))
+		{
+				decoder->sequenceErrors++;
+		}
+		decoder->sequence      = decoded[1];
+		decoder->sequenceValid = true;
+		decoder->framesRx++;
+
+		frame->id       = decoded[0];
+		frame->sequence = decoded[1];
+		frame->length   = (uint16_t)(write - 4U);
+		for (uint16_t i = 0; i < frame->length; i++)
+		{
+				frame->payload[i] = decoded[2U + i];
+		}
+		return true;
+}
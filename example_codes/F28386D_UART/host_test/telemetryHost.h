@@ -0,0 +1,98 @@
+//=================================================================================================
+/// @file       telemetryHost.h
+///
+/// @brief      Host-Bibliothek (PC-Seite) fr das Telemetrie-Protokoll aus "myTelemetry.c". Die
+///							Bibliothek ist unabhngig vom Treiber in Standard-C (C99) geschrieben und kann in
+///							Host-Programme (z.B. Auswertung ber den virtuellen COM-Port des XDS100)
+///							eingebunden werden. Sie enthlt einen Kodierer fr vollstndige Pakete und einen
+///							Dekodierer, dem die empfangenen Bytes einzeln bergeben werden.
+///
+///							Aufbau eines Pakets (vor der COBS-Kodierung):
+///							<ID> <Sequenznummer> <Nutzdaten 0 ... 128 Bytes> <CRC High> <CRC Low>
+///							CRC-16 CCITT (Polynom 0x1021, Startwert 0xFFFF) ber ID, Sequenznummer und
+///							Nutzdaten, COBS-kodiert und mit einem 0x00-Byte abgeschlossen.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef TELEMETRYHOST_H_
+#define TELEMETRYHOST_H_
+
+
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Max. Anzahl der Nutzdaten pro Paket (wie TELEMETRY_SIZE_PAYLOAD_MAX)
+#define TELEMETRY_HOST_SIZE_PAYLOAD_MAX					128
+// Max. Lnge eines Pakets vor der Kodierung
+#define TELEMETRY_HOST_SIZE_FRAME_MAX						(2U + TELEMETRY_HOST_SIZE_PAYLOAD_MAX + 2U)
+// Max. Lnge eines kodierten Pakets inkl. Endekennung
+#define TELEMETRY_HOST_SIZE_ENCODED_MAX					(TELEMETRY_HOST_SIZE_FRAME_MAX + (TELEMETRY_HOST_SIZE_FRAME_MAX / 254U) + 2U)
+// Startwert der CRC
+#define TELEMETRY_HOST_CRC_INIT									0xFFFF
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Dekodiertes Paket
+typedef struct
+{
+		uint8_t id;
+		uint8_t sequence;
+		uint16_t length;
+		uint8_t payload[TELEMETRY_HOST_SIZE_PAYLOAD_MAX];
+} TelemetryHostFrame;
+
+// Zustand des Dekodierers
+typedef struct
+{
+		// Empfangene Bytes des aktuellen Pakets (ohne Endekennung)
+		uint8_t buffer[TELEMETRY_HOST_SIZE_ENCODED_MAX];
+		uint16_t length;
+		// Das aktuelle Paket ist zu lang und wird bis zur Endekennung verworfen
+		bool discard;
+		// Sequenznummer des zuletzt empfangenen Pakets
+		uint8_t sequence;
+		bool sequenceValid;
+		// Statistik
+		uint32_t framesRx;
+		uint32_t crcErrors;
+		uint32_t framingErrors;
+		uint32_t sequenceErrors;
+} TelemetryHostDecoder;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion berechnet die CRC-16 (bitweise, ohne Tabelle)
+extern uint16_t TelemetryHostCrc16(uint16_t crc,
+																	 const uint8_t *data,
+																	 size_t length);
+// Funktion kodiert ein Paket und gibt die Anzahl der Bytes inkl. Endekennung zurck
+extern size_t TelemetryHostEncode(uint8_t id,
+																	uint8_t sequence,
+																	const uint8_t *payload,
+																	uint16_t length,
+																	uint8_t *encoded);
+// Funktion initialisiert den Dekodierer
+extern void TelemetryHostDecoderInit(TelemetryHostDecoder *decoder);
+// Funktion bergibt ein empfangenes Byte und gibt ein vollstndiges Paket zurck
+extern bool TelemetryHostDecode(TelemetryHostDecoder *decoder,
+																uint8_t data,
+																TelemetryHostFrame *frame);
+
+
+#endif
@@ -0,0 +1,179 @@
+//=================================================================================================
+/// @file       testDivider.c
+///
+/// @brief      Host-Test der Baudraten-Berechnung des UART-Treibers ("myUART.c"). Fr alle
+///							Baudraten UART_BAUD_xxx und alle Einstellungen von LOSPCP.LSPCLKDIV wird geprft:
+///
+///							- "UartGetLspclk()" liefert SYSCLK / (2 * LSPCLKDIV) bzw. SYSCLK fr 0
+///							- "UartCalcDivider()" liefert den Teiler mit der kleinsten Abweichung
+///							  (gerundet statt abgeschnitten) und bleibt im Bereich 1 ... 65535
+///							- "UartInit()" speichert die tatschliche Baudrate und die Abweichung und lehnt
+///							  Abweichungen ber UART_BAUD_ERROR_MAX ab
+///							- Die Beispiele aus der Dokumentation (460800 Baud: BRR 13 bzw. 53)
+///
+///							Die Abweichungen werden als Tabelle ausgegeben. Baudraten mit mehr als 2 %
+///							Abweichung sind mit "*" markiert (bei 8N1 nicht zuverlssig, "UartInit()" gibt
+///							"false" zurck).
+///
+///							Aufruf: make test
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <math.h>
+#include "sciModel.h"
+#include "../myUART.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+#define CHECK(condition)																																	\
+		do																																										\
+		{																																											\
+				if (!(condition))																																	\
+				{																																									\
+						printf("  FEHLER %s:%d: %s\n", __FILE__, __LINE__, #condition);								\
+						testErrors++;																																	\
+				}																																									\
+		} while (0)
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+static uint32_t testErrors = 0;
+// Alle vom Treiber definierten Baudraten
+static const uint32_t testBaud[] =
+{
+		UART_BAUD_2400, UART_BAUD_4800, UART_BAUD_9600, UART_BAUD_19200, UART_BAUD_38400,
+		UART_BAUD_115200, UART_BAUD_230400, UART_BAUD_460800, UART_BAUD_921600,
+		UART_BAUD_1000000
+};
+#define TEST_NUMBER_OF_BAUD_RATES								(sizeof(testBaud) / sizeof(testBaud[0]))
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+// Abweichung der Baudrate in % fr den Teiler "divider"
+static double TestBaudError(uint32_t lspclk,
+														uint32_t baud,
+														uint32_t divider)
+{
+		double actual = (double)lspclk / ((double)(divider + 1U) * 8.0);
+		return (actual - (double)baud) * 100.0 / (double)baud;
+}
+
+
+// Low-Speed CLK fr alle Einstellungen von LSPCLKDIV
+static void TestLspclk(void)
+{
+		printf("LSPCLK\n");
+		for (uint16_t lspclkDiv = 0; lspclkDiv < 8; lspclkDiv++)
+		{
+				SciModelReset(lspclkDiv);
+				uint32_t expected = (lspclkDiv == 0) ? UART_SYSCLK : (UART_SYSCLK / (2UL * lspclkDiv));
+				CHECK(UartGetLspclk() == expected);
+		}
+}
+
+
+// Teiler fr alle Baudraten und Einstellungen von LSPCLKDIV
+static void TestDivider(void)
+{
+		for (uint16_t lspclkDiv = 0; lspclkDiv < 8; lspclkDiv++)
+		{
+				SciModelReset(lspclkDiv);
+				uint32_t lspclk = UartGetLspclk();
+				printf("LSPCLK = %lu Hz (LSPCLKDIV = %u)\n", (unsigned long)lspclk, lspclkDiv);
+				for (uint16_t i = 0; i < TEST_NUMBER_OF_BAUD_RATES; i++)
+				{
+						uint32_t baud    = testBaud[i];
+						uint16_t divider = UartCalcDivider(lspclk, baud);
+						double error     = TestBaudError(lspclk, baud, divider);
+						CHECK(divider >= 1U);
+						// Die benachbarten Teiler sind nicht besser (gerundet statt abgeschnitten)
+						if (divider > 1U)
+						{
+								CHECK(fabs(error) <= fabs(TestBaudError(lspclk, baud, divider - 1U)) + 1.0e-9);
+						}
+						if (divider < 0xFFFFU)
+						{
+								CHECK(fabs(error) <= fabs(TestBaudError(lspclk, baud, divider + 1U)) + 1.0e-9);
+						}
+
+						// "UartInit()" speichert die gleiche Baudrate und Abweichung und
+						// konfiguriert das SCI-Modul nur bei zulssiger Abweichung
+						bool valid = (fabs(error) <= UART_BAUD_ERROR_MAX);
+						CHECK(UartInit(&uartA, &uartPinsA, baud, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE) == valid);
+						if (valid)
+						{
+								CHECK(((uint16_t)(SciaRegs.SCIHBAUD.bit.BAUD << 8) | SciaRegs.SCILBAUD.bit.BAUD) == divider);
+						}
+						CHECK(uartA.baudActual == (lspclk / ((divider + 1UL) * 8UL)));
+						// Die Abweichung wird aus der ganzzahligen Baudrate berechnet
+						CHECK(fabs(uartA.baudError - ((double)uartA.baudActual - (double)baud) * 100.0 / (double)baud) < 0.001);
+						CHECK(fabs(uartA.baudError - error) < 0.05);
+
+						printf("  %8lu Baud: BRR %5u, %8lu Baud, %+6.2f %%%s\n",
+									 (unsigned long)baud, divider, (unsigned long)uartA.baudActual, error,
+									 valid ? "" : " *");
+				}
+		}
+}
+
+
+// Beispiele aus der Dokumentation und Grenzflle
+static void TestLimits(void)
+{
+		printf("Grenzfaelle\n");
+		// 460800 Baud: LSPCLK = 50 MHz -> BRR = 13 (-3,1 %), LSPCLK = 200 MHz -> BRR = 53 (+0,5 %)
+		CHECK(UartCalcDivider(50000000UL, UART_BAUD_460800) == 13U);
+		CHECK(UartCalcDivider(200000000UL, UART_BAUD_460800) == 53U);
+		CHECK(fabs(TestBaudError(50000000UL, UART_BAUD_460800, 13U) + 3.1) < 0.05);
+		CHECK(fabs(TestBaudError(200000000UL, UART_BAUD_460800, 53U) - 0.5) < 0.05);
+		// Bei LSPCLK = SYSCLK sind alle Baudraten bis 1 MBaud verwendbar
+		for (uint16_t i = 0; i < TEST_NUMBER_OF_BAUD_RATES; i++)
+		{
+				if (testBaud[i] <= UART_BAUD_1000000)
+				{
+						uint16_t divider = UartCalcDivider(UART_SYSCLK, testBaud[i]);
+						CHECK(fabs(TestBaudError(UART_SYSCLK, testBaud[i], divider)) <= UART_BAUD_ERROR_MAX);
+				}
+		}
+		// Baudrate 0 und zu kleine Baudraten ergeben den grten Teiler
+		CHECK(UartCalcDivider(50000000UL, 0) == 0xFFFFU);
+		CHECK(UartCalcDivider(200000000UL, 100UL) == 0xFFFFU);
+		// Zu groe Baudraten ergeben den kleinsten Teiler (LSPCLK / 16)
+		CHECK(UartCalcDivider(50000000UL, 10000000UL) == 1U);
+		// Ungltige Parameter
+		SciModelReset(2);
+		CHECK(!UartInit(&uartA, &uartPinsA, 0, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE));
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Main
+//-------------------------------------------------------------------------------------------------
+int main(void)
+{
+		TestLspclk();
+		TestDivider();
+		TestLimits();
+
+		if (testErrors != 0)
+		{
+				printf("testDivider: %lu Fehler\n", (unsigned long)testErrors);
+				return 1;
+		}
+		printf("testDivider: OK\n");
+		return 0;
+}
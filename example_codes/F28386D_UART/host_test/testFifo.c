@@ -0,0 +1,353 @@
+//=================================================================================================
+/// @file       testFifo.c
+///
+/// @brief      Host-Test des UART-Treibers ("myUART.c") mit dem SCI-Modell ("sciModel.c"). Der
+///							Treiber wird unverndert bersetzt und sendet im Loopback fortlaufend Daten mit
+///							460800 Baud. Geprft werden:
+///
+///							- Dauerlast: Alle Bytes kommen vollstndig und in der richtigen Reihenfolge an,
+///							  die Leitung ist dabei ohne Pausen ausgelastet (gemessener Durchsatz)
+///							- berlast: Liest das Hauptprogramm zu selten, werden alle verworfenen Bytes in
+///							  "rxOverflow" gezhlt, der Hardware-FIFO luft nicht ber
+///							- Interrupt-Latenz: Der Empfangs-FIFO berbrckt eine Verzgerung der
+///							  Empfangs-ISR um bis zu (16 - UART_LEVEL_FIFO_RX) Zeichen
+///							- Sende-Deskriptoren: Die Callback-Funktion sendet aus der Sende-ISR bzw. aus
+///							  "UartStartTx()" weitere Bytes, ohne dass Bytes doppelt gesendet werden oder die
+///							  CPU-Interrupts in der ISR freigegeben werden
+///
+///							Aufruf: make test
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include "sciModel.h"
+#include "../myUART.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Anzahl der Bytes im Dauerlast-Test
+#define TEST_NUMBER_OF_BYTES										200000UL
+// Zeit in ns
+#define TEST_US																	1000ULL
+#define TEST_MS																	1000000ULL
+// Anzahl und max. Lnge der Nachrichten im Test der Sende-Deskriptoren
+#define TEST_NUMBER_OF_MESSAGES									200
+#define TEST_SIZE_MESSAGE												40
+// Lnge des Nachspanns, den die Callback-Funktion mit "UartWrite()" sendet
+#define TEST_SIZE_TRAILER												3
+// Anzahl der Nachrichten, die nach dem Start aus dem Hauptprogramm aus der Callback-Funktion
+// eingereiht werden
+#define TEST_MESSAGES_PER_CHAIN									10
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+#define CHECK(condition)																																	\
+		do																																										\
+		{																																											\
+				if (!(condition))																																	\
+				{																																									\
+						printf("  FEHLER %s:%d: %s\n", __FILE__, __LINE__, #condition);								\
+						testErrors++;																																	\
+				}																																									\
+		} while (0)
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+static uint32_t testErrors = 0;
+static uint32_t testRandom = 0x12345678UL;
+// Nachrichten und erwartete Bytefolge im Test der Sende-Deskriptoren
+static uint16_t testMessages[TEST_NUMBER_OF_MESSAGES][TEST_SIZE_MESSAGE];
+static uint16_t testExpected[TEST_NUMBER_OF_MESSAGES * (TEST_SIZE_MESSAGE + TEST_SIZE_TRAILER)];
+static uint32_t testExpectedLength = 0;
+static uint16_t testNextMessage = 0;
+static uint32_t testCallbacks = 0;
+static uint32_t testCallbacksInterruptsEnabled = 0;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+// Pseudo-Zufallszahl im Bereich 0 ... (range - 1) (xorshift32, reproduzierbar)
+static uint32_t TestRandom(uint32_t range)
+{
+		testRandom ^= testRandom << 13;
+		testRandom ^= testRandom >> 17;
+		testRandom ^= testRandom << 5;
+		return testRandom % range;
+}
+
+
+// Modell zurcksetzen und SCI-A mit der gewnschten Baudrate initialisieren
+static void TestInit(uint16_t lspclkDiv,
+										 uint32_t baud)
+{
+		SciModelReset(lspclkDiv);
+		CHECK(UartInit(&uartA, &uartPinsA, baud, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE));
+		SciModelSetBaud(uartA.baudActual);
+}
+
+
+// Dauerlast: Das Hauptprogramm schreibt und liest in zuflligen Abstnden und Blockgren
+static void TestContinuous(void)
+{
+		printf("Dauerlast 460800 Baud, LSPCLK = 200 MHz\n");
+		TestInit(0, UART_BAUD_460800);
+
+		uint32_t sent     = 0;
+		uint32_t received = 0;
+		uint16_t block[64];
+		uint64_t start = sciModel.time;
+		while (received < TEST_NUMBER_OF_BYTES)
+		{
+				// Fortlaufende Bytefolge schreiben
+				uint16_t length = (uint16_t)(1U + TestRandom(64));
+				if (length > (TEST_NUMBER_OF_BYTES - sent))
+				{
+						length = (uint16_t)(TEST_NUMBER_OF_BYTES - sent);
+				}
+				for (uint16_t i = 0; i < length; i++)
+				{
+						block[i] = (uint16_t)((sent + i) & 0x00FF);
+				}
+				sent += UartWrite(&uartA, block, length);
+
+				// Empfangene Bytes lesen und prfen
+				uint16_t count = UartRead(&uartA, block, (uint16_t)(1U + TestRandom(64)));
+				for (uint16_t i = 0; i < count; i++)
+				{
+						if (block[i] != ((received + i) & 0x00FF))
+						{
+								testErrors++;
+						}
+				}
+				received += count;
+
+				// Hauptprogramm luft alle 50 ... 450 us
+				SciModelRun((50U + TestRandom(400)) * TEST_US);
+		}
+		uint64_t elapsed = sciModel.time - start;
+		double throughput  = (double)received * 1.0e9 / (double)elapsed;
+		double utilization = (double)sciModel.busyTime * 100.0 / (double)elapsed;
+		printf("  Baudrate %lu, %lu Bytes in %.1f ms, %.0f Bytes/s, Auslastung %.2f %%\n",
+					 (unsigned long)uartA.baudActual, (unsigned long)received, (double)elapsed / 1.0e6,
+					 throughput, utilization);
+		printf("  ISR-Aufrufe Rx %lu, Tx %lu\n",
+					 (unsigned long)sciModel.isrCallsRx, (unsigned long)sciModel.isrCallsTx);
+		CHECK(received == sent);
+		CHECK(uartA.rxOverflow == 0);
+		CHECK(sciModel.rxLost == 0);
+		CHECK(sciModel.txFifoOverflow == 0);
+		CHECK(sciModel.interruptLoops == 0);
+		// Die Leitung ist bis auf das Ende der bertragung dauerhaft belegt
+		CHECK(utilization > 99.0);
+
+		// Nach dem letzten Byte wird das Ende der bertragung erkannt
+		SciModelRun(TEST_MS);
+		CHECK(UartGetStatusTx(&uartA) == UART_STATUS_FINISHED);
+		CHECK(SciaRegs.SCIFFTX.bit.TXFFIENA == 0);
+		CHECK(UartSetStatusIdleTx(&uartA));
+}
+
+
+// berlast: Das Hauptprogramm liest nur alle 20 ms, der Empfangs-Ringpuffer luft ber
+static void TestOverload(void)
+{
+		printf("Ueberlast Empfang (Lesen alle 20 ms)\n");
+		TestInit(0, UART_BAUD_460800);
+
+		uint32_t sent     = 0;
+		uint32_t received = 0;
+		uint16_t block[UART_SIZE_RING_BUFFER_RX];
+		for (uint16_t loop = 0; loop < 2000; loop++)
+		{
+				// Sende-Ringpuffer jede ms auffllen
+				for (uint16_t i = 0; i < UART_SIZE_RING_BUFFER_TX; i++)
+				{
+						block[i] = (uint16_t)((sent + i) & 0x00FF);
+				}
+				sent += UartWrite(&uartA, block, UartGetFreeTx(&uartA));
+				if ((loop % 20U) == 0)
+				{
+						received += UartRead(&uartA, block, UART_SIZE_RING_BUFFER_RX);
+				}
+				SciModelRun(TEST_MS);
+		}
+		SciModelRun(20U * TEST_MS);
+		received += UartRead(&uartA, block, UART_SIZE_RING_BUFFER_RX);
+		printf("  gesendet %lu, gelesen %lu, verworfen %lu\n",
+					 (unsigned long)sent, (unsigned long)received, (unsigned long)uartA.rxOverflow);
+		CHECK(uartA.rxOverflow > 0);
+		CHECK((received + uartA.rxOverflow) == sent);
+		CHECK(sciModel.rxLost == 0);
+}
+
+
+// Interrupt-Sperre: Wird die Empfangs-ISR bis zu (16 - UART_LEVEL_FIFO_RX) Zeichen nach
+// dem Erreichen des Interrupt-Niveaus verzgert, gehen keine Bytes verloren
+static void TestInterruptLatency(uint16_t latencyChars,
+																 bool lossExpected)
+{
+		printf("Interrupt-Latenz %u Zeichen\n", latencyChars);
+		TestInit(0, UART_BAUD_460800);
+
+		uint16_t block[UART_SIZE_RING_BUFFER_TX];
+		for (uint16_t i = 0; i < UART_SIZE_RING_BUFFER_TX; i++)
+		{
+				block[i] = i & 0x00FF;
+		}
+		UartWrite(&uartA, block, UART_SIZE_RING_BUFFER_TX);
+		// Warten, bis der Empfangs-FIFO zum ersten Mal ausgelesen wurde (FIFO leer), dann den
+		// Empfangs-Interrupt sperren, bis das Interrupt-Niveau erreicht und die Latenz vergangen
+		// ist (z.B. durch eine ISR hherer Prioritt). Der Sende-Interrupt bleibt freigegeben
+		SciModelRun(UART_LEVEL_FIFO_RX * sciModel.charTime + TEST_US);
+		PieCtrlRegs.PIEIER9.bit.INTx1 = 0;
+		SciModelRun((UART_LEVEL_FIFO_RX + latencyChars) * sciModel.charTime);
+		PieCtrlRegs.PIEIER9.bit.INTx1 = 1;
+		SciModelRun(UART_SIZE_RING_BUFFER_TX * sciModel.charTime);
+		UartAvailable(&uartA);
+		printf("  verloren %lu, gezaehlt %lu\n",
+					 (unsigned long)sciModel.rxLost, (unsigned long)uartA.rxOverflow);
+		CHECK((sciModel.rxLost > 0) == lossExpected);
+		CHECK(uartA.rxOverflow == (sciModel.rxLost > 0 ? 1U : 0U));
+}
+
+
+// Nchste Nachricht ohne Kopie einreihen und erwartete Bytefolge ergnzen
+static void TestQueueMessage(uint16_t maxLength);
+
+// Callback-Funktion der Sende-Deskriptoren: Sendet einen Nachspann mit "UartWrite()" und reiht
+// die nchste Nachricht ein
+static void TestMessageSent(void *context)
+{
+		uint16_t message = *(const uint16_t *)context;
+		testCallbacks++;
+		// Die Callback-Funktion luft immer mit gesperrten Interrupts
+		if (hostInterruptsEnabled)
+		{
+				testCallbacksInterruptsEnabled++;
+		}
+		uint16_t trailer[TEST_SIZE_TRAILER];
+		for (uint16_t i = 0; i < TEST_SIZE_TRAILER; i++)
+		{
+				trailer[i] = (uint16_t)((0xF0U + message + i) & 0x00FF);
+		}
+		CHECK(UartWrite(&uartA, trailer, TEST_SIZE_TRAILER) == TEST_SIZE_TRAILER);
+		for (uint16_t i = 0; i < TEST_SIZE_TRAILER; i++)
+		{
+				testExpected[testExpectedLength++] = trailer[i];
+		}
+		if ((message % TEST_MESSAGES_PER_CHAIN) != (TEST_MESSAGES_PER_CHAIN - 1U))
+		{
+				TestQueueMessage(TEST_SIZE_MESSAGE);
+		}
+}
+
+
+static void TestQueueMessage(uint16_t maxLength)
+{
+		static uint16_t index[TEST_NUMBER_OF_MESSAGES];
+		if (testNextMessage >= TEST_NUMBER_OF_MESSAGES)
+		{
+				return;
+		}
+		uint16_t message = testNextMessage++;
+		// Kurze Nachrichten passen vollstndig in den FIFO, die Callback-Funktion wird dann
+		// bereits aus "UartStartTx()" aufgerufen
+		uint16_t length = (uint16_t)(1U + TestRandom(maxLength));
+		for (uint16_t i = 0; i < length; i++)
+		{
+				testMessages[message][i] = (uint16_t)((message * 31U + i) & 0x00FF);
+				testExpected[testExpectedLength++] = testMessages[message][i];
+		}
+		index[message] = message;
+		CHECK(UartQueueTx(&uartA, testMessages[message], length, TestMessageSent, &index[message]));
+}
+
+
+// Sende-Deskriptoren: Die Callback-Funktion sendet weitere Bytes aus der ISR bzw. aus
+// "UartStartTx()". Alle Bytes kommen genau einmal und in der Reihenfolge der Aufrufe an
+static void TestDescriptorCallback(void)
+{
+		printf("Sende-Deskriptoren mit Callback\n");
+		TestInit(0, UART_BAUD_460800);
+		sciModel.interruptsEnabledInIsr = 0;
+
+		// Jede Kette von Nachrichten startet bei ruhendem Sender mit einer kurzen Nachricht aus
+		// dem Hauptprogramm, die Callback-Funktion luft dann innerhalb von "UartStartTx()" und
+		// sendet den Nachspann verschachtelt aus einem weiteren Aufruf von "UartStartTx()"
+		uint32_t received = 0;
+		uint16_t block[64];
+		for (uint16_t loop = 0; loop < 10000; loop++)
+		{
+				if (   (testNextMessage < TEST_NUMBER_OF_MESSAGES)
+						&& (UartGetStatusTx(&uartA) != UART_STATUS_IN_PROGRESS))
+				{
+						UartSetStatusIdleTx(&uartA);
+						TestQueueMessage(UART_SIZE_HARDWARE_FIFO / 2U);
+						CHECK(hostInterruptsEnabled);
+				}
+				SciModelRun((20U + TestRandom(200)) * TEST_US);
+				uint16_t count = UartRead(&uartA, block, 64);
+				for (uint16_t i = 0; i < count; i++)
+				{
+						if (   ((received + i) >= testExpectedLength)
+								|| (block[i] != testExpected[received + i]))
+						{
+								testErrors++;
+						}
+				}
+				received += count;
+				CHECK(hostInterruptsEnabled);
+				if ((testNextMessage >= TEST_NUMBER_OF_MESSAGES) && (received >= testExpectedLength))
+				{
+						break;
+				}
+		}
+		SciModelRun(TEST_MS);
+		received += UartAvailable(&uartA);
+		printf("  %u Nachrichten, %lu Bytes, Callback-Aufrufe %lu\n", testNextMessage,
+					 (unsigned long)received, (unsigned long)testCallbacks);
+		CHECK(testNextMessage == TEST_NUMBER_OF_MESSAGES);
+		CHECK(testCallbacks == TEST_NUMBER_OF_MESSAGES);
+		CHECK(received == testExpectedLength);
+		CHECK(testCallbacksInterruptsEnabled == 0);
+		CHECK(sciModel.interruptsEnabledInIsr == 0);
+		CHECK(sciModel.txFifoOverflow == 0);
+		CHECK(sciModel.rxLost == 0);
+		CHECK(uartA.rxOverflow == 0);
+		CHECK(UartGetStatusTx(&uartA) == UART_STATUS_FINISHED);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Main
+//-------------------------------------------------------------------------------------------------
+int main(void)
+{
+		TestContinuous();
+		TestOverload();
+		TestInterruptLatency(UART_SIZE_HARDWARE_FIFO - UART_LEVEL_FIFO_RX, false);
+		TestInterruptLatency(UART_SIZE_HARDWARE_FIFO - UART_LEVEL_FIFO_RX + 1U, true);
+		TestDescriptorCallback();
+
+		if (testErrors != 0)
+		{
+				printf("testFifo: %lu Fehler\n", (unsigned long)testErrors);
+				return 1;
+		}
+		printf("testFifo: OK\n");
+		return 0;
+}
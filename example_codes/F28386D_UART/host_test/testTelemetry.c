@@ -0,0 +1,486 @@
+//=================================================================================================
+/// @file       testTelemetry.c
+///
+/// @brief      Host-Test und Benchmark des Telemetrie-Protokolls ("myTelemetry.c") mit dem
+///							SCI-Modell ("sciModel.c") und der Host-Bibliothek ("telemetryHost.c"). Geprft
+///							werden:
+///
+///							- CRC-16: Tabelle der Firmware gegen die bitweise Berechnung und den Prfwert
+///							  0x29B1 fr "123456789"
+///							- Firmware -> Firmware: Alle Nutzdatenlngen 0 ... 128 mit verschiedenen
+///							  Mustern (zufllig, nur 0x00, ohne 0x00) im Loopback
+///							- Firmware -> Host: Die gesendeten Bytes sind identisch mit der Kodierung der
+///							  Host-Bibliothek und werden von ihr dekodiert
+///							- Host -> Firmware: Von der Host-Bibliothek kodierte Pakete werden von
+///							  "TelemetryPoll()" empfangen
+///							- Fehler: CRC-Fehler, Lcken in der Sequenznummer, zu lange und ungltig
+///							  kodierte Pakete werden erkannt und gezhlt
+///
+///							Anschlieend werden CRC, Kodierung und Dekodierung auf dem Host gemessen (Zeit
+///							pro kByte Nutzdaten). Die Zeiten gelten nur fr den Host-Rechner und dienen
+///							dem Vergleich der Verfahren, nicht als Angabe fr den C28x.
+///
+///							Aufruf: make test
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#define _POSIX_C_SOURCE 199309L
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "sciModel.h"
+#include "telemetryHost.h"
+#include "../myTelemetry.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Zeit in ns
+#define TEST_MS																	1000000ULL
+// Anzahl der Wiederholungen im Benchmark
+#define TEST_BENCHMARK_LOOPS										20000UL
+// Muster der Nutzdaten
+#define TEST_PATTERN_RANDOM											0
+#define TEST_PATTERN_ZERO												1
+#define TEST_PATTERN_NON_ZERO										2
+#define TEST_NUMBER_OF_PATTERNS									3
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+#define CHECK(condition)																																	\
+		do																																										\
+		{																																											\
+				if (!(condition))																																	\
+				{																																									\
+						printf("  FEHLER %s:%d: %s\n", __FILE__, __LINE__, #condition);								\
+						testErrors++;																																	\
+				}																																									\
+		} while (0)
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+static uint32_t testErrors = 0;
+static uint32_t testRandom = 0x0BADC0DEUL;
+static TelemetryLink testLink;
+static TelemetryFrame testFrame;
+// Verhindert, dass der Compiler die Berechnungen im Benchmark entfernt
+static volatile uint32_t testSink;
+
+
+//-------------------------------------------------------------------------------------------------
+// Local functions
+//-------------------------------------------------------------------------------------------------
+// Pseudo-Zufallszahl (xorshift32, reproduzierbar)
+static uint32_t TestRandom(void)
+{
+		testRandom ^= testRandom << 13;
+		testRandom ^= testRandom >> 17;
+		testRandom ^= testRandom << 5;
+		return testRandom;
+}
+
+
+// Nutzdaten mit dem gewnschten Muster fllen
+static void TestFillPayload(uint16_t *payload,
+														uint16_t length,
+														uint16_t pattern)
+{
+		for (uint16_t i = 0; i < length; i++)
+		{
+				switch (pattern)
+				{
+						case TEST_PATTERN_ZERO:
+								payload[i] = 0x00;
+								break;
+						case TEST_PATTERN_NON_ZERO:
+								payload[i] = 1U + (TestRandom() % 255U);
+								break;
+						default:
+								// Jedes vierte Byte im Mittel 0x00
+								payload[i] = ((TestRandom() % 4U) == 0) ? 0x00 : (TestRandom() & 0x00FF);
+								break;
+				}
+		}
+}
+
+
+// Modell zurcksetzen und Verbindung ber SCI-A initialisieren
+static void TestInit(void)
+{
+		SciModelReset(0);
+		CHECK(UartInit(&uartA, &uartPinsA, UART_BAUD_1000000, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE));
+		SciModelSetBaud(uartA.baudActual);
+		TelemetryInit(&testLink, &uartA);
+}
+
+
+// Modell laufen lassen, bis alle Bytes gesendet und empfangen wurden
+static void TestTransfer(void)
+{
+		while (   (uartA.tailTx != uartA.headTx)
+					 || (SciaRegs.SCIFFTX.bit.TXFFST != 0)
+					 || sciModel.shifterBusy)
+		{
+				SciModelRun(TEST_MS);
+		}
+}
+
+
+// Alle empfangenen Pakete mit "TelemetryPoll()" auswerten, das letzte wird in "testFrame"
+// gespeichert. Rckgabe: Anzahl der Pakete
+static uint16_t TestPollAll(void)
+{
+		uint16_t frames = 0;
+		while (true)
+		{
+				if (TelemetryPoll(&testLink, &testFrame))
+				{
+						frames++;
+				}
+				else if (UartAvailable(&uartA) == 0)
+				{
+						return frames;
+				}
+		}
+}
+
+
+// Bytes senden (Loopback) und mit "TelemetryPoll()" auswerten
+static uint16_t TestSendRaw(const uint8_t *data,
+														size_t length)
+{
+		uint16_t block[TELEMETRY_HOST_SIZE_ENCODED_MAX + 256U];
+		for (size_t i = 0; i < length; i++)
+		{
+				block[i] = data[i];
+		}
+		CHECK(UartWrite(&uartA, block, (uint16_t)length) == length);
+		TestTransfer();
+		return TestPollAll();
+}
+
+
+// CRC-16 der Firmware (Tabelle) gegen die bitweise Berechnung
+static void TestCrc(void)
+{
+		printf("CRC-16\n");
+		const uint8_t check[] = "123456789";
+		uint16_t check16[9];
+		for (uint16_t i = 0; i < 9; i++)
+		{
+				check16[i] = check[i];
+		}
+		CHECK(TelemetryCrc16(TELEMETRY_CRC_INIT, check16, 9) == 0x29B1);
+		CHECK(TelemetryHostCrc16(TELEMETRY_HOST_CRC_INIT, check, 9) == 0x29B1);
+
+		uint8_t data[256];
+		uint16_t data16[256];
+		for (uint16_t loop = 0; loop < 1000; loop++)
+		{
+				uint16_t length = (uint16_t)(TestRandom() % 257U);
+				for (uint16_t i = 0; i < length; i++)
+				{
+						data[i]   = (uint8_t)TestRandom();
+						data16[i] = data[i];
+				}
+				CHECK(TelemetryCrc16(TELEMETRY_CRC_INIT, data16, length)
+							== TelemetryHostCrc16(TELEMETRY_HOST_CRC_INIT, data, length));
+		}
+}
+
+
+// Firmware -> Firmware und Firmware -> Host fr alle Lngen und Muster
+static void TestFirmwareToFirmware(void)
+{
+		printf("Firmware -> Firmware / Host\n");
+		TestInit();
+		TelemetryHostDecoder decoder;
+		TelemetryHostDecoderInit(&decoder);
+		TelemetryHostFrame hostFrame;
+		uint16_t payload[TELEMETRY_SIZE_PAYLOAD_MAX];
+		uint8_t payload8[TELEMETRY_SIZE_PAYLOAD_MAX];
+		uint8_t encoded[TELEMETRY_HOST_SIZE_ENCODED_MAX];
+		uint16_t received[TELEMETRY_HOST_SIZE_ENCODED_MAX];
+		uint32_t frames = 0;
+
+		for (uint16_t pattern = 0; pattern < TEST_NUMBER_OF_PATTERNS; pattern++)
+		{
+				for (uint16_t length = 0; length <= TELEMETRY_SIZE_PAYLOAD_MAX; length++)
+				{
+						TestFillPayload(payload, length, pattern);
+						for (uint16_t i = 0; i < length; i++)
+						{
+								payload8[i] = (uint8_t)payload[i];
+						}
+						uint16_t id       = (uint16_t)(TestRandom() & 0x00FF);
+						uint16_t sequence = testLink.sequenceTx;
+
+						// Firmware -> Firmware
+						CHECK(TelemetrySend(&testLink, id, payload, length));
+						TestTransfer();
+						CHECK(TestPollAll() == 1);
+						CHECK(testFrame.id == id);
+						CHECK(testFrame.sequence == sequence);
+						CHECK(testFrame.length == length);
+						CHECK(memcmp(testFrame.payload, payload, length * sizeof(uint16_t)) == 0);
+
+						// Firmware -> Host: identische Kodierung und Dekodierung mit der Host-Bibliothek
+						sequence = testLink.sequenceTx;
+						CHECK(TelemetrySend(&testLink, id, payload, length));
+						TestTransfer();
+						uint16_t count = UartRead(&uartA, received, TELEMETRY_HOST_SIZE_ENCODED_MAX);
+						size_t lengthEncoded = TelemetryHostEncode((uint8_t)id, (uint8_t)sequence, payload8, length, encoded);
+						CHECK(count == lengthEncoded);
+						bool frameReceived = false;
+						for (uint16_t i = 0; i < count; i++)
+						{
+								CHECK(received[i] == encoded[i]);
+								frameReceived = TelemetryHostDecode(&decoder, (uint8_t)received[i], &hostFrame);
+						}
+						CHECK(frameReceived);
+						CHECK(hostFrame.id == id);
+						CHECK(hostFrame.length == length);
+						CHECK(memcmp(hostFrame.payload, payload8, length) == 0);
+						frames++;
+				}
+		}
+		printf("  %lu Pakete, Fehler Firmware %lu/%lu/%lu, Host %lu/%lu\n", (unsigned long)frames,
+					 (unsigned long)testLink.crcErrors, (unsigned long)testLink.framingErrors,
+					 (unsigned long)testLink.framesDropped, (unsigned long)decoder.crcErrors,
+					 (unsigned long)decoder.framingErrors);
+		CHECK(testLink.crcErrors == 0);
+		CHECK(testLink.framingErrors == 0);
+		CHECK(testLink.framesDropped == 0);
+		CHECK(decoder.crcErrors == 0);
+		CHECK(decoder.framingErrors == 0);
+		CHECK(sciModel.rxLost == 0);
+		CHECK(uartA.rxOverflow == 0);
+}
+
+
+// Host -> Firmware
+static void TestHostToFirmware(void)
+{
+		printf("Host -> Firmware\n");
+		TestInit();
+		uint8_t payload8[TELEMETRY_SIZE_PAYLOAD_MAX];
+		uint8_t encoded[TELEMETRY_HOST_SIZE_ENCODED_MAX];
+		for (uint16_t length = 0; length <= TELEMETRY_SIZE_PAYLOAD_MAX; length++)
+		{
+				for (uint16_t i = 0; i < length; i++)
+				{
+						payload8[i] = (uint8_t)(((TestRandom() % 4U) == 0) ? 0 : TestRandom());
+				}
+				size_t lengthEncoded = TelemetryHostEncode(0x42, (uint8_t)length, payload8, length, encoded);
+				CHECK(TestSendRaw(encoded, lengthEncoded) == 1);
+				CHECK(testFrame.id == 0x42);
+				CHECK(testFrame.sequence == length);
+				CHECK(testFrame.length == length);
+				for (uint16_t i = 0; i < length; i++)
+				{
+						CHECK(testFrame.payload[i] == payload8[i]);
+				}
+		}
+		CHECK(testLink.framesRx == (TELEMETRY_SIZE_PAYLOAD_MAX + 1U));
+		CHECK(testLink.sequenceErrors == 0);
+		// Zu lange Nutzdaten werden nicht kodiert
+		CHECK(TelemetryHostEncode(0, 0, payload8, TELEMETRY_SIZE_PAYLOAD_MAX + 1U, encoded) == 0);
+}
+
+
+// Fehlerhafte Pakete
+static void TestErrors(void)
+{
+		printf("Fehlerhafte Pakete\n");
+		TestInit();
+		uint8_t payload8[16] = {1, 2, 0, 4, 5, 0, 0, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+		uint8_t encoded[TELEMETRY_HOST_SIZE_ENCODED_MAX + 64U];
+
+		// Gltiges Paket als Referenz fr die Sequenznummer
+		size_t length = TelemetryHostEncode(1, 10, payload8, 16, encoded);
+		CHECK(TestSendRaw(encoded, length) == 1);
+
+		// Verflschtes Byte -> CRC-Fehler
+		length = TelemetryHostEncode(1, 11, payload8, 16, encoded);
+		encoded[4] ^= 0x20;
+		CHECK(TestSendRaw(encoded, length) == 0);
+		CHECK(testLink.crcErrors == 1);
+
+		// Lcke in der Sequenznummer (11 fehlt) -> Paket wird angenommen und gezhlt
+		length = TelemetryHostEncode(1, 12, payload8, 16, encoded);
+		CHECK(TestSendRaw(encoded, length) == 1);
+		CHECK(testLink.sequenceErrors == 1);
+
+		// Code-Byte zeigt ber das Paketende hinaus -> Kodierungsfehler
+		const uint8_t invalid[] = {0x05, 0x01, 0x02, 0x00};
+		CHECK(TestSendRaw(invalid, sizeof(invalid)) == 0);
+		CHECK(testLink.framingErrors == 1);
+
+		// Zu kurzes Paket (weniger als ID, Sequenznummer und CRC) -> Kodierungsfehler
+		const uint8_t shortFrame[] = {0x03, 0x01, 0x02, 0x00};
+		CHECK(TestSendRaw(shortFrame, sizeof(shortFrame)) == 0);
+		CHECK(testLink.framingErrors == 2);
+
+		// Zu langes Paket ohne Endekennung -> wird bis zur Endekennung verworfen, das folgende
+		// gltige Paket wird empfangen
+		uint8_t tooLong[TELEMETRY_SIZE_ENCODED_MAX + 11U];
+		memset(tooLong, 0x55, sizeof(tooLong));
+		tooLong[sizeof(tooLong) - 1U] = 0x00;
+		CHECK(TestSendRaw(tooLong, sizeof(tooLong)) == 0);
+		CHECK(testLink.framingErrors == 3);
+		length = TelemetryHostEncode(1, 13, payload8, 16, encoded);
+		CHECK(TestSendRaw(encoded, length) == 1);
+
+		// Mehrere Endekennungen (Synchronisation) werden ignoriert
+		const uint8_t delimiters[] = {0x00, 0x00, 0x00};
+		CHECK(TestSendRaw(delimiters, sizeof(delimiters)) == 0);
+		CHECK(testLink.framingErrors == 3);
+		CHECK(testLink.crcErrors == 1);
+		CHECK(testLink.framesRx == 3);
+}
+
+
+// Zeit in ns seit einem beliebigen Zeitpunkt
+static double TestTime(void)
+{
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return (double)now.tv_sec * 1.0e9 + (double)now.tv_nsec;
+}
+
+
+// Benchmark: Zeit pro kByte Nutzdaten auf dem Host
+static void TestBenchmark(void)
+{
+		printf("Benchmark (Host, Zeit pro kByte Nutzdaten)\n");
+		TestInit();
+		uint16_t payload[TELEMETRY_SIZE_PAYLOAD_MAX];
+		uint8_t payload8[TELEMETRY_SIZE_PAYLOAD_MAX];
+		uint16_t data[1024];
+		uint8_t data8[1024];
+		for (uint16_t i = 0; i < 1024; i++)
+		{
+				data[i]  = TestRandom() & 0x00FF;
+				data8[i] = (uint8_t)data[i];
+		}
+		TestFillPayload(payload, TELEMETRY_SIZE_PAYLOAD_MAX, TEST_PATTERN_RANDOM);
+		for (uint16_t i = 0; i < TELEMETRY_SIZE_PAYLOAD_MAX; i++)
+		{
+				payload8[i] = (uint8_t)payload[i];
+		}
+		// Anzahl der Pakete pro kByte Nutzdaten
+		const double framesPerKbyte = 1024.0 / TELEMETRY_SIZE_PAYLOAD_MAX;
+		uint32_t sink = 0;
+
+		// CRC-16 mit Tabelle (Firmware)
+		double start = TestTime();
+		for (uint32_t loop = 0; loop < TEST_BENCHMARK_LOOPS; loop++)
+		{
+				sink += TelemetryCrc16((uint16_t)loop, data, 1024);
+		}
+		double timeCrcTable = (TestTime() - start) / TEST_BENCHMARK_LOOPS;
+
+		// CRC-16 bitweise (Host-Bibliothek)
+		start = TestTime();
+		for (uint32_t loop = 0; loop < TEST_BENCHMARK_LOOPS; loop++)
+		{
+				sink += TelemetryHostCrc16((uint16_t)loop, data8, 1024);
+		}
+		double timeCrcBitwise = (TestTime() - start) / TEST_BENCHMARK_LOOPS;
+
+		// Kodierung direkt im Sende-Ringpuffer (Firmware). Der Sende-FIFO-Interrupt ist
+		// eingeschaltet, so dass "UartStartTx()" den FIFO nicht fllt, der Ringpuffer wird nach
+		// jedem Paket verworfen
+		SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
+		uint32_t encodedBytes = 0;
+		start = TestTime();
+		for (uint32_t loop = 0; loop < TEST_BENCHMARK_LOOPS; loop++)
+		{
+				uint16_t head = uartA.headTx;
+				TelemetrySend(&testLink, 1, payload, TELEMETRY_SIZE_PAYLOAD_MAX);
+				encodedBytes += (uint16_t)(uartA.headTx - head);
+				uartA.tailTx = uartA.headTx;
+		}
+		double timeEncode = (TestTime() - start) / TEST_BENCHMARK_LOOPS * framesPerKbyte;
+		CHECK(testLink.framesDropped == 0);
+
+		// Dekodierung und CRC-Prfung eines Pakets (Firmware, ohne Lesen aus dem Ringpuffer)
+		uint16_t encoded[TELEMETRY_SIZE_ENCODED_MAX];
+		uint16_t frame[TELEMETRY_SIZE_ENCODED_MAX];
+		uint16_t head = uartA.headTx;
+		TelemetrySend(&testLink, 1, payload, TELEMETRY_SIZE_PAYLOAD_MAX);
+		uint16_t lengthEncoded = (uint16_t)(uartA.headTx - head - 1U);
+		for (uint16_t i = 0; i < lengthEncoded; i++)
+		{
+				encoded[i] = uartA.ringTx[(head + i) & (UART_SIZE_RING_BUFFER_TX - 1U)];
+		}
+		uartA.tailTx = uartA.headTx;
+		start = TestTime();
+		for (uint32_t loop = 0; loop < TEST_BENCHMARK_LOOPS; loop++)
+		{
+				memcpy(frame, encoded, lengthEncoded * sizeof(uint16_t));
+				uint16_t length = TelemetryCobsDecode(frame, lengthEncoded);
+				sink += TelemetryCrc16(TELEMETRY_CRC_INIT, frame, length);
+		}
+		double timeDecode = (TestTime() - start) / TEST_BENCHMARK_LOOPS * framesPerKbyte;
+
+		// Kodierung und Dekodierung mit der Host-Bibliothek
+		uint8_t hostEncoded[TELEMETRY_HOST_SIZE_ENCODED_MAX];
+		TelemetryHostDecoder decoder;
+		TelemetryHostFrame hostFrame;
+		TelemetryHostDecoderInit(&decoder);
+		start = TestTime();
+		for (uint32_t loop = 0; loop < TEST_BENCHMARK_LOOPS; loop++)
+		{
+				size_t length = TelemetryHostEncode(1, (uint8_t)loop, payload8, TELEMETRY_SIZE_PAYLOAD_MAX, hostEncoded);
+				for (size_t i = 0; i < length; i++)
+				{
+						sink += TelemetryHostDecode(&decoder, hostEncoded[i], &hostFrame);
+				}
+		}
+		double timeHost = (TestTime() - start) / TEST_BENCHMARK_LOOPS * framesPerKbyte;
+		CHECK(decoder.framesRx == TEST_BENCHMARK_LOOPS);
+		testSink = sink;
+
+		printf("  CRC-16 Tabelle (Firmware)          %8.0f ns/kByte\n", timeCrcTable);
+		printf("  CRC-16 bitweise (Host-Bibliothek)  %8.0f ns/kByte\n", timeCrcBitwise);
+		printf("  Kodierung inkl. CRC (Firmware)     %8.0f ns/kByte\n", timeEncode);
+		printf("  Dekodierung inkl. CRC (Firmware)   %8.0f ns/kByte\n", timeDecode);
+		printf("  Kodierung + Dekodierung (Host)     %8.0f ns/kByte\n", timeHost);
+		printf("  Overhead COBS + Kopf + CRC: %lu Bytes pro %u Bytes Nutzdaten\n",
+					 (unsigned long)(encodedBytes / TEST_BENCHMARK_LOOPS - TELEMETRY_SIZE_PAYLOAD_MAX),
+					 TELEMETRY_SIZE_PAYLOAD_MAX);
+}
+
+
+//-------------------------------------------------------------------------------------------------
+// Main
+//-------------------------------------------------------------------------------------------------
+int main(void)
+{
+		TestCrc();
+		TestFirmwareToFirmware();
+		TestHostToFirmware();
+		TestErrors();
+		TestBenchmark();
+
+		if (testErrors != 0)
+		{
+				printf("testTelemetry: %lu Fehler\n", (unsigned long)testErrors);
+				return 1;
+		}
+		printf("testTelemetry: OK\n");
+		return 0;
+}
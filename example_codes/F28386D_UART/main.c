@@ -18,10 +18,15 @@
 ///						> Erweitert > VCP laden aktivieren > Debugger vom PC trennen und neu verbinden
 ///
 ///						nderung myUART.c V2.0 : Verwendung der Hardware-Puffer zum Senden und Empfangen
+///						nderung myUART.c V3.0 : Ringpuffer fr fortlaufendes Senden und Empfangen
+///						nderung myUART.c V4.0 : Instanzen fr die Module SCI-A bis SCI-D
+///						nderung main.c V1.5   : Binres Telemetrie-Protokoll ("myTelemetry.c")
+///						nderung main.c V1.6   : Debug-Monitor zum Lesen und Schreiben von Variablen
+///						nderung main.c V1.7   : Senden ohne Kopie aus Puffern der Anwendung
 ///
-/// @version	V1.2
+/// @version	V1.7
 ///
-/// @date			09.09.2022
+/// @date			19.10.2026
 ///
 /// @author		Daniel Urbaneck
 //=================================================================================================
@@ -29,24 +34,64 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myUART.h"
+#include "myTelemetry.h"
+#include "myMonitor.h"
 #include "myPWM.h"
 
 
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
+// 1: Daten als Telemetrie-Pakete senden und empfangen ("myTelemetry.c")
+// 0: Empfangene Bytes unverndert zurcksenden (Echo)
+#define MAIN_USE_TELEMETRY											1
+// Nachrichten-IDs der Telemetrie-Pakete. Antworten auf empfangene
+// Pakete werden mit gesetztem Bit 7 der ID gesendet
+#define MAIN_TELEMETRY_ID_DATA									0x01
+#define MAIN_TELEMETRY_ID_RESPONSE							0x80
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
+// Funktion wird aufgerufen, sobald die Puffer einer Nachricht gesendet wurden
+void MainTxDone(void *context);
 
 
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Zum Starten der Kommunikation
+// Zum Starten der Kommunikation (1: Daten ber den Ringpuffer senden,
+// 2: Nachricht aus zwei Puffern ohne Kopie senden)
 uint32_t goTx = 0;
+// Puffer fr das Senden ohne Kopie. Die Puffer drfen erst wieder
+// verndert werden, wenn "MainTxDone()" aufgerufen wurde
+uint16_t txHeader[2] = {0xAA, 0x55};
+uint16_t txBlock[64];
+volatile bool txBlockBusy = false;
+// Puffer fr die empfangenen Daten
+uint16_t rxData[16];
+// Telemetrie-Verbindung ber SCI-A und empfangenes Paket
+TelemetryLink telemetryLinkA;
+TelemetryFrame telemetryFrame;
+// Beispiel-Parameter, die ber den Debug-Monitor eingestellt werden knnen
+float controlKp = 0.5f;
+float controlKi = 10.0f;
+uint16_t controlMode = 0;
+// Variablen des Debug-Monitors (Index = Kennung im Befehl)
+const MonitorVariable monitorVariables[] =
+{
+		// 0: Proportionalverstrkung
+		{&controlKp, MONITOR_TYPE_FLOAT, true, 0.0f, 100.0f},
+		// 1: Integralverstrkung
+		{&controlKi, MONITOR_TYPE_FLOAT, true, 0.0f, 1000.0f},
+		// 2: Betriebsart
+		{&controlMode, MONITOR_TYPE_UINT16, true, 0.0f, 3.0f},
+		// 3: Verworfene Bytes SCI-A (nur lesen)
+		{&uartA.rxOverflow, MONITOR_TYPE_UINT32, false, 0.0f, 0.0f},
+		// 4: CRC-Fehler der Telemetrie-Verbindung (nur lesen)
+		{&telemetryLinkA.crcErrors, MONITOR_TYPE_UINT32, false, 0.0f, 0.0f}
+};
 
 
 //=== Function: main ==============================================================================
@@ -63,10 +108,16 @@ void main(void)
 		// Mikrocontroller initialisieren (Watchdog, Systemtakt, Speicher, Interrupts)
 		DeviceInit(DEVICE_CLKSRC_EXTOSC_SE_25MHZ);
     // UART (SCI-A) initialisieren
-    UartInitA(UART_BAUD_115200,
-						  UART_DATA_8_BIT,
-						  UART_STOP_1_BIT,
-						  UART_PARITY_NONE);
+    UartInit(&uartA,
+    				 &uartPinsA,
+    				 UART_BAUD_115200,
+					   UART_DATA_8_BIT,
+					   UART_STOP_1_BIT,
+					   UART_PARITY_NONE);
+		// Telemetrie-Verbindung ber SCI-A initialisieren
+		TelemetryInit(&telemetryLinkA, &uartA);
+		// Debug-Monitor mit der Tabelle der Variablen initialisieren
+		MonitorInit(monitorVariables, sizeof(monitorVariables) / sizeof(MonitorVariable));
 		// Timer 8 als Zeitgeber initialisieren
     PwmInitPwm8();
 
@@ -74,24 +125,30 @@ void main(void)
     EALLOW;
 
 
+    // Alle Funktionen erhalten die Instanz des SCI-Moduls (uart = &uartA ... &uartD).
+    // Weitere Module werden analog mit eigener Pin-Belegung initialisiert, z.B.:
+    // const UartPins pinsB = {<GPIO RxD>, <Mux RxD>, <GPIO TxD>, <Mux TxD>};
+    // UartInit(&uartB, &pinsB, UART_BAUD_230400, UART_DATA_8_BIT, UART_STOP_1_BIT, UART_PARITY_NONE);
+    //
+    //
     // Ablauf einer UART Empfangs-Kommunikation:
     //
-    // 1) Mit "UartGetStatusRx()" sicherstellen, dass aktuell keine andere Kommunikation aktiv ist
-    // 2) Puffer "uartBufferRx[]" initialisieren
-    // 3) Funktion "UartReceive(n, TO)" aufrufen, n = Anzhal der zu sendenen Bytes, TO = Time-Out in 5 ms
-    // 4) Regelmig die Funktion "UartGetStatusRx()" aufrufen um den Empfang zu berwachen
-    // 5) Wenn die Funktion "UartGetStatusRx()" "UART_STATUS_FINISHED" zurckgibt, die Daten auswerten
-    // 6) Kommunikations-Status auf "idle" setzen mit "UartSetStatusIdleRx()"
+    // Der Empfang ist nach "UartInit()" dauerhaft eingeschaltet. Alle empfangenen Bytes
+    // werden in der ISR im Ringpuffer gespeichert, auch whrend das Hauptprogramm andere
+    // Aufgaben erledigt.
+    // 1) Regelmig die Funktion "UartRead(uart, data, n)" aufrufen, n = max. Anzahl der zu lesenden Bytes
+    // 2) Der Rckgabewert gibt die Anzahl der gelesenen Bytes an (0, falls nichts empfangen wurde)
+    // 3) Optional: Mit "UartAvailable(uart)" vorher die Anzahl der empfangenen Bytes abfragen
     //
     //
     // Ablauf einer UART Sende-Kommunikation:
     //
-    // 1) Mit "UartGetStatusTx()" sicherstellen, dass aktuell keine andere Kommunikation aktiv ist
-    // 2) Puffer "uartTxBuffer[]" initialisieren
-    // 3) Zu sendene Daten in "uartTxBuffer" schreiben
-    // 4) Funktion "UartTransmit(n)" aufrufen, n = Anzhal der zu sendenen Bytes
-    // 5) Warten bis die Kommunikation abgeschlossen ist durch Abfrage von "UartGetStatusTx()"
-    // 6) Kommunikations-Status auf "idle" setzen mit "UartSetStatusIdleTx()"
+    // 1) Funktion "UartWrite(uart, data, n)" aufrufen, n = Anzahl der zu sendenen Bytes. Die Funktion
+    //    kann jederzeit aufgerufen werden, auch whrend einer laufenden bertragung
+    // 2) Der Rckgabewert gibt die Anzahl der bernommenen Bytes an (weniger als n, falls
+    //    der Ringpuffer voll ist, freie Pltze knnen mit "UartGetFreeTx(uart)" abgefragt werden)
+    // 3) Optional: Ende der bertragung durch Abfrage von "UartGetStatusTx(uart)" erkennen und
+    //    Kommunikations-Status auf "idle" setzen mit "UartSetStatusIdleTx(uart)"
 
 
 		// GPIO 5 (LED D1002 auf ControlBoard) als Ausgang
@@ -112,10 +169,10 @@ void main(void)
 		// Dauerschleife Hauptprogramm
     while(1)
     {
-    		// Solange das Bit nicht gesetzt ist, sind noch Daten im
-    		// Tx-Ausgangs-Schieberegister und/oder im Tx-Ausgangsregister.
-    		// Kann z.B. zur Umschaltung eines RS485-Treibers genutzt werden
-    		if (SciaRegs.SCICTL2.bit.TXEMPTY)
+    		// Ende der Sende-Kommunikation erkennen (die Sende-ISR wartet nicht
+    		// darauf, dass das letzte Byte das Ausgangs-Schieberegister verlassen
+    		// hat). Kann z.B. zur Umschaltung eines RS485-Treibers genutzt werden
+    		if (UartCheckTxEmpty(&uartA))
     		{
     				// RS485-Treiber auf "Empfang" umschalten
     				// ...
@@ -123,90 +180,108 @@ void main(void)
 
 
     		// EMPFANGEN:
-    		// Alle 5 ms die Funktion "UartGetStatusRxA()" zur
-    		// berwachung des Empfangsvorgangs aufrufen
-    		if (uartFlagCheckRxA)
+    		// Alle 5 ms die empfangenen Bytes auswerten
+    		if (pwmFlagTimer)
     		{
-    				// Status abfragen (darf nicht mehrmals in der if-Abfrage geschehen,
-						// da zwischen zwei Abfragen mindestens 10/Baud Sekunden vergehen mssen)
-						uint16_t state = UartGetStatusRxA();
-    				// Es ist keine Empfangs-Kommunikation aktiv
-    				if (state == UART_STATUS_IDLE)
-						{
-								// Den Empfang von 5 Datenbytes ohne Timeout initiieren
-								if (!UartReceiveA(5, UART_NO_TIMEOUT))
-								{
-										// Fehlerbehandlung:
-										// ...
-								}
-						}
-    				// Es wurde ein vollstndiges Datenpaket empfangen
-    				else if (state == UART_STATUS_FINISHED)
+    				// Flag lschen, damit die Daten erst in 5 ms wieder ausgewertet werden
+    				pwmFlagTimer = false;
+#if MAIN_USE_TELEMETRY
+    				// Ein empfangenes Paket auswerten (bearbeitet max. TELEMETRY_MAX_BYTES_PER_POLL
+    				// Bytes pro Aufruf, weitere Pakete werden in den nchsten 5 ms bearbeitet)
+    				if (TelemetryPoll(&telemetryLinkA, &telemetryFrame))
     				{
-    						// Empfangene Daten auswerten:
     		    		// LED D1002 auf dem ControlBoard umschalten um
-    						// den Empfang eines Datenpakets zu signalisieren
+    						// den Empfang eines Pakets zu signalisieren
     						GpioDataRegs.GPATOGGLE.bit.GPIO5 = 1;
-
-    						// Empfangs-Kommunikation in den Zustand "idle" (bereit)
-    						// versetzen (Rckgabewert wird hier nicht gebraucht)
-    						UartSetStatusIdleRxA();
+    						// Befehle des Debug-Monitors bearbeiten, andere Pakete
+    						// mit den Nutzdaten als Antwort zurcksenden
+    						if (   !MonitorHandleFrame(&telemetryLinkA, &telemetryFrame)
+    								&& !TelemetrySend(&telemetryLinkA,
+    																	telemetryFrame.id | MAIN_TELEMETRY_ID_RESPONSE,
+    																	telemetryFrame.payload,
+    																	telemetryFrame.length))
+    						{
+    								// Fehlerbehandlung (Sende-Ringpuffer voll):
+    								// ...
+    						}
     				}
-    				// Es ist ein Timeout aufgetreten (kein vollstndiger
-    				// Datenempfang innerhalb des definerten Zeitfensters)
-    				else if (state == UART_STATUS_RX_TIMEOUT)
+#else
+    				// Bis zu 16 empfangene Bytes aus dem Ringpuffer lesen
+    				uint16_t numberOfBytes = UartRead(&uartA, rxData, 16);
+    				if (numberOfBytes > 0)
     				{
-    						// Fehlerbehandlung:
-    						// ...
-    						// Empfangs-Kommunikation in den Zustand "idle" (bereit)
-								// versetzen (Rckgabewert wird hier nicht gebraucht)
-								UartSetStatusIdleRxA();
+    						// Empfangene Daten auswerten:
+    		    		// LED D1002 auf dem ControlBoard umschalten um
+    						// den Empfang von Daten zu signalisieren
+    						GpioDataRegs.GPATOGGLE.bit.GPIO5 = 1;
+    						// Empfangene Daten zurcksenden (Echo)
+    						if (UartWrite(&uartA, rxData, numberOfBytes) != numberOfBytes)
+    						{
+    								// Fehlerbehandlung (Sende-Ringpuffer voll):
+    								// ...
+    						}
     				}
-
-    				// SCI-Modul reseten, falls ein Rx-Fehler aufgetreten ist.
-    				// Z.B. passiert dies, wenn der Rx-Interrupt ausgeschaltet
-    				// ist und Daten empfangen werden. Dann wird der Rx-Puffer
-    				// nicht ausgelesen und es kommt zu einem berlauf
-						if (SciaRegs.SCIRXST.bit.RXERROR == 1)
-						{
-								SciaRegs.SCICTL1.bit.SWRESET = 0;
-								SciaRegs.SCICTL1.bit.SWRESET = 1;
-						}
-
-    				// Flag lschen, damit die Funktion "UartGetStatusRx()"
-    				// erst in 5 ms wieder aufgerufen wird
-    				uartFlagCheckRxA = false;
+#endif
     		}
 
 
     		// SENDEN:
-    		// Datenpaket nur senden, falls keine andere Sende-Kommunikation aktiv ist
-    		if (   (UartGetStatusTxA() == UART_STATUS_IDLE)
-    				&& (goTx == 1))
+    		if (goTx == 1)
     		{
     				// Datenpaket nur einmal senden
         		goTx = 0;
-            // Daten, welche versendet werden sollen, in den Sende-Puffer schreiben
-    				uartBufferTxA[0] = 1;
-            uartBufferTxA[1] = 2;
-            uartBufferTxA[2] = 3;
-            // Sendevorgang starten (3 Bytes senden)
-        		if (!UartTransmitA(20))
+            // Daten, welche versendet werden sollen, in den Sende-Ringpuffer schreiben
+        		uint16_t txData[3] = {1, 2, 3};
+#if MAIN_USE_TELEMETRY
+        		if (!TelemetrySend(&telemetryLinkA, MAIN_TELEMETRY_ID_DATA, txData, 3))
+#else
+        		if (UartWrite(&uartA, txData, 3) != 3)
+#endif
         		{
-        				// Fehlerbehandlung:
+        				// Fehlerbehandlung (Sende-Ringpuffer voll):
         				// ...
         		}
     		}
+    		// Nachricht aus Kopf und Datenblock ohne Kopie senden
+    		else if (   (goTx == 2)
+    						 && !txBlockBusy)
+    		{
+    				goTx = 0;
+    				for (uint16_t i = 0; i < 64; i++)
+    				{
+    						txBlock[i] = i;
+    				}
+    				const UartTxSegment segments[2] = {{txHeader, 2}, {txBlock, 64}};
+    				txBlockBusy = true;
+    				if (!UartQueueTxGather(&uartA, segments, 2, &MainTxDone, 0))
+    				{
+    						// Fehlerbehandlung (keine Sende-Deskriptoren frei):
+    						txBlockBusy = false;
+    				}
+    		}
     		// Datenpaket wurde vollstndig gesendet
-    		else if (UartGetStatusTxA() == UART_STATUS_FINISHED)
+    		if (UartGetStatusTx(&uartA) == UART_STATUS_FINISHED)
     		{
     				// Sende-Kommunikation in den Zustand "idle" (bereit)
     				// versetzen (Rckgabewert wird hier nicht gebraucht)
-    				UartSetStatusIdleTxA();
+    				UartSetStatusIdleTx(&uartA);
     		}
 
     }
 }
 
 
-
+//=== Function: MainTxDone ========================================================================
+///
+/// @brief  Funktion wird aus der Sende-ISR aufgerufen, sobald die Puffer "txHeader" und "txBlock"
+///					vollstndig in den Sende-FIFO kopiert wurden und wieder verndert werden drfen.
+///
+/// @param  void *context
+///
+/// @return void
+///
+//=================================================================================================
+void MainTxDone(void *context)
+{
+		txBlockBusy = false;
+}
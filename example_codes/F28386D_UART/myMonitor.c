@@ -0,0 +1,378 @@
+//=================================================================================================
+/// @file       myMonitor.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Debug-Monitor, mit dem registrierte
+///							Variablen ber die serielle Schnittstelle gelesen und geschrieben werden knnen
+///							(z.B. zum Einstellen von Reglerparametern ohne Debugger). Die Kommunikation
+///							erfolgt ber Telemetrie-Pakete ("myTelemetry.c"). Die Variablen werden in einer
+///							Tabelle ("MonitorVariable") mit Typ, Grenzen und Schreibrecht registriert und ber
+///							ihren Index in der Tabelle angesprochen. Mehrere Variablen knnen mit einem Paket
+///							gelesen werden. Zustzlich knnen Speicherblcke ber ihre Adresse gelesen werden.
+///							Dies ist nur fr die RAM-Bereiche M0/M1, LS0 ... LS7 und GS0 ... GS15 erlaubt, da
+///							das Lesen von Peripherie-Registern Seiteneffekte hat (z.B. entnimmt das Lesen von
+///							SCIRXBUF ein Byte aus dem FIFO) und nicht belegte Adressen einen Fehler auslsen.
+///							Pro Aufruf von "MonitorHandleFrame()" wird genau ein Paket bearbeitet, die
+///							Bearbeitungszeit ist durch die max. Paketlnge begrenzt.
+///
+///							Befehle (Nutzdaten, alle Werte Big-Endian):
+///							MONITOR_ID_READ  : <Index 0> <Index 1> ...
+///							  Antwort        : <Index 0> <Wert 0 (2 oder 4 Bytes)> <Index 1> <Wert 1> ...
+///							MONITOR_ID_WRITE : <Index> <Wert (2 oder 4 Bytes)>
+///							  Antwort        : <Index> <Status>
+///							MONITOR_ID_MEMORY: <Adresse (4 Bytes)> <Anzahl 16-Bit-Worte>
+///							  Antwort        : <Adresse (4 Bytes)> <Wort 0 (2 Bytes)> <Wort 1> ...
+///							MONITOR_ID_INFO  : -
+///							  Antwort        : <Anzahl Variablen> <Typ 0> <Typ 1> ... (Bit 7: schreibbar)
+///							Antworten werden mit der ID des Befehls | MONITOR_ID_RESPONSE gesendet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myMonitor.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Tabelle der registrierten Variablen (muss whrend der Laufzeit gltig bleiben)
+const MonitorVariable *monitorTable = 0;
+uint16_t monitorNumberOfVariables = 0;
+// Anzahl der bearbeiteten Befehle und der ungltigen Befehle
+uint32_t monitorCommands = 0;
+uint32_t monitorErrors = 0;
+// Puffer fr die Nutzdaten der Antwort
+uint16_t monitorResponse[TELEMETRY_SIZE_PAYLOAD_MAX];
+// RAM-Bereiche, die mit MONITOR_ID_MEMORY gelesen werden drfen (CPU1, siehe Memory Map
+// im Datenblatt TMS320F2838x bzw. "2838x_RAM_lnk_cpu1.cmd")
+const MonitorMemoryRange monitorMemoryRanges[MONITOR_NUMBER_OF_MEMORY_RANGES] =
+{
+		// M0 und M1 RAM
+		{0x00000000UL, 0x00000800UL},
+		// LS0 ... LS7 RAM
+		{0x00008000UL, 0x0000C000UL},
+		// GS0 ... GS15 RAM
+		{0x0000D000UL, 0x0001D000UL}
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: MonitorInit =======================================================================
+///
+/// @brief  Funktion bernimmt die Tabelle der registrierten Variablen. Der Index einer Variable in
+///					der Tabelle ist ihre Kennung in den Befehlen (max. 255 Variablen). Die Funktion gibt
+///					"false" zurck, falls die Tabelle ungltig ist.
+///
+/// @param  const MonitorVariable *table, uint16_t numberOfVariables
+///
+/// @return bool operationPerformed
+///
+//=================================================================================================
+bool MonitorInit(const MonitorVariable *table,
+								 uint16_t numberOfVariables)
+{
+		if (   (table == 0)
+				|| (numberOfVariables > 255))
+		{
+				return false;
+		}
+		for (uint16_t i = 0; i < numberOfVariables; i++)
+		{
+				if (   (table[i].address == 0)
+						|| (table[i].type > MONITOR_TYPE_FLOAT))
+				{
+						return false;
+				}
+		}
+		monitorTable             = table;
+		monitorNumberOfVariables = numberOfVariables;
+		monitorCommands          = 0;
+		monitorErrors            = 0;
+		return true;
+}
+
+
+//=== Function: MonitorHandleFrame ================================================================
+///
+/// @brief  Funktion bearbeitet ein empfangenes Telemetrie-Paket und sendet die Antwort. Pakete mit
+///					einer ID, die nicht zum Monitor gehrt, werden nicht bearbeitet und es wird "false"
+///					zurckgegeben (das Paket kann dann von der Anwendung ausgewertet werden). Die
+///					Bearbeitungszeit ist durch die Lnge eines Pakets begrenzt: Beim Lesen werden
+///					Variablen, deren Wert nicht mehr in die Antwort passt, nicht gelesen.
+///
+/// @param  TelemetryLink *link, const TelemetryFrame *frame
+///
+/// @return bool frameHandled
+///
+//=================================================================================================
+bool MonitorHandleFrame(TelemetryLink *link,
+												const TelemetryFrame *frame)
+{
+		uint16_t length = 0;
+		switch (frame->id)
+		{
+				// Eine oder mehrere Variablen lesen
+				case MONITOR_ID_READ:
+						for (uint16_t i = 0; i < frame->length; i++)
+						{
+								uint16_t index = frame->payload[i];
+								if (index >= monitorNumberOfVariables)
+								{
+										monitorErrors++;
+										continue;
+								}
+								const MonitorVariable *variable = &monitorTable[index];
+								uint16_t size = MonitorGetSize(variable->type);
+								if ((length + 1U + size) > TELEMETRY_SIZE_PAYLOAD_MAX)
+								{
+										break;
+								}
+								uint32_t value = MonitorReadValue(variable);
+								monitorResponse[length] = index;
+								length++;
+								for (uint16_t j = size; j > 0; j--)
+								{
+										monitorResponse[length] = (value >> ((j - 1U) * 8U)) & 0x00FF;
+										length++;
+								}
+						}
+						break;
+
+				// Eine Variable schreiben
+				case MONITOR_ID_WRITE:
+				{
+						uint16_t status = MONITOR_STATUS_INVALID_INDEX;
+						uint16_t index  = frame->payload[0];
+						if (   (frame->length > 0)
+								&& (index < monitorNumberOfVariables))
+						{
+								const MonitorVariable *variable = &monitorTable[index];
+								uint16_t size = MonitorGetSize(variable->type);
+								if (frame->length != (1U + size))
+								{
+										status = MONITOR_STATUS_INVALID_LENGTH;
+								}
+								else
+								{
+										uint32_t value = 0;
+										for (uint16_t j = 0; j < size; j++)
+										{
+												value = (value << 8) | (frame->payload[1U + j] & 0x00FF);
+										}
+										status = MonitorWriteValue(variable, value);
+								}
+						}
+						if (status != MONITOR_STATUS_OK)
+						{
+								monitorErrors++;
+						}
+						monitorResponse[0] = index;
+						monitorResponse[1] = status;
+						length = 2;
+						break;
+				}
+
+				// Speicherblock lesen
+				case MONITOR_ID_MEMORY:
+				{
+						if (frame->length != 5)
+						{
+								monitorErrors++;
+								break;
+						}
+						uint32_t address = ((uint32_t)frame->payload[0] << 24)
+														 | ((uint32_t)frame->payload[1] << 16)
+														 | ((uint32_t)frame->payload[2] << 8)
+														 |  (uint32_t)frame->payload[3];
+						uint16_t numberOfWords = frame->payload[4];
+						if (numberOfWords > MONITOR_MEMORY_WORDS_MAX)
+						{
+								numberOfWords = MONITOR_MEMORY_WORDS_MAX;
+						}
+						// Nur RAM lesen (keine Peripherie-Register und nicht belegte Adressen)
+						if (!MonitorIsReadable(address, numberOfWords))
+						{
+								monitorErrors++;
+								break;
+						}
+						for (uint16_t j = 0; j < 4; j++)
+						{
+								monitorResponse[j] = frame->payload[j];
+						}
+						length = 4;
+						volatile uint16_t *memory = (volatile uint16_t *)address;
+						for (uint16_t j = 0; j < numberOfWords; j++)
+						{
+								uint16_t word = memory[j];
+								monitorResponse[length]      = word >> 8;
+								monitorResponse[length + 1U] = word & 0x00FF;
+								length += 2;
+						}
+						break;
+				}
+
+				// Anzahl und Typen der registrierten Variablen
+				case MONITOR_ID_INFO:
+						monitorResponse[0] = monitorNumberOfVariables;
+						length = 1;
+						for (uint16_t i = 0; i < monitorNumberOfVariables; i++)
+						{
+								if (length >= TELEMETRY_SIZE_PAYLOAD_MAX)
+								{
+										break;
+								}
+								monitorResponse[length] = monitorTable[i].type
+																				| (monitorTable[i].writable ? MONITOR_FLAG_WRITABLE : 0);
+								length++;
+						}
+						break;
+
+				// Kein Befehl des Monitors
+				default:
+						return false;
+		}
+
+		monitorCommands++;
+		// Antwort senden (wird bei vollem Sende-Ringpuffer
+		// verworfen und in "framesDropped" gezhlt)
+		TelemetrySend(link, frame->id | MONITOR_ID_RESPONSE, monitorResponse, length);
+		return true;
+}
+
+
+//=== Function: MonitorIsReadable =================================================================
+///
+/// @brief  Funktion gibt "true" zurck, falls der Speicherblock mit "numberOfWords" 16-Bit-Worten
+///					ab "address" vollstndig in einem der RAM-Bereiche "monitorMemoryRanges" liegt.
+///
+/// @param  uint32_t address, uint16_t numberOfWords
+///
+/// @return bool readable
+///
+//=================================================================================================
+bool MonitorIsReadable(uint32_t address,
+											 uint16_t numberOfWords)
+{
+		for (uint16_t i = 0; i < MONITOR_NUMBER_OF_MEMORY_RANGES; i++)
+		{
+				const MonitorMemoryRange *range = &monitorMemoryRanges[i];
+				if (   (address >= range->start)
+						&& (address < range->end)
+						&& (numberOfWords <= (range->end - address)))
+				{
+						return true;
+				}
+		}
+		return false;
+}
+
+
+//=== Function: MonitorGetSize ====================================================================
+///
+/// @brief  Funktion gibt die Gre einer Variable des Typs "type" in Bytes zurck (2 oder 4).
+///
+/// @param  uint16_t type
+///
+/// @return uint16_t size
+///
+//=================================================================================================
+uint16_t MonitorGetSize(uint16_t type)
+{
+		if (   (type == MONITOR_TYPE_UINT16)
+				|| (type == MONITOR_TYPE_INT16))
+		{
+				return 2;
+		}
+		return 4;
+}
+
+
+//=== Function: MonitorReadValue ==================================================================
+///
+/// @brief  Funktion liest den Wert einer Variable und gibt ihn als 32-Bit-Wert zurck (16-Bit-Werte
+///					in den unteren 16 Bit, float als Bitmuster). 32-Bit-Variablen werden mit einem
+///					Zugriff gelesen, eine ISR kann den Wert daher nicht whrend des Lesens verndern.
+///
+/// @param  const MonitorVariable *variable
+///
+/// @return uint32_t value
+///
+//=================================================================================================
+uint32_t MonitorReadValue(const MonitorVariable *variable)
+{
+		if (MonitorGetSize(variable->type) == 2)
+		{
+				return *(volatile uint16_t *)variable->address;
+		}
+		return *(volatile uint32_t *)variable->address;
+}
+
+
+//=== Function: MonitorWriteValue =================================================================
+///
+/// @brief  Funktion schreibt "value" in eine Variable, falls diese schreibbar ist und der Wert
+///					innerhalb der Grenzen liegt, und gibt den Status zurck (MONITOR_STATUS_...).
+///					32-Bit-Variablen werden mit einem Zugriff geschrieben.
+///
+/// @param  const MonitorVariable *variable, uint32_t value
+///
+/// @return uint16_t status
+///
+//=================================================================================================
+uint16_t MonitorWriteValue(const MonitorVariable *variable,
+													 uint32_t value)
+{
+		if (!variable->writable)
+		{
+				return MONITOR_STATUS_READ_ONLY;
+		}
+
+		// Wert fr die Prfung der Grenzen in float umwandeln
+		union
+		{
+				uint32_t u;
+				float f;
+		} number;
+		number.u = value;
+		float compare;
+		switch (variable->type)
+		{
+				case MONITOR_TYPE_UINT16:
+						compare = (float)(uint16_t)value;
+						break;
+				case MONITOR_TYPE_INT16:
+						compare = (float)(int16_t)value;
+						break;
+				case MONITOR_TYPE_UINT32:
+						compare = (float)value;
+						break;
+				case MONITOR_TYPE_INT32:
+						compare = (float)(int32_t)value;
+						break;
+				default:
+						compare = number.f;
+						break;
+		}
+		// Ungltige float-Werte (NaN) werden durch diese Abfrage ebenfalls abgelehnt
+		if (!((compare >= variable->min) && (compare <= variable->max)))
+		{
+				return MONITOR_STATUS_OUT_OF_RANGE;
+		}
+
+		if (MonitorGetSize(variable->type) == 2)
+		{
+				*(volatile uint16_t *)variable->address = (uint16_t)value;
+		}
+		else
+		{
+				*(volatile uint32_t *)variable->address = value;
+		}
+		return MONITOR_STATUS_OK;
+}
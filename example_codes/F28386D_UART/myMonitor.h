@@ -0,0 +1,133 @@
+//=================================================================================================
+/// @file       myMonitor.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr einen Debug-Monitor, mit dem registrierte
+///							Variablen ber die serielle Schnittstelle gelesen und geschrieben werden knnen
+///							(z.B. zum Einstellen von Reglerparametern ohne Debugger). Die Kommunikation
+///							erfolgt ber Telemetrie-Pakete ("myTelemetry.c"). Die Variablen werden in einer
+///							Tabelle ("MonitorVariable") mit Typ, Grenzen und Schreibrecht registriert und ber
+///							ihren Index in der Tabelle angesprochen. Mehrere Variablen knnen mit einem Paket
+///							gelesen werden. Zustzlich knnen Speicherblcke ber ihre Adresse gelesen werden.
+///							Dies ist nur fr die RAM-Bereiche M0/M1, LS0 ... LS7 und GS0 ... GS15 erlaubt, da
+///							das Lesen von Peripherie-Registern Seiteneffekte hat (z.B. entnimmt das Lesen von
+///							SCIRXBUF ein Byte aus dem FIFO) und nicht belegte Adressen einen Fehler auslsen.
+///							Pro Aufruf von "MonitorHandleFrame()" wird genau ein Paket bearbeitet, die
+///							Bearbeitungszeit ist durch die max. Paketlnge begrenzt.
+///
+///							Befehle (Nutzdaten, alle Werte Big-Endian):
+///							MONITOR_ID_READ  : <Index 0> <Index 1> ...
+///							  Antwort        : <Index 0> <Wert 0 (2 oder 4 Bytes)> <Index 1> <Wert 1> ...
+///							MONITOR_ID_WRITE : <Index> <Wert (2 oder 4 Bytes)>
+///							  Antwort        : <Index> <Status>
+///							MONITOR_ID_MEMORY: <Adresse (4 Bytes)> <Anzahl 16-Bit-Worte>
+///							  Antwort        : <Adresse (4 Bytes)> <Wort 0 (2 Bytes)> <Wort 1> ...
+///							MONITOR_ID_INFO  : -
+///							  Antwort        : <Anzahl Variablen> <Typ 0> <Typ 1> ... (Bit 7: schreibbar)
+///							Antworten werden mit der ID des Befehls | MONITOR_ID_RESPONSE gesendet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYMONITOR_H_
+#define MYMONITOR_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myTelemetry.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Nachrichten-IDs der Befehle
+#define MONITOR_ID_READ													0x10
+#define MONITOR_ID_WRITE												0x11
+#define MONITOR_ID_MEMORY												0x12
+#define MONITOR_ID_INFO													0x13
+// Kennung einer Antwort (wird zur ID des Befehls addiert)
+#define MONITOR_ID_RESPONSE											0x80
+// Datentypen der Variablen
+#define MONITOR_TYPE_UINT16											0
+#define MONITOR_TYPE_INT16											1
+#define MONITOR_TYPE_UINT32											2
+#define MONITOR_TYPE_INT32											3
+#define MONITOR_TYPE_FLOAT											4
+// Variable darf geschrieben werden (Bit in "MONITOR_ID_INFO")
+#define MONITOR_FLAG_WRITABLE										0x80
+// Status eines Schreibbefehls
+#define MONITOR_STATUS_OK												0
+#define MONITOR_STATUS_INVALID_INDEX						1
+#define MONITOR_STATUS_READ_ONLY								2
+#define MONITOR_STATUS_OUT_OF_RANGE							3
+#define MONITOR_STATUS_INVALID_LENGTH						4
+// Max. Anzahl der 16-Bit-Worte beim Lesen eines Speicherblocks
+#define MONITOR_MEMORY_WORDS_MAX								((TELEMETRY_SIZE_PAYLOAD_MAX - 4U) / 2U)
+// Anzahl der RAM-Bereiche, die mit MONITOR_ID_MEMORY gelesen werden drfen
+#define MONITOR_NUMBER_OF_MEMORY_RANGES					3
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Registrierte Variable
+typedef struct
+{
+		// Adresse der Variable
+		void *address;
+		// Datentyp (MONITOR_TYPE_...)
+		uint16_t type;
+		// Variable darf ber den Monitor geschrieben werden
+		bool writable;
+		// Grenzen fr Schreibzugriffe (werden fr alle Typen als float verglichen)
+		float min;
+		float max;
+} MonitorVariable;
+
+// Adressbereich, der mit MONITOR_ID_MEMORY gelesen werden darf
+typedef struct
+{
+		// Erste Adresse und erste Adresse nach dem Bereich
+		uint32_t start;
+		uint32_t end;
+} MonitorMemoryRange;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Anzahl der bearbeiteten Befehle und der ungltigen Befehle
+extern uint32_t monitorCommands;
+extern uint32_t monitorErrors;
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion bernimmt die Tabelle der registrierten Variablen
+extern bool MonitorInit(const MonitorVariable *table,
+												uint16_t numberOfVariables);
+// Funktion bearbeitet ein empfangenes Telemetrie-Paket
+extern bool MonitorHandleFrame(TelemetryLink *link,
+															 const TelemetryFrame *frame);
+// Funktion prft, ob ein Speicherblock vollstndig in einem erlaubten RAM-Bereich liegt
+extern bool MonitorIsReadable(uint32_t address,
+															uint16_t numberOfWords);
+// Funktion gibt die Gre einer Variable in Bytes zurck
+extern uint16_t MonitorGetSize(uint16_t type);
+// Funktion liest den Wert einer Variable als 32-Bit-Wert
+extern uint32_t MonitorReadValue(const MonitorVariable *variable);
+// Funktion schreibt den Wert einer Variable nach Prfung der Grenzen
+extern uint16_t MonitorWriteValue(const MonitorVariable *variable,
+																	uint32_t value);
+
+
+#endif
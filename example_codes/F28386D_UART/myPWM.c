@@ -21,6 +21,8 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Wird alle 5 ms in "Pwm8ISR()" gesetzt und im Hauptprogramm gelscht
+volatile bool pwmFlagTimer = false;
 
 
 //-------------------------------------------------------------------------------------------------
@@ -92,8 +94,8 @@ void PwmInitPwm8(void)
 
 //=== Function: Epwm8ISR ==========================================================================
 ///
-/// @brief  ISR wird alle 5 ms aufgerufen. Wird als Zeitgeber fr den Aufruf der Funktion
-///					"UartGetStatusRxA()" verwendet. Diese Funktion berwacht den Empfang von UART-Daten
+/// @brief  ISR wird alle 5 ms aufgerufen. Wird als Zeitgeber fr periodisch zu erledigende
+///					Aufgaben im Hauptprogramm verwendet (z.B. Auswertung der empfangenen UART-Daten)
 ///
 /// @param  void
 ///
@@ -111,13 +113,8 @@ __interrupt void Pwm8ISR(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Flag fr den Aufruf der Funktion "UartGetStatusRx()" setzen
-		uartFlagCheckRxA = true;
-		// Timeout-Zhler herunterzhlen
-		if (uartRxTimeoutA > 0)
-		{
-				uartRxTimeoutA--;
-		}
+		// Flag fr periodisch zu erledigende Aufgaben setzen
+		pwmFlagTimer = true;
 
     // Interrupt-Flag im ePWM8-Modul lschen
 		EPwm8Regs.ETCLR.bit.INT = 1;
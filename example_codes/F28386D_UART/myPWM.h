@@ -18,7 +18,6 @@
 // Includes
 //-------------------------------------------------------------------------------------------------
 #include "myDevice.h"
-#include "myUART.h"
 
 
 //-------------------------------------------------------------------------------------------------
@@ -215,12 +214,14 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
+// Wird alle 5 ms in "Pwm8ISR()" gesetzt und im Hauptprogramm gelscht
+extern volatile bool pwmFlagTimer;
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
-// Funktion initialisiert das ePWM8-Modul um alle 100 ms einen Interrupt auszulsen
+// Funktion initialisiert das ePWM8-Modul um alle 5 ms einen Interrupt auszulsen
 extern void PwmInitPwm8(void);
 // Interrupt-Service-Routine des ePWM8-Moduls
 __interrupt void Pwm8ISR(void);
@@ -0,0 +1,379 @@
+//=================================================================================================
+/// @file       myTelemetry.c
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein binres Telemetrie-Protokoll ber
+///							UART ("myUART.c"). Jedes Datenpaket besteht aus Nachrichten-ID, Sequenznummer,
+///							Nutzdaten und einer CRC-16 (CCITT, Polynom 0x1021, Startwert 0xFFFF). Das Paket
+///							wird mit COBS (Consistent Overhead Byte Stuffing) kodiert und mit einem 0x00-Byte
+///							abgeschlossen, so dass der Empfnger den Anfang eines Pakets nach einem Fehler
+///							sicher wiederfindet. Beim Senden wird das Paket ohne Zwischenpuffer direkt im
+///							Sende-Ringpuffer des UART-Moduls kodiert. Empfangene Pakete werden aus dem
+///							Hauptprogramm mit "TelemetryPoll()" ausgewertet, die Bearbeitungszeit pro Aufruf
+///							ist durch TELEMETRY_MAX_BYTES_PER_POLL begrenzt.
+///
+///							Aufbau eines Pakets (vor der COBS-Kodierung, ein Byte pro uint16_t):
+///							<ID> <Sequenznummer> <Nutzdaten 0 ... 128 Bytes> <CRC High> <CRC Low>
+///							Die CRC wird ber ID, Sequenznummer und Nutzdaten gebildet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myTelemetry.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Tabelle fr die CRC-16-Berechnung (CCITT, Polynom 0x1021). Ein Byte wird mit einem
+// Tabellenzugriff statt mit 8 Schiebe-Operationen verarbeitet
+const uint16_t telemetryCrcTable[256] =
+{
+		0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+		0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+		0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+		0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+		0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+		0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+		0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+		0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+		0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+		0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+		0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+		0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+		0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+		0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+		0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+		0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+		0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+		0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+		0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+		0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+		0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+		0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+		0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+		0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+		0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+		0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+		0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+		0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+		0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+		0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+		0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+		0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+
+
+//-------------------------------------------------------------------------------------------------
+// Global functions
+//-------------------------------------------------------------------------------------------------
+//=== Function: TelemetryInit =====================================================================
+///
+/// @brief  Funktion initialisiert eine Verbindung ber ein UART-Modul. Das UART-Modul muss zuvor
+///					mit "UartInit()" initialisiert werden.
+///
+/// @param  TelemetryLink *link, UartInstance *uart
+///
+/// @return void
+///
+//=================================================================================================
+void TelemetryInit(TelemetryLink *link,
+									 UartInstance *uart)
+{
+		link->uart            = uart;
+		link->sequenceTx      = 0;
+		link->sequenceRx      = 0;
+		link->sequenceRxValid = false;
+		link->lengthRx        = 0;
+		link->discardRx       = false;
+		link->framesTx        = 0;
+		link->framesRx        = 0;
+		link->framesDropped   = 0;
+		link->crcErrors       = 0;
+		link->framingErrors   = 0;
+		link->sequenceErrors  = 0;
+}
+
+
+//=== Function: TelemetrySend =====================================================================
+///
+/// @brief  Funktion sendet ein Paket mit der Nachrichten-ID "id" und "length" Bytes Nutzdaten.
+///					ID, Sequenznummer, Nutzdaten und CRC werden ohne Zwischenpuffer direkt in den
+///					Sende-Ringpuffer des UART-Moduls COBS-kodiert und anschlieend mit
+///					"UartCommitTx()" zum Senden freigegeben. Die Funktion gibt "false" zurck (und
+///					zhlt das Paket in "framesDropped"), falls die Nutzdaten zu lang sind oder im
+///					Sende-Ringpuffer nicht genug Platz fr das vollstndige Paket ist. Es werden nie
+///					unvollstndige Pakete gesendet. Da eine Callback-Funktion der Sende-ISR ebenfalls
+///					in den Ringpuffer schreiben kann, wird das Paket mit gesperrten CPU-Interrupts
+///					kodiert und freigegeben.
+///
+/// @param  TelemetryLink *link, uint16_t id, const uint16_t *payload, uint16_t length
+///
+/// @return bool frameQueued
+///
+//=================================================================================================
+bool TelemetrySend(TelemetryLink *link,
+									 uint16_t id,
+									 const uint16_t *payload,
+									 uint16_t length)
+{
+		UartInstance *uart = link->uart;
+		// Lnge des Pakets vor und nach der Kodierung (inkl. Endekennung)
+		uint16_t lengthFrame   = TELEMETRY_SIZE_HEADER + length + TELEMETRY_SIZE_CRC;
+		uint16_t lengthEncoded = lengthFrame + (lengthFrame / 254U) + 2U;
+		if (length > TELEMETRY_SIZE_PAYLOAD_MAX)
+		{
+				link->framesDropped++;
+				return false;
+		}
+		// Platz prfen, Paket ab dem Schreibindex kodieren und freigeben mit gesperrten
+		// CPU-Interrupts (vorherigen Zustand wiederherstellen)
+		uint16_t interruptState = __disable_interrupts();
+		if (UartGetFreeTx(uart) < lengthEncoded)
+		{
+				__restore_interrupts(interruptState);
+				link->framesDropped++;
+				return false;
+		}
+
+		// COBS-Kodierung: Jeder Block beginnt mit einem Code-Byte, das die Position
+		// des nchsten 0x00-Bytes angibt (bzw. 0xFF fr 254 Bytes ohne 0x00). Die
+		// Positionen sind relativ zum Schreibindex des Sende-Ringpuffers
+		uint16_t head     = uart->headTx;
+		uint16_t position = 1;
+		uint16_t positionCode = 0;
+		uint16_t code     = 1;
+		uint16_t crc      = TELEMETRY_CRC_INIT;
+		uint16_t data;
+		for (uint16_t i = 0; i < lengthFrame; i++)
+		{
+				// Nchstes Byte des Pakets bestimmen und CRC aktualisieren
+				if (i == 0)
+				{
+						data = id & 0x00FF;
+				}
+				else if (i == 1)
+				{
+						data = link->sequenceTx & 0x00FF;
+				}
+				else if (i < (TELEMETRY_SIZE_HEADER + length))
+				{
+						data = payload[i - TELEMETRY_SIZE_HEADER] & 0x00FF;
+				}
+				else if (i == (TELEMETRY_SIZE_HEADER + length))
+				{
+						data = crc >> 8;
+				}
+				else
+				{
+						data = crc & 0x00FF;
+				}
+				if (i < (TELEMETRY_SIZE_HEADER + length))
+				{
+						crc = (crc << 8) ^ telemetryCrcTable[((crc >> 8) ^ data) & 0x00FF];
+				}
+
+				// Byte kodieren
+				if (data == 0)
+				{
+						// Block abschlieen
+						uart->ringTx[(head + positionCode) & (UART_SIZE_RING_BUFFER_TX - 1U)] = code;
+						positionCode = position;
+						position++;
+						code = 1;
+				}
+				else
+				{
+						uart->ringTx[(head + position) & (UART_SIZE_RING_BUFFER_TX - 1U)] = data;
+						position++;
+						code++;
+						// Max. Blocklnge erreicht
+						if (code == 0xFF)
+						{
+								uart->ringTx[(head + positionCode) & (UART_SIZE_RING_BUFFER_TX - 1U)] = code;
+								positionCode = position;
+								position++;
+								code = 1;
+						}
+				}
+		}
+		// Letzten Block abschlieen und Endekennung anhngen
+		uart->ringTx[(head + positionCode) & (UART_SIZE_RING_BUFFER_TX - 1U)] = code;
+		uart->ringTx[(head + position) & (UART_SIZE_RING_BUFFER_TX - 1U)] = TELEMETRY_DELIMITER;
+		position++;
+
+		// Paket zum Senden freigeben
+		UartCommitTx(uart, position);
+		__restore_interrupts(interruptState);
+		link->sequenceTx = (link->sequenceTx + 1U) & 0x00FF;
+		link->framesTx++;
+		return true;
+}
+
+
+//=== Function: TelemetryPoll =====================================================================
+///
+/// @brief  Funktion liest empfangene Bytes aus dem Empfangs-Ringpuffer des UART-Moduls, bis eine
+///					Endekennung empfangen wurde oder TELEMETRY_MAX_BYTES_PER_POLL Bytes bearbeitet
+///					wurden. Bei einer Endekennung wird das Paket dekodiert und die CRC geprft. Ist das
+///					Paket gltig, wird es in "frame" gespeichert und "true" zurckgegeben. Die weiteren
+///					Bytes bleiben im Ringpuffer und werden beim nchsten Aufruf bearbeitet. Fehlerhafte
+///					Pakete werden verworfen und gezhlt, eine Lcke in den Sequenznummern wird in
+///					"sequenceErrors" gezhlt. Die Funktion wird periodisch aus dem Hauptprogramm
+///					aufgerufen.
+///
+/// @param  TelemetryLink *link, TelemetryFrame *frame
+///
+/// @return bool frameReceived
+///
+//=================================================================================================
+bool TelemetryPoll(TelemetryLink *link,
+									 TelemetryFrame *frame)
+{
+		uint16_t data;
+		// Restliche Bytes aus dem Empfangs-FIFO in den Ringpuffer kopieren
+		UartAvailable(link->uart);
+		for (uint16_t i = 0; i < TELEMETRY_MAX_BYTES_PER_POLL; i++)
+		{
+				if (!UartGetByte(link->uart, &data))
+				{
+						return false;
+				}
+
+				// Byte eines Pakets speichern
+				if (data != TELEMETRY_DELIMITER)
+				{
+						if (link->lengthRx < TELEMETRY_SIZE_ENCODED_MAX)
+						{
+								link->bufferRx[link->lengthRx] = data;
+								link->lengthRx++;
+						}
+						// Paket zu lang -> bis zur nchsten Endekennung verwerfen
+						else if (!link->discardRx)
+						{
+								link->discardRx = true;
+								link->framingErrors++;
+						}
+						continue;
+				}
+
+				// Endekennung: Paket auswerten
+				uint16_t length = link->lengthRx;
+				bool discard    = link->discardRx;
+				link->lengthRx  = 0;
+				link->discardRx = false;
+				// Leere Pakete (z.B. mehrere Endekennungen zur Synchronisation) ignorieren
+				if (discard || (length == 0))
+				{
+						continue;
+				}
+				length = TelemetryCobsDecode(link->bufferRx, length);
+				if (   (length == TELEMETRY_DECODE_ERROR)
+						|| (length < (TELEMETRY_SIZE_HEADER + TELEMETRY_SIZE_CRC)))
+				{
+						link->framingErrors++;
+						continue;
+				}
+				// Die CRC ber Paket und angehngte CRC ergibt 0, falls das Paket fehlerfrei ist
+				if (TelemetryCrc16(TELEMETRY_CRC_INIT, link->bufferRx, length) != 0)
+				{
+						link->crcErrors++;
+						continue;
+				}
+
+				// Lcke in den Sequenznummern (verlorene Pakete) zhlen
+				uint16_t sequence = link->bufferRx[1];
+				if (   link->sequenceRxValid
+						&& (sequence != ((link->sequenceRx + 1U) & 0x00FF)))
+				{
+						link->sequenceErrors++;
+				}
+				link->sequenceRx      = sequence;
+				link->sequenceRxValid = true;
+				link->framesRx++;
+
+				// Paket bergeben
+				frame->id       = link->bufferRx[0];
+				frame->sequence = sequence;
+				frame->length   = length - TELEMETRY_SIZE_HEADER - TELEMETRY_SIZE_CRC;
+				for (uint16_t j = 0; j < frame->length; j++)
+				{
+						frame->payload[j] = link->bufferRx[TELEMETRY_SIZE_HEADER + j];
+				}
+				return true;
+		}
+		return false;
+}
+
+
+//=== Function: TelemetryCrc16 ====================================================================
+///
+/// @brief  Funktion berechnet die CRC-16 (CCITT, Polynom 0x1021) ber "length" Bytes und gibt das
+///					Ergebnis zurck. Fr den ersten Block wird "crc" = TELEMETRY_CRC_INIT bergeben,
+///					fr weitere Blcke das Ergebnis des vorherigen Aufrufs.
+///
+/// @param  uint16_t crc, const uint16_t *data, uint16_t length
+///
+/// @return uint16_t crc
+///
+//=================================================================================================
+uint16_t TelemetryCrc16(uint16_t crc,
+												const uint16_t *data,
+												uint16_t length)
+{
+		for (uint16_t i = 0; i < length; i++)
+		{
+				crc = (crc << 8) ^ telemetryCrcTable[((crc >> 8) ^ data[i]) & 0x00FF];
+		}
+		return crc;
+}
+
+
+//=== Function: TelemetryCobsDecode ===============================================================
+///
+/// @brief  Funktion dekodiert ein COBS-kodiertes Paket (ohne Endekennung) im selben Puffer und gibt
+///					die Lnge des dekodierten Pakets zurck. Da das dekodierte Paket nie lnger als das
+///					kodierte ist, berschreibt das Schreiben keine noch nicht gelesenen Bytes. Bei einem
+///					ungltigen Paket (Code-Byte 0 oder Block lnger als das Paket) wird
+///					TELEMETRY_DECODE_ERROR zurckgegeben.
+///
+/// @param  uint16_t *data, uint16_t length
+///
+/// @return uint16_t decodedLength
+///
+//=================================================================================================
+uint16_t TelemetryCobsDecode(uint16_t *data,
+														 uint16_t length)
+{
+		uint16_t read  = 0;
+		uint16_t write = 0;
+		while (read < length)
+		{
+				uint16_t code = data[read];
+				if (   (code == 0)
+						|| ((read + code) > length))
+				{
+						return TELEMETRY_DECODE_ERROR;
+				}
+				read++;
+				for (uint16_t i = 1; i < code; i++)
+				{
+						data[write] = data[read];
+						write++;
+						read++;
+				}
+				// Nach jedem Block auer dem letzten und Blcken maximaler Lnge folgt ein 0x00-Byte
+				if (   (code != 0xFF)
+						&& (read < length))
+				{
+						data[write] = 0;
+						write++;
+				}
+		}
+		return write;
+}
@@ -0,0 +1,131 @@
+//=================================================================================================
+/// @file       myTelemetry.h
+///
+/// @brief      Datei enthlt Variablen und Funktionen fr ein binres Telemetrie-Protokoll ber
+///							UART ("myUART.c"). Jedes Datenpaket besteht aus Nachrichten-ID, Sequenznummer,
+///							Nutzdaten und einer CRC-16 (CCITT, Polynom 0x1021, Startwert 0xFFFF). Das Paket
+///							wird mit COBS (Consistent Overhead Byte Stuffing) kodiert und mit einem 0x00-Byte
+///							abgeschlossen, so dass der Empfnger den Anfang eines Pakets nach einem Fehler
+///							sicher wiederfindet. Beim Senden wird das Paket ohne Zwischenpuffer direkt im
+///							Sende-Ringpuffer des UART-Moduls kodiert. Empfangene Pakete werden aus dem
+///							Hauptprogramm mit "TelemetryPoll()" ausgewertet, die Bearbeitungszeit pro Aufruf
+///							ist durch TELEMETRY_MAX_BYTES_PER_POLL begrenzt.
+///
+///							Aufbau eines Pakets (vor der COBS-Kodierung, ein Byte pro uint16_t):
+///							<ID> <Sequenznummer> <Nutzdaten 0 ... 128 Bytes> <CRC High> <CRC Low>
+///							Die CRC wird ber ID, Sequenznummer und Nutzdaten gebildet.
+///
+/// @version    V1.0
+///
+/// @date       19.10.2026
+///
+/// @author     Daniel Urbaneck
+//=================================================================================================
+#ifndef MYTELEMETRY_H_
+#define MYTELEMETRY_H_
+//-------------------------------------------------------------------------------------------------
+// Includes
+//-------------------------------------------------------------------------------------------------
+#include "myDevice.h"
+#include "myUART.h"
+
+
+//-------------------------------------------------------------------------------------------------
+// Defines
+//-------------------------------------------------------------------------------------------------
+// Max. Anzahl der Nutzdaten pro Paket
+#define TELEMETRY_SIZE_PAYLOAD_MAX							128
+// Anzahl der Bytes fr ID und Sequenznummer bzw. CRC
+#define TELEMETRY_SIZE_HEADER										2
+#define TELEMETRY_SIZE_CRC											2
+// Max. Lnge eines Pakets vor der Kodierung
+#define TELEMETRY_SIZE_FRAME_MAX								(TELEMETRY_SIZE_HEADER + TELEMETRY_SIZE_PAYLOAD_MAX + TELEMETRY_SIZE_CRC)
+// Max. Lnge eines kodierten Pakets (ohne Endekennung). COBS fgt pro 254 Bytes
+// ein Byte hinzu, mindestens jedoch ein Byte
+#define TELEMETRY_SIZE_ENCODED_MAX							(TELEMETRY_SIZE_FRAME_MAX + (TELEMETRY_SIZE_FRAME_MAX / 254U) + 1U)
+// Endekennung eines Pakets
+#define TELEMETRY_DELIMITER											0x00
+// Startwert der CRC
+#define TELEMETRY_CRC_INIT											0xFFFF
+// Max. Anzahl der Bytes, die pro Aufruf von "TelemetryPoll()" bearbeitet werden
+#define TELEMETRY_MAX_BYTES_PER_POLL						64
+// Fehler bei der COBS-Dekodierung
+#define TELEMETRY_DECODE_ERROR									0xFFFF
+
+
+//-------------------------------------------------------------------------------------------------
+// Macros
+//-------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Empfangenes Paket
+typedef struct
+{
+		// Nachrichten-ID und Sequenznummer (jeweils 0 ... 255)
+		uint16_t id;
+		uint16_t sequence;
+		// Anzahl und Inhalt der Nutzdaten (ein Byte pro uint16_t)
+		uint16_t length;
+		uint16_t payload[TELEMETRY_SIZE_PAYLOAD_MAX];
+} TelemetryFrame;
+
+// Verbindung ber ein UART-Modul
+typedef struct
+{
+		// Verwendetes UART-Modul
+		UartInstance *uart;
+		// Sequenznummer des nchsten gesendeten Pakets
+		uint16_t sequenceTx;
+		// Sequenznummer des zuletzt empfangenen Pakets
+		uint16_t sequenceRx;
+		// Es wurde bereits ein gltiges Paket empfangen ("sequenceRx" ist gltig)
+		bool sequenceRxValid;
+		// Empfangene, noch nicht dekodierte Bytes des aktuellen Pakets
+		uint16_t bufferRx[TELEMETRY_SIZE_ENCODED_MAX];
+		uint16_t lengthRx;
+		// Das aktuelle Paket ist zu lang und wird bis zur Endekennung verworfen
+		bool discardRx;
+		// Statistik
+		uint32_t framesTx;
+		uint32_t framesRx;
+		uint32_t framesDropped;
+		uint32_t crcErrors;
+		uint32_t framingErrors;
+		uint32_t sequenceErrors;
+} TelemetryLink;
+
+
+//-------------------------------------------------------------------------------------------------
+// Global variables
+//-------------------------------------------------------------------------------------------------
+// Tabelle fr die CRC-16-Berechnung
+extern const uint16_t telemetryCrcTable[256];
+
+
+//-------------------------------------------------------------------------------------------------
+// Prototypes of global functions
+//-------------------------------------------------------------------------------------------------
+// Funktion initialisiert eine Verbindung ber ein UART-Modul
+extern void TelemetryInit(TelemetryLink *link,
+													UartInstance *uart);
+// Funktion sendet ein Paket
+extern bool TelemetrySend(TelemetryLink *link,
+													uint16_t id,
+													const uint16_t *payload,
+													uint16_t length);
+// Funktion wertet empfangene Bytes aus und gibt ein vollstndiges Paket zurck
+extern bool TelemetryPoll(TelemetryLink *link,
+													TelemetryFrame *frame);
+// Funktion berechnet die CRC-16 ber einen Datenblock
+extern uint16_t TelemetryCrc16(uint16_t crc,
+															 const uint16_t *data,
+															 uint16_t length);
+// Funktion dekodiert ein COBS-kodiertes Paket
+extern uint16_t TelemetryCobsDecode(uint16_t *data,
+																		uint16_t length);
+
+
+#endif
@@ -1,24 +1,46 @@
 //=================================================================================================
 /// @file       uart.c
 ///
-/// @brief      Datei enthlt Variablen und Funktionen um die UART-Schnittstelle (SCI) eines
-///							TMS320F283x zu benutzen. Die Kommunikation ist Interrupt-basiert. Zum Senden wird
-////						die Funktion "UartTransmit()" aufgerufen und die zu sendene Anzahl an Bytes als
-///							Parameter bergeben. Die zu sendenen Daten werden zuvor in den Puffer
-///							"uartBufferTx[]" geschrieben. Der Empfangsvorgang wird durch Aufruf der Funktion
-///							"UartReceive()" freigegeben. Da UART asynchron ist, kann der Empfangsvorgang nur
-///							freigegeben, aber nicht aktiv forciert werden. Nach Aufruf der Funktion
-///							"UartReceive()", sollte in regelmigen Abstnden die Funktion "UartGetStatusRx()"
-///							aufgerufen werden um den korekten/vollstndigen Empfang eines Datenpakets zu
-///							prfen. Nheres ist der Beschreibung der Funktion "UartGetStatusRx()" zu entnehmen.
-///							Es wird das SCI-A Modul verwendet. Die Module B, C und D knnen analog zu den hier
-///							gezeigten Funktionen verwendet werden.
+/// @brief      Datei enthlt Variablen und Funktionen um die UART-Schnittstellen (SCI) eines
+///							TMS320F283x zu benutzen. Die Kommunikation ist Interrupt-basiert. Alle Funktionen
+///							arbeiten mit einer Instanz ("UartInstance"), die das verwendete SCI-Modul, die
+///							Ringpuffer und den Zustand der Kommunikation enthlt. Fr die Module SCI-A bis
+///							SCI-D stehen die Instanzen "uartA" bis "uartD" zur Verfgung, die gleichzeitig
+///							und unabhngig voneinander betrieben werden knnen. Empfangene Bytes werden in
+///							der Empfangs-ISR fortlaufend aus dem Hardware-FIFO in einen Ringpuffer kopiert
+///							und knnen mit "UartRead()" in beliebiger Lnge gelesen werden. Zu sendende
+///							Bytes werden mit "UartWrite()" in einen zweiten Ringpuffer geschrieben, aus dem
+///							die Sende-ISR den Hardware-FIFO nachfllt. Da der Empfang dauerhaft eingeschaltet
+///							ist, gehen zwischen zwei Datenpaketen keine Bytes verloren. Bei einem vollen
+///							Empfangs-Ringpuffer werden neue Bytes verworfen und gezhlt ("rxOverflow").
+///							Alternativ knnen Puffer des Aufrufers mit "UartQueueTx()" ohne Kopie gesendet
+///							werden. Die Reihenfolge der Bytes entspricht immer der Reihenfolge der Aufrufe.
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///							nderung in Version 3.0: Ringpuffer fr fortlaufendes Senden und Empfangen
+///							nderung in Version 3.1: Kein aktives Warten auf das Ende der bertragung in der
+///																			 Sende-ISR
+///							nderung in Version 3.2: Berechnung der Baudrate aus dem eingestellten Low-Speed
+///																			 CLK, optional LSPCLK = SYSCLK fr hohe Baudraten
+///							nderung in Version 4.0: Instanzen fr die Module SCI-A bis SCI-D
+///							nderung in Version 4.1: Direktes Schreiben in den Sende-Ringpuffer ("UartCommitTx()")
+///																			 und byteweises Lesen ("UartGetByte()") fr Protokolle
+///							nderung in Version 4.2: Senden ohne Kopie aus Puffern des Aufrufers ber
+///																			 Sende-Deskriptoren ("UartQueueTx()")
+///							nderung in Version 4.3: "UartStartTx()", "UartAvailable()" und
+///																			 "UartCheckTxEmpty()" stellen den Zustand der
+///																			 CPU-Interrupts wieder her (Aufruf aus einer ISR
+///																			 bzw. Callback-Funktion mglich)
+///							nderung in Version 4.4: "UartWrite()" und "UartQueueTxGather()" reservieren und
+///																			 belegen die Pltze mit gesperrten CPU-Interrupts,
+///																			 damit eine Callback-Funktion der Sende-ISR
+///																			 dazwischen senden kann
+///							nderung in Version 4.5: "UartInit()" gibt "false" zurck, wenn die Baudrate um
+///																			 mehr als UART_BAUD_ERROR_MAX abweicht
 ///
-/// @version    V2.0
+/// @version    V4.5
 ///
-/// @date       24.03.2023
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -31,519 +53,922 @@
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die UART-Kommunikation
-uint16_t uartBufferRxA[UART_SIZE_SOFTWARE_BUFFER_RX];
-uint16_t uartBufferTxA[UART_SIZE_SOFTWARE_BUFFER_TX];
-// Steuern das Kopieren in und aus den Software-Puffern whrend der UART-Kommunikation
-uint16_t uartBufferIndexRxA;
-uint16_t uartBufferIndexTxA;
-uint16_t uartBufferIndexRxOldA;
-uint16_t uartBytesToTransferRxA;
-uint16_t uartBytesToTransferTxA;
-// Dient zur Erkennung des Empfangsvorgangs
-uint32_t uartOldValueFifoBufferA;
-// Flags speichern den aktuellen Zustand der UART-Kommunikation
-uint16_t uartStatusFlagRxA;
-uint16_t uartStatusFlagTxA;
-// Flag kann zum Aufruf der Funktion "UartGetStatusRxA()" genutzt werden
-// und sollte dazu regelmig (z.B. alle 5 ms) in einer ISR gesetzt werden.
-// Anschlieend kann z.B. im Hauptprogramm bei gesetztem Flag die Funktion
-// aufgerufen und das Flag gelscht werden
-bool uartFlagCheckRxA;
-// Timeout-Zhler fr den Empfang eines Datenpakets
-int32_t uartRxTimeoutA = UART_NO_TIMEOUT;
+// Instanzen der Module SCI-A bis SCI-D
+UartInstance uartA = {&SciaRegs, UART_SCI_A};
+UartInstance uartB = {&ScibRegs, UART_SCI_B};
+UartInstance uartC = {&ScicRegs, UART_SCI_C};
+UartInstance uartD = {&ScidRegs, UART_SCI_D};
+// Pin-Belegung von SCI-A auf dem ControlBoard (GPIO 28 RxD, GPIO 135 TxD)
+const UartPins uartPinsA = {28, 1, 135, 6};
 
 
 //-------------------------------------------------------------------------------------------------
 // Global functions
 //-------------------------------------------------------------------------------------------------
-//=== Function: UartInitA =========================================================================
+//=== Function: UartInit ==========================================================================
 ///
-/// @brief  Funktion initialisiert GPIO 28 und 135 als UART-Pins und das
-///         SCI-A Modul fr den UART-Betrieb mit der gewnschten Baudrate.
+/// @brief  Funktion initialisiert die GPIOs und das SCI-Modul einer Instanz fr den UART-Betrieb
+///         mit der gewnschten Baudrate. Der Empfang wird eingeschaltet, ab diesem Zeitpunkt
+///         werden alle empfangenen Bytes im Ringpuffer der Instanz gespeichert. Die tatschlich
+///         erreichte Baudrate steht anschlieend in "uart->baudActual", die Abweichung von der
+///         gewnschten Baudrate in % in "uart->baudError". Die Interrupts werden wie folgt
+///         freigeschaltet (siehe PIE-Vector Table S. 150 Reference Manual TMS320F2838x,
+///         SPRUII0D, Rev. D, July 2022):
 ///
-/// @param  uint32_t baud, uint32_t numberOfDataBits, uint32_t numberOfStopBits, uint32_t parity
+///         SCI-A: Gruppe 9, Rx INTx1, Tx INTx2
+///         SCI-B: Gruppe 9, Rx INTx3, Tx INTx4
+///         SCI-C: Gruppe 8, Rx INTx5, Tx INTx6
+///         SCI-D: Gruppe 8, Rx INTx7, Tx INTx8
 ///
-/// @return void
+///         Die Funktion gibt "false" zurck, falls die Instanz oder die Pins ungltig sind oder
+///         die Baudrate mit dem eingestellten Low-Speed CLK nicht auf UART_BAUD_ERROR_MAX genau
+///         erreicht wird ("uart->baudActual" und "uart->baudError" sind dann trotzdem gesetzt,
+///         das SCI-Modul und die Pins werden nicht konfiguriert).
+///
+/// @param  UartInstance *uart, const UartPins *pins, uint32_t baud, uint32_t numberOfDataBits,
+///					uint32_t numberOfStopBits, uint32_t parity
+///
+/// @return bool operationPerformed
 ///
 //=================================================================================================
-void UartInitA(uint32_t baud,
-							 uint32_t numberOfDataBits,
-							 uint32_t numberOfStopBits,
-							 uint32_t parity)
+bool UartInit(UartInstance *uart,
+							const UartPins *pins,
+							uint32_t baud,
+							uint32_t numberOfDataBits,
+							uint32_t numberOfStopBits,
+							uint32_t parity)
 {
+		if (   (uart == 0)
+				|| (pins == 0)
+				|| (uart->sci > UART_SCI_D)
+				|| (pins->rxGpio >= UART_NUMBER_OF_GPIOS)
+				|| (pins->txGpio >= UART_NUMBER_OF_GPIOS)
+				|| (baud == 0))
+		{
+				return false;
+		}
+		volatile struct SCI_REGS *regs = uart->regs;
+
     // Register-Schreibschutz aufheben
     EALLOW;
 
-    // Rx-Pin
-    // GPIO-Sperre fr GPIO 28 aufheben
-    GpioCtrlRegs.GPALOCK.bit.GPIO28 = 0;
-    // GPIO 28 auf UART-Funktion setzen (RxD)
-    // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
-    // GPAGMUX (MSB, 2 Bit) + GPAMUX (LSB, 2 Bit) als Dezimalzahl an.
-    // (siehe S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    GpioCtrlRegs.GPAGMUX2.bit.GPIO28 = (1 >> 2);
-    GpioCtrlRegs.GPAMUX2.bit.GPIO28  = (1 & 0x03);
-    // GPIO 28 Pull-Up-Widerstand deaktivieren
-    GpioCtrlRegs.GPAPUD.bit.GPIO28 = 1;
-    // GPIO 28 Asynchroner Eingang (muss fr UART gesetzt sein)
-    GpioCtrlRegs.GPAQSEL2.bit.GPIO28 = 0x03;
-
-    // Tx-Pin:
-    // GPIO-Sperre aufheben
-    GpioCtrlRegs.GPELOCK.bit.GPIO135 = 0;
-    // Auf UART-Funktion setzen (TxD)
-    // Die Zahl in der obersten Zeile der Tabelle gibt den Wert fr
-    // GPAGMUX (MSB, 2 Bit) + GPAMUX (LSB, 2 Bit) als Dezimalzahl an.
-    // (siehe S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    GpioCtrlRegs.GPEGMUX1.bit.GPIO135 = (6 >> 2);
-    GpioCtrlRegs.GPEMUX1.bit.GPIO135  = (6 & 0x03);
-    // Pull-Up-Widerstand deaktivieren
-    GpioCtrlRegs.GPEPUD.bit.GPIO135 = 1;
-    // Asynchroner Eingang (muss fr UART gesetzt sein)
-    GpioCtrlRegs.GPEQSEL1.bit.GPIO135 = 0x03;
-
     // Takt fr das UART-Modul einschalten und 5 Takte
     // warten, bis der Takt zum Modul durchgestellt ist
     // (siehe S. 169 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    CpuSysRegs.PCLKCR7.bit.SCI_A = 1;
+    CpuSysRegs.PCLKCR7.all |= (1UL << uart->sci);
     __asm(" RPT #4 || NOP");
-    // Baudrate setzen
-    // (Low-Speed CLK / (BAUD * SCICHAR)) - 1
-    // Low-Speed CLK = 50 MHz (siehe "DeviceInit()")
-    uint32_t divider = (50000000 / (baud * 8U)) - 1U;
-    SciaRegs.SCIHBAUD.bit.BAUD = (divider & 0xFF00) >> 8;
-    SciaRegs.SCILBAUD.bit.BAUD =  divider & 0x00FF;
+#if UART_LSPCLK_EQUALS_SYSCLK
+    // Low-Speed CLK auf SYSCLK setzen (gilt fr alle Module am Low-Speed CLK, z.B. SPI)
+    ClkCfgRegs.LOSPCP.bit.LSPCLKDIV = 0;
+#endif
+    // Baudrate setzen. Der Teiler wird aus dem tatschlich eingestellten Low-Speed CLK
+    // berechnet (siehe "DeviceInit()"). Die erreichte Baudrate und die Abweichung
+    // werden in der Instanz gespeichert. Bei zu groer Abweichung ist keine
+    // zuverlssige bertragung mglich, das SCI-Modul wird dann nicht konfiguriert
+    uint32_t lspclk  = UartGetLspclk();
+    uint16_t divider = UartCalcDivider(lspclk, baud);
+    uart->baudActual = lspclk / (((uint32_t)divider + 1UL) * 8UL);
+    uart->baudError  = ((float)uart->baudActual - (float)baud) * 100.0f / (float)baud;
+    if (   (uart->baudError >  UART_BAUD_ERROR_MAX)
+    		|| (uart->baudError < -UART_BAUD_ERROR_MAX))
+    {
+    		EDIS;
+    		return false;
+    }
+    regs->SCIHBAUD.bit.BAUD = (divider & 0xFF00) >> 8;
+    regs->SCILBAUD.bit.BAUD =  divider & 0x00FF;
+
+    // Rx- und Tx-Pin auf UART-Funktion setzen
+    UartConfigGpio(pins->rxGpio, pins->rxMux);
+    UartConfigGpio(pins->txGpio, pins->txMux);
     // Anzahl der Datenbits setzen
-    SciaRegs.SCICCR.bit.SCICHAR = numberOfDataBits;
+    regs->SCICCR.bit.SCICHAR = numberOfDataBits;
     // Anzahl der Stopbits setzen
-    SciaRegs.SCICCR.bit.STOPBITS = numberOfStopBits;
+    regs->SCICCR.bit.STOPBITS = numberOfStopBits;
     // Paritt setzen
 		switch (parity)
 		{
 				// Gerade Paritt
 				case UART_PARITY_EVEN:
-						SciaRegs.SCICCR.bit.PARITYENA = 1;
-						SciaRegs.SCICCR.bit.PARITY    = 1;
+						regs->SCICCR.bit.PARITYENA = 1;
+						regs->SCICCR.bit.PARITY    = 1;
 						break;
 				// Ungerade Paritt
 				case UART_PARITY_ODD:
-						SciaRegs.SCICCR.bit.PARITYENA = 1;
-						SciaRegs.SCICCR.bit.PARITY    = 0;
+						regs->SCICCR.bit.PARITYENA = 1;
+						regs->SCICCR.bit.PARITY    = 0;
 						break;
 				// Keine Paritt
 				default:
-						SciaRegs.SCICCR.bit.PARITYENA = 0;
+						regs->SCICCR.bit.PARITYENA = 0;
 		}
     // RxD und TxD ausschalten
-    SciaRegs.SCICTL1.bit.RXENA = 0;
-    SciaRegs.SCICTL1.bit.TXENA = 0;
+    regs->SCICTL1.bit.RXENA = 0;
+    regs->SCICTL1.bit.TXENA = 0;
     // Soft-Reset deaktivieren (mit aktiverten
 		// Soft-Reset ist der FIFO-Modus ausgeschaltet)
-    SciaRegs.SCICTL1.bit.SWRESET = 1;
+    regs->SCICTL1.bit.SWRESET = 1;
     // FIFO-Modus (fr Tx und Rx) einschalten
-    SciaRegs.SCIFFTX.bit.SCIFFENA = 1;
+    regs->SCIFFTX.bit.SCIFFENA = 1;
     // FIFO-Interrupts ausschalten
-    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
-    SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
+    regs->SCIFFRX.bit.RXFFIENA = 0;
+    regs->SCIFFTX.bit.TXFFIENA = 0;
+    // Interrupt-Niveaus der FIFOs setzen
+    regs->SCIFFRX.bit.RXFFIL = UART_LEVEL_FIFO_RX;
+    regs->SCIFFTX.bit.TXFFIL = UART_LEVEL_FIFO_TX;
+
+    // Ringpuffer und Steuervariablen initialisieren
+    uart->headRx     = 0;
+    uart->tailRx     = 0;
+    uart->headTx     = 0;
+    uart->tailTx     = 0;
+    uart->headDescriptorTx   = 0;
+    uart->tailDescriptorTx   = 0;
+    uart->offsetDescriptorTx = 0;
+    uart->rxOverflow = 0;
+    uart->rxError    = 0;
+		uart->statusTx   = UART_STATUS_IDLE;
 
     // CPU-Interrupts whrend der Konfiguration global sperren
     DINT;
-    // Interrupt-Service-Routinen fr den RxD-Interrupt an die
-    // entsprechende Stelle (SCIA_RX_INT) der PIE-Vector Table speichern
-    PieVectTable.SCIA_RX_INT = &UartRxISRA;
-    // SCIA_RX-Interrupt freischalten (Zeile 9, Spalte 1 der Tabelle)
-    // (siehe PIE-Vector Table S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    PieCtrlRegs.PIEIER9.bit.INTx1 = 1;
-    // Interrupt-Service-Routinen fr den TxD-Interrupt an die
-    // entsprechende Stelle (SCIA_TX_INT) der PIE-Vector Table speichern
-    PieVectTable.SCIA_TX_INT = &UartTxISRA;
-    // SCIA_TX-Interrupt freischalten (Zeile 9, Spalte 2 der Tabelle 3-2)
-    // (siehe S. 150 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
-    PieCtrlRegs.PIEIER9.bit.INTx2 = 1;
-    // CPU-Interrupt 9 einschalten (Zeile 9 der Tabelle 3-2)
-    IER |= M_INT9;
+    // Interrupt-Service-Routinen in die PIE-Vector Table
+    // speichern und die Interrupts freischalten
+    switch (uart->sci)
+    {
+    		case UART_SCI_A:
+    				PieVectTable.SCIA_RX_INT = &UartRxISRA;
+    				PieVectTable.SCIA_TX_INT = &UartTxISRA;
+    				PieCtrlRegs.PIEIER9.bit.INTx1 = 1;
+    				PieCtrlRegs.PIEIER9.bit.INTx2 = 1;
+    				IER |= M_INT9;
+    				break;
+    		case UART_SCI_B:
+    				PieVectTable.SCIB_RX_INT = &UartRxISRB;
+    				PieVectTable.SCIB_TX_INT = &UartTxISRB;
+    				PieCtrlRegs.PIEIER9.bit.INTx3 = 1;
+    				PieCtrlRegs.PIEIER9.bit.INTx4 = 1;
+    				IER |= M_INT9;
+    				break;
+    		case UART_SCI_C:
+    				PieVectTable.SCIC_RX_INT = &UartRxISRC;
+    				PieVectTable.SCIC_TX_INT = &UartTxISRC;
+    				PieCtrlRegs.PIEIER8.bit.INTx5 = 1;
+    				PieCtrlRegs.PIEIER8.bit.INTx6 = 1;
+    				IER |= M_INT8;
+    				break;
+    		default:
+    				PieVectTable.SCID_RX_INT = &UartRxISRD;
+    				PieVectTable.SCID_TX_INT = &UartTxISRD;
+    				PieCtrlRegs.PIEIER8.bit.INTx7 = 1;
+    				PieCtrlRegs.PIEIER8.bit.INTx8 = 1;
+    				IER |= M_INT8;
+    				break;
+    }
+    // Empfangs-FIFO leeren, Overflow- und Interrupt-Flag lschen
+    regs->SCIFFRX.bit.RXFIFORESET = 0;
+    regs->SCIFFRX.bit.RXFIFORESET = 1;
+    regs->SCIFFRX.bit.RXFFOVRCLR  = 1;
+    regs->SCIFFRX.bit.RXFFINTCLR  = 1;
+    // Empfangs-FIFO-Interrupt einschalten. Der Empfang bleibt dauerhaft
+    // eingeschaltet, die Bytes werden in der ISR in den Ringpuffer kopiert
+    regs->SCIFFRX.bit.RXFFIENA = 1;
+    regs->SCICTL1.bit.RXENA    = 1;
+    // Senden einschalten. Der Sende-FIFO-Interrupt wird erst
+    // eingeschaltet, wenn Daten in den Ringpuffer geschrieben werden
+    regs->SCICTL1.bit.TXENA = 1;
     // CPU-Interrupts nach Konfiguration global wieder freigeben
     EINT;
 
 		// Register-Schreibschutz setzen
 		EDIS;
+		return true;
+}
 
-    // Software-Puffer inititalisieren
-    UartInitBufferRxA();
-    UartInitBufferTxA();
-    // Steuervariablen initialisieren
-    uartBufferIndexRxA     = 0;
-    uartBufferIndexTxA     = 0;
-    uartBufferIndexRxOldA  = uartBufferIndexRxA;
-    uartBytesToTransferRxA = 0;
-		uartBytesToTransferTxA = 0;
-		uartStatusFlagRxA      = UART_STATUS_IDLE;
-		uartStatusFlagTxA      = UART_STATUS_IDLE;
-		uartFlagCheckRxA       = false;
-		uartRxTimeoutA         = UART_NO_TIMEOUT;
+
+//=== Function: UartConfigGpio ====================================================================
+///
+/// @brief  Funktion konfiguriert einen GPIO als Pin eines SCI-Moduls: Konfigurationssperre
+///					aufheben, Mux-Nummer setzen, Pull-Up-Widerstand deaktivieren und asynchronen
+///					Eingang einstellen (muss fr UART gesetzt sein). Da die Pins der Module SCI-A bis
+///					SCI-D auf beliebigen Ports liegen knnen, wird auf die Register ber die Position
+///					innerhalb von "GpioCtrlRegs" zugegriffen. Der Register-Schreibschutz muss vor dem
+///					Aufruf aufgehoben sein (EALLOW).
+///
+/// @param  uint16_t gpio, uint16_t mux
+///
+/// @return void
+///
+//=================================================================================================
+void UartConfigGpio(uint16_t gpio,
+										uint16_t mux)
+{
+		// Register des Ports, in dem der GPIO liegt
+		volatile uint32_t *port = (volatile uint32_t *)&GpioCtrlRegs
+														+ ((gpio / 32U) * UART_GPIO_PORT_STEP);
+		// Bit des GPIOs in den 1-Bit-Registern (LOCK, PUD)
+		uint32_t mask = 1UL << (gpio % 32U);
+		// Register (x1 oder x2) und Position des GPIOs in den 2-Bit-Registern (MUX, GMUX, QSEL)
+		uint16_t index = (gpio % 32U) / 16U;
+		uint16_t shift = (gpio % 16U) * 2U;
+
+		// GPIO-Sperre aufheben
+		port[UART_GPIO_LOCK] &= ~mask;
+		// Mux-Nummer setzen: GPxGMUX (MSB, 2 Bit) + GPxMUX (LSB, 2 Bit)
+		port[UART_GPIO_GMUX1 + index] = (port[UART_GPIO_GMUX1 + index] & ~(3UL << shift))
+																	| ((uint32_t)((mux >> 2) & 0x03) << shift);
+		port[UART_GPIO_MUX1 + index]  = (port[UART_GPIO_MUX1 + index] & ~(3UL << shift))
+																	| ((uint32_t)(mux & 0x03) << shift);
+		// Pull-Up-Widerstand deaktivieren
+		port[UART_GPIO_PUD] |= mask;
+		// Asynchroner Eingang (muss fr UART gesetzt sein)
+		port[UART_GPIO_QSEL1 + index] |= (3UL << shift);
 }
 
 
-//=== Function: UartInitBufferRxA =================================================================
+//=== Function: UartGetLspclk =====================================================================
 ///
-/// @brief  Funktion initialisiert alle Elemente des UART Software-Empfangspuffers zu 0.
+/// @brief  Funktion gibt den aktuell eingestellten Low-Speed Peripheral Clock (LSPCLK) in Hz
+///					zurck. LSPCLK = SYSCLK / (2 * LOSPCP.LSPCLKDIV) bzw. LSPCLK = SYSCLK fr
+///					LOSPCP.LSPCLKDIV = 0 (siehe Register LOSPCP, Reference Manual TMS320F2838x,
+///					SPRUII0D, Rev. D, July 2022).
 ///
 /// @param  void
 ///
+/// @return uint32_t lspclk
+///
+//=================================================================================================
+uint32_t UartGetLspclk(void)
+{
+		uint16_t lspclkDiv = ClkCfgRegs.LOSPCP.bit.LSPCLKDIV;
+		if (lspclkDiv == 0)
+		{
+				return UART_SYSCLK;
+		}
+		return UART_SYSCLK / (2UL * lspclkDiv);
+}
+
+
+//=== Function: UartCalcDivider ===================================================================
+///
+/// @brief  Funktion berechnet den Teiler (BRR) fr die gewnschte Baudrate aus dem Low-Speed
+///					Peripheral Clock. Baudrate = LSPCLK / ((BRR + 1) * 8). Der Teiler wird auf die
+///					nchstliegende ganze Zahl gerundet (statt abgeschnitten) und auf den gltigen
+///					Bereich 1 ... 65535 begrenzt (BRR = 0 ergibt ebenfalls LSPCLK / 16, siehe Register
+///					SCIHBAUD, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Beispiel
+///					460800 Baud: LSPCLK = 50 MHz -> BRR = 13 (-3,1 %), LSPCLK = 200 MHz -> BRR = 53
+///					(+0,5 %).
+///
+/// @param  uint32_t lspclk, uint32_t baud
+///
+/// @return uint16_t divider
+///
+//=================================================================================================
+uint16_t UartCalcDivider(uint32_t lspclk,
+												 uint32_t baud)
+{
+		if (baud == 0)
+		{
+				return 0xFFFF;
+		}
+		// Gerundet: (LSPCLK / (8 * Baud)) - 1
+		uint32_t divider = (lspclk + (4UL * baud)) / (8UL * baud);
+		if (divider < 2UL)
+		{
+				return 1;
+		}
+		divider -= 1UL;
+		if (divider > 0xFFFFUL)
+		{
+				return 0xFFFF;
+		}
+		return (uint16_t)divider;
+}
+
+
+//=== Function: UartAvailable =====================================================================
+///
+/// @brief  Funktion gibt die Anzahl der empfangenen, noch nicht gelesenen Bytes zurck. Zuvor
+///					werden die Bytes aus dem Empfangs-FIFO in den Ringpuffer kopiert, die noch nicht
+///					das Interrupt-Niveau UART_LEVEL_FIFO_RX erreicht haben.
+///
+/// @param  UartInstance *uart
+///
+/// @return uint16_t numberOfBytes
+///
+//=================================================================================================
+uint16_t UartAvailable(UartInstance *uart)
+{
+		// CPU-Interrupts sperren, da der Empfangs-FIFO auch in der ISR gelesen wird. Der
+		// vorherige Zustand wird wiederhergestellt, damit die Funktion auch aus einer ISR
+		// (z.B. einer Callback-Funktion) aufgerufen werden kann
+		uint16_t interruptState = __disable_interrupts();
+		UartCopyFifoRx(uart);
+		__restore_interrupts(interruptState);
+		return (uint16_t)(uart->headRx - uart->tailRx);
+}
+
+
+//=== Function: UartRead ==========================================================================
+///
+/// @brief  Funktion kopiert bis zu "maxNumberOfBytes" empfangene Bytes aus dem Empfangs-Ringpuffer
+///					nach "data" und gibt die Anzahl der kopierten Bytes zurck. Die Funktion wartet nicht
+///					auf Daten, d.h. sie gibt 0 zurck, falls keine Bytes empfangen wurden.
+///
+/// @param  UartInstance *uart, uint16_t *data, uint16_t maxNumberOfBytes
+///
+/// @return uint16_t numberOfBytes
+///
+//=================================================================================================
+uint16_t UartRead(UartInstance *uart,
+									uint16_t *data,
+									uint16_t maxNumberOfBytes)
+{
+		uint16_t numberOfBytes = UartAvailable(uart);
+		if (numberOfBytes > maxNumberOfBytes)
+		{
+				numberOfBytes = maxNumberOfBytes;
+		}
+		uint16_t tail = uart->tailRx;
+		for (uint16_t i = 0; i < numberOfBytes; i++)
+		{
+				data[i] = uart->ringRx[tail & (UART_SIZE_RING_BUFFER_RX - 1U)];
+				tail++;
+		}
+		// Leseindex erst nach dem Kopieren weitersetzen, damit
+		// die ISR die Pltze nicht vorher berschreibt
+		uart->tailRx = tail;
+		return numberOfBytes;
+}
+
+
+//=== Function: UartGetByte =======================================================================
+///
+/// @brief  Funktion liest ein Byte aus dem Empfangs-Ringpuffer und gibt "true" zurck, falls ein
+///					Byte vorhanden war. Im Gegensatz zu "UartRead()" wird der Empfangs-FIFO nicht
+///					ausgelesen, die Funktion ist daher fr das byteweise Lesen in einer Schleife
+///					geeignet (vorher einmal "UartAvailable()" aufrufen).
+///
+/// @param  UartInstance *uart, uint16_t *data
+///
+/// @return bool byteAvailable
+///
+//=================================================================================================
+bool UartGetByte(UartInstance *uart,
+								 uint16_t *data)
+{
+		uint16_t tail = uart->tailRx;
+		if (tail == uart->headRx)
+		{
+				return false;
+		}
+		*data = uart->ringRx[tail & (UART_SIZE_RING_BUFFER_RX - 1U)];
+		uart->tailRx = tail + 1U;
+		return true;
+}
+
+
+//=== Function: UartFlushRx =======================================================================
+///
+/// @brief  Funktion verwirft alle empfangenen, noch nicht gelesenen Bytes (Ringpuffer und
+///					Empfangs-FIFO).
+///
+/// @param  UartInstance *uart
+///
 /// @return void
 ///
 //=================================================================================================
-void UartInitBufferRxA(void)
+void UartFlushRx(UartInstance *uart)
 {
-    for(uint16_t i=0; i<UART_SIZE_SOFTWARE_BUFFER_RX; i++)
-    {
-        uartBufferRxA[i] = 0;
-    }
+		UartAvailable(uart);
+		uart->tailRx = uart->headRx;
 }
 
 
-//=== Function: UartInitTxBufferA =================================================================
+//=== Function: UartGetFreeTx =====================================================================
 ///
-/// @brief  Funktion initialisiert alle Elemente des UART Software-Sendepuffers zu 0.
+/// @brief  Funktion gibt die Anzahl der freien Pltze im Sende-Ringpuffer zurck, d.h. wie viele
+///					Bytes mit "UartWrite()" ohne Verlust geschrieben werden knnen.
 ///
-/// @param  void
+/// @param  UartInstance *uart
+///
+/// @return uint16_t numberOfBytes
+///
+//=================================================================================================
+uint16_t UartGetFreeTx(UartInstance *uart)
+{
+		return UART_SIZE_RING_BUFFER_TX - (uint16_t)(uart->headTx - uart->tailTx);
+}
+
+
+//=== Function: UartWrite =========================================================================
+///
+/// @brief  Funktion schreibt bis zu "numberOfBytes" Bytes aus "data" in den Sende-Ringpuffer und
+///					gibt die Anzahl der geschriebenen Bytes zurck (weniger, falls der Ringpuffer voll
+///					ist). Ist aktuell keine Sende-Kommunikation aktiv, wird der Sende-FIFO direkt
+///					gefllt und der Sende-FIFO-Interrupt eingeschaltet. Andernfalls werden die Bytes
+///					im Anschluss an die bereits im Ringpuffer befindlichen Bytes gesendet. Die Funktion
+///					kann jederzeit aufgerufen werden, auch whrend einer laufenden bertragung und aus
+///					einer Callback-Funktion "UartTxCallback". Die Pltze werden mit gesperrten CPU-
+///					Interrupts reserviert und beschrieben, da eine Callback-Funktion sonst dieselben
+///					Pltze belegen knnte.
+///
+/// @param  UartInstance *uart, const uint16_t *data, uint16_t numberOfBytes
+///
+/// @return uint16_t numberOfBytesWritten
+///
+//=================================================================================================
+uint16_t UartWrite(UartInstance *uart,
+									 const uint16_t *data,
+									 uint16_t numberOfBytes)
+{
+		// Die Sende-ISR kann ber eine Callback-Funktion ebenfalls in den Ringpuffer schreiben.
+		// Freien Platz prfen, Bytes kopieren und Schreibindex weitersetzen daher mit
+		// gesperrten CPU-Interrupts (vorherigen Zustand wiederherstellen)
+		uint16_t interruptState = __disable_interrupts();
+		uint16_t free = UartGetFreeTx(uart);
+		if (numberOfBytes > free)
+		{
+				numberOfBytes = free;
+		}
+		if (numberOfBytes == 0)
+		{
+				__restore_interrupts(interruptState);
+				return 0;
+		}
+		uint16_t head = uart->headTx;
+		for (uint16_t i = 0; i < numberOfBytes; i++)
+		{
+				uart->ringTx[head & (UART_SIZE_RING_BUFFER_TX - 1U)] = data[i];
+				head++;
+		}
+		// Bytes freigeben und bertragung starten
+		UartCommitTx(uart, numberOfBytes);
+		__restore_interrupts(interruptState);
+		return numberOfBytes;
+}
+
+
+//=== Function: UartCommitTx ======================================================================
+///
+/// @brief  Funktion gibt "numberOfBytes" Bytes zum Senden frei, die bereits direkt ab dem
+///					Schreibindex in den Sende-Ringpuffer geschrieben wurden (z.B. von einem Protokoll,
+///					das die Daten ohne Zwischenpuffer im Ringpuffer erzeugt). Ist aktuell keine
+///					Sende-Kommunikation aktiv, wird der Sende-FIFO direkt gefllt und der
+///					Sende-FIFO-Interrupt eingeschaltet. Der Aufrufer muss zuvor mit "UartGetFreeTx()"
+///					prfen, dass genug Platz vorhanden ist. Kann eine Callback-Funktion "UartTxCallback"
+///					senden, muss der Aufrufer die CPU-Interrupts von dieser Prfung bis nach dem Aufruf
+///					von "UartCommitTx()" sperren (siehe "UartWrite()").
+///
+/// @param  UartInstance *uart, uint16_t numberOfBytes
 ///
 /// @return void
 ///
 //=================================================================================================
-void UartInitBufferTxA(void)
+void UartCommitTx(UartInstance *uart,
+									uint16_t numberOfBytes)
 {
-    for(uint16_t i=0; i<UART_SIZE_SOFTWARE_BUFFER_TX; i++)
-    {
-        uartBufferTxA[i] = 0;
-    }
+		// Schreibindex erst nach dem Kopieren weitersetzen, damit
+		// die ISR keine unvollstndigen Daten sendet
+		uart->headTx += numberOfBytes;
+		UartStartTx(uart);
 }
 
 
-//=== Function: UartGetStatusRxA ==================================================================
+//=== Function: UartQueueTx =======================================================================
 ///
-/// @brief	Funktion gibt den aktuellen Status der UART-Kommunikation (Empfangs-Prozess) zurck
-///				  und prft den Empfang von Daten, d.h. es wird abhngig vom Wert der Variable
-///					"uartBytesToTransferRxA" (wird ber die Funktion "UartReceiveA()" gesetzt) die
-///					Gltigkeit der empfangenen Daten geprft (Lnge des empfangenen Datenpakets). Damit
-///					diese Prfung funktioniert, muss die Funktion innerhalb eines definierten Intervalls
-///					aufgerufen werden. Die min. Zeit zwischen den Aufrufen muss lnger sein, als der
-///					Empfang eines vollstndigen Datenpakets dauert:
+/// @brief  Funktion reiht den Puffer "data" mit "length" Bytes zum Senden ein, ohne ihn zu
+///					kopieren. Die Sende-ISR kopiert die Bytes direkt aus dem Puffer in den Sende-FIFO.
+///					Der Puffer darf erst wieder verndert werden, wenn die Funktion "callback" mit dem
+///					Parameter "context" aufgerufen wurde, sobald das letzte Byte in den Sende-FIFO
+///					kopiert wurde ("callback" darf 0 sein). Der Aufruf erfolgt mit gesperrten
+///					Interrupts aus der Sende-ISR oder, falls der Sende-FIFO direkt gefllt wird, aus
+///					dieser Funktion. "callback" darf weitere Bytes senden. Es knnen bis zu
+///					UART_SIZE_DESCRIPTOR_QUEUE Puffer gleichzeitig eingereiht sein. Bytes, die vorher
+///					mit "UartWrite()" geschrieben wurden, werden vor dem Puffer gesendet. Die Deskriptoren
+///					werden mit gesperrten CPU-Interrupts reserviert und ausgefllt. Die Funktion gibt
+///					"false" zurck, falls keine Deskriptoren frei sind oder "length" 0 ist.
 ///
-///         t_min > ((1 Start-Bit + 1 Stop-Bit + 8 Daten-Bits)/Baud-Rate) * Bytes pro Datenpaket
+/// @param  UartInstance *uart, const uint16_t *data, uint16_t length, UartTxCallback callback,
+///					void *context
 ///
-///					Die max. Zeit richtet sich nach der Hufigkeit der zu empfangenen Daten. Die
-///					Kommunikation ist Interrupt-basiert. Die Funktion gibt folgende Zustnde der
-///					Kommunikation zurck:
+/// @return bool bufferQueued
 ///
-///					- UART_STATUS_IDLE       : Es ist keine Empfangs-Kommunikation aktiv
-///					- UART_STATUS_IN_PROGRESS: Es werde mindestens 1 Byte empfangen
-///					- UART_STATUS_FINISHED   : Eine Empfangs-Kommunikation ist abgeschlossen
+//=================================================================================================
+bool UartQueueTx(UartInstance *uart,
+								 const uint16_t *data,
+								 uint16_t length,
+								 UartTxCallback callback,
+								 void *context)
+{
+		UartTxSegment segment = {data, length};
+		return UartQueueTxGather(uart, &segment, 1, callback, context);
+}
+
+
+//=== Function: UartQueueTxGather =================================================================
 ///
-///					Zum starten einer Empfangs-Kommunikation muss die Funktionen "UartReceiveA()"
-///					aufgerufen werden. Dabei wird nicht aktiv ein Empfang durchgefhrt, da UART nicht
-///					Master-Slave-basiert ist. Siehe hierzu die Beschreibung der Funktion "UartReceiveA()".
+/// @brief  Funktion reiht eine aus "numberOfSegments" Puffern bestehende Nachricht (z.B. Kopf,
+///					Nutzdaten und Prfsumme in getrennten Puffern) zum Senden ohne Kopie ein. Die
+///					Puffer werden direkt nacheinander gesendet. Es werden entweder alle oder keine
+///					Puffer eingereiht. Die Funktion "callback" wird einmal aufgerufen, sobald der
+///					letzte Puffer in den Sende-FIFO kopiert wurde, ab dann drfen alle Puffer wieder
+///					verndert werden (siehe "UartQueueTx()").
 ///
-/// @param	void
+/// @param  UartInstance *uart, const UartTxSegment *segments, uint16_t numberOfSegments,
+///					UartTxCallback callback, void *context
 ///
-/// @return uint16_t uartStatusFlagRxA
+/// @return bool messageQueued
 ///
 //=================================================================================================
-extern uint16_t UartGetStatusRxA(void)
+bool UartQueueTxGather(UartInstance *uart,
+											 const UartTxSegment *segments,
+											 uint16_t numberOfSegments,
+											 UartTxCallback callback,
+											 void *context)
 {
-		// Die Kommunikaton wurde gestartet
-		if (uartStatusFlagRxA == UART_STATUS_IN_PROGRESS)
+		if (numberOfSegments == 0)
 		{
-				// Es wurden seit dem letzten Aufruf der Funktion
-				// keine neuen Daten in den Software-Puffer kopiert
-				if (uartBufferIndexRxA == uartBufferIndexRxOldA)
-				{
-						// Es wurde ein vollstndiges Datenpaket empfangen
-						// und keine weiteren Daten empfangen (FIFO ist leer)
-						if (   (uartBufferIndexRxA == uartBytesToTransferRxA)
-							  && !SciaRegs.SCIFFRX.bit.RXFFST)
-						{
-						    // Empfangen ausschalten
-						    SciaRegs.SCICTL1.bit.RXENA = 0;
-						    // Empfangs-FIFO-Interrupt ausschalten
-						    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
-								// Timeout-Zhler initialisieren
-								uartRxTimeoutA = UART_NO_TIMEOUT;
-								// Status-Flag setzen
-								uartStatusFlagRxA = UART_STATUS_FINISHED;
-						}
-						// Es wurde mindestens ein Byte in den Software-Puffer kopiert, jedoch kein
-						// komplettes Datenpaket (entweder zu wenige oder zu viele Bytes empfangen)
-						// oder es wurden weniger Bytes empfangen, als das Interrupt-Niveau. Die
-						// letzte Bedingung wrde zutreffen, wenn diese Funktion kurz nach Beginn
-						// einer Empfangskommunikation aufgerufen wird, also wenn bereits ein Paar
-						// Bytes empfangen wurden, jedoch deren Anzahl noch unterhalb des ersten
-						// Interrupt-Niveaus liegt. Damit hierdurch die Abfrage-Bedingung nicht
-						// erfllt wird, wird der Wert der empfangenen Bytes mit dem aus dem vor-
-						// herigen Funktionsaufruf verglichen
-						else if (   uartBufferIndexRxA
-										 || (SciaRegs.SCIFFRX.bit.RXFFST && (SciaRegs.SCIFFRX.bit.RXFFST == uartOldValueFifoBufferA)))
-						{
-						    // Empfangen ausschalten
-						    SciaRegs.SCICTL1.bit.RXENA = 0;
-						    // Empfangs-FIFO-Interrupt ausschalten
-						    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
-								// Status auf "bereit" setzen
-								uartStatusFlagRxA = UART_STATUS_IDLE;
-						}
-				}
-				// Es wurden seit dem letzten Aufruf der Funktion neue Daten in den Software-Puffer kopiert
-				else
-				{
-						// Alten und neuen Zhler synchronisieren
-						uartBufferIndexRxOldA = uartBufferIndexRxA;
-				}
-				// Aktuelle Zahl der im Empfangs-FIFO befindlichen Bytes speichern.
-				// Wird zur Erkennung von Empfangsfehlern bentigt
-				uartOldValueFifoBufferA = SciaRegs.SCIFFRX.bit.RXFFST;
-				// Innerhalb des vorgegebenen Zeitfensters (wird bei Aufruf der Funktion
-				// "UartReceive()" bergeben) wurde kein vollstndiges Datenpaket empfangen
-				if (uartRxTimeoutA == 0)
+				return false;
+		}
+		for (uint16_t i = 0; i < numberOfSegments; i++)
+		{
+				if (   (segments[i].data == 0)
+						|| (segments[i].length == 0))
 				{
-						// Zhler initialisieren, damit der Empfangsvorgang
-						// in dieser Funktion nur einmalig abgebochen wird
-						uartRxTimeoutA = UART_NO_TIMEOUT;
-				    // Empfangen ausschalten
-				    SciaRegs.SCICTL1.bit.RXENA = 0;
-				    // Empfangs-FIFO-Interrupt ausschalten
-				    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
-						// Staus auf "Timeout" setzen
-						uartStatusFlagRxA = UART_STATUS_RX_TIMEOUT;
+						return false;
 				}
 		}
-		return uartStatusFlagRxA;
+
+		// Die Sende-ISR kann ber eine Callback-Funktion ebenfalls Deskriptoren belegen.
+		// Freie Deskriptoren prfen, ausfllen und Schreibindex weitersetzen daher mit
+		// gesperrten CPU-Interrupts (vorherigen Zustand wiederherstellen)
+		uint16_t interruptState = __disable_interrupts();
+		if (numberOfSegments > UartGetFreeDescriptorsTx(uart))
+		{
+				__restore_interrupts(interruptState);
+				return false;
+		}
+		uint16_t head = uart->headDescriptorTx;
+		for (uint16_t i = 0; i < numberOfSegments; i++)
+		{
+				UartTxDescriptor *descriptor = &uart->descriptorTx[head & (UART_SIZE_DESCRIPTOR_QUEUE - 1U)];
+				descriptor->data         = segments[i].data;
+				descriptor->length       = segments[i].length;
+				descriptor->ringPosition = uart->headTx;
+				// Nur der letzte Puffer der Nachricht meldet den Abschluss
+				descriptor->callback     = (i == (numberOfSegments - 1U)) ? callback : 0;
+				descriptor->context      = context;
+				head++;
+		}
+		// Schreibindex erst nach dem Ausfllen weitersetzen, damit
+		// die ISR keine unvollstndigen Deskriptoren liest
+		uart->headDescriptorTx = head;
+		UartStartTx(uart);
+		__restore_interrupts(interruptState);
+		return true;
+}
+
+
+//=== Function: UartGetFreeDescriptorsTx ==========================================================
+///
+/// @brief  Funktion gibt die Anzahl der freien Sende-Deskriptoren zurck.
+///
+/// @param  UartInstance *uart
+///
+/// @return uint16_t numberOfDescriptors
+///
+//=================================================================================================
+uint16_t UartGetFreeDescriptorsTx(UartInstance *uart)
+{
+		return UART_SIZE_DESCRIPTOR_QUEUE - (uint16_t)(uart->headDescriptorTx - uart->tailDescriptorTx);
+}
+
+
+//=== Function: UartStartTx =======================================================================
+///
+/// @brief  Funktion startet die bertragung nach dem Schreiben in den Sende-Ringpuffer oder dem
+///					Einreihen eines Sende-Deskriptors. Ist aktuell keine Sende-Kommunikation aktiv, wird
+///					der Sende-FIFO direkt gefllt und der Sende-FIFO-Interrupt eingeschaltet. Die
+///					Funktion darf auch aus einer ISR bzw. einer Callback-Funktion "UartTxCallback"
+///					aufgerufen werden, der Zustand der CPU-Interrupts bleibt dabei erhalten.
+///
+/// @param  UartInstance *uart
+///
+/// @return void
+///
+//=================================================================================================
+void UartStartTx(UartInstance *uart)
+{
+		// CPU-Interrupts sperren, damit sich Hauptprogramm und Sende-ISR beim Einschalten
+		// des Sende-FIFO-Interrupts nicht berschneiden. Der vorherige Zustand wird
+		// wiederhergestellt, damit ein Aufruf aus einer ISR die Interrupts nicht freigibt
+		uint16_t interruptState = __disable_interrupts();
+		uart->statusTx = UART_STATUS_IN_PROGRESS;
+		if (!uart->regs->SCIFFTX.bit.TXFFIENA)
+		{
+				// Sende-FIFO fllen
+				UartCopyFifoTx(uart);
+				// Sende-FIFO-Interrupt-Flag lschen und Interrupt einschalten
+				uart->regs->SCIFFTX.bit.TXFFINTCLR = 1;
+				uart->regs->SCIFFTX.bit.TXFFIENA   = 1;
+		}
+		// bertragung luft bereits -> Interrupt-Niveau wieder anheben,
+		// damit der FIFO vor dem Leerlaufen nachgefllt wird
+		else
+		{
+				uart->regs->SCIFFTX.bit.TXFFIL = UART_LEVEL_FIFO_TX;
+		}
+		__restore_interrupts(interruptState);
 }
 
 
-//=== Function: UartGetStatusTxA ==================================================================
+//=== Function: UartGetStatusTx ===================================================================
 ///
 /// @brief	Funktion gibt den aktuellen Status der Tx UART-Kommunikation (senden) zurck.
 ///					Die Kommunikation ist Interrupt-basiert und kann folgende Zustnde annehmen:
 ///
 ///					- UART_STATUS_IDLE       : Es ist keine Sende-Kommunikation aktiv
-///					- UART_STATUS_IN_PROGRESS: Eine Sende-Kommunikation wurde gestartet
-///					- UART_STATUS_FINISHED   : Das letzte Byte wurde begonnen zu senden,
-///																		 ist aber noch nicht koplett versendet
+///					- UART_STATUS_IN_PROGRESS: Es befinden sich noch Bytes im Ringpuffer, im FIFO oder
+///					                           im Ausgangs-Schieberegister
+///					- UART_STATUS_FINISHED   : Alle Bytes wurden vollstndig gesendet
 ///
-///					Zum starten einer Sende-Kommunikation muss die Funktionen "UartTransmitA()"
-///					aufgerufen werden.
+///					Eine Sende-Kommunikation wird durch Aufruf der Funktion "UartWrite()" gestartet.
+///					Vor der Rckgabe wird mit "UartCheckTxEmpty()" geprft, ob die bertragung
+///					inzwischen abgeschlossen ist.
 ///
-/// @param	void
+/// @param	UartInstance *uart
 ///
-/// @return uint16_t uartStatusFlagTx
+/// @return uint16_t statusTx
 ///
 //=================================================================================================
-extern uint16_t UartGetStatusTxA(void)
+uint16_t UartGetStatusTx(UartInstance *uart)
 {
-		return uartStatusFlagTxA;
+		UartCheckTxEmpty(uart);
+		return uart->statusTx;
 }
 
 
-//=== Function: UartSetStatusIdleRxA ==============================================================
+//=== Function: UartCheckTxEmpty ==================================================================
 ///
-/// @brief	Funktion setzt das Rx Status-Flag auf "idle" und gibt "true" zurck, falls die vorherige
-///					Kommunikation abgeschlossen ist. Ist noch eine Kommunikation aktiv, wird das Flag nicht
-///					verndert und es wird "false" zurck gegeben.
+/// @brief	Funktion prft, ob die laufende Sende-Kommunikation abgeschlossen ist und setzt in
+///					diesem Fall das Status-Flag auf UART_STATUS_FINISHED. Die bertragung ist
+///					abgeschlossen, wenn die Sende-ISR den Sende-FIFO-Interrupt ausgeschaltet hat
+///					(Ringpuffer und FIFO leer) und SCICTL2.TXEMPTY gesetzt ist, d.h. auch das letzte
+///					Byte das Ausgangs-Schieberegister TXSHF verlassen hat (S. 3888 Reference Manual
+///					TMS320F2838x, SPRUII0D, Rev. D, July 2022). Die Funktion wartet nicht und muss
+///					periodisch aufgerufen werden (z.B. aus einem Zeitgeber oder dem Hauptprogramm),
+///					falls das Ende der bertragung zeitnah erkannt werden muss (z.B. zur Umschaltung
+///					eines RS485-Treibers). Sie wird auch von "UartGetStatusTx()" aufgerufen.
 ///
-/// @param	void
+/// @param	UartInstance *uart
 ///
-/// @return bool flagSetToIdle
+/// @return bool transmissionFinished
 ///
 //=================================================================================================
-extern bool UartSetStatusIdleRxA(void)
+bool UartCheckTxEmpty(UartInstance *uart)
 {
-		bool flagSetToIdle = false;
-		// Staus-Flag nur auf "idle" setzen, falls eine
-		// vorherige Kommunikation abgeschlossen ist
-		if (uartStatusFlagRxA != UART_STATUS_IN_PROGRESS)
+		// Ist der Sende-FIFO-Interrupt ausgeschaltet, kann die Sende-ISR den Zustand nicht mehr
+		// verndern. "UartStartTx()" darf jedoch auch aus einer ISR aufgerufen werden, die
+		// Prfung erfolgt daher mit gesperrten CPU-Interrupts
+		uint16_t interruptState = __disable_interrupts();
+		if (   (uart->statusTx == UART_STATUS_IN_PROGRESS)
+				&& !uart->regs->SCIFFTX.bit.TXFFIENA
+				&& (uart->tailTx == uart->headTx)
+				&& (uart->tailDescriptorTx == uart->headDescriptorTx)
+				&& uart->regs->SCICTL2.bit.TXEMPTY)
 		{
-				uartStatusFlagRxA = UART_STATUS_IDLE;
-				flagSetToIdle = true;
+				uart->statusTx = UART_STATUS_FINISHED;
 		}
-		return flagSetToIdle;
+		bool transmissionFinished = (uart->statusTx == UART_STATUS_FINISHED);
+		__restore_interrupts(interruptState);
+		return transmissionFinished;
 }
 
 
-//=== Function: UartSetStatusIdleTxA ==============================================================
+//=== Function: UartSetStatusIdleTx ===============================================================
 ///
 /// @brief	Funktion setzt das Tx Status-Flag auf "idle" und gibt "true" zurck, falls die vorherige
 ///					Kommunikation abgeschlossen ist. Ist noch eine Kommunikation aktiv, wird das Flag nicht
 ///					verndert und es wird "false" zurck gegeben.
 ///
-/// @param	void
+/// @param	UartInstance *uart
 ///
 /// @return bool flagSetToIdle
 ///
 //=================================================================================================
-extern bool UartSetStatusIdleTxA(void)
+bool UartSetStatusIdleTx(UartInstance *uart)
 {
 		bool flagSetToIdle = false;
 		// Staus-Flag nur auf "idle" setzen, falls eine
 		// vorherige Kommunikation abgeschlossen ist
-		if (uartStatusFlagTxA == UART_STATUS_FINISHED)
+		if (uart->statusTx == UART_STATUS_FINISHED)
 		{
-				uartStatusFlagTxA = UART_STATUS_IDLE;
+				uart->statusTx = UART_STATUS_IDLE;
 				flagSetToIdle = true;
 		}
 		return flagSetToIdle;
 }
 
 
-//=== Function: UartReceiveA ======================================================================
+//=== Function: UartCopyFifoRx ====================================================================
 ///
-/// @brief  Funktion konfiguriert die Steuervariablen und den Empfangs-Interrupt so, dass Daten
-///					ber UART empfangen werden knnen. Der Parameter "numberOfBytesRx" gibt an, wie viele
-///					Bytes empfangen werden sollen. Wenn diese Anzahl erreicht ist, gibt die Funktion
-///					"UartGetStatusRxA()" bei Aufruf den Wert "UART_STATUS_RX_FINISHED" zurck (Daten
-///					vollstndig empfangen). Wird innerhalb des mit dem Parameter "timeOut" bergebenen
-///					Zeitfensters (= timeOut * 5 ms) kein vollstndiges Datenpaket empfangen, so wird
-///					der Empfangsvorgang abgebrochen (z.B. im Hauptprogramm durch Abfrage der Variable
-///         "uartRxTimeoutA" auf 0). Da UART eine asynchrone Schnittstelle ist, ist die Funktion
-///					"UartReceiveA()" nicht als Funktion zum forcierten Empfangen von Daten zu verstehen,
-///					sondern als initialisierende Vorbereitung zum Empfang vom Daten.
+/// @brief  Funktion kopiert alle Bytes aus dem Empfangs-FIFO in den Empfangs-Ringpuffer. Ist der
+///					Ringpuffer voll, werden die Bytes trotzdem aus dem FIFO gelesen (damit der FIFO nicht
+///					berluft), jedoch verworfen und in "rxOverflow" gezhlt. Die Funktion wird aus der
+///					Empfangs-ISR und mit gesperrten Interrupts aus "UartAvailable()" aufgerufen.
 ///
-/// @param  uint16_t numberOfBytesRx, int32_t timeOut
+/// @param  UartInstance *uart
 ///
-/// @return bool operationPerformed
+/// @return void
 ///
 //=================================================================================================
-extern bool UartReceiveA(uint16_t numberOfBytesRx,
-												 int32_t timeOut)
+void UartCopyFifoRx(UartInstance *uart)
 {
-		// Ergebnis des Funktionsaufrufes (Empfangsvorgang initiiert / nicht initiiert)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist
-		// und die Anzahl der zu empfangenen Bytes die Gre des Software-Puffers
-		// nicht berschreitet und mindestens 1 ist
-		if ((uartStatusFlagRxA != UART_STATUS_IN_PROGRESS)
-				&& (numberOfBytesRx <= UART_SIZE_SOFTWARE_BUFFER_RX)
-				&& numberOfBytesRx)
+		uint16_t head = uart->headRx;
+		while (uart->regs->SCIFFRX.bit.RXFFST > 0)
 		{
-				// Rckgabewert auf "true" setzen, um der aufrufenden Stelle
-				// zu signalisieren, dass der Empfangsvorgang initiiert wurde
-				operationPerformed = true;
-				// Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine UART-Kommunikation gestartet wurde
-				uartStatusFlagRxA = UART_STATUS_IN_PROGRESS;
-				// Timeout-Zhler auf den bergebenen Wert setzen
-				uartRxTimeoutA = timeOut;
-
-				// Index zur Verwaltung des Software-Puffers "uartBufferRxA[]" auf das erste Element
-				// setzen, damit die zu sendenen Daten vom Anfang des Puffers beginnend kopiert werden
-				uartBufferIndexRxA    = 0;
-				uartBufferIndexRxOldA = 0;
-				// Menge der zu empfangenen Bytes an die Steuervariable bergeben.
-				// Diese koordiniert die restliche Kommunikation in der ISR und
-				// der Funktion "UartGetStatusRxA()"
-				uartBytesToTransferRxA = numberOfBytesRx;
-				// Empfangs-FIFO leeren, falls in diesem noch Daten vorhanden sind
-				while (SciaRegs.SCIFFRX.bit.RXFFST > 0)
+				uint16_t data = uart->regs->SCIRXBUF.bit.SAR;
+				if ((uint16_t)(head - uart->tailRx) < UART_SIZE_RING_BUFFER_RX)
+				{
+						uart->ringRx[head & (UART_SIZE_RING_BUFFER_RX - 1U)] = data;
+						head++;
+				}
+				else
 				{
-						uint16_t dummy = SciaRegs.SCIRXBUF.bit.SAR;
+						uart->rxOverflow++;
 				}
-				uartOldValueFifoBufferA = SciaRegs.SCIFFRX.bit.RXFFST;
-		    // Empfangs-FIFO-Interrupt auslsen, wenn die Anzahl
-				// erwarteter Bytes empfangen wurde oder die max.
-				// Kapazitt des FIFOs erreicht ist
-		    SciaRegs.SCIFFRX.bit.RXFFIL = numberOfBytesRx;
-		    if (numberOfBytesRx > UART_SIZE_HARDWARE_FIFO)
-		    {
-		    		SciaRegs.SCIFFRX.bit.RXFFIL = UART_SIZE_HARDWARE_FIFO;
-		    }
-		    // Evtl. gesetztes Overflow-Flag lschen, da kein Interrupt
-		    // ausgelst werden, falls das Bit gesetzt ist
-		    SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
-		    //Empfangs-FIFO-Interrupt-Flag lschen
-		    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
-		    // Empfangs-FIFO-Interrupt einschalten
-		    SciaRegs.SCIFFRX.bit.RXFFIENA = 1;
-		    // Empfangen einschalten
-		    SciaRegs.SCICTL1.bit.RXENA = 1;
 		}
-		return operationPerformed;
+		uart->headRx = head;
 }
 
 
-//=== Function: UartTransmitA =====================================================================
+//=== Function: UartCopyFifoTx ====================================================================
 ///
-/// @brief  Funktion sendet ber UART Daten aus dem Sotware-Puffer "uartBufferTx[]". Der
-///					Parameter "numberOfBytesTx" gibt an, wie viele Bytes gesendet werden sollen. Es
-///				  wird der Hardware-FIFO des Mikrocontrollers benutzt. In diesen werden zunchst
-///					die Daten aus dem Software-Puffer "uartBufferTx[]" kopiert. Sollen mehr Bytes
-///					versendet werden, als der FIFO fasst, so wird der FIFO vollstndig gefllt und
-///					im nchsten Aufruf der ISR die restlichen Bytes in den Sende-FIFO kopiert. Die
-///					ISR wird aufgerufen, sobald der Sende-FIFO leer ist.
+/// @brief  Funktion kopiert Bytes aus dem Sende-Ringpuffer und den Puffern der Sende-Deskriptoren
+///					in den Sende-FIFO, bis dieser voll ist oder keine Bytes mehr zu senden sind. Bytes
+///					des Ringpuffers, die vor einem Deskriptor geschrieben wurden, werden vor dessen
+///					Puffer gesendet. Ist ein Puffer vollstndig kopiert, wird die Funktion "callback"
+///					des Deskriptors aufgerufen. Die Funktion wird aus der Sende-ISR und mit gesperrten
+///					Interrupts aus "UartStartTx()" aufgerufen, "callback" luft daher immer mit
+///					gesperrten Interrupts. Der Leseindex wird vor dem Aufruf gespeichert und danach
+///					neu gelesen, damit "callback" mit "UartWrite()" oder "UartQueueTx()" weitere
+///					Bytes senden kann, ohne dass Bytes doppelt gesendet werden.
 ///
-/// @param  uint16_t numberOfBytesTx
+/// @param  UartInstance *uart
 ///
-/// @return bool operationPerformed
+/// @return void
+///
+//=================================================================================================
+void UartCopyFifoTx(UartInstance *uart)
+{
+		uint16_t tail = uart->tailTx;
+		while (uart->regs->SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO)
+		{
+				// Kein Deskriptor eingereiht -> Ringpuffer bis zum Schreibindex senden
+				if (uart->tailDescriptorTx == uart->headDescriptorTx)
+				{
+						if (tail == uart->headTx)
+						{
+								break;
+						}
+						uart->regs->SCITXBUF.bit.TXDT = uart->ringTx[tail & (UART_SIZE_RING_BUFFER_TX - 1U)];
+						tail++;
+						continue;
+				}
+
+				UartTxDescriptor *descriptor = &uart->descriptorTx[uart->tailDescriptorTx & (UART_SIZE_DESCRIPTOR_QUEUE - 1U)];
+				// Zuerst die vor dem Deskriptor in den Ringpuffer geschriebenen Bytes senden
+				if (tail != descriptor->ringPosition)
+				{
+						uart->regs->SCITXBUF.bit.TXDT = uart->ringTx[tail & (UART_SIZE_RING_BUFFER_TX - 1U)];
+						tail++;
+						continue;
+				}
+				// Byte aus dem Puffer des Deskriptors senden
+				uart->regs->SCITXBUF.bit.TXDT = descriptor->data[uart->offsetDescriptorTx];
+				uart->offsetDescriptorTx++;
+				// Puffer vollstndig kopiert -> Deskriptor freigeben und Abschluss melden
+				if (uart->offsetDescriptorTx >= descriptor->length)
+				{
+						UartTxCallback callback = descriptor->callback;
+						void *context = descriptor->context;
+						uart->offsetDescriptorTx = 0;
+						uart->tailDescriptorTx++;
+						if (callback != 0)
+						{
+								// Leseindex vor dem Aufruf speichern, "callback" kann ber
+								// "UartStartTx()" selbst Bytes in den Sende-FIFO kopieren
+								uart->tailTx = tail;
+								callback(context);
+								tail = uart->tailTx;
+						}
+				}
+		}
+		uart->tailTx = tail;
+}
+
+
+//=== Function: UartHandleRx ======================================================================
+///
+/// @brief  Funktion bearbeitet den Empfangs-Interrupt einer Instanz. Alle Bytes werden aus dem
+///					Empfangs-FIFO in den Ringpuffer kopiert. Ein berlauf des FIFOs und Empfangsfehler
+///					werden gezhlt, bei einem Empfangsfehler wird das SCI-Modul zurckgesetzt, da es
+///					sonst keine weiteren Bytes empfngt. Die Funktion wird aus den ISRs "UartRxISRx()"
+///					aufgerufen, das PIE-Interrupt-Flag wird dort gelscht.
+///
+/// @param  UartInstance *uart
+///
+/// @return void
 ///
 //=================================================================================================
-extern bool UartTransmitA(uint16_t numberOfBytesTx)
+void UartHandleRx(UartInstance *uart)
 {
-		// Ergebnis des Funktionsaufrufes (Sendevorgang gestartet / nicht gestartet)
-		bool operationPerformed = false;
-		// Vorgang nur starten falls keine vorherige Kommunikation aktiv ist
-		// und die Anzahl der zu sendenen Bytes die Gre des Software-Puffers
-		// nicht berschreitet und mindestens 1 ist
-		if ((uartStatusFlagTxA != UART_STATUS_IN_PROGRESS)
-				&& (numberOfBytesTx <= UART_SIZE_SOFTWARE_BUFFER_TX)
-				&& numberOfBytesTx)
+		volatile struct SCI_REGS *regs = uart->regs;
+
+		// Daten aus dem Empfangs-FIFO in den Ringpuffer kopieren
+		UartCopyFifoRx(uart);
+
+		// Der Empfangs-FIFO ist bergelaufen (mindestens ein Byte verloren)
+		if (regs->SCIFFRX.bit.RXFFOVF)
 		{
-				// Rckgabewert auf "true" setzen, um der aufrufenden Stelle
-				// zu signalisieren, dass der Sendevorgang gestartet wurde
-				operationPerformed = true;
-				// Flag setzen um der aufrufenden Stelle zu signalisieren,
-				// dass eine UART-Kommunikation gestartet wurde
-				uartStatusFlagTxA = UART_STATUS_IN_PROGRESS;
-				// Index zur Verwaltung des Software-Puffers "uartBufferTxA[]" auf das erste Element
-				// setzen, damit die zu sendenen Daten vom Anfang des Puffers aus kopiert werden
-				uartBufferIndexTxA = 0;
-				// Menge der zu sendenen Bytes an die Steuervariable bergeben.
-				// Diese koordiniert die restliche Kommunikation in der ISR
-				uartBytesToTransferTxA = numberOfBytesTx;
-		    // Senden einschalten (muss VOR dem Beschreiben des Sende-FIFOs gesetzt werden)
-		    SciaRegs.SCICTL1.bit.TXENA = 1;
-		    // Zu sendene Daten von dem Software-Puffer in den Sende-FIFO kopieren
-				// bis dieser gefllt ist oder der Software-Puffer leer ist
-				while (   (uartBufferIndexTxA < uartBytesToTransferTxA)
-							 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
+				uart->rxOverflow++;
+				regs->SCIFFRX.bit.RXFFOVRCLR = 1;
+		}
+		// Empfangsfehler: SCI-Modul zurcksetzen (Konfiguration
+		// und FIFO-Einstellungen bleiben dabei erhalten)
+		if (regs->SCIRXST.bit.RXERROR)
+		{
+				uart->rxError++;
+				regs->SCICTL1.bit.SWRESET = 0;
+				regs->SCICTL1.bit.SWRESET = 1;
+		}
+
+		// Empfangs-FIFO-Interrupt-Flag lschen
+		regs->SCIFFRX.bit.RXFFINTCLR = 1;
+}
+
+
+//=== Function: UartHandleTx ======================================================================
+///
+/// @brief  Funktion bearbeitet den Sende-Interrupt einer Instanz. Der Sende-FIFO wird aus dem
+///					Sende-Ringpuffer und den Sende-Deskriptoren nachgefllt, so dass bei fortlaufendem
+///					Senden keine Pausen zwischen den Bytes entstehen. Sind keine Bytes mehr zu senden,
+///					wird das Interrupt-Niveau auf 0 gesetzt, so dass der Interrupt erneut ausgelst
+///					wird, sobald der FIFO leer ist. Sind dann keine neuen Bytes hinzugekommen, wird der
+///					Sende-FIFO-Interrupt ausgeschaltet.
+///					Es wird nie aktiv gewartet, das Ende der bertragung wird von "UartCheckTxEmpty()"
+///					erkannt. Die Funktion wird aus den ISRs "UartTxISRx()" aufgerufen, das
+///					PIE-Interrupt-Flag wird dort gelscht.
+///
+/// @param  UartInstance *uart
+///
+/// @return void
+///
+//=================================================================================================
+void UartHandleTx(UartInstance *uart)
+{
+		volatile struct SCI_REGS *regs = uart->regs;
+
+		// Sende-FIFO aus dem Ringpuffer nachfllen
+		UartCopyFifoTx(uart);
+
+		// Ringpuffer ist leer und keine Deskriptoren eingereiht
+		if (   (uart->tailTx == uart->headTx)
+				&& (uart->tailDescriptorTx == uart->headDescriptorTx))
+		{
+				// Sende-FIFO ist ebenfalls leer -> bertragung beenden
+				if (regs->SCIFFTX.bit.TXFFST == 0)
+				{
+				    // Sende-FIFO-Interrupt ausschalten und Interrupt-Niveau zurcksetzen.
+				    // Das letzte Byte befindet sich jetzt noch im Ausgangs-Schieberegister
+				    // TXSHF. Das Ende der bertragung (SCICTL2.TXEMPTY) wird nicht in der
+				    // ISR abgewartet (bis zu eine Zeichendauer, bei 9600 Baud ca. 1 ms),
+				    // sondern auerhalb der ISR von "UartCheckTxEmpty()" erkannt
+				    regs->SCIFFTX.bit.TXFFIENA = 0;
+				    regs->SCIFFTX.bit.TXFFIL   = UART_LEVEL_FIFO_TX;
+				}
+				// ISR erneut aufrufen, sobald der Sende-FIFO leer ist
+				else
 				{
-						SciaRegs.SCITXBUF.bit.TXDT = uartBufferTxA[uartBufferIndexTxA];
-						uartBufferIndexTxA++;
+						regs->SCIFFTX.bit.TXFFIL = 0;
 				}
-		    // Sende-FIFO-Interrupt-Flag lschen
-		    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
-		    // Tx-FIFO-Interrupt wird ausgelst, wenn der Wert in SCIFFTX.TXFFST gleich oder
-		    // kleiner SCIFFTX.TXFFIL ist. SCIFFTX.TXFFST gibt die Anzahl der sich im Sende-
-		    // FIFO befindlichen Bytes an. Dieser Wert wird mit jedem vom Sende-FIFO in das
-		    // Sende-Schieberegister kopierte Byte um 1 reduziert. ACHTUNG: SCIFFTX.TXFFST
-		    // = 0 bedeutet nicht, dass das Senden abgeschlossen sit, da sich das letzte Byte
-		    // noch im Sende-Shift-Register befindet und Bit fr Bit ausgesendet wird. Um zu
-		    // prfen, ob der Sendevorgang vollstndig abgeschlossen ist, muss das Bit
-		    // SCICTL2.TXEMPTY abgefragt werden. Dies ist 1, sobald Sende-FIFO und Sende-
-		    // Shift-Register leer sind.
-		    // Sende-FIFO-Interrupt auslsen, wenn der Sende-FIFO leer ist
-		    SciaRegs.SCIFFTX.bit.TXFFIL = 0;
-		    // Tx-FIFO-Interrupt einschalten
-		    SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
 		}
-		return operationPerformed;
+		// Weitere Bytes zu senden -> FIFO rechtzeitig vor dem Leerlaufen nachfllen
+		else
+		{
+				regs->SCIFFTX.bit.TXFFIL = UART_LEVEL_FIFO_TX;
+		}
+
+		// Sende-FIFO-Interrupt-Flag lschen
+		regs->SCIFFTX.bit.TXFFINTCLR = 1;
 }
 
 
 //=== Function: UartRxISRA ========================================================================
 ///
-/// @brief  ISR wird aufgerufen, sobald der (Hardware-) Empfangs-FIFO voll ist oder die Anzahl
-///					an Bytes die im Register SCIFFRX.RXFFIL steht empfangen wurde. Aus dem Empfangs-
-///					FIFO werden die Daten in den Software-Puffer "uartBufferRxA[]" kopiert, bis die
-///					erwartete Zahl an Bytes (uartBytesToTransferRx) erreicht ist.
+/// @brief  ISR wird aufgerufen, sobald sich mindestens UART_LEVEL_FIFO_RX Bytes im (Hardware-)
+///					Empfangs-FIFO von SCI-A befinden. Die Bearbeitung erfolgt in
+///					"UartHandleRx()".
 ///
 /// @param  void
 ///
@@ -561,51 +986,101 @@ __interrupt void UartRxISRA(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Daten aus dem Empfangs-FIFO in den Software-Puffer kopieren bis die
-		// erwartete Anzahl an Bytes empfangen wurde oder der FIFO leer ist
-		while (   (uartBufferIndexRxA < uartBytesToTransferRxA)
-					 && (SciaRegs.SCIFFRX.bit.RXFFST > 0))
-		{
-				uartBufferRxA[uartBufferIndexRxA] = SciaRegs.SCIRXBUF.bit.SAR;
-				uartBufferIndexRxA++;
-		}
-		// Es werden noch weitere Bytes erwartet -> neues Interrupt-Niveau setzen
-		if (uartBufferIndexRxA < uartBytesToTransferRxA)
-		{
-		    if ((uartBytesToTransferRxA - uartBufferIndexRxA) > UART_SIZE_HARDWARE_FIFO)
-		    {
-		    		SciaRegs.SCIFFRX.bit.RXFFIL = UART_SIZE_HARDWARE_FIFO;
-		    }
-		    else
-		    {
-		    		SciaRegs.SCIFFRX.bit.RXFFIL =	(uartBytesToTransferRxA - uartBufferIndexRxA);
-		    }
-		}
-		// Die erwartete Anzahl an Bytes wurde empfangen
-		else
-		{
-		    // Empfangs-FIFO-Interrupt ausschalten
-		    SciaRegs.SCIFFRX.bit.RXFFIENA = 0;
-		    // Empfangen weiterhin eingeschaltet lassen,
-		    // um eine berzahl an Bytes zu erkennen
-		    // (mehr Bytes empfangen als Datepaketgre)
-		}
-
-		// Empfangs-FIFO-Interrupt-Flag lschen
-		SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1;
+		UartHandleRx(&uartA);
 		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_RX-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
 }
 
 
+//=== Function: UartRxISRB ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald sich mindestens UART_LEVEL_FIFO_RX Bytes im (Hardware-)
+///					Empfangs-FIFO von SCI-B befinden. Die Bearbeitung erfolgt in
+///					"UartHandleRx()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartRxISRB(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		UartHandleRx(&uartB);
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIB_RX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+}
+
+
+//=== Function: UartRxISRC ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald sich mindestens UART_LEVEL_FIFO_RX Bytes im (Hardware-)
+///					Empfangs-FIFO von SCI-C befinden. Die Bearbeitung erfolgt in
+///					"UartHandleRx()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartRxISRC(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		UartHandleRx(&uartC);
+		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der INT_SCIC_RX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
+}
+
+
+//=== Function: UartRxISRD ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald sich mindestens UART_LEVEL_FIFO_RX Bytes im (Hardware-)
+///					Empfangs-FIFO von SCI-D befinden. Die Bearbeitung erfolgt in
+///					"UartHandleRx()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartRxISRD(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		UartHandleRx(&uartD);
+		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der INT_SCID_RX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
+}
+
+
 //=== Function: UartTxISRA ========================================================================
 ///
-/// @brief  ISR wird aufgerufen, sobald ein Byte aus dem Register SCITXBUF in das Senderegister
-///					geshiftet wurde. Das bedeutet, dass die ISR aufgerufen wird, wenn das zu sendene
-///					Byte gerade angefangen wird an dem Pin TxD auszugeben und nicht nach Ende des
-///					Sendevorgangs! Sind beim Aufruf der ISR noch weitere Bytes zu senden, so wird
-///         das nchste aus dem Software-Puffer "uartBufferTxA[]" gesendet. Andernfalls wird
-///         der Tx-Interrupt ausgeschaltet. Anschlieend werden alle Interrupt-Flags gelscht.
+/// @brief  ISR wird aufgerufen, sobald sich hchstens UART_LEVEL_FIFO_TX Bytes im (Hardware-)
+///					Sende-FIFO von SCI-A befinden. Die Bearbeitung erfolgt in
+///					"UartHandleTx()".
 ///
 /// @param  void
 ///
@@ -623,42 +1098,91 @@ __interrupt void UartTxISRA(void)
 		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
 		//EALLOW;
 
-		// Alle Bytes wurden aus dem Software-Puffer uartBufferTx[] in den (Hardware-) Sende-Puffer
-		// SCIFFTX.TXFFST und von dort in das Ausgangs-Schieberegister TXSHF geladen (siehe S. 3866
-		// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022). Zu diesem Zeitpunkt wird
-		// das letzte Byte noch versendet!
-		if (uartBufferIndexTxA == uartBytesToTransferTxA)
-		{
-		    // Senden ausschalten. Es werden trotzdem noch alle Daten aus dem Puffer
-				// SCITXBUF.TXDT versendet (siehe S. 3885 Reference Manual TMS320F2838x,
-				// SPRUII0D, Rev. D, July 2022)
-		    SciaRegs.SCICTL1.bit.TXENA = 0;
-		    // Sende-FIFO-Interrupt ausschalten
-		    SciaRegs.SCIFFTX.bit.TXFFIENA = 0;
-				// Warten, bis das letzte Byte vollstndig gesendet wurde und anschlieend
-		    // das Status-Flag setzen um das Ende der bertragung zu signalisieren.
-		    // SCICTL2.TXEMPTY wird gesetzt, sobald der Sende-FIFO und das Ausgangs-
-		    // Schieberegister TXSHF leer sind (S. 3888 Reference Manual TMS320F2838x,
-		    // SPRUII0D, Rev. D, July 2022). Bei zeitkritischen Anwendungen sollte die
-		    // Abfrage von SCICTL2.TXEMPTY aus der ISR ausgelagert werden und zyklisch
-		    // erfolgen
-		    #warning "Achtung: while()-Schleife blockiert Prorammablauf!"
-		    while(!SciaRegs.SCICTL2.bit.TXEMPTY);
-				uartStatusFlagTxA = UART_STATUS_FINISHED;
-		}
-    // Zu sendene Daten von dem Software-Puffer in den Sende-FIFO kopieren
-		// bis diser gefllt ist oder der Software-Puffer leer ist. Dieser
-		// Teil muss hinter der obigen if-Abfrage stehen, da andernfalls der
-		// Sendevorgang beendet werden wrde
-		while (   (uartBufferIndexTxA < uartBytesToTransferTxA)
-					 && (SciaRegs.SCIFFTX.bit.TXFFST < UART_SIZE_HARDWARE_FIFO))
-		{
-				SciaRegs.SCITXBUF.bit.TXDT = uartBufferTxA[uartBufferIndexTxA];
-				uartBufferIndexTxA++;
-		}
-
-		// Sende-FIFO-Interrupt-Flag lschen
-		SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1;
+		UartHandleTx(&uartA);
 		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIA_TX-Interrupt zu)
 		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
 }
+
+
+//=== Function: UartTxISRB ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald sich hchstens UART_LEVEL_FIFO_TX Bytes im (Hardware-)
+///					Sende-FIFO von SCI-B befinden. Die Bearbeitung erfolgt in
+///					"UartHandleTx()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartTxISRB(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		UartHandleTx(&uartB);
+		// Interrupt-Flag der Gruppe 9 lschen (da gehrt der INT_SCIB_TX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK9 = 1;
+}
+
+
+//=== Function: UartTxISRC ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald sich hchstens UART_LEVEL_FIFO_TX Bytes im (Hardware-)
+///					Sende-FIFO von SCI-C befinden. Die Bearbeitung erfolgt in
+///					"UartHandleTx()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartTxISRC(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		UartHandleTx(&uartC);
+		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der INT_SCIC_TX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
+}
+
+
+//=== Function: UartTxISRD ========================================================================
+///
+/// @brief  ISR wird aufgerufen, sobald sich hchstens UART_LEVEL_FIFO_TX Bytes im (Hardware-)
+///					Sende-FIFO von SCI-D befinden. Die Bearbeitung erfolgt in
+///					"UartHandleTx()".
+///
+/// @param  void
+///
+/// @return void
+///
+//=================================================================================================
+__interrupt void UartTxISRD(void)
+{
+		// Bei jedem Eintritt in eine Interrupt-Service-Routine (ISR) wird automatisch
+		// das EALLOW-Bit gelscht, unabhngig davon, ob es zuvor gesetzt war (siehe
+		// S. 148 Punkt 9, Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022).
+		// Nach Abschluss der ISR wird das EALLOW-Bit automatisch wieder gesetzt, falls
+		// es vor dem Auftritt des Interrupts gesetzt war. Falls in der ISR nur auf
+		// Register ohne Schreibschutz zugegriffen wird, kann auf den folgenden Befehl
+		// verzichtet werden (siehe Spalte "Write Protection" in der Registerbersicht)
+		//EALLOW;
+
+		UartHandleTx(&uartD);
+		// Interrupt-Flag der Gruppe 8 lschen (da gehrt der INT_SCID_TX-Interrupt zu)
+		PieCtrlRegs.PIEACK.bit.ACK8 = 1;
+}
@@ -1,24 +1,46 @@
 //=================================================================================================
 /// @file       uart.h
 ///
-/// @brief      Datei enthlt Variablen und Funktionen um die UART-Schnittstelle (SCI) eines
-///							TMS320F283x zu benutzen. Die Kommunikation ist Interrupt-basiert. Zum Senden wird
-////						die Funktion "UartTransmit()" aufgerufen und die zu sendene Anzahl an Bytes als
-///							Parameter bergeben. Die zu sendenen Daten werden zuvor in den Puffer
-///							"uartBufferTx[]" geschrieben. Der Empfangsvorgang wird durch Aufruf der Funktion
-///							"UartReceive()" freigegeben. Da UART asynchron ist, kann der Empfangsvorgang nur
-///							freigegeben, aber nicht aktiv forciert werden. Nach Aufruf der Funktion
-///							"UartReceive()", sollte in regelmigen Abstnden die Funktion "UartGetStatusRx()"
-///							aufgerufen werden um den korekten/vollstndigen Empfang eines Datenpakets zu
-///							prfen. Nheres ist der Beschreibung der Funktion "UartGetStatusRx()" zu entnehmen.
-///							Es wird das SCI-A Modul verwendet. Die Module B, C und D knnen analog zu den hier
-///							gezeigten Funktionen verwendet werden.
+/// @brief      Datei enthlt Variablen und Funktionen um die UART-Schnittstellen (SCI) eines
+///							TMS320F283x zu benutzen. Die Kommunikation ist Interrupt-basiert. Alle Funktionen
+///							arbeiten mit einer Instanz ("UartInstance"), die das verwendete SCI-Modul, die
+///							Ringpuffer und den Zustand der Kommunikation enthlt. Fr die Module SCI-A bis
+///							SCI-D stehen die Instanzen "uartA" bis "uartD" zur Verfgung, die gleichzeitig
+///							und unabhngig voneinander betrieben werden knnen. Empfangene Bytes werden in
+///							der Empfangs-ISR fortlaufend aus dem Hardware-FIFO in einen Ringpuffer kopiert
+///							und knnen mit "UartRead()" in beliebiger Lnge gelesen werden. Zu sendende
+///							Bytes werden mit "UartWrite()" in einen zweiten Ringpuffer geschrieben, aus dem
+///							die Sende-ISR den Hardware-FIFO nachfllt. Da der Empfang dauerhaft eingeschaltet
+///							ist, gehen zwischen zwei Datenpaketen keine Bytes verloren. Bei einem vollen
+///							Empfangs-Ringpuffer werden neue Bytes verworfen und gezhlt ("rxOverflow").
+///							Alternativ knnen Puffer des Aufrufers mit "UartQueueTx()" ohne Kopie gesendet
+///							werden. Die Reihenfolge der Bytes entspricht immer der Reihenfolge der Aufrufe.
 ///
 ///							nderung in Version 2.0: Verwendung der Hardware-FIFOs
+///							nderung in Version 3.0: Ringpuffer fr fortlaufendes Senden und Empfangen
+///							nderung in Version 3.1: Kein aktives Warten auf das Ende der bertragung in der
+///																			 Sende-ISR
+///							nderung in Version 3.2: Berechnung der Baudrate aus dem eingestellten Low-Speed
+///																			 CLK, optional LSPCLK = SYSCLK fr hohe Baudraten
+///							nderung in Version 4.0: Instanzen fr die Module SCI-A bis SCI-D
+///							nderung in Version 4.1: Direktes Schreiben in den Sende-Ringpuffer ("UartCommitTx()")
+///																			 und byteweises Lesen ("UartGetByte()") fr Protokolle
+///							nderung in Version 4.2: Senden ohne Kopie aus Puffern des Aufrufers ber
+///																			 Sende-Deskriptoren ("UartQueueTx()")
+///							nderung in Version 4.3: "UartStartTx()", "UartAvailable()" und
+///																			 "UartCheckTxEmpty()" stellen den Zustand der
+///																			 CPU-Interrupts wieder her (Aufruf aus einer ISR
+///																			 bzw. Callback-Funktion mglich)
+///							nderung in Version 4.4: "UartWrite()" und "UartQueueTxGather()" reservieren und
+///																			 belegen die Pltze mit gesperrten CPU-Interrupts,
+///																			 damit eine Callback-Funktion der Sende-ISR
+///																			 dazwischen senden kann
+///							nderung in Version 4.5: "UartInit()" gibt "false" zurck, wenn die Baudrate um
+///																			 mehr als UART_BAUD_ERROR_MAX abweicht
 ///
-/// @version    V2.0
+/// @version    V4.5
 ///
-/// @date       24.03.2023
+/// @date       19.10.2026
 ///
 /// @author     Daniel Urbaneck
 //=================================================================================================
@@ -35,35 +57,50 @@
 //-------------------------------------------------------------------------------------------------
 // Defines
 //-------------------------------------------------------------------------------------------------
-// Gre der Software-Puffer
-#define UART_SIZE_SOFTWARE_BUFFER_RX		        50
-#define UART_SIZE_SOFTWARE_BUFFER_TX		        50
+// Gre der Ringpuffer (muss eine Zweierpotenz sein)
+#define UART_SIZE_RING_BUFFER_RX								256
+#define UART_SIZE_RING_BUFFER_TX								256
+// Anzahl der Sende-Deskriptoren pro Instanz (muss eine Zweierpotenz sein)
+#define UART_SIZE_DESCRIPTOR_QUEUE							8
 // Gre der Hardware-FIFOs
 #define UART_SIZE_HARDWARE_FIFO									16
-// Zustnde der UART-Kommunikation (uartRxStatusFlag und uartTxStatusFlag)
+// Interrupt-Niveaus der Hardware-FIFOs: Der Empfangs-Interrupt wird ausgelst, sobald
+// mindestens UART_LEVEL_FIFO_RX Bytes im FIFO sind, der Sende-Interrupt, sobald hchstens
+// UART_LEVEL_FIFO_TX Bytes im FIFO sind. Der Abstand zur FIFO-Gre bzw. zu 0 gibt die
+// Zeit vor, in der die ISR ausgefhrt werden muss (bei 460800 Baud ca. 21,7 us pro Byte)
+#define UART_LEVEL_FIFO_RX											8
+#define UART_LEVEL_FIFO_TX											4
+// Zustnde der Sende-Kommunikation ("statusTx")
 #define UART_STATUS_IDLE												0
 #define UART_STATUS_IN_PROGRESS									1
-#define UART_STATUS_RX_TIMEOUT									2
 #define UART_STATUS_FINISHED										3
-// Werte fr den Timeout-Zhler beim Empfangen von Daten. Wird innerhalb des
-// gewhlten Zeitfensters (bergeben beim Aufruf der Funktion "UartReceive()")
-// kein vollstndiges Datenpaket empfangen, so wird der Empfangsvorgang abgerochen
-#define UART_NO_TIMEOUT													-1
-#define UART_10_MS_TIMEOUT											2
-#define UART_20_MS_TIMEOUT											4
-#define UART_50_MS_TIMEOUT											10
-#define UART_100_MS_TIMEOUT											20
-#define UART_200_MS_TIMEOUT											40
-#define UART_500_MS_TIMEOUT											100
-#define UART_1_S_TIMEOUT												200
-#define UART_2_S_TIMEOUT												400
-#define UART_5_S_TIMEOUT												1000
-#define UART_10_S_TIMEOUT												2000
-#define UART_20_S_TIMEOUT												4000
-#define UART_1_M_TIMEOUT												12000
-#define UART_2_M_TIMEOUT												24000
-#define UART_5_M_TIMEOUT												60000
-// Baud-Raten
+// Nummer des SCI-Moduls einer Instanz
+#define UART_SCI_A															0
+#define UART_SCI_B															1
+#define UART_SCI_C															2
+#define UART_SCI_D															3
+// Anzahl der GPIOs
+#define UART_NUMBER_OF_GPIOS										169
+// Abstand der GPIO-Steuerregister zweier Ports (A, B, C, ...) und Position der Register
+// innerhalb eines Ports in 32-Bit-Worten (siehe Registerbersicht GPIO_CTRL_REGS,
+// Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+#define UART_GPIO_PORT_STEP											0x20
+#define UART_GPIO_QSEL1													0x01
+#define UART_GPIO_MUX1													0x03
+#define UART_GPIO_PUD														0x06
+#define UART_GPIO_GMUX1													0x10
+#define UART_GPIO_LOCK													0x1E
+// Systemtakt in Hz (siehe "DeviceInit()" und DEVICE_CPU_RATE)
+#define UART_SYSCLK															200000000UL
+// 1: Low-Speed CLK in "UartInitA()" auf SYSCLK setzen (max. LSPCLK / 16 = 12,5 MBaud statt
+// 3,125 MBaud bei LSPCLK = 50 MHz, geringerer Rundungsfehler). Achtung: Gilt auch fr alle
+// anderen Module am Low-Speed CLK (z.B. SPI, McBSP), deren Teiler ggf. angepasst werden mssen
+#define UART_LSPCLK_EQUALS_SYSCLK								0
+// Max. Abweichung der Baudrate in % (bei 8N1), "UartInit()" lehnt grere Abweichungen ab
+#define UART_BAUD_ERROR_MAX											2.0f
+// Baud-Raten (die tatschliche Baudrate wird in "uart->baudActual" gespeichert, die Abweichung
+// in "uart->baudError"). Bei LSPCLK = 50 MHz weichen 460800, 921600 und 1000000 Baud um mehr
+// als UART_BAUD_ERROR_MAX ab, diese Baudraten bentigen UART_LSPCLK_EQUALS_SYSCLK
 #define UART_BAUD_2400													2400
 #define UART_BAUD_4800													4800
 #define UART_BAUD_9600													9600
@@ -72,6 +109,8 @@
 #define UART_BAUD_115200												115200
 #define UART_BAUD_230400												230400
 #define UART_BAUD_460800												460800
+#define UART_BAUD_921600												921600
+#define UART_BAUD_1000000												1000000
 // Wortlnge
 #define UART_DATA_1_BIT													0
 #define UART_DATA_2_BIT													1
@@ -95,57 +134,178 @@
 //-------------------------------------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------------------------------------
+// Types
+//-------------------------------------------------------------------------------------------------
+// Pin-Belegung eines SCI-Moduls. Die Mux-Nummer ist die Zahl in der obersten Zeile der
+// GPIO-Mux-Tabelle (GPxGMUX (MSB, 2 Bit) + GPxMUX (LSB, 2 Bit) als Dezimalzahl, siehe
+// S. 1645 Reference Manual TMS320F2838x, SPRUII0D, Rev. D, July 2022)
+typedef struct
+{
+		uint16_t rxGpio;
+		uint16_t rxMux;
+		uint16_t txGpio;
+		uint16_t txMux;
+} UartPins;
+
+// Funktion, die aufgerufen wird, sobald der Puffer eines Sende-Deskriptors vollstndig in
+// den Sende-FIFO kopiert wurde und wieder verwendet werden darf. Der Aufruf erfolgt mit
+// gesperrten Interrupts aus der Sende-ISR oder aus "UartStartTx()", die Funktion darf mit
+// "UartWrite()" bzw. "UartQueueTx()" weitere Bytes senden
+typedef void (*UartTxCallback)(void *context);
+
+// Abschnitt einer Nachricht fr "UartQueueTxGather()"
+typedef struct
+{
+		const uint16_t *data;
+		uint16_t length;
+} UartTxSegment;
+
+// Sende-Deskriptor: Verweis auf einen Puffer des Aufrufers, der ohne Kopie gesendet wird
+typedef struct
+{
+		// Puffer und Anzahl der Bytes
+		const uint16_t *data;
+		uint16_t length;
+		// Schreibindex des Sende-Ringpuffers beim Einreihen. Alle davor in den Ringpuffer
+		// geschriebenen Bytes werden vor dem Puffer gesendet, alle danach geschriebenen danach
+		uint16_t ringPosition;
+		// Funktion und Parameter, die nach dem Kopieren des Puffers aufgerufen werden (oder 0)
+		UartTxCallback callback;
+		void *context;
+} UartTxDescriptor;
+
+// Instanz eines SCI-Moduls. Die Elemente "regs" und "sci" werden bei der Definition der
+// Instanzen "uartA" bis "uartD" festgelegt, alle weiteren Elemente in "UartInit()"
+typedef struct
+{
+		// Register des SCI-Moduls (z.B. &SciaRegs)
+		volatile struct SCI_REGS *regs;
+		// Nummer des SCI-Moduls (UART_SCI_A ... UART_SCI_D)
+		uint16_t sci;
+		// Ringpuffer
+		uint16_t ringRx[UART_SIZE_RING_BUFFER_RX];
+		uint16_t ringTx[UART_SIZE_RING_BUFFER_TX];
+		// Schreib- (Head) und Leseindex (Tail) der Ringpuffer. Die Indizes laufen frei ber
+		// den gesamten Wertebereich von uint16_t, die Position im Puffer ergibt sich durch
+		// Maskierung mit (Gre - 1). Die Anzahl der Bytes im Puffer ist (Head - Tail).
+		// Head des Empfangs- und Tail des Sendepuffers werden nur in der ISR verndert,
+		// die jeweils anderen Indizes nur im Hauptprogramm
+		volatile uint16_t headRx;
+		volatile uint16_t tailRx;
+		volatile uint16_t headTx;
+		volatile uint16_t tailTx;
+		// Warteschlange der Sende-Deskriptoren (Indizes wie bei den Ringpuffern). Der
+		// Schreibindex wird nur im Hauptprogramm, der Leseindex nur in der ISR verndert
+		UartTxDescriptor descriptorTx[UART_SIZE_DESCRIPTOR_QUEUE];
+		volatile uint16_t headDescriptorTx;
+		volatile uint16_t tailDescriptorTx;
+		// Anzahl der bereits gesendeten Bytes des aktuellen Deskriptors
+		uint16_t offsetDescriptorTx;
+		// Aktueller Zustand der Sende-Kommunikation
+		uint16_t statusTx;
+		// Anzahl der verworfenen Bytes (Empfangs-Ringpuffer oder Hardware-FIFO voll)
+		uint32_t rxOverflow;
+		// Anzahl der Empfangsfehler (Break, Framing, Paritt, Overrun)
+		uint32_t rxError;
+		// Tatschlich eingestellte Baudrate und Abweichung von der gewnschten Baudrate in %
+		uint32_t baudActual;
+		float baudError;
+} UartInstance;
+
+
 //-------------------------------------------------------------------------------------------------
 // Global variables
 //-------------------------------------------------------------------------------------------------
-// Software-Puffer fr die UART-Kommunikation (SCI-A)
-extern uint16_t uartBufferRxA[UART_SIZE_SOFTWARE_BUFFER_RX];
-extern uint16_t uartBufferTxA[UART_SIZE_SOFTWARE_BUFFER_TX];
-// Flag kann zum Aufruf der Funktion "UartGetStatusRxA()" genutzt werden
-// und sollte dazu regelmig (z.B. alle 5 ms) in einer ISR gesetzt werden.
-// Anschlieend kann z.B. im Hauptprogramm bei gesetztem Flag die Funktion
-// aufgerufen und das Flag gelscht werden
-extern bool uartFlagCheckRxA;
-// Timeout-Zhler fr den Empfang eines Datenpakets
-extern int32_t uartRxTimeoutA;
+// Instanzen der Module SCI-A bis SCI-D
+extern UartInstance uartA;
+extern UartInstance uartB;
+extern UartInstance uartC;
+extern UartInstance uartD;
+// Pin-Belegung von SCI-A auf dem ControlBoard (GPIO 28 RxD, GPIO 135 TxD)
+extern const UartPins uartPinsA;
 
 
 //-------------------------------------------------------------------------------------------------
 // Prototypes of global functions
 //-------------------------------------------------------------------------------------------------
-// Funktion initialisiert das UART-Modul (SCI-A)
+// Funktion initialisiert ein UART-Modul (SCI)
 // und die GPIOs fr die Kommunikation ber UART
-extern void UartInitA(uint32_t baud,
-										  uint32_t numberOfDataBits,
-										  uint32_t numberOfStopBits,
-										  uint32_t parity);
-// Funktion initialisiert den UART Empfangs-Softwarepuffer zu 0
-extern void UartInitBufferRxA(void);
-// Funktion initialisiert den UART Sende-Softwarepuffer zu 0
-extern void UartInitBufferTxA(void);
-// Funktion prft den Empfang eines Datenpakets ber UART und
-// gibt den aktuellen Status der Empfangs-Kommuniktaion zurck
-extern uint16_t UartGetStatusRxA(void);
+extern bool UartInit(UartInstance *uart,
+										 const UartPins *pins,
+										 uint32_t baud,
+										 uint32_t numberOfDataBits,
+										 uint32_t numberOfStopBits,
+										 uint32_t parity);
+// Funktion konfiguriert einen GPIO als Pin eines SCI-Moduls
+extern void UartConfigGpio(uint16_t gpio,
+													 uint16_t mux);
+// Funktion gibt den eingestellten Low-Speed Peripheral Clock in Hz zurck
+extern uint32_t UartGetLspclk(void);
+// Funktion berechnet den Teiler fr die gewnschte Baudrate
+extern uint16_t UartCalcDivider(uint32_t lspclk,
+																uint32_t baud);
+// Funktion gibt die Anzahl der empfangenen, noch nicht gelesenen Bytes zurck
+extern uint16_t UartAvailable(UartInstance *uart);
+// Funktion liest bis zu "maxNumberOfBytes" empfangene Bytes
+extern uint16_t UartRead(UartInstance *uart,
+												 uint16_t *data,
+												 uint16_t maxNumberOfBytes);
+// Funktion liest ein Byte aus dem Empfangs-Ringpuffer
+extern bool UartGetByte(UartInstance *uart,
+												uint16_t *data);
+// Funktion verwirft alle empfangenen, noch nicht gelesenen Bytes
+extern void UartFlushRx(UartInstance *uart);
+// Funktion gibt die Anzahl der freien Pltze im Sende-Ringpuffer zurck
+extern uint16_t UartGetFreeTx(UartInstance *uart);
+// Funktion schreibt bis zu "numberOfBytes" Bytes in den Sende-Ringpuffer
+extern uint16_t UartWrite(UartInstance *uart,
+													const uint16_t *data,
+													uint16_t numberOfBytes);
+// Funktion gibt direkt in den Sende-Ringpuffer geschriebene Bytes zum Senden frei
+extern void UartCommitTx(UartInstance *uart,
+												 uint16_t numberOfBytes);
+// Funktion reiht einen Puffer des Aufrufers zum Senden ohne Kopie ein
+extern bool UartQueueTx(UartInstance *uart,
+												const uint16_t *data,
+												uint16_t length,
+												UartTxCallback callback,
+												void *context);
+// Funktion reiht eine aus mehreren Puffern bestehende Nachricht zum Senden ohne Kopie ein
+extern bool UartQueueTxGather(UartInstance *uart,
+															const UartTxSegment *segments,
+															uint16_t numberOfSegments,
+															UartTxCallback callback,
+															void *context);
+// Funktion gibt die Anzahl der freien Sende-Deskriptoren zurck
+extern uint16_t UartGetFreeDescriptorsTx(UartInstance *uart);
+// Funktion startet die bertragung, falls sie noch nicht luft
+extern void UartStartTx(UartInstance *uart);
 // Funktion gibt den aktuellen Status der Tx-UART-Kommunikation (senden) zurck
-extern uint16_t UartGetStatusTxA(void);
-// Funktion setzt das Status-Flag fr den Empfangsvorgang auf "idle",
-// falls die vorherige Kommunikation abgeschlossen ist
-extern bool UartSetStatusIdleRxA(void);
+extern uint16_t UartGetStatusTx(UartInstance *uart);
+// Funktion prft ohne zu warten, ob die Sende-Kommunikation abgeschlossen ist
+extern bool UartCheckTxEmpty(UartInstance *uart);
 // Funktion setzt das Status-Flag fr den Sendevorgang auf "idle",
 // falls die vorherige Kommunikation abgeschlossen ist
-extern bool UartSetStatusIdleTxA(void);
-// Funktion initialisiert Steuervariablen und den Rx-Interrupt, um die mit
-// dem Parameter "numberOfBytesRxA" angegebene Anzahl an Bytes zu empfangen
-extern bool UartReceiveA(uint16_t numberOfBytesRx,
-												 int32_t timeOut);
-// Funktion sendet ber UART die mit dem Parameter "numberOfBytesTxA"
-// angegebene Anzahl an Bytes aus dem Software-Puffer "uartBufferTxA[]"
-extern bool UartTransmitA(uint16_t numberOfBytesTx);
-// Interrupt-Service-Routine fr die UART-Kommunikation (Aufruf, wenn ein Byte empfangen wurde)
+extern bool UartSetStatusIdleTx(UartInstance *uart);
+// Funktion kopiert alle Bytes aus dem Empfangs-FIFO in den Empfangs-Ringpuffer
+extern void UartCopyFifoRx(UartInstance *uart);
+// Funktion fllt den Sende-FIFO aus dem Sende-Ringpuffer
+extern void UartCopyFifoTx(UartInstance *uart);
+// Funktion bearbeitet den Empfangs-Interrupt einer Instanz
+extern void UartHandleRx(UartInstance *uart);
+// Funktion bearbeitet den Sende-Interrupt einer Instanz
+extern void UartHandleTx(UartInstance *uart);
+// Interrupt-Service-Routinen fr die UART-Kommunikation (Aufruf, wenn Bytes empfangen wurden)
 __interrupt void UartRxISRA(void);
-// Interrupt-Service-Routine fr die UART-Kommunikation (Aufruf, nachdem ein Byte gesendet wurde)
+__interrupt void UartRxISRB(void);
+__interrupt void UartRxISRC(void);
+__interrupt void UartRxISRD(void);
+// Interrupt-Service-Routinen fr die UART-Kommunikation (Aufruf, wenn der Sende-FIFO geleert wurde)
 __interrupt void UartTxISRA(void);
+__interrupt void UartTxISRB(void);
+__interrupt void UartTxISRC(void);
+__interrupt void UartTxISRD(void);
 
 
 #endif
-